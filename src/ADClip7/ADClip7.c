@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define ADCLIP7_URI "https://hannesbraun.net/ns/lv2/airwindows/adclip7"
 
 typedef enum {
@@ -234,13 +236,13 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			// done with interpolated mostly negative feedback of the overshoot
 		}
 
-		bridgerectifier = sin(fabs(highsL) * hardness);
+		bridgerectifier = fast_sin(fabs(highsL) * hardness);
 		// this will wrap around and is scaled back by softness
 		// wrap around is the same principle as Fracture: no top limit to sin()
 		if (highsL > 0) highsL = bridgerectifier;
 		else highsL = -bridgerectifier;
 
-		bridgerectifier = sin(fabs(highsR) * hardness);
+		bridgerectifier = fast_sin(fabs(highsR) * hardness);
 		// this will wrap around and is scaled back by softness
 		// wrap around is the same principle as Fracture: no top limit to sin()
 		if (highsR > 0) highsR = bridgerectifier;
@@ -400,13 +402,13 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			// now we have the lows content to use
 		}
 
-		bridgerectifier = sin(fabs(adclip7->lowsL) * softness);
+		bridgerectifier = fast_sin(fabs(adclip7->lowsL) * softness);
 		// this will wrap around and is scaled back by hardness: hard = less bass push, more treble
 		// wrap around is the same principle as Fracture: no top limit to sin()
 		if (adclip7->lowsL > 0) adclip7->lowsL = bridgerectifier;
 		else adclip7->lowsL = -bridgerectifier;
 
-		bridgerectifier = sin(fabs(adclip7->lowsR) * softness);
+		bridgerectifier = fast_sin(fabs(adclip7->lowsR) * softness);
 		// this will wrap around and is scaled back by hardness: hard = less bass push, more treble
 		// wrap around is the same principle as Fracture: no top limit to sin()
 		if (adclip7->lowsR > 0) adclip7->lowsR = bridgerectifier;
@@ -414,25 +416,25 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		adclip7->iirLowsAL = (adclip7->iirLowsAL * invcalibsubs) + (adclip7->lowsL * calibsubs);
 		adclip7->lowsL = adclip7->iirLowsAL;
-		bridgerectifier = sin(fabs(adclip7->lowsL));
+		bridgerectifier = fast_sin(fabs(adclip7->lowsL));
 		if (adclip7->lowsL > 0) adclip7->lowsL = bridgerectifier;
 		else adclip7->lowsL = -bridgerectifier;
 
 		adclip7->iirLowsAR = (adclip7->iirLowsAR * invcalibsubs) + (adclip7->lowsR * calibsubs);
 		adclip7->lowsR = adclip7->iirLowsAR;
-		bridgerectifier = sin(fabs(adclip7->lowsR));
+		bridgerectifier = fast_sin(fabs(adclip7->lowsR));
 		if (adclip7->lowsR > 0) adclip7->lowsR = bridgerectifier;
 		else adclip7->lowsR = -bridgerectifier;
 
 		adclip7->iirLowsBL = (adclip7->iirLowsBL * invcalibsubs) + (adclip7->lowsL * calibsubs);
 		adclip7->lowsL = adclip7->iirLowsBL;
-		bridgerectifier = sin(fabs(adclip7->lowsL)) * 2.0;
+		bridgerectifier = fast_sin(fabs(adclip7->lowsL)) * 2.0;
 		if (adclip7->lowsL > 0) adclip7->lowsL = bridgerectifier;
 		else adclip7->lowsL = -bridgerectifier;
 
 		adclip7->iirLowsBR = (adclip7->iirLowsBR * invcalibsubs) + (adclip7->lowsR * calibsubs);
 		adclip7->lowsR = adclip7->iirLowsBR;
-		bridgerectifier = sin(fabs(adclip7->lowsR)) * 2.0;
+		bridgerectifier = fast_sin(fabs(adclip7->lowsR)) * 2.0;
 		if (adclip7->lowsR > 0) adclip7->lowsR = bridgerectifier;
 		else adclip7->lowsR = -bridgerectifier;
 
@@ -522,12 +524,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		adclip7->fpdL ^= adclip7->fpdL << 13;
 		adclip7->fpdL ^= adclip7->fpdL >> 17;
 		adclip7->fpdL ^= adclip7->fpdL << 5;
-		inputSampleL += (((double) adclip7->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) adclip7->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		adclip7->fpdR ^= adclip7->fpdR << 13;
 		adclip7->fpdR ^= adclip7->fpdR >> 17;
 		adclip7->fpdR ^= adclip7->fpdR << 5;
-		inputSampleR += (((double) adclip7->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) adclip7->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define ADCLIP8_URI "https://hannesbraun.net/ns/lv2/airwindows/adclip8"
 
 typedef enum {
@@ -251,12 +253,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		adclip8->fpdL ^= adclip8->fpdL << 13;
 		adclip8->fpdL ^= adclip8->fpdL >> 17;
 		adclip8->fpdL ^= adclip8->fpdL << 5;
-		inputSampleL += (((double) adclip8->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) adclip8->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		adclip8->fpdR ^= adclip8->fpdR << 13;
 		adclip8->fpdR ^= adclip8->fpdR >> 17;
 		adclip8->fpdR ^= adclip8->fpdR << 5;
-		inputSampleR += (((double) adclip8->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) adclip8->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define ADT_URI "https://hannesbraun.net/ns/lv2/airwindows/adt"
 
 typedef enum {
@@ -37,6 +40,8 @@ typedef struct {
 
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	Silence silence;
 } ADT;
 
 static LV2_Handle instantiate(
@@ -102,6 +107,8 @@ static void activate(LV2_Handle instance)
 	while (adt->fpdL < 16386) adt->fpdL = rand() * UINT32_MAX;
 	adt->fpdR = 1.0;
 	while (adt->fpdR < 16386) adt->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&adt->silence, 10000); // delay memory per channel
 }
 
 static void run(LV2_Handle instance, uint32_t sampleFrames)
@@ -113,6 +120,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = adt->output[0];
 	float* out2 = adt->output[1];
 
+	if (silence_skip(&adt->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	double gain = (*adt->headroom * 0.5) * 1.272;
 	double targetA = pow(*adt->aDelay, 4) * 4790.0;
 	double fractionA;
@@ -154,8 +163,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR > 1.2533141373155) inputSampleR = 1.2533141373155;
 		if (inputSampleR < -1.2533141373155) inputSampleR = -1.2533141373155;
 
-		inputSampleL = sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL));
-		inputSampleR = sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR));
+		inputSampleL = fast_sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL));
+		inputSampleR = fast_sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR));
 		// Spiral: lean out the sound a little when decoded by ConsoleBuss
 
 		if (adt->gcount < 1 || adt->gcount > 4800) {
@@ -214,8 +223,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
 
-		inputSampleL = asin(inputSampleL);
-		inputSampleR = asin(inputSampleR);
+		inputSampleL = fast_asin(inputSampleL);
+		inputSampleR = fast_asin(inputSampleR);
 		// amplitude aspect
 
 		inputSampleL *= gain;
@@ -232,12 +241,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		adt->fpdL ^= adt->fpdL << 13;
 		adt->fpdL ^= adt->fpdL >> 17;
 		adt->fpdL ^= adt->fpdL << 5;
-		inputSampleL += (((double) adt->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) adt->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		adt->fpdR ^= adt->fpdR << 13;
 		adt->fpdR ^= adt->fpdR >> 17;
 		adt->fpdR ^= adt->fpdR << 5;
-		inputSampleR += (((double) adt->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) adt->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -248,6 +257,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&adt->silence, adt->output[0], adt->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define ACCELERATION_URI "https://hannesbraun.net/ns/lv2/airwindows/acceleration"
 
 typedef enum {
@@ -211,12 +213,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		acceleration->fpdL ^= acceleration->fpdL << 13;
 		acceleration->fpdL ^= acceleration->fpdL >> 17;
 		acceleration->fpdL ^= acceleration->fpdL << 5;
-		inputSampleL += (((double) acceleration->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) acceleration->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		acceleration->fpdR ^= acceleration->fpdR << 13;
 		acceleration->fpdR ^= acceleration->fpdR >> 17;
 		acceleration->fpdR ^= acceleration->fpdR << 5;
-		inputSampleR += (((double) acceleration->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) acceleration->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
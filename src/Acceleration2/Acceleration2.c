@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define ACCELERATION2_URI "https://hannesbraun.net/ns/lv2/airwindows/acceleration2"
@@ -202,12 +204,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		acceleration2->fpdL ^= acceleration2->fpdL << 13;
 		acceleration2->fpdL ^= acceleration2->fpdL >> 17;
 		acceleration2->fpdL ^= acceleration2->fpdL << 5;
-		inputSampleL += (((double) acceleration2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) acceleration2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		acceleration2->fpdR ^= acceleration2->fpdR << 13;
 		acceleration2->fpdR ^= acceleration2->fpdR >> 17;
 		acceleration2->fpdR ^= acceleration2->fpdR << 5;
-		inputSampleR += (((double) acceleration2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) acceleration2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
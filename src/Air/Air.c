@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define AIR_URI "https://hannesbraun.net/ns/lv2/airwindows/air"
 
 typedef enum {
@@ -385,12 +387,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		air->fpdL ^= air->fpdL << 13;
 		air->fpdL ^= air->fpdL >> 17;
 		air->fpdL ^= air->fpdL << 5;
-		inputSampleL += (((double) air->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) air->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		air->fpdR ^= air->fpdR << 13;
 		air->fpdR ^= air->fpdR >> 17;
 		air->fpdR ^= air->fpdR << 5;
-		inputSampleR += (((double) air->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) air->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define AIR2_URI "https://hannesbraun.net/ns/lv2/airwindows/air2"
 
 typedef enum {
@@ -389,7 +391,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			correctionL -= 1.0;
 			double bridgerectifier = fabs(correctionL);
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (correctionL > 0) correctionL = bridgerectifier;
 			else correctionL = -bridgerectifier;
 			correctionL += air2->postsine;
@@ -399,7 +401,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			correctionR -= 1.0;
 			bridgerectifier = fabs(correctionR);
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (correctionR > 0) correctionR = bridgerectifier;
 			else correctionR = -bridgerectifier;
 			correctionR += air2->postsine;
@@ -490,12 +492,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		air2->fpdL ^= air2->fpdL << 13;
 		air2->fpdL ^= air2->fpdL >> 17;
 		air2->fpdL ^= air2->fpdL << 5;
-		inputSampleL += (((double) air2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) air2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		air2->fpdR ^= air2->fpdR << 13;
 		air2->fpdR ^= air2->fpdR >> 17;
 		air2->fpdR ^= air2->fpdR << 5;
-		inputSampleR += (((double) air2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) air2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define AIR3_URI "https://hannesbraun.net/ns/lv2/airwindows/air3"
 
 typedef enum {
@@ -201,12 +203,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		air3->fpdL ^= air3->fpdL << 13;
 		air3->fpdL ^= air3->fpdL >> 17;
 		air3->fpdL ^= air3->fpdL << 5;
-		inputSampleL += (((double) air3->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) air3->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		air3->fpdR ^= air3->fpdR << 13;
 		air3->fpdR ^= air3->fpdR >> 17;
 		air3->fpdR ^= air3->fpdR << 5;
-		inputSampleR += (((double) air3->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) air3->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
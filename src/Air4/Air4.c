@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define AIR4_URI "https://hannesbraun.net/ns/lv2/airwindows/air4"
 
 typedef enum {
@@ -236,12 +238,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		air4->fpdL ^= air4->fpdL << 13;
 		air4->fpdL ^= air4->fpdL >> 17;
 		air4->fpdL ^= air4->fpdL << 5;
-		inputSampleL += (((double) air4->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) air4->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		air4->fpdR ^= air4->fpdR << 13;
 		air4->fpdR ^= air4->fpdR >> 17;
 		air4->fpdR ^= air4->fpdR << 5;
-		inputSampleR += (((double) air4->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) air4->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define BASSAMP_URI "https://hannesbraun.net/ns/lv2/airwindows/bassamp"
 
 typedef enum {
@@ -869,12 +871,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bassAmp->fpdL ^= bassAmp->fpdL << 13;
 		bassAmp->fpdL ^= bassAmp->fpdL >> 17;
 		bassAmp->fpdL ^= bassAmp->fpdL << 5;
-		LinputSample += (((double) bassAmp->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		LinputSample += (((double) bassAmp->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) RinputSample, &expon);
 		bassAmp->fpdR ^= bassAmp->fpdR << 13;
 		bassAmp->fpdR ^= bassAmp->fpdR >> 17;
 		bassAmp->fpdR ^= bassAmp->fpdR << 5;
-		RinputSample += (((double) bassAmp->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		RinputSample += (((double) bassAmp->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) LinputSample;
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define BASS_DRIVE_URI "https://hannesbraun.net/ns/lv2/airwindows/bassdrive"
 
 typedef enum {
@@ -202,7 +204,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bassDrive->presenceOutAL[6] = (bassDrive->presenceInAL[0] + bassDrive->presenceInAL[6]) + 1.9152966321 * (bassDrive->presenceInAL[1] + bassDrive->presenceInAL[5]) - (bassDrive->presenceInAL[2] + bassDrive->presenceInAL[4]) - 3.8305932641 * bassDrive->presenceInAL[3] + (-0.2828214615 * bassDrive->presenceOutAL[2]) + (0.2613069963 * bassDrive->presenceOutAL[3]) + (-0.8628193852 * bassDrive->presenceOutAL[4]) + (0.5387164389 * bassDrive->presenceOutAL[5]);
 			bridgerectifier = fabs(bassDrive->presenceOutAL[6]);
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (bassDrive->presenceOutAL[6] > 0.0) {
 				sumL += bridgerectifier;
 			} else {
@@ -223,7 +225,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bassDrive->presenceOutAR[6] = (bassDrive->presenceInAR[0] + bassDrive->presenceInAR[6]) + 1.9152966321 * (bassDrive->presenceInAR[1] + bassDrive->presenceInAR[5]) - (bassDrive->presenceInAR[2] + bassDrive->presenceInAR[4]) - 3.8305932641 * bassDrive->presenceInAR[3] + (-0.2828214615 * bassDrive->presenceOutAR[2]) + (0.2613069963 * bassDrive->presenceOutAR[3]) + (-0.8628193852 * bassDrive->presenceOutAR[4]) + (0.5387164389 * bassDrive->presenceOutAR[5]);
 			bridgerectifier = fabs(bassDrive->presenceOutAR[6]);
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (bassDrive->presenceOutAR[6] > 0.0) {
 				sumR += bridgerectifier;
 			} else {
@@ -241,7 +243,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleL > 0.0) {
 				bassDrive->highInAL[6] = bridgerectifier;
 			} else {
@@ -255,7 +257,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bassDrive->highOutAL[6] = (bassDrive->highInAL[0] + bassDrive->highInAL[6]) - 0.5141967433 * (bassDrive->highInAL[1] + bassDrive->highInAL[5]) - (bassDrive->highInAL[2] + bassDrive->highInAL[4]) + 1.0283934866 * bassDrive->highInAL[3] + (-0.2828214615 * bassDrive->highOutAL[2]) + (1.0195930909 * bassDrive->highOutAL[3]) + (-1.9633013869 * bassDrive->highOutAL[4]) + (2.1020162751 * bassDrive->highOutAL[5]);
 			bridgerectifier = fabs(bassDrive->highOutAL[6]);
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (bassDrive->highOutAL[6] > 0.0) {
 				sumL += bridgerectifier;
 			} else {
@@ -272,7 +274,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleR > 0.0) {
 				bassDrive->highInAR[6] = bridgerectifier;
 			} else {
@@ -286,7 +288,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bassDrive->highOutAR[6] = (bassDrive->highInAR[0] + bassDrive->highInAR[6]) - 0.5141967433 * (bassDrive->highInAR[1] + bassDrive->highInAR[5]) - (bassDrive->highInAR[2] + bassDrive->highInAR[4]) + 1.0283934866 * bassDrive->highInAR[3] + (-0.2828214615 * bassDrive->highOutAR[2]) + (1.0195930909 * bassDrive->highOutAR[3]) + (-1.9633013869 * bassDrive->highOutAR[4]) + (2.1020162751 * bassDrive->highOutAR[5]);
 			bridgerectifier = fabs(bassDrive->highOutAR[6]);
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (bassDrive->highOutAR[6] > 0.0) {
 				sumR += bridgerectifier;
 			} else {
@@ -304,7 +306,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleL > 0.0) {
 				bassDrive->midInAL[6] = bridgerectifier;
 			} else {
@@ -328,7 +330,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleR > 0.0) {
 				bassDrive->midInAR[6] = bridgerectifier;
 			} else {
@@ -353,7 +355,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleL > 0.0) {
 				bassDrive->lowInAL[6] = bridgerectifier;
 			} else {
@@ -377,7 +379,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleR > 0.0) {
 				bassDrive->lowInAR[6] = bridgerectifier;
 			} else {
@@ -406,7 +408,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bassDrive->presenceOutBL[6] = (bassDrive->presenceInBL[0] + bassDrive->presenceInBL[6]) + 1.9152966321 * (bassDrive->presenceInBL[1] + bassDrive->presenceInBL[5]) - (bassDrive->presenceInBL[2] + bassDrive->presenceInBL[4]) - 3.8305932641 * bassDrive->presenceInBL[3] + (-0.2828214615 * bassDrive->presenceOutBL[2]) + (0.2613069963 * bassDrive->presenceOutBL[3]) + (-0.8628193852 * bassDrive->presenceOutBL[4]) + (0.5387164389 * bassDrive->presenceOutBL[5]);
 			bridgerectifier = fabs(bassDrive->presenceOutBL[6]);
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (bassDrive->presenceOutBL[6] > 0.0) {
 				sumL += bridgerectifier;
 			} else {
@@ -427,7 +429,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bassDrive->presenceOutBR[6] = (bassDrive->presenceInBR[0] + bassDrive->presenceInBR[6]) + 1.9152966321 * (bassDrive->presenceInBR[1] + bassDrive->presenceInBR[5]) - (bassDrive->presenceInBR[2] + bassDrive->presenceInBR[4]) - 3.8305932641 * bassDrive->presenceInBR[3] + (-0.2828214615 * bassDrive->presenceOutBR[2]) + (0.2613069963 * bassDrive->presenceOutBR[3]) + (-0.8628193852 * bassDrive->presenceOutBR[4]) + (0.5387164389 * bassDrive->presenceOutBR[5]);
 			bridgerectifier = fabs(bassDrive->presenceOutBR[6]);
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (bassDrive->presenceOutBR[6] > 0.0) {
 				sumR += bridgerectifier;
 			} else {
@@ -445,7 +447,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleL > 0.0) {
 				bassDrive->highInBL[6] = bridgerectifier;
 			} else {
@@ -459,7 +461,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bassDrive->highOutBL[6] = (bassDrive->highInBL[0] + bassDrive->highInBL[6]) - 0.5141967433 * (bassDrive->highInBL[1] + bassDrive->highInBL[5]) - (bassDrive->highInBL[2] + bassDrive->highInBL[4]) + 1.0283934866 * bassDrive->highInBL[3] + (-0.2828214615 * bassDrive->highOutBL[2]) + (1.0195930909 * bassDrive->highOutBL[3]) + (-1.9633013869 * bassDrive->highOutBL[4]) + (2.1020162751 * bassDrive->highOutBL[5]);
 			bridgerectifier = fabs(bassDrive->highOutBL[6]);
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (bassDrive->highOutBL[6] > 0.0) {
 				sumL += bridgerectifier;
 			} else {
@@ -476,7 +478,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleR > 0.0) {
 				bassDrive->highInBR[6] = bridgerectifier;
 			} else {
@@ -490,7 +492,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bassDrive->highOutBR[6] = (bassDrive->highInBR[0] + bassDrive->highInBR[6]) - 0.5141967433 * (bassDrive->highInBR[1] + bassDrive->highInBR[5]) - (bassDrive->highInBR[2] + bassDrive->highInBR[4]) + 1.0283934866 * bassDrive->highInBR[3] + (-0.2828214615 * bassDrive->highOutBR[2]) + (1.0195930909 * bassDrive->highOutBR[3]) + (-1.9633013869 * bassDrive->highOutBR[4]) + (2.1020162751 * bassDrive->highOutBR[5]);
 			bridgerectifier = fabs(bassDrive->highOutBR[6]);
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (bassDrive->highOutBR[6] > 0.0) {
 				sumR += bridgerectifier;
 			} else {
@@ -508,7 +510,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleL > 0.0) {
 				bassDrive->midInBL[6] = bridgerectifier;
 			} else {
@@ -532,7 +534,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleR > 0.0) {
 				bassDrive->midInBR[6] = bridgerectifier;
 			} else {
@@ -557,7 +559,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleL > 0.0) {
 				bassDrive->lowInBL[6] = bridgerectifier;
 			} else {
@@ -581,7 +583,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > 1.57079633) {
 				bridgerectifier = 1.57079633;
 			}
-			bridgerectifier = sin(bridgerectifier);
+			bridgerectifier = fast_sin(bridgerectifier);
 			if (inputSampleR > 0.0) {
 				bassDrive->lowInBR[6] = bridgerectifier;
 			} else {
@@ -601,14 +603,14 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleL > 1.57079633) {
 			inputSampleL = 1.57079633;
 		}
-		inputSampleL = sin(inputSampleL);
+		inputSampleL = fast_sin(inputSampleL);
 		if (sumL < 0) inputSampleL = -inputSampleL;
 		// output L
 		inputSampleR = fabs(sumR) * drive;
 		if (inputSampleR > 1.57079633) {
 			inputSampleR = 1.57079633;
 		}
-		inputSampleR = sin(inputSampleR);
+		inputSampleR = fast_sin(inputSampleR);
 		if (sumR < 0) inputSampleR = -inputSampleR;
 		// output R
 
@@ -620,12 +622,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bassDrive->fpdL ^= bassDrive->fpdL << 13;
 		bassDrive->fpdL ^= bassDrive->fpdL >> 17;
 		bassDrive->fpdL ^= bassDrive->fpdL << 5;
-		inputSampleL += (((double) bassDrive->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) bassDrive->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		bassDrive->fpdR ^= bassDrive->fpdR << 13;
 		bassDrive->fpdR ^= bassDrive->fpdR >> 17;
 		bassDrive->fpdR ^= bassDrive->fpdR << 5;
-		inputSampleR += (((double) bassDrive->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) bassDrive->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
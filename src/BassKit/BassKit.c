@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define BASSKIT_URI "https://hannesbraun.net/ns/lv2/airwindows/basskit"
 
 typedef enum {
@@ -388,12 +390,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bassKit->fpdL ^= bassKit->fpdL << 13;
 		bassKit->fpdL ^= bassKit->fpdL >> 17;
 		bassKit->fpdL ^= bassKit->fpdL << 5;
-		inputSampleL += (((double) bassKit->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) bassKit->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		bassKit->fpdR ^= bassKit->fpdR << 13;
 		bassKit->fpdR ^= bassKit->fpdR >> 17;
 		bassKit->fpdR ^= bassKit->fpdR << 5;
-		inputSampleR += (((double) bassKit->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) bassKit->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
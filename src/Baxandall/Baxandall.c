@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define BAXANDALL_URI "https://hannesbraun.net/ns/lv2/airwindows/baxandall"
@@ -193,8 +195,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleR *= output;
 		} // gain trim in front of plugin, in case Console stage clips
 
-		inputSampleL = sin(inputSampleL);
-		inputSampleR = sin(inputSampleR);
+		inputSampleL = fast_sin(inputSampleL);
+		inputSampleR = fast_sin(inputSampleR);
 		// encode Console5: good cleanness
 
 		double trebleSampleL;
@@ -251,13 +253,13 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleL > 1.0) inputSampleL = 1.0;
 		if (inputSampleL < -1.0) inputSampleL = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
-		inputSampleL = asin(inputSampleL);
+		inputSampleL = fast_asin(inputSampleL);
 		// amplitude aspect
 
 		if (inputSampleR > 1.0) inputSampleR = 1.0;
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
-		inputSampleR = asin(inputSampleR);
+		inputSampleR = fast_asin(inputSampleR);
 		// amplitude aspect
 
 		// begin 32 bit stereo floating point dither
@@ -266,12 +268,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		baxandall->fpdL ^= baxandall->fpdL << 13;
 		baxandall->fpdL ^= baxandall->fpdL >> 17;
 		baxandall->fpdL ^= baxandall->fpdL << 5;
-		inputSampleL += (((double) baxandall->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) baxandall->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		baxandall->fpdR ^= baxandall->fpdR << 13;
 		baxandall->fpdR ^= baxandall->fpdR >> 17;
 		baxandall->fpdR ^= baxandall->fpdR << 5;
-		inputSampleR += (((double) baxandall->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) baxandall->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
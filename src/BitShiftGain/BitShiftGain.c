@@ -3,6 +3,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/dispatch.h"
+
 #define BITSHIFTGAIN_URI "https://hannesbraun.net/ns/lv2/airwindows/bitshiftgain"
 
 typedef enum {
@@ -54,7 +56,7 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 
 static void activate(LV2_Handle instance) {}
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+CPU_DISPATCH static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	BitShiftGain* bitshiftgain = (BitShiftGain*) instance;
 
@@ -168,8 +170,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	}
 
 	while (sampleFrames-- > 0) {
-		*out1 = *in1 * gain;
-		*out2 = *in2 * gain;
+		const float inputSampleL = *in1;
+		const float inputSampleR = *in2;
+		*out1 = inputSampleL * gain;
+		*out2 = inputSampleR * gain;
 
 		in1++;
 		in2++;
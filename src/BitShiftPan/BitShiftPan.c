@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/dispatch.h"
+
 #define BITSHIFTPAN_URI "https://hannesbraun.net/ns/lv2/airwindows/bitshiftpan"
 
 typedef enum {
@@ -60,7 +62,7 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 
 static void activate(LV2_Handle instance) {}
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+CPU_DISPATCH static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	BitShiftPan* bitShiftPan = (BitShiftPan*) instance;
 
@@ -212,8 +214,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	}
 
 	while (sampleFrames-- > 0) {
-		*out1 = *in1 * gainL; // in this plugin, all the work is done
-		*out2 = *in2 * gainR; // before the buffer is processed
+		const float inputSampleL = *in1;
+		const float inputSampleR = *in2;
+		*out1 = inputSampleL * gainL; // in this plugin, all the work is done
+		*out2 = inputSampleR * gainR; // before the buffer is processed
 
 		in1++;
 		in2++;
@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define BRIGHTAMBIENCE_URI "https://hannesbraun.net/ns/lv2/airwindows/brightambience"
 
 typedef enum {
@@ -28,6 +31,8 @@ typedef struct {
 	int gcount;
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	Silence silence;
 } BrightAmbience;
 
 static LV2_Handle instantiate(
@@ -81,6 +86,8 @@ static void activate(LV2_Handle instance)
 	while (brightAmbience->fpdL < 16386) brightAmbience->fpdL = rand() * UINT32_MAX;
 	brightAmbience->fpdR = 1.0;
 	while (brightAmbience->fpdR < 16386) brightAmbience->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&brightAmbience->silence, 25361); // delay memory per channel
 }
 
 static void run(LV2_Handle instance, uint32_t sampleFrames)
@@ -92,6 +99,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = brightAmbience->output[0];
 	float* out2 = brightAmbience->output[1];
 
+	if (silence_skip(&brightAmbience->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	double wet = *brightAmbience->dryWet;
 	int cpu = (int) (*brightAmbience->sustain * 32);
 	double decay = 1.0 + (pow(*brightAmbience->decay, 2) / 2.0);
@@ -1585,12 +1594,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		brightAmbience->fpdL ^= brightAmbience->fpdL << 13;
 		brightAmbience->fpdL ^= brightAmbience->fpdL >> 17;
 		brightAmbience->fpdL ^= brightAmbience->fpdL << 5;
-		inputSampleL += (((double) brightAmbience->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) brightAmbience->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		brightAmbience->fpdR ^= brightAmbience->fpdR << 13;
 		brightAmbience->fpdR ^= brightAmbience->fpdR >> 17;
 		brightAmbience->fpdR ^= brightAmbience->fpdR << 5;
-		inputSampleR += (((double) brightAmbience->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) brightAmbience->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -1601,6 +1610,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&brightAmbience->silence, brightAmbience->output[0], brightAmbience->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define BRIGHTAMBIENCE2_URI "https://hannesbraun.net/ns/lv2/airwindows/brightambience2"
 
 typedef enum {
@@ -34,6 +37,8 @@ typedef struct {
 	double feedbackA;
 	double feedbackB;
 	double feedbackC;
+
+	Silence silence;
 } BrightAmbience2;
 
 static LV2_Handle instantiate(
@@ -91,6 +96,8 @@ static void activate(LV2_Handle instance)
 	while (brightAmbience2->fpdL < 16386) brightAmbience2->fpdL = rand() * UINT32_MAX;
 	brightAmbience2->fpdR = 1.0;
 	while (brightAmbience2->fpdR < 16386) brightAmbience2->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&brightAmbience2->silence, 32768); // delay memory per channel
 }
 
 static const int primeL[] = {
@@ -108,6 +115,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = brightAmbience2->output[0];
 	float* out2 = brightAmbience2->output[1];
 
+	if (silence_skip(&brightAmbience2->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	int start = (int) (pow(*brightAmbience2->start, 2) * 480) + 1;
 	int length = (int) (pow(*brightAmbience2->length, 2) * 480) + 1;
 	if (start + length > 488) start = 488 - length;
@@ -127,8 +136,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (brightAmbience2->gcount < 0 || brightAmbience2->gcount > 32767) brightAmbience2->gcount = 32767;
 		int count = brightAmbience2->gcount;
 
-		brightAmbience2->pL[count] = inputSampleL + ((sin(brightAmbience2->feedbackA) / sqrt(length + 1)) * feedbackAmount);
-		brightAmbience2->pR[count] = inputSampleR + ((sin(brightAmbience2->feedbackB) / sqrt(length + 1)) * feedbackAmount);
+		brightAmbience2->pL[count] = inputSampleL + ((fast_sin(brightAmbience2->feedbackA) / sqrt(length + 1)) * feedbackAmount);
+		brightAmbience2->pR[count] = inputSampleR + ((fast_sin(brightAmbience2->feedbackB) / sqrt(length + 1)) * feedbackAmount);
 
 		for (int offset = start; offset < start + length; offset++) {
 			tempL += brightAmbience2->pL[count + primeL[offset] - ((count + primeL[offset] > 32767) ? 32768 : 0)];
@@ -155,12 +164,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		brightAmbience2->fpdL ^= brightAmbience2->fpdL << 13;
 		brightAmbience2->fpdL ^= brightAmbience2->fpdL >> 17;
 		brightAmbience2->fpdL ^= brightAmbience2->fpdL << 5;
-		inputSampleL += (((double) brightAmbience2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) brightAmbience2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		brightAmbience2->fpdR ^= brightAmbience2->fpdR << 13;
 		brightAmbience2->fpdR ^= brightAmbience2->fpdR >> 17;
 		brightAmbience2->fpdR ^= brightAmbience2->fpdR << 5;
-		inputSampleR += (((double) brightAmbience2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) brightAmbience2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -171,6 +180,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&brightAmbience2->silence, brightAmbience2->output[0], brightAmbience2->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
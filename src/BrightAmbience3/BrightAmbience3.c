@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define BRIGHTAMBIENCE3_URI "https://hannesbraun.net/ns/lv2/airwindows/brightambience3"
@@ -40,6 +43,8 @@ typedef struct {
 	int cycle;
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	Silence silence;
 } BrightAmbience3;
 
 static LV2_Handle instantiate(
@@ -108,6 +113,8 @@ static void activate(LV2_Handle instance)
 	while (brightAmbience3->fpdL < 16386) brightAmbience3->fpdL = rand() * UINT32_MAX;
 	brightAmbience3->fpdR = 1.0;
 	while (brightAmbience3->fpdR < 16386) brightAmbience3->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&brightAmbience3->silence, 32768 * 4); // delay memory per channel, undersampled
 }
 
 static const int primeL[] = {
@@ -125,6 +132,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = brightAmbience3->output[0];
 	float* out2 = brightAmbience3->output[1];
 
+	if (silence_skip(&brightAmbience3->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	double overallscale = 1.0;
 	overallscale /= 44100.0;
 	overallscale *= brightAmbience3->sampleRate;
@@ -181,12 +190,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			double tempSample = (inputSampleL * brightAmbience3->figureL[2]) + brightAmbience3->figureL[7];
 			brightAmbience3->figureL[7] = -(tempSample * brightAmbience3->figureL[5]) + brightAmbience3->figureL[8];
 			brightAmbience3->figureL[8] = (inputSampleL * brightAmbience3->figureL[4]) - (tempSample * brightAmbience3->figureL[6]);
-			brightAmbience3->feedbackA = sin(tempSample) * feedbackAmount;
+			brightAmbience3->feedbackA = fast_sin(tempSample) * feedbackAmount;
 
 			tempSample = (inputSampleR * brightAmbience3->figureR[2]) + brightAmbience3->figureR[7];
 			brightAmbience3->figureR[7] = -(tempSample * brightAmbience3->figureR[5]) + brightAmbience3->figureR[8];
 			brightAmbience3->figureR[8] = (inputSampleR * brightAmbience3->figureR[4]) - (tempSample * brightAmbience3->figureR[6]);
-			brightAmbience3->feedbackB = sin(tempSample) * feedbackAmount;
+			brightAmbience3->feedbackB = fast_sin(tempSample) * feedbackAmount;
 			brightAmbience3->gcount--;
 
 			if (cycleEnd == 4) {
@@ -270,12 +279,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		brightAmbience3->fpdL ^= brightAmbience3->fpdL << 13;
 		brightAmbience3->fpdL ^= brightAmbience3->fpdL >> 17;
 		brightAmbience3->fpdL ^= brightAmbience3->fpdL << 5;
-		inputSampleL += (((double) brightAmbience3->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) brightAmbience3->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		brightAmbience3->fpdR ^= brightAmbience3->fpdR << 13;
 		brightAmbience3->fpdR ^= brightAmbience3->fpdR >> 17;
 		brightAmbience3->fpdR ^= brightAmbience3->fpdR << 5;
-		inputSampleR += (((double) brightAmbience3->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) brightAmbience3->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -286,6 +295,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&brightAmbience3->silence, brightAmbience3->output[0], brightAmbience3->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define BUSSCOLORS4_URI "https://hannesbraun.net/ns/lv2/airwindows/busscolors4"
 
 typedef enum {
@@ -233,7 +235,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		dynamicconvL = 2.5 + bussColors4->slowdynL;
 
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleL > 0) inputSampleL = bridgerectifier;
 		else inputSampleL = -bridgerectifier;
 		// end pre saturation stage L
@@ -248,7 +250,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		dynamicconvR = 2.5 + bussColors4->slowdynR;
 
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleR > 0) inputSampleR = bridgerectifier;
 		else inputSampleR = -bridgerectifier;
 		// end pre saturation stage R
@@ -923,12 +925,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bussColors4->fpdL ^= bussColors4->fpdL << 13;
 		bussColors4->fpdL ^= bussColors4->fpdL >> 17;
 		bussColors4->fpdL ^= bussColors4->fpdL << 5;
-		inputSampleL += (((double) bussColors4->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) bussColors4->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		bussColors4->fpdR ^= bussColors4->fpdR << 13;
 		bussColors4->fpdR ^= bussColors4->fpdR >> 17;
 		bussColors4->fpdR ^= bussColors4->fpdR << 5;
-		inputSampleR += (((double) bussColors4->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));*/
+		inputSampleR += (((double) bussColors4->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));*/
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CABS_URI "https://hannesbraun.net/ns/lv2/airwindows/cabs"
 
 typedef enum {
@@ -1797,12 +1799,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		cabs->fpdL ^= cabs->fpdL << 13;
 		cabs->fpdL ^= cabs->fpdL >> 17;
 		cabs->fpdL ^= cabs->fpdL << 5;
-		inputSampleL += (((double) cabs->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) cabs->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		cabs->fpdR ^= cabs->fpdR << 13;
 		cabs->fpdR ^= cabs->fpdR >> 17;
 		cabs->fpdR ^= cabs->fpdR << 5;
-		inputSampleR += (((double) cabs->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) cabs->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
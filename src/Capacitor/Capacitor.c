@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CAPACITOR_URI "https://hannesbraun.net/ns/lv2/airwindows/capacitor"
 
 typedef enum {
@@ -369,12 +371,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		capacitor->fpdL ^= capacitor->fpdL << 13;
 		capacitor->fpdL ^= capacitor->fpdL >> 17;
 		capacitor->fpdL ^= capacitor->fpdL << 5;
-		inputSampleL += (((double) capacitor->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) capacitor->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		capacitor->fpdR ^= capacitor->fpdR << 13;
 		capacitor->fpdR ^= capacitor->fpdR >> 17;
 		capacitor->fpdR ^= capacitor->fpdR << 5;
-		inputSampleR += (((double) capacitor->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) capacitor->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
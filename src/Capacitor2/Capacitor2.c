@@ -4,7 +4,10 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CAPACITOR2_URI "https://hannesbraun.net/ns/lv2/airwindows/capacitor2"
+#define CAPACITOR2MONO_URI "https://hannesbraun.net/ns/lv2/airwindows/capacitor2mono"
 
 typedef enum {
 	INPUT_L = 0,
@@ -26,31 +29,18 @@ typedef struct {
 	const float* nonlin;
 	const float* drywet;
 
-	double iirHighpassAL;
-	double iirHighpassBL;
-	double iirHighpassCL;
-	double iirHighpassDL;
-	double iirHighpassEL;
-	double iirHighpassFL;
-	double iirLowpassAL;
-	double iirLowpassBL;
-	double iirLowpassCL;
-	double iirLowpassDL;
-	double iirLowpassEL;
-	double iirLowpassFL;
-
-	double iirHighpassAR;
-	double iirHighpassBR;
-	double iirHighpassCR;
-	double iirHighpassDR;
-	double iirHighpassER;
-	double iirHighpassFR;
-	double iirLowpassAR;
-	double iirLowpassBR;
-	double iirLowpassCR;
-	double iirLowpassDR;
-	double iirLowpassER;
-	double iirLowpassFR;
+	double iirHighpassA[2];
+	double iirHighpassB[2];
+	double iirHighpassC[2];
+	double iirHighpassD[2];
+	double iirHighpassE[2];
+	double iirHighpassF[2];
+	double iirLowpassA[2];
+	double iirLowpassB[2];
+	double iirLowpassC[2];
+	double iirLowpassD[2];
+	double iirLowpassE[2];
+	double iirLowpassF[2];
 
 	int count;
 
@@ -66,8 +56,7 @@ typedef struct {
 	double lastHighpass;
 	double lastWet;
 
-	uint32_t fpdL;
-	uint32_t fpdR;
+	uint32_t fpd[2];
 } Capacitor2;
 
 static LV2_Handle instantiate(
@@ -113,35 +102,38 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 	}
 }
 
+// The mono variant has one input and one output, its controls follow at 2
+static void connect_port_mono(LV2_Handle instance, uint32_t port, void* data)
+{
+	Capacitor2* capacitor2 = (Capacitor2*) instance;
+
+	if (port == 0) {
+		capacitor2->input[0] = (const float*) data;
+	} else if (port == 1) {
+		capacitor2->output[0] = (float*) data;
+	} else {
+		connect_port(instance, port + 2, data);
+	}
+}
+
 static void activate(LV2_Handle instance)
 {
 	Capacitor2* capacitor2 = (Capacitor2*) instance;
 
-	capacitor2->iirHighpassAL = 0.0;
-	capacitor2->iirHighpassBL = 0.0;
-	capacitor2->iirHighpassCL = 0.0;
-	capacitor2->iirHighpassDL = 0.0;
-	capacitor2->iirHighpassEL = 0.0;
-	capacitor2->iirHighpassFL = 0.0;
-	capacitor2->iirLowpassAL = 0.0;
-	capacitor2->iirLowpassBL = 0.0;
-	capacitor2->iirLowpassCL = 0.0;
-	capacitor2->iirLowpassDL = 0.0;
-	capacitor2->iirLowpassEL = 0.0;
-	capacitor2->iirLowpassFL = 0.0;
-
-	capacitor2->iirHighpassAR = 0.0;
-	capacitor2->iirHighpassBR = 0.0;
-	capacitor2->iirHighpassCR = 0.0;
-	capacitor2->iirHighpassDR = 0.0;
-	capacitor2->iirHighpassER = 0.0;
-	capacitor2->iirHighpassFR = 0.0;
-	capacitor2->iirLowpassAR = 0.0;
-	capacitor2->iirLowpassBR = 0.0;
-	capacitor2->iirLowpassCR = 0.0;
-	capacitor2->iirLowpassDR = 0.0;
-	capacitor2->iirLowpassER = 0.0;
-	capacitor2->iirLowpassFR = 0.0;
+	for (int c = 0; c < 2; c++) {
+		capacitor2->iirHighpassA[c] = 0.0;
+		capacitor2->iirHighpassB[c] = 0.0;
+		capacitor2->iirHighpassC[c] = 0.0;
+		capacitor2->iirHighpassD[c] = 0.0;
+		capacitor2->iirHighpassE[c] = 0.0;
+		capacitor2->iirHighpassF[c] = 0.0;
+		capacitor2->iirLowpassA[c] = 0.0;
+		capacitor2->iirLowpassB[c] = 0.0;
+		capacitor2->iirLowpassC[c] = 0.0;
+		capacitor2->iirLowpassD[c] = 0.0;
+		capacitor2->iirLowpassE[c] = 0.0;
+		capacitor2->iirLowpassF[c] = 0.0;
+	}
 	capacitor2->count = 0;
 	capacitor2->lowpassChase = 0.0;
 	capacitor2->highpassChase = 0.0;
@@ -153,21 +145,16 @@ static void activate(LV2_Handle instance)
 	capacitor2->lastHighpass = 1000.0;
 	capacitor2->lastWet = 1000.0;
 
-	capacitor2->fpdL = 1.0;
-	while (capacitor2->fpdL < 16386) capacitor2->fpdL = rand() * UINT32_MAX;
-	capacitor2->fpdR = 1.0;
-	while (capacitor2->fpdR < 16386) capacitor2->fpdR = rand() * UINT32_MAX;
+	for (int c = 0; c < 2; c++) {
+		capacitor2->fpd[c] = 1.0;
+		while (capacitor2->fpd[c] < 16386) capacitor2->fpd[c] = rand() * UINT32_MAX;
+	}
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+// Processes the first `channels` inputs into the outputs. The control smoothing
+// and the filter rotation are shared, the filter states are per channel.
+static inline void run_channels(Capacitor2* capacitor2, uint32_t sampleFrames, const int channels)
 {
-	Capacitor2* capacitor2 = (Capacitor2*) instance;
-
-	const float* in1 = capacitor2->input[0];
-	const float* in2 = capacitor2->input[1];
-	float* out1 = capacitor2->output[0];
-	float* out2 = capacitor2->output[1];
-
 	capacitor2->lowpassChase = pow(*capacitor2->lowpass, 2);
 	capacitor2->highpassChase = pow(*capacitor2->highpass, 2);
 	double nonLin = 1.0 + ((1.0 - *capacitor2->nonlin) * 6.0);
@@ -182,32 +169,32 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	capacitor2->lastHighpass = capacitor2->highpassChase;
 	capacitor2->lastWet = capacitor2->wetChase;
 
-	while (sampleFrames-- > 0) {
-		double inputSampleL = *in1;
-		double inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = capacitor2->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = capacitor2->fpdR * 1.18e-17;
-		double drySampleL = inputSampleL;
-		double drySampleR = inputSampleR;
-
-		double dielectricScaleL = fabs(2.0 - ((inputSampleL + nonLin) / nonLin));
-		double dielectricScaleR = fabs(2.0 - ((inputSampleR + nonLin) / nonLin));
+	double inputSample[2];
+	double drySample[2];
+	double lowpassAmount[2];
+	double invLowpass[2];
+	double highpassAmount[2];
+	double invHighpass[2];
+
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		for (int c = 0; c < channels; c++) {
+			inputSample[c] = capacitor2->input[c][i];
+			if (fabs(inputSample[c]) < 1.18e-23) inputSample[c] = capacitor2->fpd[c] * 1.18e-17;
+			drySample[c] = inputSample[c];
+		}
 
 		capacitor2->lowpassBaseAmount = (((capacitor2->lowpassBaseAmount * lowpassSpeed) + capacitor2->lowpassChase) / (lowpassSpeed + 1.0));
-		// positive voltage will mean lower capacitance when capacitor is barium titanate
-		// on the lowpass, higher pressure means positive swings/smaller cap/larger value for lowpassAmount
-		double lowpassAmountL = capacitor2->lowpassBaseAmount * dielectricScaleL;
-		double invLowpassL = 1.0 - lowpassAmountL;
-		double lowpassAmountR = capacitor2->lowpassBaseAmount * dielectricScaleR;
-		double invLowpassR = 1.0 - lowpassAmountR;
-
 		capacitor2->highpassBaseAmount = (((capacitor2->highpassBaseAmount * highpassSpeed) + capacitor2->highpassChase) / (highpassSpeed + 1.0));
-		// positive voltage will mean lower capacitance when capacitor is barium titanate
-		// on the highpass, higher pressure means positive swings/smaller cap/larger value for highpassAmount
-		double highpassAmountL = capacitor2->highpassBaseAmount * dielectricScaleL;
-		double invHighpassL = 1.0 - highpassAmountL;
-		double highpassAmountR = capacitor2->highpassBaseAmount * dielectricScaleR;
-		double invHighpassR = 1.0 - highpassAmountR;
+		for (int c = 0; c < channels; c++) {
+			double dielectricScale = fabs(2.0 - ((inputSample[c] + nonLin) / nonLin));
+			// positive voltage will mean lower capacitance when capacitor is barium titanate
+			// on the lowpass, higher pressure means positive swings/smaller cap/larger value for lowpassAmount
+			lowpassAmount[c] = capacitor2->lowpassBaseAmount * dielectricScale;
+			invLowpass[c] = 1.0 - lowpassAmount[c];
+			// on the highpass, higher pressure means positive swings/smaller cap/larger value for highpassAmount
+			highpassAmount[c] = capacitor2->highpassBaseAmount * dielectricScale;
+			invHighpass[c] = 1.0 - highpassAmount[c];
+		}
 
 		capacitor2->wet = (((capacitor2->wet * wetSpeed) + capacitor2->wetChase) / (wetSpeed + 1.0));
 
@@ -215,192 +202,134 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (capacitor2->count > 5) capacitor2->count = 0;
 		switch (capacitor2->count) {
 			case 0:
-				capacitor2->iirHighpassAL = (capacitor2->iirHighpassAL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassAL;
-				capacitor2->iirLowpassAL = (capacitor2->iirLowpassAL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassAL;
-				capacitor2->iirHighpassBL = (capacitor2->iirHighpassBL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassBL;
-				capacitor2->iirLowpassBL = (capacitor2->iirLowpassBL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassBL;
-				capacitor2->iirHighpassDL = (capacitor2->iirHighpassDL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassDL;
-				capacitor2->iirLowpassDL = (capacitor2->iirLowpassDL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassDL;
-				capacitor2->iirHighpassAR = (capacitor2->iirHighpassAR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassAR;
-				capacitor2->iirLowpassAR = (capacitor2->iirLowpassAR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassAR;
-				capacitor2->iirHighpassBR = (capacitor2->iirHighpassBR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassBR;
-				capacitor2->iirLowpassBR = (capacitor2->iirLowpassBR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassBR;
-				capacitor2->iirHighpassDR = (capacitor2->iirHighpassDR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassDR;
-				capacitor2->iirLowpassDR = (capacitor2->iirLowpassDR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassDR;
+				for (int c = 0; c < channels; c++) {
+					capacitor2->iirHighpassA[c] = (capacitor2->iirHighpassA[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassA[c];
+					capacitor2->iirLowpassA[c] = (capacitor2->iirLowpassA[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassA[c];
+					capacitor2->iirHighpassB[c] = (capacitor2->iirHighpassB[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassB[c];
+					capacitor2->iirLowpassB[c] = (capacitor2->iirLowpassB[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassB[c];
+					capacitor2->iirHighpassD[c] = (capacitor2->iirHighpassD[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassD[c];
+					capacitor2->iirLowpassD[c] = (capacitor2->iirLowpassD[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassD[c];
+				}
 				break;
 			case 1:
-				capacitor2->iirHighpassAL = (capacitor2->iirHighpassAL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassAL;
-				capacitor2->iirLowpassAL = (capacitor2->iirLowpassAL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassAL;
-				capacitor2->iirHighpassCL = (capacitor2->iirHighpassCL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassCL;
-				capacitor2->iirLowpassCL = (capacitor2->iirLowpassCL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassCL;
-				capacitor2->iirHighpassEL = (capacitor2->iirHighpassEL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassEL;
-				capacitor2->iirLowpassEL = (capacitor2->iirLowpassEL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassEL;
-				capacitor2->iirHighpassAR = (capacitor2->iirHighpassAR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassAR;
-				capacitor2->iirLowpassAR = (capacitor2->iirLowpassAR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassAR;
-				capacitor2->iirHighpassCR = (capacitor2->iirHighpassCR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassCR;
-				capacitor2->iirLowpassCR = (capacitor2->iirLowpassCR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassCR;
-				capacitor2->iirHighpassER = (capacitor2->iirHighpassER * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassER;
-				capacitor2->iirLowpassER = (capacitor2->iirLowpassER * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassER;
+				for (int c = 0; c < channels; c++) {
+					capacitor2->iirHighpassA[c] = (capacitor2->iirHighpassA[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassA[c];
+					capacitor2->iirLowpassA[c] = (capacitor2->iirLowpassA[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassA[c];
+					capacitor2->iirHighpassC[c] = (capacitor2->iirHighpassC[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassC[c];
+					capacitor2->iirLowpassC[c] = (capacitor2->iirLowpassC[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassC[c];
+					capacitor2->iirHighpassE[c] = (capacitor2->iirHighpassE[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassE[c];
+					capacitor2->iirLowpassE[c] = (capacitor2->iirLowpassE[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassE[c];
+				}
 				break;
 			case 2:
-				capacitor2->iirHighpassAL = (capacitor2->iirHighpassAL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassAL;
-				capacitor2->iirLowpassAL = (capacitor2->iirLowpassAL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassAL;
-				capacitor2->iirHighpassBL = (capacitor2->iirHighpassBL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassBL;
-				capacitor2->iirLowpassBL = (capacitor2->iirLowpassBL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassBL;
-				capacitor2->iirHighpassFL = (capacitor2->iirHighpassFL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassFL;
-				capacitor2->iirLowpassFL = (capacitor2->iirLowpassFL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassFL;
-				capacitor2->iirHighpassAR = (capacitor2->iirHighpassAR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassAR;
-				capacitor2->iirLowpassAR = (capacitor2->iirLowpassAR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassAR;
-				capacitor2->iirHighpassBR = (capacitor2->iirHighpassBR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassBR;
-				capacitor2->iirLowpassBR = (capacitor2->iirLowpassBR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassBR;
-				capacitor2->iirHighpassFR = (capacitor2->iirHighpassFR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassFR;
-				capacitor2->iirLowpassFR = (capacitor2->iirLowpassFR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassFR;
+				for (int c = 0; c < channels; c++) {
+					capacitor2->iirHighpassA[c] = (capacitor2->iirHighpassA[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassA[c];
+					capacitor2->iirLowpassA[c] = (capacitor2->iirLowpassA[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassA[c];
+					capacitor2->iirHighpassB[c] = (capacitor2->iirHighpassB[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassB[c];
+					capacitor2->iirLowpassB[c] = (capacitor2->iirLowpassB[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassB[c];
+					capacitor2->iirHighpassF[c] = (capacitor2->iirHighpassF[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassF[c];
+					capacitor2->iirLowpassF[c] = (capacitor2->iirLowpassF[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassF[c];
+				}
 				break;
 			case 3:
-				capacitor2->iirHighpassAL = (capacitor2->iirHighpassAL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassAL;
-				capacitor2->iirLowpassAL = (capacitor2->iirLowpassAL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassAL;
-				capacitor2->iirHighpassCL = (capacitor2->iirHighpassCL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassCL;
-				capacitor2->iirLowpassCL = (capacitor2->iirLowpassCL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassCL;
-				capacitor2->iirHighpassDL = (capacitor2->iirHighpassDL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassDL;
-				capacitor2->iirLowpassDL = (capacitor2->iirLowpassDL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassDL;
-				capacitor2->iirHighpassAR = (capacitor2->iirHighpassAR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassAR;
-				capacitor2->iirLowpassAR = (capacitor2->iirLowpassAR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassAR;
-				capacitor2->iirHighpassCR = (capacitor2->iirHighpassCR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassCR;
-				capacitor2->iirLowpassCR = (capacitor2->iirLowpassCR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassCR;
-				capacitor2->iirHighpassDR = (capacitor2->iirHighpassDR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassDR;
-				capacitor2->iirLowpassDR = (capacitor2->iirLowpassDR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassDR;
+				for (int c = 0; c < channels; c++) {
+					capacitor2->iirHighpassA[c] = (capacitor2->iirHighpassA[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassA[c];
+					capacitor2->iirLowpassA[c] = (capacitor2->iirLowpassA[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassA[c];
+					capacitor2->iirHighpassC[c] = (capacitor2->iirHighpassC[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassC[c];
+					capacitor2->iirLowpassC[c] = (capacitor2->iirLowpassC[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassC[c];
+					capacitor2->iirHighpassD[c] = (capacitor2->iirHighpassD[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassD[c];
+					capacitor2->iirLowpassD[c] = (capacitor2->iirLowpassD[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassD[c];
+				}
 				break;
 			case 4:
-				capacitor2->iirHighpassAL = (capacitor2->iirHighpassAL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassAL;
-				capacitor2->iirLowpassAL = (capacitor2->iirLowpassAL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassAL;
-				capacitor2->iirHighpassBL = (capacitor2->iirHighpassBL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassBL;
-				capacitor2->iirLowpassBL = (capacitor2->iirLowpassBL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassBL;
-				capacitor2->iirHighpassEL = (capacitor2->iirHighpassEL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassEL;
-				capacitor2->iirLowpassEL = (capacitor2->iirLowpassEL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassEL;
-				capacitor2->iirHighpassAR = (capacitor2->iirHighpassAR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassAR;
-				capacitor2->iirLowpassAR = (capacitor2->iirLowpassAR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassAR;
-				capacitor2->iirHighpassBR = (capacitor2->iirHighpassBR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassBR;
-				capacitor2->iirLowpassBR = (capacitor2->iirLowpassBR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassBR;
-				capacitor2->iirHighpassER = (capacitor2->iirHighpassER * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassER;
-				capacitor2->iirLowpassER = (capacitor2->iirLowpassER * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassER;
+				for (int c = 0; c < channels; c++) {
+					capacitor2->iirHighpassA[c] = (capacitor2->iirHighpassA[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassA[c];
+					capacitor2->iirLowpassA[c] = (capacitor2->iirLowpassA[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassA[c];
+					capacitor2->iirHighpassB[c] = (capacitor2->iirHighpassB[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassB[c];
+					capacitor2->iirLowpassB[c] = (capacitor2->iirLowpassB[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassB[c];
+					capacitor2->iirHighpassE[c] = (capacitor2->iirHighpassE[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassE[c];
+					capacitor2->iirLowpassE[c] = (capacitor2->iirLowpassE[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassE[c];
+				}
 				break;
 			case 5:
-				capacitor2->iirHighpassAL = (capacitor2->iirHighpassAL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassAL;
-				capacitor2->iirLowpassAL = (capacitor2->iirLowpassAL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassAL;
-				capacitor2->iirHighpassCL = (capacitor2->iirHighpassCL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassCL;
-				capacitor2->iirLowpassCL = (capacitor2->iirLowpassCL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassCL;
-				capacitor2->iirHighpassFL = (capacitor2->iirHighpassFL * invHighpassL) + (inputSampleL * highpassAmountL);
-				inputSampleL -= capacitor2->iirHighpassFL;
-				capacitor2->iirLowpassFL = (capacitor2->iirLowpassFL * invLowpassL) + (inputSampleL * lowpassAmountL);
-				inputSampleL = capacitor2->iirLowpassFL;
-				capacitor2->iirHighpassAR = (capacitor2->iirHighpassAR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassAR;
-				capacitor2->iirLowpassAR = (capacitor2->iirLowpassAR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassAR;
-				capacitor2->iirHighpassCR = (capacitor2->iirHighpassCR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassCR;
-				capacitor2->iirLowpassCR = (capacitor2->iirLowpassCR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassCR;
-				capacitor2->iirHighpassFR = (capacitor2->iirHighpassFR * invHighpassR) + (inputSampleR * highpassAmountR);
-				inputSampleR -= capacitor2->iirHighpassFR;
-				capacitor2->iirLowpassFR = (capacitor2->iirLowpassFR * invLowpassR) + (inputSampleR * lowpassAmountR);
-				inputSampleR = capacitor2->iirLowpassFR;
+				for (int c = 0; c < channels; c++) {
+					capacitor2->iirHighpassA[c] = (capacitor2->iirHighpassA[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassA[c];
+					capacitor2->iirLowpassA[c] = (capacitor2->iirLowpassA[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassA[c];
+					capacitor2->iirHighpassC[c] = (capacitor2->iirHighpassC[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassC[c];
+					capacitor2->iirLowpassC[c] = (capacitor2->iirLowpassC[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassC[c];
+					capacitor2->iirHighpassF[c] = (capacitor2->iirHighpassF[c] * invHighpass[c]) + (inputSample[c] * highpassAmount[c]);
+					inputSample[c] -= capacitor2->iirHighpassF[c];
+					capacitor2->iirLowpassF[c] = (capacitor2->iirLowpassF[c] * invLowpass[c]) + (inputSample[c] * lowpassAmount[c]);
+					inputSample[c] = capacitor2->iirLowpassF[c];
+				}
 				break;
 		}
 		// Highpass Filter chunk. This is three poles of IIR highpass, with a 'gearbox' that progressively
 		// steepens the filter after minimizing artifacts.
 
-		inputSampleL = (drySampleL * (1.0 - capacitor2->wet)) + (inputSampleL * nonLinTrim * capacitor2->wet);
-		inputSampleR = (drySampleR * (1.0 - capacitor2->wet)) + (inputSampleR * nonLinTrim * capacitor2->wet);
-
-		// begin 32 bit stereo floating point dither
-		int expon;
-		frexpf((float) inputSampleL, &expon);
-		capacitor2->fpdL ^= capacitor2->fpdL << 13;
-		capacitor2->fpdL ^= capacitor2->fpdL >> 17;
-		capacitor2->fpdL ^= capacitor2->fpdL << 5;
-		inputSampleL += (((double) capacitor2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		frexpf((float) inputSampleR, &expon);
-		capacitor2->fpdR ^= capacitor2->fpdR << 13;
-		capacitor2->fpdR ^= capacitor2->fpdR >> 17;
-		capacitor2->fpdR ^= capacitor2->fpdR << 5;
-		inputSampleR += (((double) capacitor2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		// end 32 bit stereo floating point dither
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+		for (int c = 0; c < channels; c++) {
+			inputSample[c] = (drySample[c] * (1.0 - capacitor2->wet)) + (inputSample[c] * nonLinTrim * capacitor2->wet);
+		}
+
+		// begin 32 bit floating point dither
+		for (int c = 0; c < channels; c++) {
+			int expon;
+			frexpf((float) inputSample[c], &expon);
+			capacitor2->fpd[c] ^= capacitor2->fpd[c] << 13;
+			capacitor2->fpd[c] ^= capacitor2->fpd[c] >> 17;
+			capacitor2->fpd[c] ^= capacitor2->fpd[c] << 5;
+			inputSample[c] += (((double) capacitor2->fpd[c] - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+		}
+		// end 32 bit floating point dither
+
+		for (int c = 0; c < channels; c++) capacitor2->output[c][i] = (float) inputSample[c];
 	}
 }
 
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Capacitor2*) instance, sampleFrames, 2);
+}
+
+static void run_mono(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Capacitor2*) instance, sampleFrames, 1);
+}
+
 static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
@@ -413,17 +342,25 @@ static const void* extension_data(const char* uri)
 	return NULL;
 }
 
-static const LV2_Descriptor descriptor = {
-	CAPACITOR2_URI,
-	instantiate,
-	connect_port,
-	activate,
-	run,
-	deactivate,
-	cleanup,
-	extension_data};
+static const LV2_Descriptor descriptors[] = {
+	{CAPACITOR2_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{CAPACITOR2MONO_URI,
+	 instantiate,
+	 connect_port_mono,
+	 activate,
+	 run_mono,
+	 deactivate,
+	 cleanup,
+	 extension_data}};
 
 LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
 {
-	return index == 0 ? &descriptor : NULL;
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
 }
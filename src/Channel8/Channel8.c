@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CHANNEL8_URI "https://hannesbraun.net/ns/lv2/airwindows/channel8"
 
 typedef enum {
@@ -172,11 +174,11 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		if (inputSampleL > 1.0) inputSampleL = 1.0;
 		if (inputSampleL < -1.0) inputSampleL = -1.0;
-		double phatSampleL = sin(inputSampleL * 1.57079633);
+		double phatSampleL = fast_sin(inputSampleL * 1.57079633);
 		inputSampleL *= 1.2533141373155;
 		// clip to 1.2533141373155 to reach maximum output, or 1.57079633 for pure sine 'phat' version
 
-		double distSampleL = sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL));
+		double distSampleL = fast_sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL));
 
 		inputSampleL = distSampleL; // purest form is full Spiral
 		if (density < 1.0) inputSampleL = (drySampleL * (1 - density)) + (distSampleL * density); // fade Spiral aspect
@@ -184,11 +186,11 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		if (inputSampleR > 1.0) inputSampleR = 1.0;
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
-		double phatSampleR = sin(inputSampleR * 1.57079633);
+		double phatSampleR = fast_sin(inputSampleR * 1.57079633);
 		inputSampleR *= 1.2533141373155;
 		// clip to 1.2533141373155 to reach maximum output, or 1.57079633 for pure sine 'phat' version
 
-		double distSampleR = sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR));
+		double distSampleR = fast_sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR));
 
 		inputSampleR = distSampleR; // purest form is full Spiral
 		if (density < 1.0) inputSampleR = (drySampleR * (1 - density)) + (distSampleR * density); // fade Spiral aspect
@@ -241,12 +243,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		channel8->fpdL ^= channel8->fpdL << 13;
 		channel8->fpdL ^= channel8->fpdL >> 17;
 		channel8->fpdL ^= channel8->fpdL << 5;
-		inputSampleL += (((double) channel8->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) channel8->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		channel8->fpdR ^= channel8->fpdR << 13;
 		channel8->fpdR ^= channel8->fpdR >> 17;
 		channel8->fpdR ^= channel8->fpdR << 5;
-		inputSampleR += (((double) channel8->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) channel8->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
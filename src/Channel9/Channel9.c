@@ -5,9 +5,12 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define CHANNEL9_URI "https://hannesbraun.net/ns/lv2/airwindows/channel9"
+#define CHANNEL9MONO_URI "https://hannesbraun.net/ns/lv2/airwindows/channel9mono"
 
 typedef enum {
 	INPUT_L = 0,
@@ -27,20 +30,14 @@ typedef struct {
 	const float* drive;
 	const float* outputGain;
 
-	uint32_t fpdL;
-	uint32_t fpdR;
+	uint32_t fpd[2];
 	// default stuff
-	double iirSampleLA;
-	double iirSampleRA;
-	double iirSampleLB;
-	double iirSampleRB;
-	double lastSampleAL;
-	double lastSampleBL;
-	double lastSampleCL;
-	double lastSampleAR;
-	double lastSampleBR;
-	double lastSampleCR;
-	double biquadA[15];
+	double iirSampleA[2];
+	double iirSampleB[2];
+	double lastSampleA[2];
+	double lastSampleB[2];
+	double lastSampleC[2];
+	double biquadA[15]; // the coefficients, then x1, x2, y1 and y2 of each channel
 	double biquadB[15];
 	double iirAmount;
 	double threshold;
@@ -88,6 +85,20 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 	}
 }
 
+// The mono variant has one input and one output, its controls follow at 2
+static void connect_port_mono(LV2_Handle instance, uint32_t port, void* data)
+{
+	Channel9* channel9 = (Channel9*) instance;
+
+	if (port == 0) {
+		channel9->input[0] = (const float*) data;
+	} else if (port == 1) {
+		channel9->output[0] = (float*) data;
+	} else {
+		connect_port(instance, port + 2, data);
+	}
+}
+
 static void activate(LV2_Handle instance)
 {
 	Channel9* channel9 = (Channel9*) instance;
@@ -96,35 +107,27 @@ static void activate(LV2_Handle instance)
 		channel9->biquadA[x] = 0.0;
 		channel9->biquadB[x] = 0.0;
 	}
-	channel9->fpdL = 1.0;
-	while (channel9->fpdL < 16386) channel9->fpdL = rand() * UINT32_MAX;
-	channel9->fpdR = 1.0;
-	while (channel9->fpdR < 16386) channel9->fpdR = rand() * UINT32_MAX;
-	channel9->iirSampleLA = 0.0;
-	channel9->iirSampleRA = 0.0;
-	channel9->iirSampleLB = 0.0;
-	channel9->iirSampleRB = 0.0;
-	channel9->lastSampleAL = 0.0;
-	channel9->lastSampleBL = 0.0;
-	channel9->lastSampleCL = 0.0;
-	channel9->lastSampleAR = 0.0;
-	channel9->lastSampleBR = 0.0;
-	channel9->lastSampleCR = 0.0;
+	for (int c = 0; c < 2; c++) {
+		channel9->fpd[c] = 1.0;
+		while (channel9->fpd[c] < 16386) channel9->fpd[c] = rand() * UINT32_MAX;
+	}
+	for (int c = 0; c < 2; c++) {
+		channel9->iirSampleA[c] = 0.0;
+		channel9->iirSampleB[c] = 0.0;
+		channel9->lastSampleA[c] = 0.0;
+		channel9->lastSampleB[c] = 0.0;
+		channel9->lastSampleC[c] = 0.0;
+	}
 	channel9->flip = false;
 	channel9->iirAmount = 0.005832;
 	channel9->threshold = 0.33362176; // instantiating with Neve values
 	channel9->cutoff = 28811.0;
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+// Processes the first `channels` inputs into the outputs. The console type,
+// drive and the highpass flip are shared, everything else has a lane per channel.
+static inline void run_channels(Channel9* channel9, uint32_t sampleFrames, const int channels)
 {
-	Channel9* channel9 = (Channel9*) instance;
-
-	const float* in1 = channel9->input[0];
-	const float* in2 = channel9->input[1];
-	float* out1 = channel9->output[0];
-	float* out2 = channel9->output[1];
-
 	float consoletype = *channel9->consoletype;
 	switch ((int) consoletype) {
 		case 1:
@@ -187,158 +190,121 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	channel9->biquadB[5] = 2.0 * (K * K - 1.0) * norm;
 	channel9->biquadB[6] = (1.0 - K / channel9->biquadB[1] + K * K) * norm;
 
-	while (sampleFrames-- > 0) {
-		double inputSampleL = *in1;
-		double inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = channel9->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = channel9->fpdR * 1.18e-17;
-		double tempSample;
+	double inputSample[2];
 
-		if (channel9->biquadA[0] < 0.49999) {
-			tempSample = channel9->biquadA[2] * inputSampleL + channel9->biquadA[3] * channel9->biquadA[7] + channel9->biquadA[4] * channel9->biquadA[8] - channel9->biquadA[5] * channel9->biquadA[9] - channel9->biquadA[6] * channel9->biquadA[10];
-			channel9->biquadA[8] = channel9->biquadA[7];
-			channel9->biquadA[7] = inputSampleL;
-			if (fabs(tempSample) < 1.18e-37) tempSample = 0.0;
-			inputSampleL = tempSample;
-			channel9->biquadA[10] = channel9->biquadA[9];
-			channel9->biquadA[9] = inputSampleL; // DF1 left
-			tempSample = channel9->biquadA[2] * inputSampleR + channel9->biquadA[3] * channel9->biquadA[11] + channel9->biquadA[4] * channel9->biquadA[12] - channel9->biquadA[5] * channel9->biquadA[13] - channel9->biquadA[6] * channel9->biquadA[14];
-			channel9->biquadA[12] = channel9->biquadA[11];
-			channel9->biquadA[11] = inputSampleR;
-			if (fabs(tempSample) < 1.18e-37) tempSample = 0.0;
-			inputSampleR = tempSample;
-			channel9->biquadA[14] = channel9->biquadA[13];
-			channel9->biquadA[13] = inputSampleR; // DF1 right
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		for (int c = 0; c < channels; c++) {
+			inputSample[c] = channel9->input[c][i];
+			if (fabs(inputSample[c]) < 1.18e-23) inputSample[c] = channel9->fpd[c] * 1.18e-17;
 		}
 
-		double dielectricScaleL = fabs(2.0 - ((inputSampleL + nonLin) / nonLin));
-		double dielectricScaleR = fabs(2.0 - ((inputSampleR + nonLin) / nonLin));
+		if (channel9->biquadA[0] < 0.49999) {
+			for (int c = 0; c < channels; c++) {
+				double* state = channel9->biquadA + 7 + 4 * c;
+				double tempSample = channel9->biquadA[2] * inputSample[c] + channel9->biquadA[3] * state[0] + channel9->biquadA[4] * state[1] - channel9->biquadA[5] * state[2] - channel9->biquadA[6] * state[3];
+				state[1] = state[0];
+				state[0] = inputSample[c];
+				if (fabs(tempSample) < 1.18e-37) tempSample = 0.0;
+				inputSample[c] = tempSample;
+				state[3] = state[2];
+				state[2] = inputSample[c]; // DF1
+			}
+		}
 
 		if (channel9->flip) {
-			if (fabs(channel9->iirSampleLA) < 1.18e-37) channel9->iirSampleLA = 0.0;
-			channel9->iirSampleLA = (channel9->iirSampleLA * (1.0 - (localiirAmount * dielectricScaleL))) + (inputSampleL * localiirAmount * dielectricScaleL);
-			inputSampleL = inputSampleL - channel9->iirSampleLA;
-			if (fabs(channel9->iirSampleRA) < 1.18e-37) channel9->iirSampleRA = 0.0;
-			channel9->iirSampleRA = (channel9->iirSampleRA * (1.0 - (localiirAmount * dielectricScaleR))) + (inputSampleR * localiirAmount * dielectricScaleR);
-			inputSampleR = inputSampleR - channel9->iirSampleRA;
+			for (int c = 0; c < channels; c++) {
+				double dielectricScale = fabs(2.0 - ((inputSample[c] + nonLin) / nonLin));
+				if (fabs(channel9->iirSampleA[c]) < 1.18e-37) channel9->iirSampleA[c] = 0.0;
+				channel9->iirSampleA[c] = (channel9->iirSampleA[c] * (1.0 - (localiirAmount * dielectricScale))) + (inputSample[c] * localiirAmount * dielectricScale);
+				inputSample[c] = inputSample[c] - channel9->iirSampleA[c];
+			}
 		} else {
-			if (fabs(channel9->iirSampleLB) < 1.18e-37) channel9->iirSampleLB = 0.0;
-			channel9->iirSampleLB = (channel9->iirSampleLB * (1.0 - (localiirAmount * dielectricScaleL))) + (inputSampleL * localiirAmount * dielectricScaleL);
-			inputSampleL = inputSampleL - channel9->iirSampleLB;
-			if (fabs(channel9->iirSampleRB) < 1.18e-37) channel9->iirSampleRB = 0.0;
-			channel9->iirSampleRB = (channel9->iirSampleRB * (1.0 - (localiirAmount * dielectricScaleR))) + (inputSampleR * localiirAmount * dielectricScaleR);
-			inputSampleR = inputSampleR - channel9->iirSampleRB;
+			for (int c = 0; c < channels; c++) {
+				double dielectricScale = fabs(2.0 - ((inputSample[c] + nonLin) / nonLin));
+				if (fabs(channel9->iirSampleB[c]) < 1.18e-37) channel9->iirSampleB[c] = 0.0;
+				channel9->iirSampleB[c] = (channel9->iirSampleB[c] * (1.0 - (localiirAmount * dielectricScale))) + (inputSample[c] * localiirAmount * dielectricScale);
+				inputSample[c] = inputSample[c] - channel9->iirSampleB[c];
+			}
 		}
 		// highpass section
-		double drySampleL = inputSampleL;
-		double drySampleR = inputSampleR;
-
-		if (inputSampleL > 1.0) inputSampleL = 1.0;
-		if (inputSampleL < -1.0) inputSampleL = -1.0;
-		double phatSampleL = sin(inputSampleL * 1.57079633);
-		inputSampleL *= 1.2533141373155;
-		// clip to 1.2533141373155 to reach maximum output, or 1.57079633 for pure sine 'phat' version
 
-		double distSampleL = sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL));
+		for (int c = 0; c < channels; c++) {
+			double drySample = inputSample[c];
 
-		inputSampleL = distSampleL; // purest form is full Spiral
-		if (density < 1.0) inputSampleL = (drySampleL * (1 - density)) + (distSampleL * density); // fade Spiral aspect
-		if (phattity > 0.0) inputSampleL = (inputSampleL * (1 - phattity)) + (phatSampleL * phattity); // apply original Density on top
+			if (inputSample[c] > 1.0) inputSample[c] = 1.0;
+			if (inputSample[c] < -1.0) inputSample[c] = -1.0;
+			double phatSample = fast_sin(inputSample[c] * 1.57079633);
+			inputSample[c] *= 1.2533141373155;
+			// clip to 1.2533141373155 to reach maximum output, or 1.57079633 for pure sine 'phat' version
 
-		if (inputSampleR > 1.0) inputSampleR = 1.0;
-		if (inputSampleR < -1.0) inputSampleR = -1.0;
-		double phatSampleR = sin(inputSampleR * 1.57079633);
-		inputSampleR *= 1.2533141373155;
-		// clip to 1.2533141373155 to reach maximum output, or 1.57079633 for pure sine 'phat' version
+			double distSample = fast_sin(inputSample[c] * fabs(inputSample[c])) / ((fabs(inputSample[c]) == 0.0) ? 1 : fabs(inputSample[c]));
 
-		double distSampleR = sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR));
-
-		inputSampleR = distSampleR; // purest form is full Spiral
-		if (density < 1.0) inputSampleR = (drySampleR * (1 - density)) + (distSampleR * density); // fade Spiral aspect
-		if (phattity > 0.0) inputSampleR = (inputSampleR * (1 - phattity)) + (phatSampleR * phattity); // apply original Density on top
-
-		// begin L
-		double clamp = (channel9->lastSampleBL - channel9->lastSampleCL) * 0.381966011250105;
-		clamp -= (channel9->lastSampleAL - channel9->lastSampleBL) * 0.6180339887498948482045;
-		clamp += inputSampleL - channel9->lastSampleAL; // regular slew clamping added
-
-		channel9->lastSampleCL = channel9->lastSampleBL;
-		channel9->lastSampleBL = channel9->lastSampleAL;
-		channel9->lastSampleAL = inputSampleL; // now our output relates off lastSampleB
-
-		if (clamp > localthreshold)
-			inputSampleL = channel9->lastSampleBL + localthreshold;
-		if (-clamp > localthreshold)
-			inputSampleL = channel9->lastSampleBL - localthreshold;
-
-		channel9->lastSampleAL = (channel9->lastSampleAL * 0.381966011250105) + (inputSampleL * 0.6180339887498948482045); // split the difference between raw and smoothed for buffer
-		// end L
+			inputSample[c] = distSample; // purest form is full Spiral
+			if (density < 1.0) inputSample[c] = (drySample * (1 - density)) + (distSample * density); // fade Spiral aspect
+			if (phattity > 0.0) inputSample[c] = (inputSample[c] * (1 - phattity)) + (phatSample * phattity); // apply original Density on top
+		}
 
-		// begin R
-		clamp = (channel9->lastSampleBR - channel9->lastSampleCR) * 0.381966011250105;
-		clamp -= (channel9->lastSampleAR - channel9->lastSampleBR) * 0.6180339887498948482045;
-		clamp += inputSampleR - channel9->lastSampleAR; // regular slew clamping added
+		for (int c = 0; c < channels; c++) {
+			double clamp = (channel9->lastSampleB[c] - channel9->lastSampleC[c]) * 0.381966011250105;
+			clamp -= (channel9->lastSampleA[c] - channel9->lastSampleB[c]) * 0.6180339887498948482045;
+			clamp += inputSample[c] - channel9->lastSampleA[c]; // regular slew clamping added
 
-		channel9->lastSampleCR = channel9->lastSampleBR;
-		channel9->lastSampleBR = channel9->lastSampleAR;
-		channel9->lastSampleAR = inputSampleR; // now our output relates off lastSampleB
+			channel9->lastSampleC[c] = channel9->lastSampleB[c];
+			channel9->lastSampleB[c] = channel9->lastSampleA[c];
+			channel9->lastSampleA[c] = inputSample[c]; // now our output relates off lastSampleB
 
-		if (clamp > localthreshold)
-			inputSampleR = channel9->lastSampleBR + localthreshold;
-		if (-clamp > localthreshold)
-			inputSampleR = channel9->lastSampleBR - localthreshold;
+			if (clamp > localthreshold)
+				inputSample[c] = channel9->lastSampleB[c] + localthreshold;
+			if (-clamp > localthreshold)
+				inputSample[c] = channel9->lastSampleB[c] - localthreshold;
 
-		channel9->lastSampleAR = (channel9->lastSampleAR * 0.381966011250105) + (inputSampleR * 0.6180339887498948482045); // split the difference between raw and smoothed for buffer
-		// end R
+			channel9->lastSampleA[c] = (channel9->lastSampleA[c] * 0.381966011250105) + (inputSample[c] * 0.6180339887498948482045); // split the difference between raw and smoothed for buffer
+		}
 
 		channel9->flip = !channel9->flip;
 
 		if (output < 1.0) {
-			inputSampleL *= output;
-			inputSampleR *= output;
+			for (int c = 0; c < channels; c++) inputSample[c] *= output;
 		}
 
 		if (channel9->biquadB[0] < 0.49999) {
-			tempSample = channel9->biquadB[2] * inputSampleL + channel9->biquadB[3] * channel9->biquadB[7] + channel9->biquadB[4] * channel9->biquadB[8] - channel9->biquadB[5] * channel9->biquadB[9] - channel9->biquadB[6] * channel9->biquadB[10];
-			channel9->biquadB[8] = channel9->biquadB[7];
-			channel9->biquadB[7] = inputSampleL;
-			if (fabs(tempSample) < 1.18e-37) tempSample = 0.0;
-			inputSampleL = tempSample;
-			channel9->biquadB[10] = channel9->biquadB[9];
-			channel9->biquadB[9] = inputSampleL; // DF1 left
-			tempSample = channel9->biquadB[2] * inputSampleR + channel9->biquadB[3] * channel9->biquadB[11] + channel9->biquadB[4] * channel9->biquadB[12] - channel9->biquadB[5] * channel9->biquadB[13] - channel9->biquadB[6] * channel9->biquadB[14];
-			channel9->biquadB[12] = channel9->biquadB[11];
-			channel9->biquadB[11] = inputSampleR;
-			if (fabs(tempSample) < 1.18e-37) tempSample = 0.0;
-			inputSampleR = tempSample;
-			channel9->biquadB[14] = channel9->biquadB[13];
-			channel9->biquadB[13] = inputSampleR; // DF1 right
+			for (int c = 0; c < channels; c++) {
+				double* state = channel9->biquadB + 7 + 4 * c;
+				double tempSample = channel9->biquadB[2] * inputSample[c] + channel9->biquadB[3] * state[0] + channel9->biquadB[4] * state[1] - channel9->biquadB[5] * state[2] - channel9->biquadB[6] * state[3];
+				state[1] = state[0];
+				state[0] = inputSample[c];
+				if (fabs(tempSample) < 1.18e-37) tempSample = 0.0;
+				inputSample[c] = tempSample;
+				state[3] = state[2];
+				state[2] = inputSample[c]; // DF1
+			}
+		}
+
+		// begin 32 bit floating point dither
+		for (int c = 0; c < channels; c++) {
+			int expon;
+			frexpf((float) inputSample[c], &expon);
+			channel9->fpd[c] ^= channel9->fpd[c] << 13;
+			channel9->fpd[c] ^= channel9->fpd[c] >> 17;
+			channel9->fpd[c] ^= channel9->fpd[c] << 5;
+			inputSample[c] += (((double) channel9->fpd[c] - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		}
+		// end 32 bit floating point dither
 
-		// begin 32 bit stereo floating point dither
-		int expon;
-		frexpf((float) inputSampleL, &expon);
-		channel9->fpdL ^= channel9->fpdL << 13;
-		channel9->fpdL ^= channel9->fpdL >> 17;
-		channel9->fpdL ^= channel9->fpdL << 5;
-		inputSampleL += (((double) channel9->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		frexpf((float) inputSampleR, &expon);
-		channel9->fpdR ^= channel9->fpdR << 13;
-		channel9->fpdR ^= channel9->fpdR >> 17;
-		channel9->fpdR ^= channel9->fpdR << 5;
-		inputSampleR += (((double) channel9->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		// end 32 bit stereo floating point dither
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+		for (int c = 0; c < channels; c++) channel9->output[c][i] = (float) inputSample[c];
 	}
 }
 
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Channel9*) instance, sampleFrames, 2);
+}
+
+static void run_mono(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Channel9*) instance, sampleFrames, 1);
+}
+
 static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
@@ -351,17 +317,25 @@ static const void* extension_data(const char* uri)
 	return NULL;
 }
 
-static const LV2_Descriptor descriptor = {
-	CHANNEL9_URI,
-	instantiate,
-	connect_port,
-	activate,
-	run,
-	deactivate,
-	cleanup,
-	extension_data};
+static const LV2_Descriptor descriptors[] = {
+	{CHANNEL9_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{CHANNEL9MONO_URI,
+	 instantiate,
+	 connect_port_mono,
+	 activate,
+	 run_mono,
+	 deactivate,
+	 cleanup,
+	 extension_data}};
 
 LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
 {
-	return index == 0 ? &descriptor : NULL;
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
 }
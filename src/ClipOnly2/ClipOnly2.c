@@ -4,6 +4,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include "../common/fused.h"
 
 #define CLIPONLY2_URI "https://hannesbraun.net/ns/lv2/airwindows/cliponly2"
 
@@ -75,6 +78,48 @@ static void activate(LV2_Handle instance)
 	}
 }
 
+static inline int get_spacing(const ClipOnly2* clipOnly2)
+{
+	double overallscale = 1.0;
+	overallscale /= 44100.0;
+	overallscale *= clipOnly2->sampleRate;
+
+	int spacing = floor(overallscale); // should give us working basic scaling, usually 2 or 4
+	if (spacing < 1) spacing = 1;
+	if (spacing > 16) spacing = 16;
+	return spacing;
+}
+
+// One channel of ClipOnly2, which works on float samples
+static inline float clip_only2(float inputSample, double* lastSample, double* intermediate, bool* wasPosClip, bool* wasNegClip, int spacing)
+{
+	if (inputSample > 4.0) inputSample = 4.0;
+	if (inputSample < -4.0) inputSample = -4.0;
+	if (*wasPosClip == true) { // current will be over
+		if (inputSample < *lastSample) *lastSample = 0.7058208 + (inputSample * 0.2609148);
+		else *lastSample = 0.2491717 + (*lastSample * 0.7390851);
+	}
+	*wasPosClip = false;
+	if (inputSample > 0.9549925859) {
+		*wasPosClip = true;
+		inputSample = 0.7058208 + (*lastSample * 0.2609148);
+	}
+	if (*wasNegClip == true) { // current will be -over
+		if (inputSample > *lastSample) *lastSample = -0.7058208 + (inputSample * 0.2609148);
+		else *lastSample = -0.2491717 + (*lastSample * 0.7390851);
+	}
+	*wasNegClip = false;
+	if (inputSample < -0.9549925859) {
+		*wasNegClip = true;
+		inputSample = -0.7058208 + (*lastSample * 0.2609148);
+	}
+	intermediate[spacing] = inputSample;
+	inputSample = *lastSample; // Latency is however many samples equals one 44.1k sample
+	for (int x = spacing; x > 0; x--) intermediate[x - 1] = intermediate[x];
+	*lastSample = intermediate[0]; // run a little buffer to handle this
+	return inputSample;
+}
+
 static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	ClipOnly2* clipOnly2 = (ClipOnly2*) instance;
@@ -84,71 +129,14 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = clipOnly2->output[0];
 	float* out2 = clipOnly2->output[1];
 
-	double overallscale = 1.0;
-	overallscale /= 44100.0;
-	overallscale *= clipOnly2->sampleRate;
-
-	int spacing = floor(overallscale); // should give us working basic scaling, usually 2 or 4
-	if (spacing < 1) spacing = 1;
-	if (spacing > 16) spacing = 16;
+	const int spacing = get_spacing(clipOnly2);
 
 	while (sampleFrames-- > 0) {
-		float inputSampleL = *in1;
-		float inputSampleR = *in2;
-
-		// begin ClipOnly2 stereo as a little, compressed chunk that can be dropped into code
-		if (inputSampleL > 4.0) inputSampleL = 4.0;
-		if (inputSampleL < -4.0) inputSampleL = -4.0;
-		if (clipOnly2->wasPosClipL == true) { // current will be over
-			if (inputSampleL < clipOnly2->lastSampleL) clipOnly2->lastSampleL = 0.7058208 + (inputSampleL * 0.2609148);
-			else clipOnly2->lastSampleL = 0.2491717 + (clipOnly2->lastSampleL * 0.7390851);
-		}
-		clipOnly2->wasPosClipL = false;
-		if (inputSampleL > 0.9549925859) {
-			clipOnly2->wasPosClipL = true;
-			inputSampleL = 0.7058208 + (clipOnly2->lastSampleL * 0.2609148);
-		}
-		if (clipOnly2->wasNegClipL == true) { // current will be -over
-			if (inputSampleL > clipOnly2->lastSampleL) clipOnly2->lastSampleL = -0.7058208 + (inputSampleL * 0.2609148);
-			else clipOnly2->lastSampleL = -0.2491717 + (clipOnly2->lastSampleL * 0.7390851);
-		}
-		clipOnly2->wasNegClipL = false;
-		if (inputSampleL < -0.9549925859) {
-			clipOnly2->wasNegClipL = true;
-			inputSampleL = -0.7058208 + (clipOnly2->lastSampleL * 0.2609148);
-		}
-		clipOnly2->intermediateL[spacing] = inputSampleL;
-		inputSampleL = clipOnly2->lastSampleL; // Latency is however many samples equals one 44.1k sample
-		for (int x = spacing; x > 0; x--) clipOnly2->intermediateL[x - 1] = clipOnly2->intermediateL[x];
-		clipOnly2->lastSampleL = clipOnly2->intermediateL[0]; // run a little buffer to handle this
-
-		if (inputSampleR > 4.0) inputSampleR = 4.0;
-		if (inputSampleR < -4.0) inputSampleR = -4.0;
-		if (clipOnly2->wasPosClipR == true) { // current will be over
-			if (inputSampleR < clipOnly2->lastSampleR) clipOnly2->lastSampleR = 0.7058208 + (inputSampleR * 0.2609148);
-			else clipOnly2->lastSampleR = 0.2491717 + (clipOnly2->lastSampleR * 0.7390851);
-		}
-		clipOnly2->wasPosClipR = false;
-		if (inputSampleR > 0.9549925859) {
-			clipOnly2->wasPosClipR = true;
-			inputSampleR = 0.7058208 + (clipOnly2->lastSampleR * 0.2609148);
-		}
-		if (clipOnly2->wasNegClipR == true) { // current will be -over
-			if (inputSampleR > clipOnly2->lastSampleR) clipOnly2->lastSampleR = -0.7058208 + (inputSampleR * 0.2609148);
-			else clipOnly2->lastSampleR = -0.2491717 + (clipOnly2->lastSampleR * 0.7390851);
-		}
-		clipOnly2->wasNegClipR = false;
-		if (inputSampleR < -0.9549925859) {
-			clipOnly2->wasNegClipR = true;
-			inputSampleR = -0.7058208 + (clipOnly2->lastSampleR * 0.2609148);
-		}
-		clipOnly2->intermediateR[spacing] = inputSampleR;
-		inputSampleR = clipOnly2->lastSampleR; // Latency is however many samples equals one 44.1k sample
-		for (int x = spacing; x > 0; x--) clipOnly2->intermediateR[x - 1] = clipOnly2->intermediateR[x];
-		clipOnly2->lastSampleR = clipOnly2->intermediateR[0]; // run a little buffer to handle this
-
-		*out1 = inputSampleL;
-		*out2 = inputSampleR;
+		const float inputSampleL = *in1;
+		const float inputSampleR = *in2;
+
+		*out1 = clip_only2(inputSampleL, &clipOnly2->lastSampleL, clipOnly2->intermediateL, &clipOnly2->wasPosClipL, &clipOnly2->wasNegClipL, spacing);
+		*out2 = clip_only2(inputSampleR, &clipOnly2->lastSampleR, clipOnly2->intermediateR, &clipOnly2->wasPosClipR, &clipOnly2->wasNegClipR, spacing);
 
 		in1++;
 		in2++;
@@ -157,6 +145,18 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	}
 }
 
+// There is no dither, the samples come out as floats anyway
+static void process(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	ClipOnly2* clipOnly2 = (ClipOnly2*) instance;
+	const int spacing = get_spacing(clipOnly2);
+
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		samples[0][i] = clip_only2((float) samples[0][i], &clipOnly2->lastSampleL, clipOnly2->intermediateL, &clipOnly2->wasPosClipL, &clipOnly2->wasNegClipL, spacing);
+		samples[1][i] = clip_only2((float) samples[1][i], &clipOnly2->lastSampleR, clipOnly2->intermediateR, &clipOnly2->wasPosClipR, &clipOnly2->wasNegClipR, spacing);
+	}
+}
+
 static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
@@ -166,7 +166,8 @@ static void cleanup(LV2_Handle instance)
 
 static const void* extension_data(const char* uri)
 {
-	return NULL;
+	static const AirwindowsFused fused = {process};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
 }
 
 static const LV2_Descriptor descriptor = {
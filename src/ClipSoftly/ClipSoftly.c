@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CLIPSOFTLY_URI "https://hannesbraun.net/ns/lv2/airwindows/clipsoftly"
 
 typedef enum {
@@ -100,7 +102,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		else softSpeed = 1.0 / softSpeed;
 		if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 		if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-		inputSampleL = sin(inputSampleL) * 0.9549925859; // scale to what cliponly uses
+		inputSampleL = fast_sin(inputSampleL) * 0.9549925859; // scale to what cliponly uses
 		inputSampleL = (inputSampleL * softSpeed) + (clipSoftly->lastSampleL * (1.0 - softSpeed));
 
 		softSpeed = fabs(inputSampleR);
@@ -108,7 +110,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		else softSpeed = 1.0 / softSpeed;
 		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 		if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-		inputSampleR = sin(inputSampleR) * 0.9549925859; // scale to what cliponly uses
+		inputSampleR = fast_sin(inputSampleR) * 0.9549925859; // scale to what cliponly uses
 		inputSampleR = (inputSampleR * softSpeed) + (clipSoftly->lastSampleR * (1.0 - softSpeed));
 
 		clipSoftly->intermediateL[spacing] = inputSampleL;
@@ -127,12 +129,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		clipSoftly->fpdL ^= clipSoftly->fpdL << 13;
 		clipSoftly->fpdL ^= clipSoftly->fpdL >> 17;
 		clipSoftly->fpdL ^= clipSoftly->fpdL << 5;
-		inputSampleL += (((double) clipSoftly->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) clipSoftly->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		clipSoftly->fpdR ^= clipSoftly->fpdR << 13;
 		clipSoftly->fpdR ^= clipSoftly->fpdR >> 17;
 		clipSoftly->fpdR ^= clipSoftly->fpdR << 5;
-		inputSampleR += (((double) clipSoftly->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) clipSoftly->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
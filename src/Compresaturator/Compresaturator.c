@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define COMPRESATURATOR_URI "https://hannesbraun.net/ns/lv2/airwindows/compresaturator"
 
 typedef enum {
@@ -163,7 +165,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		// if our output's gone beyond saturating to distorting, we begin chasing the
 		// buffer size smaller. Anytime we don't have that, we expand (smoothest sound, only adding to an increasingly subdivided buffer)
 
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleL > 0) {
 			inputSampleL = bridgerectifier;
 			overspill = temp - bridgerectifier;
@@ -201,7 +203,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		// if our output's gone beyond saturating to distorting, we begin chasing the
 		// buffer size smaller. Anytime we don't have that, we expand (smoothest sound, only adding to an increasingly subdivided buffer)
 
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleR > 0) {
 			inputSampleR = bridgerectifier;
 			overspill = temp - bridgerectifier;
@@ -276,12 +278,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		compresaturator->fpdL ^= compresaturator->fpdL << 13;
 		compresaturator->fpdL ^= compresaturator->fpdL >> 17;
 		compresaturator->fpdL ^= compresaturator->fpdL << 5;
-		inputSampleL += (int32_t) compresaturator->fpdL * 5.960464655174751e-36L * pow(2, expon + 62);
+		inputSampleL += (int32_t) compresaturator->fpdL * 5.960464655174751e-36L * fast_pow2i(expon + 62);
 		frexpf((float) inputSampleR, &expon);
 		compresaturator->fpdR ^= compresaturator->fpdR << 13;
 		compresaturator->fpdR ^= compresaturator->fpdR >> 17;
 		compresaturator->fpdR ^= compresaturator->fpdR << 5;
-		inputSampleR += (int32_t) compresaturator->fpdR * 5.960464655174751e-36L * pow(2, expon + 62);
+		inputSampleR += (int32_t) compresaturator->fpdR * 5.960464655174751e-36L * fast_pow2i(expon + 62);
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
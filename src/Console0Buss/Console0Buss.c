@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CONSOLE0BUSS_URI "https://hannesbraun.net/ns/lv2/airwindows/console0buss"
 
 typedef enum {
@@ -267,12 +269,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		console0Buss->fpdL ^= console0Buss->fpdL << 13;
 		console0Buss->fpdL ^= console0Buss->fpdL >> 17;
 		console0Buss->fpdL ^= console0Buss->fpdL << 5;
-		inputSampleL += (((double) console0Buss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) console0Buss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		console0Buss->fpdR ^= console0Buss->fpdR << 13;
 		console0Buss->fpdR ^= console0Buss->fpdR >> 17;
 		console0Buss->fpdR ^= console0Buss->fpdR << 5;
-		inputSampleR += (((double) console0Buss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) console0Buss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CONSOLE0CHANNEL_URI "https://hannesbraun.net/ns/lv2/airwindows/console0channel"
 
 typedef enum {
@@ -267,12 +269,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		console0Channel->fpdL ^= console0Channel->fpdL << 13;
 		console0Channel->fpdL ^= console0Channel->fpdL >> 17;
 		console0Channel->fpdL ^= console0Channel->fpdL << 5;
-		inputSampleL += (((double) console0Channel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) console0Channel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		console0Channel->fpdR ^= console0Channel->fpdR << 13;
 		console0Channel->fpdR ^= console0Channel->fpdR >> 17;
 		console0Channel->fpdR ^= console0Channel->fpdR << 5;
-		inputSampleR += (((double) console0Channel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) console0Channel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CONSOLE6BUSS_URI "https://hannesbraun.net/ns/lv2/airwindows/console6buss"
 
 typedef enum {
@@ -109,12 +111,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		console6Buss->fpdL ^= console6Buss->fpdL << 13;
 		console6Buss->fpdL ^= console6Buss->fpdL >> 17;
 		console6Buss->fpdL ^= console6Buss->fpdL << 5;
-		inputSampleL += (((double) console6Buss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) console6Buss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		console6Buss->fpdR ^= console6Buss->fpdR << 13;
 		console6Buss->fpdR ^= console6Buss->fpdR >> 17;
 		console6Buss->fpdR ^= console6Buss->fpdR << 5;
-		inputSampleR += (((double) console6Buss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) console6Buss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CONSOLE6CHANNEL_URI "https://hannesbraun.net/ns/lv2/airwindows/console6channel"
 
 typedef enum {
@@ -120,12 +122,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		console6Channel->fpdL ^= console6Channel->fpdL << 13;
 		console6Channel->fpdL ^= console6Channel->fpdL >> 17;
 		console6Channel->fpdL ^= console6Channel->fpdL << 5;
-		inputSampleL += (((double) console6Channel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) console6Channel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		console6Channel->fpdR ^= console6Channel->fpdR << 13;
 		console6Channel->fpdR ^= console6Channel->fpdR >> 17;
 		console6Channel->fpdR ^= console6Channel->fpdR << 5;
-		inputSampleR += (((double) console6Channel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) console6Channel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
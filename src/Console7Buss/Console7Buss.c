@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define CONSOLE7BUSS_URI "https://hannesbraun.net/ns/lv2/airwindows/console7buss"
@@ -151,10 +153,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		if (inputSampleL > 1.0) inputSampleL = 1.0;
 		if (inputSampleL < -1.0) inputSampleL = -1.0;
-		inputSampleL = ((asin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.618033988749894848204586) + (asin(inputSampleL) * 0.381966011250105);
+		inputSampleL = ((fast_asin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.618033988749894848204586) + (fast_asin(inputSampleL) * 0.381966011250105);
 		if (inputSampleR > 1.0) inputSampleR = 1.0;
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
-		inputSampleR = ((asin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.618033988749894848204586) + (asin(inputSampleR) * 0.381966011250105);
+		inputSampleR = ((fast_asin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.618033988749894848204586) + (fast_asin(inputSampleR) * 0.381966011250105);
 		// this is an asin version of Spiral blended with regular asin ConsoleBuss.
 		// It's blending between two different harmonics in the overtones of the algorithm
 
@@ -184,12 +186,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		console7Buss->fpdL ^= console7Buss->fpdL << 13;
 		console7Buss->fpdL ^= console7Buss->fpdL >> 17;
 		console7Buss->fpdL ^= console7Buss->fpdL << 5;
-		inputSampleL += (((double) console7Buss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) console7Buss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		console7Buss->fpdR ^= console7Buss->fpdR << 13;
 		console7Buss->fpdR ^= console7Buss->fpdR >> 17;
 		console7Buss->fpdR ^= console7Buss->fpdR << 5;
-		inputSampleR += (((double) console7Buss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) console7Buss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
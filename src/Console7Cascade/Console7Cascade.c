@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define CONSOLE7CASCADE_URI "https://hannesbraun.net/ns/lv2/airwindows/console7cascade"
@@ -182,10 +184,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		}
 		if (inputSampleL > 1.097) inputSampleL = 1.097;
 		if (inputSampleL < -1.097) inputSampleL = -1.097;
-		inputSampleL = ((sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (sin(inputSampleL) * 0.2);
+		inputSampleL = ((fast_sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (fast_sin(inputSampleL) * 0.2);
 		if (inputSampleR > 1.097) inputSampleR = 1.097;
 		if (inputSampleR < -1.097) inputSampleR = -1.097;
-		inputSampleR = ((sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (sin(inputSampleR) * 0.2);
+		inputSampleR = ((fast_sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (fast_sin(inputSampleR) * 0.2);
 		// Console7Channel distortion stage, with a simpler form of the gain boost: no extra accentuation, because it's repeated 5x
 
 		outSampleL = console7Cascade->biquadB[2] * inputSampleL + console7Cascade->biquadB[3] * console7Cascade->biquadB[7] + console7Cascade->biquadB[4] * console7Cascade->biquadB[8] - console7Cascade->biquadB[5] * console7Cascade->biquadB[9] - console7Cascade->biquadB[6] * console7Cascade->biquadB[10];
@@ -207,10 +209,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		}
 		if (inputSampleL > 1.097) inputSampleL = 1.097;
 		if (inputSampleL < -1.097) inputSampleL = -1.097;
-		inputSampleL = ((sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (sin(inputSampleL) * 0.2);
+		inputSampleL = ((fast_sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (fast_sin(inputSampleL) * 0.2);
 		if (inputSampleR > 1.097) inputSampleR = 1.097;
 		if (inputSampleR < -1.097) inputSampleR = -1.097;
-		inputSampleR = ((sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (sin(inputSampleR) * 0.2);
+		inputSampleR = ((fast_sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (fast_sin(inputSampleR) * 0.2);
 		// Console7Channel distortion stage, with a simpler form of the gain boost: no extra accentuation, because it's repeated 5x
 
 		outSampleL = console7Cascade->biquadC[2] * inputSampleL + console7Cascade->biquadC[3] * console7Cascade->biquadC[7] + console7Cascade->biquadC[4] * console7Cascade->biquadC[8] - console7Cascade->biquadC[5] * console7Cascade->biquadC[9] - console7Cascade->biquadC[6] * console7Cascade->biquadC[10];
@@ -232,10 +234,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		}
 		if (inputSampleL > 1.097) inputSampleL = 1.097;
 		if (inputSampleL < -1.097) inputSampleL = -1.097;
-		inputSampleL = ((sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (sin(inputSampleL) * 0.2);
+		inputSampleL = ((fast_sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (fast_sin(inputSampleL) * 0.2);
 		if (inputSampleR > 1.097) inputSampleR = 1.097;
 		if (inputSampleR < -1.097) inputSampleR = -1.097;
-		inputSampleR = ((sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (sin(inputSampleR) * 0.2);
+		inputSampleR = ((fast_sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (fast_sin(inputSampleR) * 0.2);
 		// Console7Channel distortion stage, with a simpler form of the gain boost: no extra accentuation, because it's repeated 5x
 
 		outSampleL = console7Cascade->biquadD[2] * inputSampleL + console7Cascade->biquadD[3] * console7Cascade->biquadD[7] + console7Cascade->biquadD[4] * console7Cascade->biquadD[8] - console7Cascade->biquadD[5] * console7Cascade->biquadD[9] - console7Cascade->biquadD[6] * console7Cascade->biquadD[10];
@@ -257,10 +259,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		}
 		if (inputSampleL > 1.097) inputSampleL = 1.097;
 		if (inputSampleL < -1.097) inputSampleL = -1.097;
-		inputSampleL = ((sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (sin(inputSampleL) * 0.2);
+		inputSampleL = ((fast_sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (fast_sin(inputSampleL) * 0.2);
 		if (inputSampleR > 1.097) inputSampleR = 1.097;
 		if (inputSampleR < -1.097) inputSampleR = -1.097;
-		inputSampleR = ((sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (sin(inputSampleR) * 0.2);
+		inputSampleR = ((fast_sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (fast_sin(inputSampleR) * 0.2);
 		// Console7Channel distortion stage, with a simpler form of the gain boost: no extra accentuation, because it's repeated 5x
 
 		outSampleL = console7Cascade->biquadE[2] * inputSampleL + console7Cascade->biquadE[3] * console7Cascade->biquadE[7] + console7Cascade->biquadE[4] * console7Cascade->biquadE[8] - console7Cascade->biquadE[5] * console7Cascade->biquadE[9] - console7Cascade->biquadE[6] * console7Cascade->biquadE[10];
@@ -282,10 +284,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		}
 		if (inputSampleL > 1.097) inputSampleL = 1.097;
 		if (inputSampleL < -1.097) inputSampleL = -1.097;
-		inputSampleL = ((sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (sin(inputSampleL) * 0.2);
+		inputSampleL = ((fast_sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (fast_sin(inputSampleL) * 0.2);
 		if (inputSampleR > 1.097) inputSampleR = 1.097;
 		if (inputSampleR < -1.097) inputSampleR = -1.097;
-		inputSampleR = ((sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (sin(inputSampleR) * 0.2);
+		inputSampleR = ((fast_sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (fast_sin(inputSampleR) * 0.2);
 		// Console7Channel distortion stage, with a simpler form of the gain boost: no extra accentuation, because it's repeated 5x
 
 		if (cascade > 1.0) {
@@ -300,12 +302,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		console7Cascade->fpdL ^= console7Cascade->fpdL << 13;
 		console7Cascade->fpdL ^= console7Cascade->fpdL >> 17;
 		console7Cascade->fpdL ^= console7Cascade->fpdL << 5;
-		inputSampleL += (((double) console7Cascade->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) console7Cascade->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		console7Cascade->fpdR ^= console7Cascade->fpdR << 13;
 		console7Cascade->fpdR ^= console7Cascade->fpdR >> 17;
 		console7Cascade->fpdR ^= console7Cascade->fpdR << 5;
-		inputSampleR += (((double) console7Cascade->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) console7Cascade->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -3,10 +3,15 @@
 #include <math.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include "../common/fastmath.h"
+#include "../common/fused.h"
 
 #define M_PI 3.14159265358979323846264338327950288
 
 #define CONSOLE7CHANNEL_URI "https://hannesbraun.net/ns/lv2/airwindows/console7channel"
+#define CONSOLE7CHANNELMONO_URI "https://hannesbraun.net/ns/lv2/airwindows/console7channelmono"
 
 typedef enum {
 	INPUT_L = 0,
@@ -25,10 +30,9 @@ typedef struct {
 	double gainchase;
 	double chasespeed;
 
-	double biquadA[15];
+	double biquadA[15]; // the coefficients, then x1, x2, y1 and y2 of each channel
 
-	uint32_t fpdL;
-	uint32_t fpdR;
+	uint32_t fpd[2];
 } Console7Channel;
 
 static LV2_Handle instantiate(
@@ -65,6 +69,20 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 	}
 }
 
+// The mono variant has one input and one output, its controls follow at 2
+static void connect_port_mono(LV2_Handle instance, uint32_t port, void* data)
+{
+	Console7Channel* console7Channel = (Console7Channel*) instance;
+
+	if (port == 0) {
+		console7Channel->input[0] = (const float*) data;
+	} else if (port == 1) {
+		console7Channel->output[0] = (float*) data;
+	} else {
+		connect_port(instance, port + 2, data);
+	}
+}
+
 static void activate(LV2_Handle instance)
 {
 	Console7Channel* console7Channel = (Console7Channel*) instance;
@@ -73,21 +91,17 @@ static void activate(LV2_Handle instance)
 	for (int x = 0; x < 15; x++) {
 		console7Channel->biquadA[x] = 0.0;
 	}
-	console7Channel->fpdL = 1.0;
-	while (console7Channel->fpdL < 16386) console7Channel->fpdL = rand() * UINT32_MAX;
-	console7Channel->fpdR = 1.0;
-	while (console7Channel->fpdR < 16386) console7Channel->fpdR = rand() * UINT32_MAX;
+	for (int c = 0; c < 2; c++) {
+		console7Channel->fpd[c] = 1.0;
+		while (console7Channel->fpd[c] < 16386) console7Channel->fpd[c] = rand() * UINT32_MAX;
+	}
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+// Processes the first `channels` inputs into the outputs, or the samples in
+// place for process(). The fader chase is shared, the biquad state and the
+// dither are per channel.
+static inline void run_channels(Console7Channel* console7Channel, uint32_t sampleFrames, const int channels, double* const* samples, const bool dither)
 {
-	Console7Channel* console7Channel = (Console7Channel*) instance;
-
-	const float* in1 = console7Channel->input[0];
-	const float* in2 = console7Channel->input[1];
-	float* out1 = console7Channel->output[0];
-	float* out2 = console7Channel->output[1];
-
 	double inputgain = *console7Channel->fader * 1.272019649514069;
 	// which is, in fact, the square root of 1.618033988749894848204586...
 	// this happens to give us a boost factor where the track continues to get louder even
@@ -97,36 +111,33 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	if (console7Channel->chasespeed > sampleFrames) console7Channel->chasespeed = sampleFrames;
 	if (console7Channel->gainchase < 0.0) console7Channel->gainchase = inputgain;
 
-	console7Channel->biquadA[0] = 20000.0 / console7Channel->sampleRate;
-	console7Channel->biquadA[1] = 1.618033988749894848204586;
-
-	double K = tan(M_PI * console7Channel->biquadA[0]); // lowpass
-	double norm = 1.0 / (1.0 + K / console7Channel->biquadA[1] + K * K);
-	console7Channel->biquadA[2] = K * K * norm;
-	console7Channel->biquadA[3] = 2.0 * console7Channel->biquadA[2];
-	console7Channel->biquadA[4] = console7Channel->biquadA[2];
-	console7Channel->biquadA[5] = 2.0 * (K * K - 1.0) * norm;
-	console7Channel->biquadA[6] = (1.0 - K / console7Channel->biquadA[1] + K * K) * norm;
-
-	while (sampleFrames-- > 0) {
-		double inputSampleL = *in1;
-		double inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = console7Channel->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = console7Channel->fpdR * 1.18e-17;
-
-		double outSampleL = console7Channel->biquadA[2] * inputSampleL + console7Channel->biquadA[3] * console7Channel->biquadA[7] + console7Channel->biquadA[4] * console7Channel->biquadA[8] - console7Channel->biquadA[5] * console7Channel->biquadA[9] - console7Channel->biquadA[6] * console7Channel->biquadA[10];
-		console7Channel->biquadA[8] = console7Channel->biquadA[7];
-		console7Channel->biquadA[7] = inputSampleL;
-		inputSampleL = outSampleL;
-		console7Channel->biquadA[10] = console7Channel->biquadA[9];
-		console7Channel->biquadA[9] = inputSampleL; // DF1 left
-
-		double outSampleR = console7Channel->biquadA[2] * inputSampleR + console7Channel->biquadA[3] * console7Channel->biquadA[11] + console7Channel->biquadA[4] * console7Channel->biquadA[12] - console7Channel->biquadA[5] * console7Channel->biquadA[13] - console7Channel->biquadA[6] * console7Channel->biquadA[14];
-		console7Channel->biquadA[12] = console7Channel->biquadA[11];
-		console7Channel->biquadA[11] = inputSampleR;
-		inputSampleR = outSampleR;
-		console7Channel->biquadA[14] = console7Channel->biquadA[13];
-		console7Channel->biquadA[13] = inputSampleR; // DF1 right
+	double* biquadA = console7Channel->biquadA;
+	biquadA[0] = 20000.0 / console7Channel->sampleRate;
+	biquadA[1] = 1.618033988749894848204586;
+
+	double K = tan(M_PI * biquadA[0]); // lowpass
+	double norm = 1.0 / (1.0 + K / biquadA[1] + K * K);
+	biquadA[2] = K * K * norm;
+	biquadA[3] = 2.0 * biquadA[2];
+	biquadA[4] = biquadA[2];
+	biquadA[5] = 2.0 * (K * K - 1.0) * norm;
+	biquadA[6] = (1.0 - K / biquadA[1] + K * K) * norm;
+
+	double inputSample[2];
+
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		for (int c = 0; c < channels; c++) {
+			inputSample[c] = samples ? samples[c][i] : console7Channel->input[c][i];
+			if (fabs(inputSample[c]) < 1.18e-23) inputSample[c] = console7Channel->fpd[c] * 1.18e-17;
+
+			double* state = biquadA + 7 + 4 * c;
+			double outSample = biquadA[2] * inputSample[c] + biquadA[3] * state[0] + biquadA[4] * state[1] - biquadA[5] * state[2] - biquadA[6] * state[3];
+			state[1] = state[0];
+			state[0] = inputSample[c];
+			inputSample[c] = outSample;
+			state[3] = state[2];
+			state[2] = inputSample[c]; // DF1
+		}
 
 		console7Channel->chasespeed *= 0.9999;
 		console7Channel->chasespeed -= 0.01;
@@ -135,52 +146,54 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		console7Channel->gainchase = (((console7Channel->gainchase * console7Channel->chasespeed) + inputgain) / (console7Channel->chasespeed + 1.0));
 		// gainchase is chasing the target, as a simple multiply gain factor
 		if (1.0 != console7Channel->gainchase) {
-			inputSampleL *= pow(console7Channel->gainchase, 3);
-			inputSampleR *= pow(console7Channel->gainchase, 3);
+			double trim = pow(console7Channel->gainchase, 3);
+			for (int c = 0; c < channels; c++) inputSample[c] *= trim;
 		}
 		// this trim control cuts back extra hard because we will amplify after the distortion
 		// that will shift the distortion/antidistortion curve, in order to make faded settings
 		// slightly 'expanded' and fall back in the soundstage, subtly
 
-		if (inputSampleL > 1.097) inputSampleL = 1.097;
-		if (inputSampleL < -1.097) inputSampleL = -1.097;
-		inputSampleL = ((sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (sin(inputSampleL) * 0.2);
-		if (inputSampleR > 1.097) inputSampleR = 1.097;
-		if (inputSampleR < -1.097) inputSampleR = -1.097;
-		inputSampleR = ((sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (sin(inputSampleR) * 0.2);
+		for (int c = 0; c < channels; c++) {
+			if (inputSample[c] > 1.097) inputSample[c] = 1.097;
+			if (inputSample[c] < -1.097) inputSample[c] = -1.097;
+			inputSample[c] = ((fast_sin(inputSample[c] * fabs(inputSample[c])) / ((fabs(inputSample[c]) == 0.0) ? 1 : fabs(inputSample[c]))) * 0.8) + (fast_sin(inputSample[c]) * 0.2);
+		}
 		// this is a version of Spiral blended 80/20 with regular Density ConsoleChannel.
 		// It's blending between two different harmonics in the overtones of the algorithm
 
 		if (1.0 != console7Channel->gainchase && 0.0 != console7Channel->gainchase) {
-			inputSampleL /= console7Channel->gainchase;
-			inputSampleR /= console7Channel->gainchase;
+			for (int c = 0; c < channels; c++) inputSample[c] /= console7Channel->gainchase;
 		}
 		// we re-amplify after the distortion relative to how much we cut back previously.
 
-		// begin 32 bit stereo floating point dither
-		int expon;
-		frexpf((float) inputSampleL, &expon);
-		console7Channel->fpdL ^= console7Channel->fpdL << 13;
-		console7Channel->fpdL ^= console7Channel->fpdL >> 17;
-		console7Channel->fpdL ^= console7Channel->fpdL << 5;
-		inputSampleL += (((double) console7Channel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		frexpf((float) inputSampleR, &expon);
-		console7Channel->fpdR ^= console7Channel->fpdR << 13;
-		console7Channel->fpdR ^= console7Channel->fpdR >> 17;
-		console7Channel->fpdR ^= console7Channel->fpdR << 5;
-		inputSampleR += (((double) console7Channel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		// end 32 bit stereo floating point dither
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+		// begin 32 bit floating point dither
+		for (int c = 0; c < channels; c++) {
+			int expon;
+			frexpf((float) inputSample[c], &expon);
+			console7Channel->fpd[c] ^= console7Channel->fpd[c] << 13;
+			console7Channel->fpd[c] ^= console7Channel->fpd[c] >> 17;
+			console7Channel->fpd[c] ^= console7Channel->fpd[c] << 5;
+			if (dither) inputSample[c] += (((double) console7Channel->fpd[c] - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+		}
+		// end 32 bit floating point dither
+
+		for (int c = 0; c < channels; c++) {
+			if (samples) samples[c][i] = inputSample[c];
+			else console7Channel->output[c][i] = (float) inputSample[c];
+		}
 	}
 }
 
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Console7Channel*) instance, sampleFrames, 2, NULL, true);
+}
+
+static void run_mono(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Console7Channel*) instance, sampleFrames, 1, NULL, true);
+}
+
 static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
@@ -188,22 +201,47 @@ static void cleanup(LV2_Handle instance)
 	free(instance);
 }
 
+static void process(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_channels((Console7Channel*) instance, sampleFrames, 2, samples, dither);
+}
+
+static void process_mono(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_channels((Console7Channel*) instance, sampleFrames, 1, samples, dither);
+}
+
 static const void* extension_data(const char* uri)
 {
-	return NULL;
+	static const AirwindowsFused fused = {process};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const void* extension_data_mono(const char* uri)
+{
+	static const AirwindowsFused fused = {process_mono};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
 }
 
-static const LV2_Descriptor descriptor = {
-	CONSOLE7CHANNEL_URI,
-	instantiate,
-	connect_port,
-	activate,
-	run,
-	deactivate,
-	cleanup,
-	extension_data};
+static const LV2_Descriptor descriptors[] = {
+	{CONSOLE7CHANNEL_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{CONSOLE7CHANNELMONO_URI,
+	 instantiate,
+	 connect_port_mono,
+	 activate,
+	 run_mono,
+	 deactivate,
+	 cleanup,
+	 extension_data_mono}};
 
 LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
 {
-	return index == 0 ? &descriptor : NULL;
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
 }
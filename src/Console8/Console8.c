@@ -0,0 +1,719 @@
+#include <lv2/core/lv2.h>
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../common/fastmath.h"
+#include "../common/fused.h"
+
+#define M_PI 3.14159265358979323846264338327950288
+
+#define CONSOLE8BUSSHYPE_URI "https://hannesbraun.net/ns/lv2/airwindows/console8busshype"
+#define CONSOLE8BUSSIN_URI "https://hannesbraun.net/ns/lv2/airwindows/console8bussin"
+#define CONSOLE8BUSSOUT_URI "https://hannesbraun.net/ns/lv2/airwindows/console8bussout"
+#define CONSOLE8CHANNELHYPE_URI "https://hannesbraun.net/ns/lv2/airwindows/console8channelhype"
+#define CONSOLE8CHANNELIN_URI "https://hannesbraun.net/ns/lv2/airwindows/console8channelin"
+#define CONSOLE8CHANNELOUT_URI "https://hannesbraun.net/ns/lv2/airwindows/console8channelout"
+#define CONSOLE8SUBHYPE_URI "https://hannesbraun.net/ns/lv2/airwindows/console8subhype"
+#define CONSOLE8SUBIN_URI "https://hannesbraun.net/ns/lv2/airwindows/console8subin"
+#define CONSOLE8SUBOUT_URI "https://hannesbraun.net/ns/lv2/airwindows/console8subout"
+
+// Console8 In, Out and Hype for channels, submixes and the buss all run on the
+// same engine. Each plugin is a run() entry point passing its voicing as
+// constants into one of the static inline stages below, so every variant is
+// still compiled with its own immediate coefficients. Their process() entry
+// points for fused chains (see fused.h) pass the same voicings.
+
+typedef enum {
+	INPUT_L = 0,
+	INPUT_R = 1,
+	OUTPUT_L = 2,
+	OUTPUT_R = 3,
+	FADER = 4 // Out variants only
+} PortIndex;
+
+enum {
+	fix_freq,
+	fix_reso,
+	fix_a0,
+	fix_a1,
+	fix_a2,
+	fix_b1,
+	fix_b2,
+	fix_sL1,
+	fix_sL2,
+	fix_sR1,
+	fix_sR2,
+	fix_total
+}; // fixed frequency biquad filter for ultrasonics, stereo
+
+typedef struct {
+	double sampleRate;
+	const float* input[2];
+	float* output[2];
+	const float* fader;
+
+	// In, Hype
+	double iirAL;
+	double iirBL;
+	double iirAR;
+	double iirBR;
+	double softL[11];
+	double softR[11];
+	int cycleEnd;
+
+	// Out
+	double inTrimA;
+	double inTrimB;
+
+	// BussOut
+	double lastSampleL;
+	double intermediateL[18];
+	bool wasPosClipL;
+	bool wasNegClipL; // ClipOnly2
+
+	double lastSampleR;
+	double intermediateR[18];
+	bool wasPosClipR;
+	bool wasNegClipR;
+
+	int spacing;
+
+	bool hsr;
+	double fix[fix_total];
+	uint32_t fpdL;
+	uint32_t fpdR;
+} Console8;
+
+static LV2_Handle instantiate(
+	const LV2_Descriptor* descriptor,
+	double rate,
+	const char* bundle_path,
+	const LV2_Feature* const* features)
+{
+	Console8* console8 = (Console8*) calloc(1, sizeof(Console8));
+	console8->sampleRate = rate;
+	return (LV2_Handle) console8;
+}
+
+static void connect_port(LV2_Handle instance, uint32_t port, void* data)
+{
+	Console8* console8 = (Console8*) instance;
+
+	switch ((PortIndex) port) {
+		case INPUT_L:
+			console8->input[0] = (const float*) data;
+			break;
+		case INPUT_R:
+			console8->input[1] = (const float*) data;
+			break;
+		case OUTPUT_L:
+			console8->output[0] = (float*) data;
+			break;
+		case OUTPUT_R:
+			console8->output[1] = (float*) data;
+			break;
+		case FADER:
+			console8->fader = (const float*) data;
+			break;
+	}
+}
+
+static void activate(LV2_Handle instance)
+{
+	Console8* console8 = (Console8*) instance;
+
+	console8->iirAL = 0.0;
+	console8->iirBL = 0.0;
+	console8->iirAR = 0.0;
+	console8->iirBR = 0.0;
+	for (int x = 0; x < 10; x++) {
+		console8->softL[x] = 0.0;
+		console8->softR[x] = 0.0;
+	}
+	console8->inTrimA = 0.5;
+	console8->inTrimB = 0.5;
+	for (int x = 0; x < fix_total; x++) console8->fix[x] = 0.0;
+	console8->lastSampleL = 0.0;
+	console8->wasPosClipL = false;
+	console8->wasNegClipL = false;
+	console8->lastSampleR = 0.0;
+	console8->wasPosClipR = false;
+	console8->wasNegClipR = false;
+	for (int x = 0; x < 17; x++) {
+		console8->intermediateL[x] = 0.0;
+		console8->intermediateR[x] = 0.0;
+	} // ADClip2
+
+	console8->fpdL = 1.0;
+	while (console8->fpdL < 16386) console8->fpdL = rand() * UINT32_MAX;
+	console8->fpdR = 1.0;
+	while (console8->fpdR < 16386) console8->fpdR = rand() * UINT32_MAX;
+}
+
+static inline void setup_fix(Console8* console8, double reso)
+{
+	const double sampleRate = console8->sampleRate;
+
+	if (sampleRate > 49000.0) console8->hsr = true;
+	else console8->hsr = false;
+	console8->fix[fix_freq] = 24000.0 / sampleRate;
+	console8->fix[fix_reso] = reso;
+	double K = tan(M_PI * console8->fix[fix_freq]); // lowpass
+	double norm = 1.0 / (1.0 + K / console8->fix[fix_reso] + K * K);
+	console8->fix[fix_a0] = K * K * norm;
+	console8->fix[fix_a1] = 2.0 * console8->fix[fix_a0];
+	console8->fix[fix_a2] = console8->fix[fix_a0];
+	console8->fix[fix_b1] = 2.0 * (K * K - 1.0) * norm;
+	console8->fix[fix_b2] = (1.0 - K / console8->fix[fix_reso] + K * K) * norm;
+	// this is the fixed biquad distributed anti-aliasing filter
+}
+
+static inline void process_fix(Console8* console8, double* inputSampleL, double* inputSampleR)
+{
+	if (console8->hsr) {
+		double outSample = (*inputSampleL * console8->fix[fix_a0]) + console8->fix[fix_sL1];
+		console8->fix[fix_sL1] = (*inputSampleL * console8->fix[fix_a1]) - (outSample * console8->fix[fix_b1]) + console8->fix[fix_sL2];
+		console8->fix[fix_sL2] = (*inputSampleL * console8->fix[fix_a2]) - (outSample * console8->fix[fix_b2]);
+		*inputSampleL = outSample;
+		outSample = (*inputSampleR * console8->fix[fix_a0]) + console8->fix[fix_sR1];
+		console8->fix[fix_sR1] = (*inputSampleR * console8->fix[fix_a1]) - (outSample * console8->fix[fix_b1]) + console8->fix[fix_sR2];
+		console8->fix[fix_sR2] = (*inputSampleR * console8->fix[fix_a2]) - (outSample * console8->fix[fix_b2]);
+		*inputSampleR = outSample;
+	} // fixed biquad filtering ultrasonics
+}
+
+static inline void setup_soft(Console8* console8)
+{
+	double overallscale = 1.0;
+	overallscale /= 44100.0;
+	overallscale *= console8->sampleRate;
+	console8->cycleEnd = floor(overallscale);
+	if (console8->cycleEnd < 1) console8->cycleEnd = 1;
+	if (console8->cycleEnd == 3) console8->cycleEnd = 4;
+	if (console8->cycleEnd > 4) console8->cycleEnd = 4;
+	// this is going to be 2 for 88.1 or 96k, 4 for 176 or 192k
+
+	if (fabs(console8->iirAL) < 1.18e-37) console8->iirAL = 0.0;
+	if (fabs(console8->iirBL) < 1.18e-37) console8->iirBL = 0.0;
+	if (fabs(console8->iirAR) < 1.18e-37) console8->iirAR = 0.0;
+	if (fabs(console8->iirBR) < 1.18e-37) console8->iirBR = 0.0;
+	// catch denormals early and only check once per buffer
+}
+
+static inline void process_highpass_and_soft(Console8* console8, double iirAmountA, double* inputSampleL, double* inputSampleR)
+{
+	console8->iirAL = (console8->iirAL * (1.0 - iirAmountA)) + (*inputSampleL * iirAmountA);
+	double iirAmountBL = fabs(console8->iirAL) + 0.00001;
+	console8->iirBL = (console8->iirBL * (1.0 - iirAmountBL)) + (console8->iirAL * iirAmountBL);
+	*inputSampleL -= console8->iirBL;
+	console8->iirAR = (console8->iirAR * (1.0 - iirAmountA)) + (*inputSampleR * iirAmountA);
+	double iirAmountBR = fabs(console8->iirAR) + 0.00001;
+	console8->iirBR = (console8->iirBR * (1.0 - iirAmountBR)) + (console8->iirAR * iirAmountBR);
+	*inputSampleR -= console8->iirBR;
+	// Console8 highpass
+	double* softL = console8->softL;
+	double* softR = console8->softR;
+	if (console8->cycleEnd == 4) {
+		softL[8] = softL[7];
+		softL[7] = softL[6];
+		softL[6] = softL[5];
+		softL[5] = softL[4];
+		softL[4] = softL[3];
+		softL[3] = softL[2];
+		softL[2] = softL[1];
+		softL[1] = softL[0];
+		softL[0] = *inputSampleL;
+		softR[8] = softR[7];
+		softR[7] = softR[6];
+		softR[6] = softR[5];
+		softR[5] = softR[4];
+		softR[4] = softR[3];
+		softR[3] = softR[2];
+		softR[2] = softR[1];
+		softR[1] = softR[0];
+		softR[0] = *inputSampleR;
+	}
+	if (console8->cycleEnd == 2) {
+		softL[8] = softL[6];
+		softL[6] = softL[4];
+		softL[4] = softL[2];
+		softL[2] = softL[0];
+		softL[0] = *inputSampleL;
+		softR[8] = softR[6];
+		softR[6] = softR[4];
+		softR[4] = softR[2];
+		softR[2] = softR[0];
+		softR[0] = *inputSampleR;
+	}
+	if (console8->cycleEnd == 1) {
+		softL[8] = softL[4];
+		softL[4] = softL[0];
+		softL[0] = *inputSampleL;
+		softR[8] = softR[4];
+		softR[4] = softR[0];
+		softR[0] = *inputSampleR;
+	}
+	softL[9] = ((softL[0] - softL[4]) - (softL[4] - softL[8]));
+	softR[9] = ((softR[0] - softR[4]) - (softR[4] - softR[8]));
+}
+
+static inline void decode(double* inputSampleL, double* inputSampleR)
+{
+	if (*inputSampleL > 1.0) *inputSampleL = 1.0;
+	if (*inputSampleL < -1.0) *inputSampleL = -1.0;
+	*inputSampleL = fast_asin(*inputSampleL); // Console8 decode
+	if (*inputSampleR > 1.0) *inputSampleR = 1.0;
+	if (*inputSampleR < -1.0) *inputSampleR = -1.0;
+	*inputSampleR = fast_asin(*inputSampleR); // Console8 decode
+}
+
+static inline void gain_stage(double inTrim, double* inputSampleL, double* inputSampleR)
+{
+	*inputSampleL *= inTrim;
+	if (*inputSampleL > 1.57079633) *inputSampleL = 1.57079633;
+	if (*inputSampleL < -1.57079633) *inputSampleL = -1.57079633;
+	*inputSampleL = fast_sin(*inputSampleL);
+	// Console8 gain stage clips at exactly 1.0 post-sin()
+	*inputSampleR *= inTrim;
+	if (*inputSampleR > 1.57079633) *inputSampleR = 1.57079633;
+	if (*inputSampleR < -1.57079633) *inputSampleR = -1.57079633;
+	*inputSampleR = fast_sin(*inputSampleR);
+	// Console8 gain stage clips at exactly 1.0 post-sin()
+}
+
+static inline void clip_only2(double* inputSample, double* lastSample, double* intermediate, bool* wasPosClip, bool* wasNegClip, int spacing)
+{
+	if (*inputSample > 4.0) *inputSample = 4.0;
+	if (*inputSample < -4.0) *inputSample = -4.0;
+	if (*wasPosClip == true) { // current will be over
+		if (*inputSample < *lastSample) *lastSample = 0.7058208 + (*inputSample * 0.2609148);
+		else *lastSample = 0.2491717 + (*lastSample * 0.7390851);
+	}
+	*wasPosClip = false;
+	if (*inputSample > 0.9549925859) {
+		*wasPosClip = true;
+		*inputSample = 0.7058208 + (*lastSample * 0.2609148);
+	}
+	if (*wasNegClip == true) { // current will be -over
+		if (*inputSample > *lastSample) *lastSample = -0.7058208 + (*inputSample * 0.2609148);
+		else *lastSample = -0.2491717 + (*lastSample * 0.7390851);
+	}
+	*wasNegClip = false;
+	if (*inputSample < -0.9549925859) {
+		*wasNegClip = true;
+		*inputSample = -0.7058208 + (*lastSample * 0.2609148);
+	}
+	intermediate[spacing] = *inputSample;
+	*inputSample = *lastSample; // Latency is however many samples equals one 44.1k sample
+	for (int x = spacing; x > 0; x--) intermediate[x - 1] = intermediate[x];
+	*lastSample = intermediate[0]; // run a little buffer to handle this
+}
+
+static inline void dither(Console8* console8, double* inputSampleL, double* inputSampleR, bool withDither)
+{
+	// begin 32 bit stereo floating point dither
+	int expon;
+	frexpf((float) *inputSampleL, &expon);
+	console8->fpdL ^= console8->fpdL << 13;
+	console8->fpdL ^= console8->fpdL >> 17;
+	console8->fpdL ^= console8->fpdL << 5;
+	if (withDither) *inputSampleL += (((double) console8->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+	frexpf((float) *inputSampleR, &expon);
+	console8->fpdR ^= console8->fpdR << 13;
+	console8->fpdR ^= console8->fpdR >> 17;
+	console8->fpdR ^= console8->fpdR << 5;
+	if (withDither) *inputSampleR += (((double) console8->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+	// end 32 bit stereo floating point dither
+}
+
+static inline void run_in(Console8* console8, uint32_t sampleFrames, double reso, double softThreshold, double softAmount, bool withDecode, double* const* samples, bool withDither)
+{
+	const float* in1 = console8->input[0];
+	const float* in2 = console8->input[1];
+	float* out1 = console8->output[0];
+	float* out2 = console8->output[1];
+	double* samplesL = samples ? samples[0] : NULL;
+	double* samplesR = samples ? samples[1] : NULL;
+
+	double iirAmountA = 12.66 / console8->sampleRate;
+	// this is our distributed unusual highpass, which is
+	// adding subtle harmonics to the really deep stuff to define it
+	setup_fix(console8, reso);
+	setup_soft(console8);
+
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		double inputSampleL = samples ? samplesL[i] : in1[i];
+		double inputSampleR = samples ? samplesR[i] : in2[i];
+		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = console8->fpdL * 1.18e-17;
+		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = console8->fpdR * 1.18e-17;
+
+		process_highpass_and_soft(console8, iirAmountA, &inputSampleL, &inputSampleR);
+		const double* softL = console8->softL;
+		const double* softR = console8->softR;
+		if (softL[9] > softThreshold) inputSampleL = softL[4] + (fabs(softL[4]) * fast_sin(softL[9] - softThreshold) * softAmount);
+		if (-softL[9] > softThreshold) inputSampleL = softL[4] - (fabs(softL[4]) * fast_sin(-softL[9] - softThreshold) * softAmount);
+		// Console8 slew soften: must be clipped or it can generate NAN out of the full system
+		if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
+		if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
+		if (softR[9] > softThreshold) inputSampleR = softR[4] + (fabs(softR[4]) * fast_sin(softR[9] - softThreshold) * softAmount);
+		if (-softR[9] > softThreshold) inputSampleR = softR[4] - (fabs(softR[4]) * fast_sin(-softR[9] - softThreshold) * softAmount);
+		// Console8 slew soften: must be clipped or it can generate NAN out of the full system
+		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
+		if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
+		process_fix(console8, &inputSampleL, &inputSampleR);
+		if (withDecode) decode(&inputSampleL, &inputSampleR);
+		// on the input channel we have direct signal, not Console8 decode:
+		// we can go directly into the first distortion stage of ChannelOut
+		// with a filtered signal, so its biquad is between stages
+
+		dither(console8, &inputSampleL, &inputSampleR, withDither);
+
+		if (samples) {
+			samplesL[i] = inputSampleL;
+			samplesR[i] = inputSampleR;
+		} else {
+			out1[i] = (float) inputSampleL;
+			out2[i] = (float) inputSampleR;
+		}
+	}
+}
+
+static inline void run_hype(Console8* console8, uint32_t sampleFrames, double reso, bool withDecode, double* const* samples, bool withDither)
+{
+	const float* in1 = console8->input[0];
+	const float* in2 = console8->input[1];
+	float* out1 = console8->output[0];
+	float* out2 = console8->output[1];
+	double* samplesL = samples ? samples[0] : NULL;
+	double* samplesR = samples ? samples[1] : NULL;
+
+	double iirAmountA = 12.66 / console8->sampleRate;
+	// this is our distributed unusual highpass, which is
+	// adding subtle harmonics to the really deep stuff to define it
+	setup_fix(console8, reso);
+	setup_soft(console8);
+
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		double inputSampleL = samples ? samplesL[i] : in1[i];
+		double inputSampleR = samples ? samplesR[i] : in2[i];
+		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = console8->fpdL * 1.18e-17;
+		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = console8->fpdR * 1.18e-17;
+
+		process_highpass_and_soft(console8, iirAmountA, &inputSampleL, &inputSampleR);
+		double* softL = console8->softL;
+		double* softR = console8->softR;
+		if (softL[9] < -1.57079633) softL[9] = -1.57079633;
+		if (softL[9] > 1.57079633) softL[9] = 1.57079633;
+		inputSampleL = softL[8] + (fast_sin(softL[9]) * 0.61803398);
+		if (softR[9] < -1.57079633) softR[9] = -1.57079633;
+		if (softR[9] > 1.57079633) softR[9] = 1.57079633;
+		inputSampleR = softR[8] + (fast_sin(softR[9]) * 0.61803398);
+		// treble softening effect ended up being an aural exciter
+
+		process_fix(console8, &inputSampleL, &inputSampleR);
+		if (withDecode) decode(&inputSampleL, &inputSampleR);
+
+		dither(console8, &inputSampleL, &inputSampleR, withDither);
+
+		if (samples) {
+			samplesL[i] = inputSampleL;
+			samplesR[i] = inputSampleR;
+		} else {
+			out1[i] = (float) inputSampleL;
+			out2[i] = (float) inputSampleR;
+		}
+	}
+}
+
+static inline void run_out(Console8* console8, uint32_t sampleFrames, double reso, bool withClipOnly2, double* const* samples, bool withDither)
+{
+	const float* in1 = console8->input[0];
+	const float* in2 = console8->input[1];
+	float* out1 = console8->output[0];
+	float* out2 = console8->output[1];
+	double* samplesL = samples ? samples[0] : NULL;
+	double* samplesR = samples ? samples[1] : NULL;
+
+	console8->inTrimA = console8->inTrimB;
+	console8->inTrimB = *console8->fader * 2.0;
+	// 0.5 is unity gain, and we can attenuate to silence or boost slightly over 12dB
+	// into softclipping overdrive.
+	setup_fix(console8, reso);
+	if (withClipOnly2) {
+		double overallscale = 1.0;
+		overallscale /= 44100.0;
+		overallscale *= console8->sampleRate;
+		console8->spacing = floor(overallscale); // should give us working basic scaling, usually 2 or 4
+		if (console8->spacing < 1) console8->spacing = 1;
+		if (console8->spacing > 16) console8->spacing = 16;
+	}
+
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		double inputSampleL = samples ? samplesL[i] : in1[i];
+		double inputSampleR = samples ? samplesR[i] : in2[i];
+		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = console8->fpdL * 1.18e-17;
+		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = console8->fpdR * 1.18e-17;
+
+		double position = (double) (sampleFrames - 1 - i) / sampleFrames;
+		double inTrim = (console8->inTrimA * position) + (console8->inTrimB * (1.0 - position));
+		// input trim smoothed to cut out zipper noise
+		gain_stage(inTrim, &inputSampleL, &inputSampleR);
+		process_fix(console8, &inputSampleL, &inputSampleR);
+		if (withClipOnly2) {
+			inputSampleL *= inTrim;
+			inputSampleR *= inTrim;
+			// the final output fader, before ClipOnly2 and dithering
+
+			// begin ClipOnly2 stereo as a little, compressed chunk that can be dropped into code
+			clip_only2(&inputSampleL, &console8->lastSampleL, console8->intermediateL, &console8->wasPosClipL, &console8->wasNegClipL, console8->spacing);
+			clip_only2(&inputSampleR, &console8->lastSampleR, console8->intermediateR, &console8->wasPosClipR, &console8->wasNegClipR, console8->spacing);
+			// end ClipOnly2 stereo as a little, compressed chunk that can be dropped into code
+		} else {
+			gain_stage(inTrim, &inputSampleL, &inputSampleR);
+		}
+
+		dither(console8, &inputSampleL, &inputSampleR, withDither);
+
+		if (samples) {
+			samplesL[i] = inputSampleL;
+			samplesR[i] = inputSampleR;
+		} else {
+			out1[i] = (float) inputSampleL;
+			out2[i] = (float) inputSampleR;
+		}
+	}
+}
+
+static void run_buss_hype(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_hype((Console8*) instance, sampleFrames, 0.5, true, NULL, true);
+}
+
+static void run_buss_in(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_in((Console8*) instance, sampleFrames, 0.5, 0.56852180, 0.4314782, true, NULL, true);
+}
+
+static void run_buss_out(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_out((Console8*) instance, sampleFrames, 0.52110856, true, NULL, true);
+}
+
+static void run_channel_hype(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_hype((Console8*) instance, sampleFrames, 0.76352112, false, NULL, true);
+}
+
+static void run_channel_in(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_in((Console8*) instance, sampleFrames, 0.76352112, 0.91416342, 0.08583658, false, NULL, true);
+}
+
+static void run_channel_out(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_out((Console8*) instance, sampleFrames, 3.51333709, false, NULL, true);
+}
+
+static void run_sub_hype(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_hype((Console8*) instance, sampleFrames, 0.59435114, true, NULL, true);
+}
+
+static void run_sub_in(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_in((Console8*) instance, sampleFrames, 0.59435114, 0.73824539, 0.26175461, true, NULL, true);
+}
+
+static void run_sub_out(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_out((Console8*) instance, sampleFrames, 1.20361562, false, NULL, true);
+}
+
+static void process_buss_hype(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_hype((Console8*) instance, sampleFrames, 0.5, true, samples, dither);
+}
+
+static void process_buss_in(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_in((Console8*) instance, sampleFrames, 0.5, 0.56852180, 0.4314782, true, samples, dither);
+}
+
+static void process_buss_out(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_out((Console8*) instance, sampleFrames, 0.52110856, true, samples, dither);
+}
+
+static void process_channel_hype(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_hype((Console8*) instance, sampleFrames, 0.76352112, false, samples, dither);
+}
+
+static void process_channel_in(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_in((Console8*) instance, sampleFrames, 0.76352112, 0.91416342, 0.08583658, false, samples, dither);
+}
+
+static void process_channel_out(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_out((Console8*) instance, sampleFrames, 3.51333709, false, samples, dither);
+}
+
+static void process_sub_hype(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_hype((Console8*) instance, sampleFrames, 0.59435114, true, samples, dither);
+}
+
+static void process_sub_in(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_in((Console8*) instance, sampleFrames, 0.59435114, 0.73824539, 0.26175461, true, samples, dither);
+}
+
+static void process_sub_out(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_out((Console8*) instance, sampleFrames, 1.20361562, false, samples, dither);
+}
+
+static void deactivate(LV2_Handle instance) {}
+
+static void cleanup(LV2_Handle instance)
+{
+	free(instance);
+}
+
+static const void* extension_data_buss_hype(const char* uri)
+{
+	static const AirwindowsFused fused = {process_buss_hype};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const void* extension_data_buss_in(const char* uri)
+{
+	static const AirwindowsFused fused = {process_buss_in};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const void* extension_data_buss_out(const char* uri)
+{
+	static const AirwindowsFused fused = {process_buss_out};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const void* extension_data_channel_hype(const char* uri)
+{
+	static const AirwindowsFused fused = {process_channel_hype};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const void* extension_data_channel_in(const char* uri)
+{
+	static const AirwindowsFused fused = {process_channel_in};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const void* extension_data_channel_out(const char* uri)
+{
+	static const AirwindowsFused fused = {process_channel_out};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const void* extension_data_sub_hype(const char* uri)
+{
+	static const AirwindowsFused fused = {process_sub_hype};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const void* extension_data_sub_in(const char* uri)
+{
+	static const AirwindowsFused fused = {process_sub_in};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const void* extension_data_sub_out(const char* uri)
+{
+	static const AirwindowsFused fused = {process_sub_out};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const LV2_Descriptor descriptors[] = {
+	{CONSOLE8BUSSHYPE_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_buss_hype,
+	 deactivate,
+	 cleanup,
+	 extension_data_buss_hype},
+	{CONSOLE8BUSSIN_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_buss_in,
+	 deactivate,
+	 cleanup,
+	 extension_data_buss_in},
+	{CONSOLE8BUSSOUT_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_buss_out,
+	 deactivate,
+	 cleanup,
+	 extension_data_buss_out},
+	{CONSOLE8CHANNELHYPE_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_channel_hype,
+	 deactivate,
+	 cleanup,
+	 extension_data_channel_hype},
+	{CONSOLE8CHANNELIN_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_channel_in,
+	 deactivate,
+	 cleanup,
+	 extension_data_channel_in},
+	{CONSOLE8CHANNELOUT_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_channel_out,
+	 deactivate,
+	 cleanup,
+	 extension_data_channel_out},
+	{CONSOLE8SUBHYPE_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_sub_hype,
+	 deactivate,
+	 cleanup,
+	 extension_data_sub_hype},
+	{CONSOLE8SUBIN_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_sub_in,
+	 deactivate,
+	 cleanup,
+	 extension_data_sub_in},
+	{CONSOLE8SUBOUT_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_sub_out,
+	 deactivate,
+	 cleanup,
+	 extension_data_sub_out}};
+
+LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
+{
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
+}
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define CONSOLE8LITEBUSS_URI "https://hannesbraun.net/ns/lv2/airwindows/console8litebuss"
@@ -257,14 +259,14 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			console8LiteBuss->softR[0] = inputSampleR;
 		}
 		console8LiteBuss->softL[9] = ((console8LiteBuss->softL[0] - console8LiteBuss->softL[4]) - (console8LiteBuss->softL[4] - console8LiteBuss->softL[8]));
-		if (console8LiteBuss->softL[9] > 0.56852180) inputSampleL = console8LiteBuss->softL[4] + (fabs(console8LiteBuss->softL[4]) * sin(console8LiteBuss->softL[9] - 0.56852180) * 0.4314782);
-		if (-console8LiteBuss->softL[9] > 0.56852180) inputSampleL = console8LiteBuss->softL[4] - (fabs(console8LiteBuss->softL[4]) * sin(-console8LiteBuss->softL[9] - 0.56852180) * 0.4314782);
+		if (console8LiteBuss->softL[9] > 0.56852180) inputSampleL = console8LiteBuss->softL[4] + (fabs(console8LiteBuss->softL[4]) * fast_sin(console8LiteBuss->softL[9] - 0.56852180) * 0.4314782);
+		if (-console8LiteBuss->softL[9] > 0.56852180) inputSampleL = console8LiteBuss->softL[4] - (fabs(console8LiteBuss->softL[4]) * fast_sin(-console8LiteBuss->softL[9] - 0.56852180) * 0.4314782);
 		// Console8 slew soften: must be clipped or it can generate NAN out of the full system
 		if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 		if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
 		console8LiteBuss->softR[9] = ((console8LiteBuss->softR[0] - console8LiteBuss->softR[4]) - (console8LiteBuss->softR[4] - console8LiteBuss->softR[8]));
-		if (console8LiteBuss->softR[9] > 0.56852180) inputSampleR = console8LiteBuss->softR[4] + (fabs(console8LiteBuss->softR[4]) * sin(console8LiteBuss->softR[9] - 0.56852180) * 0.4314782);
-		if (-console8LiteBuss->softR[9] > 0.56852180) inputSampleR = console8LiteBuss->softR[4] - (fabs(console8LiteBuss->softR[4]) * sin(-console8LiteBuss->softR[9] - 0.56852180) * 0.4314782);
+		if (console8LiteBuss->softR[9] > 0.56852180) inputSampleR = console8LiteBuss->softR[4] + (fabs(console8LiteBuss->softR[4]) * fast_sin(console8LiteBuss->softR[9] - 0.56852180) * 0.4314782);
+		if (-console8LiteBuss->softR[9] > 0.56852180) inputSampleR = console8LiteBuss->softR[4] - (fabs(console8LiteBuss->softR[4]) * fast_sin(-console8LiteBuss->softR[9] - 0.56852180) * 0.4314782);
 		// Console8 slew soften: must be clipped or it can generate NAN out of the full system
 
 		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
@@ -281,20 +283,20 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		} // fixed biquad filtering ultrasonics
 		if (inputSampleL > 1.0) inputSampleL = 1.0;
 		if (inputSampleL < -1.0) inputSampleL = -1.0;
-		inputSampleL = asin(inputSampleL); // Console8 decode
+		inputSampleL = fast_asin(inputSampleL); // Console8 decode
 		if (inputSampleR > 1.0) inputSampleR = 1.0;
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
-		inputSampleR = asin(inputSampleR); // Console8 decode
+		inputSampleR = fast_asin(inputSampleR); // Console8 decode
 
 		inputSampleL *= inTrim;
 		if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 		if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-		inputSampleL = sin(inputSampleL);
+		inputSampleL = fast_sin(inputSampleL);
 		// Console8 gain stage clips at exactly 1.0 post-sin()
 		inputSampleR *= inTrim;
 		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 		if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-		inputSampleR = sin(inputSampleR);
+		inputSampleR = fast_sin(inputSampleR);
 		// Console8 gain stage clips at exactly 1.0 post-sin()
 		if (console8LiteBuss->hsr) {
 			double outSample = (inputSampleL * console8LiteBuss->fixB[fix_a0]) + console8LiteBuss->fixB[fix_sL1];
@@ -368,12 +370,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		console8LiteBuss->fpdL ^= console8LiteBuss->fpdL << 13;
 		console8LiteBuss->fpdL ^= console8LiteBuss->fpdL >> 17;
 		console8LiteBuss->fpdL ^= console8LiteBuss->fpdL << 5;
-		inputSampleL += (((double) console8LiteBuss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) console8LiteBuss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		console8LiteBuss->fpdR ^= console8LiteBuss->fpdR << 13;
 		console8LiteBuss->fpdR ^= console8LiteBuss->fpdR >> 17;
 		console8LiteBuss->fpdR ^= console8LiteBuss->fpdR << 5;
-		inputSampleR += (((double) console8LiteBuss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) console8LiteBuss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define CONSOLE8LITECHANNEL_URI "https://hannesbraun.net/ns/lv2/airwindows/console8litechannel"
@@ -231,14 +233,14 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			console8LiteChannel->softR[0] = inputSampleR;
 		}
 		console8LiteChannel->softL[9] = ((console8LiteChannel->softL[0] - console8LiteChannel->softL[4]) - (console8LiteChannel->softL[4] - console8LiteChannel->softL[8]));
-		if (console8LiteChannel->softL[9] > 0.91416342) inputSampleL = console8LiteChannel->softL[4] + (fabs(console8LiteChannel->softL[4]) * sin(console8LiteChannel->softL[9] - 0.91416342) * 0.08583658);
-		if (-console8LiteChannel->softL[9] > 0.91416342) inputSampleL = console8LiteChannel->softL[4] - (fabs(console8LiteChannel->softL[4]) * sin(-console8LiteChannel->softL[9] - 0.91416342) * 0.08583658);
+		if (console8LiteChannel->softL[9] > 0.91416342) inputSampleL = console8LiteChannel->softL[4] + (fabs(console8LiteChannel->softL[4]) * fast_sin(console8LiteChannel->softL[9] - 0.91416342) * 0.08583658);
+		if (-console8LiteChannel->softL[9] > 0.91416342) inputSampleL = console8LiteChannel->softL[4] - (fabs(console8LiteChannel->softL[4]) * fast_sin(-console8LiteChannel->softL[9] - 0.91416342) * 0.08583658);
 		// Console8 slew soften: must be clipped or it can generate NAN out of the full system
 		if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 		if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
 		console8LiteChannel->softR[9] = ((console8LiteChannel->softR[0] - console8LiteChannel->softR[4]) - (console8LiteChannel->softR[4] - console8LiteChannel->softR[8]));
-		if (console8LiteChannel->softR[9] > 0.91416342) inputSampleR = console8LiteChannel->softR[4] + (fabs(console8LiteChannel->softR[4]) * sin(console8LiteChannel->softR[9] - 0.91416342) * 0.08583658);
-		if (-console8LiteChannel->softR[9] > 0.91416342) inputSampleR = console8LiteChannel->softR[4] - (fabs(console8LiteChannel->softR[4]) * sin(-console8LiteChannel->softR[9] - 0.91416342) * 0.08583658);
+		if (console8LiteChannel->softR[9] > 0.91416342) inputSampleR = console8LiteChannel->softR[4] + (fabs(console8LiteChannel->softR[4]) * fast_sin(console8LiteChannel->softR[9] - 0.91416342) * 0.08583658);
+		if (-console8LiteChannel->softR[9] > 0.91416342) inputSampleR = console8LiteChannel->softR[4] - (fabs(console8LiteChannel->softR[4]) * fast_sin(-console8LiteChannel->softR[9] - 0.91416342) * 0.08583658);
 		// Console8 slew soften: must be clipped or it can generate NAN out of the full system
 		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 		if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
@@ -259,12 +261,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleL *= inTrim;
 		if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 		if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-		inputSampleL = sin(inputSampleL);
+		inputSampleL = fast_sin(inputSampleL);
 		// Console8 gain stage clips at exactly 1.0 post-sin()
 		inputSampleR *= inTrim;
 		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 		if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-		inputSampleR = sin(inputSampleR);
+		inputSampleR = fast_sin(inputSampleR);
 		// Console8 gain stage clips at exactly 1.0 post-sin()
 		if (console8LiteChannel->hsr) {
 			double outSample = (inputSampleL * console8LiteChannel->fixB[fix_a0]) + console8LiteChannel->fixB[fix_sL1];
@@ -279,12 +281,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleL *= inTrim;
 		if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 		if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-		inputSampleL = sin(inputSampleL);
+		inputSampleL = fast_sin(inputSampleL);
 		// Console8 gain stage clips at exactly 1.0 post-sin()
 		inputSampleR *= inTrim;
 		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 		if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-		inputSampleR = sin(inputSampleR);
+		inputSampleR = fast_sin(inputSampleR);
 		// Console8 gain stage clips at exactly 1.0 post-sin()
 
 		// begin 32 bit stereo floating point dither
@@ -293,12 +295,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		console8LiteChannel->fpdL ^= console8LiteChannel->fpdL << 13;
 		console8LiteChannel->fpdL ^= console8LiteChannel->fpdL >> 17;
 		console8LiteChannel->fpdL ^= console8LiteChannel->fpdL << 5;
-		inputSampleL += (((double) console8LiteChannel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) console8LiteChannel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		console8LiteChannel->fpdR ^= console8LiteChannel->fpdR << 13;
 		console8LiteChannel->fpdR ^= console8LiteChannel->fpdR >> 17;
 		console8LiteChannel->fpdR ^= console8LiteChannel->fpdR << 5;
-		inputSampleR += (((double) console8LiteChannel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) console8LiteChannel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CONSOLELABUSS_URI "https://hannesbraun.net/ns/lv2/airwindows/consolelabuss"
 
 typedef enum {
@@ -126,22 +128,22 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		double subSampleR = inputSampleR * subTrim;
 
 		double scale = 0.5 + fabs(subSampleL * 0.5);
-		subSampleL = (consoleLABuss->subAL + (sin(consoleLABuss->subAL - subSampleL) * scale));
+		subSampleL = (consoleLABuss->subAL + (fast_sin(consoleLABuss->subAL - subSampleL) * scale));
 		consoleLABuss->subAL = subSampleL * scale;
 		scale = 0.5 + fabs(subSampleR * 0.5);
-		subSampleR = (consoleLABuss->subAR + (sin(consoleLABuss->subAR - subSampleR) * scale));
+		subSampleR = (consoleLABuss->subAR + (fast_sin(consoleLABuss->subAR - subSampleR) * scale));
 		consoleLABuss->subAR = subSampleR * scale;
 		scale = 0.5 + fabs(subSampleL * 0.5);
-		subSampleL = (consoleLABuss->subBL + (sin(consoleLABuss->subBL - subSampleL) * scale));
+		subSampleL = (consoleLABuss->subBL + (fast_sin(consoleLABuss->subBL - subSampleL) * scale));
 		consoleLABuss->subBL = subSampleL * scale;
 		scale = 0.5 + fabs(subSampleR * 0.5);
-		subSampleR = (consoleLABuss->subBR + (sin(consoleLABuss->subBR - subSampleR) * scale));
+		subSampleR = (consoleLABuss->subBR + (fast_sin(consoleLABuss->subBR - subSampleR) * scale));
 		consoleLABuss->subBR = subSampleR * scale;
 		scale = 0.5 + fabs(subSampleL * 0.5);
-		subSampleL = (consoleLABuss->subCL + (sin(consoleLABuss->subCL - subSampleL) * scale));
+		subSampleL = (consoleLABuss->subCL + (fast_sin(consoleLABuss->subCL - subSampleL) * scale));
 		consoleLABuss->subCL = subSampleL * scale;
 		scale = 0.5 + fabs(subSampleR * 0.5);
-		subSampleR = (consoleLABuss->subCR + (sin(consoleLABuss->subCR - subSampleR) * scale));
+		subSampleR = (consoleLABuss->subCR + (fast_sin(consoleLABuss->subCR - subSampleR) * scale));
 		consoleLABuss->subCR = subSampleR * scale;
 		if (subSampleL > 0.25) subSampleL = 0.25;
 		if (subSampleL < -0.25) subSampleL = -0.25;
@@ -205,12 +207,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		consoleLABuss->fpdL ^= consoleLABuss->fpdL << 13;
 		consoleLABuss->fpdL ^= consoleLABuss->fpdL >> 17;
 		consoleLABuss->fpdL ^= consoleLABuss->fpdL << 5;
-		inputSampleL += (((double) consoleLABuss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) consoleLABuss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		consoleLABuss->fpdR ^= consoleLABuss->fpdR << 13;
 		consoleLABuss->fpdR ^= consoleLABuss->fpdR >> 17;
 		consoleLABuss->fpdR ^= consoleLABuss->fpdR << 5;
-		inputSampleR += (((double) consoleLABuss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) consoleLABuss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI_2 1.57079632679489661923132169163975144
 
 #define CONSOLELACHANNEL_URI "https://hannesbraun.net/ns/lv2/airwindows/consolelachannel"
@@ -403,8 +405,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (treble > 0.0) {
 			w = treble;
 			if (w > 1.0) w = 1.0;
-			trebleL = (trebleL * (1.0 - w)) + (sin(trebleL * M_PI_2) * treble);
-			trebleR = (trebleR * (1.0 - w)) + (sin(trebleR * M_PI_2) * treble);
+			trebleL = (trebleL * (1.0 - w)) + (fast_sin(trebleL * M_PI_2) * treble);
+			trebleR = (trebleR * (1.0 - w)) + (fast_sin(trebleR * M_PI_2) * treble);
 		}
 		if (treble < 0.0) {
 			if (trebleL > 1.0) trebleL = 1.0;
@@ -426,8 +428,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (mid > 0.0) {
 			w = mid;
 			if (w > 1.0) w = 1.0;
-			midL = (midL * (1.0 - w)) + (sin(midL * M_PI_2) * mid);
-			midR = (midR * (1.0 - w)) + (sin(midR * M_PI_2) * mid);
+			midL = (midL * (1.0 - w)) + (fast_sin(midL * M_PI_2) * mid);
+			midR = (midR * (1.0 - w)) + (fast_sin(midR * M_PI_2) * mid);
 		}
 		if (mid < 0.0) {
 			w = -mid;
@@ -445,8 +447,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (bass > 0.0) {
 			w = bass;
 			if (w > 1.0) w = 1.0;
-			bassL = (bassL * (1.0 - w)) + (sin(bassL * M_PI_2) * bass);
-			bassR = (bassR * (1.0 - w)) + (sin(bassR * M_PI_2) * bass);
+			bassL = (bassL * (1.0 - w)) + (fast_sin(bassL * M_PI_2) * bass);
+			bassR = (bassR * (1.0 - w)) + (fast_sin(bassR * M_PI_2) * bass);
 		}
 		if (bass < 0.0) {
 			w = -bass;
@@ -466,22 +468,22 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		double subSampleR = inputSampleR * subTrim;
 
 		double scale = 0.5 + fabs(subSampleL * 0.5);
-		subSampleL = (consoleLAChannel->subAL + (sin(consoleLAChannel->subAL - subSampleL) * scale));
+		subSampleL = (consoleLAChannel->subAL + (fast_sin(consoleLAChannel->subAL - subSampleL) * scale));
 		consoleLAChannel->subAL = subSampleL * scale;
 		scale = 0.5 + fabs(subSampleR * 0.5);
-		subSampleR = (consoleLAChannel->subAR + (sin(consoleLAChannel->subAR - subSampleR) * scale));
+		subSampleR = (consoleLAChannel->subAR + (fast_sin(consoleLAChannel->subAR - subSampleR) * scale));
 		consoleLAChannel->subAR = subSampleR * scale;
 		scale = 0.5 + fabs(subSampleL * 0.5);
-		subSampleL = (consoleLAChannel->subBL + (sin(consoleLAChannel->subBL - subSampleL) * scale));
+		subSampleL = (consoleLAChannel->subBL + (fast_sin(consoleLAChannel->subBL - subSampleL) * scale));
 		consoleLAChannel->subBL = subSampleL * scale;
 		scale = 0.5 + fabs(subSampleR * 0.5);
-		subSampleR = (consoleLAChannel->subBR + (sin(consoleLAChannel->subBR - subSampleR) * scale));
+		subSampleR = (consoleLAChannel->subBR + (fast_sin(consoleLAChannel->subBR - subSampleR) * scale));
 		consoleLAChannel->subBR = subSampleR * scale;
 		scale = 0.5 + fabs(subSampleL * 0.5);
-		subSampleL = (consoleLAChannel->subCL + (sin(consoleLAChannel->subCL - subSampleL) * scale));
+		subSampleL = (consoleLAChannel->subCL + (fast_sin(consoleLAChannel->subCL - subSampleL) * scale));
 		consoleLAChannel->subCL = subSampleL * scale;
 		scale = 0.5 + fabs(subSampleR * 0.5);
-		subSampleR = (consoleLAChannel->subCR + (sin(consoleLAChannel->subCR - subSampleR) * scale));
+		subSampleR = (consoleLAChannel->subCR + (fast_sin(consoleLAChannel->subCR - subSampleR) * scale));
 		consoleLAChannel->subCR = subSampleR * scale;
 		if (subSampleL > 0.25) subSampleL = 0.25;
 		if (subSampleL < -0.25) subSampleL = -0.25;
@@ -496,8 +498,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleL < -1.097) inputSampleL = -1.097;
 		if (inputSampleR > 1.097) inputSampleR = 1.097;
 		if (inputSampleR < -1.097) inputSampleR = -1.097;
-		inputSampleL = ((sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (sin(inputSampleL) * 0.2);
-		inputSampleR = ((sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (sin(inputSampleR) * 0.2);
+		inputSampleL = ((fast_sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL))) * 0.8) + (fast_sin(inputSampleL) * 0.2);
+		inputSampleR = ((fast_sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR))) * 0.8) + (fast_sin(inputSampleR) * 0.2);
 		// this is a version of Spiral blended 80/20 with regular Density.
 		// It's blending between two different harmonics in the overtones of the algorithm
 
@@ -507,12 +509,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		consoleLAChannel->fpdL ^= consoleLAChannel->fpdL << 13;
 		consoleLAChannel->fpdL ^= consoleLAChannel->fpdL >> 17;
 		consoleLAChannel->fpdL ^= consoleLAChannel->fpdL << 5;
-		inputSampleL += (((double) consoleLAChannel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) consoleLAChannel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		consoleLAChannel->fpdR ^= consoleLAChannel->fpdR << 13;
 		consoleLAChannel->fpdR ^= consoleLAChannel->fpdR >> 17;
 		consoleLAChannel->fpdR ^= consoleLAChannel->fpdR << 5;
-		inputSampleR += (((double) consoleLAChannel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) consoleLAChannel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CREATURE_URI "https://hannesbraun.net/ns/lv2/airwindows/creature"
 
 typedef enum {
@@ -116,9 +118,9 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		double drySampleR = inputSampleR;
 
 		for (int x = 0; x < stages; x++) {
-			inputSampleL = (creature->slewL[x] + (sin(creature->slewL[x] - inputSampleL) * 0.5)) * source;
+			inputSampleL = (creature->slewL[x] + (fast_sin(creature->slewL[x] - inputSampleL) * 0.5)) * source;
 			creature->slewL[x] = inputSampleL * 0.5;
-			inputSampleR = (creature->slewR[x] + (sin(creature->slewR[x] - inputSampleR) * 0.5)) * source;
+			inputSampleR = (creature->slewR[x] + (fast_sin(creature->slewR[x] - inputSampleR) * 0.5)) * source;
 			creature->slewR[x] = inputSampleR * 0.5;
 		}
 		if (stages % 2 > 0) {
@@ -139,12 +141,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		creature->fpdL ^= creature->fpdL << 13;
 		creature->fpdL ^= creature->fpdL >> 17;
 		creature->fpdL ^= creature->fpdL << 5;
-		inputSampleL += (((double) creature->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) creature->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		creature->fpdR ^= creature->fpdR << 13;
 		creature->fpdR ^= creature->fpdR >> 17;
 		creature->fpdR ^= creature->fpdR << 5;
-		inputSampleR += (((double) creature->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) creature->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CRUNCHYGROOVEWEAR_URI "https://hannesbraun.net/ns/lv2/airwindows/crunchygroovewear"
 
 typedef enum {
@@ -748,12 +750,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		crunchyGrooveWear->fpdL ^= crunchyGrooveWear->fpdL << 13;
 		crunchyGrooveWear->fpdL ^= crunchyGrooveWear->fpdL >> 17;
 		crunchyGrooveWear->fpdL ^= crunchyGrooveWear->fpdL << 5;
-		inputSampleL += (((double) crunchyGrooveWear->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) crunchyGrooveWear->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		crunchyGrooveWear->fpdR ^= crunchyGrooveWear->fpdR << 13;
 		crunchyGrooveWear->fpdR ^= crunchyGrooveWear->fpdR >> 17;
 		crunchyGrooveWear->fpdR ^= crunchyGrooveWear->fpdR << 5;
-		inputSampleR += (((double) crunchyGrooveWear->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) crunchyGrooveWear->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -65,8 +65,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	const float voltage = *dcvoltage->voltage;
 
 	while (sampleFrames-- > 0) {
-		*out1 = *in1 + voltage;
-		*out2 = *in2 + voltage;
+		const float inputSampleL = *in1;
+		const float inputSampleR = *in2;
+		*out1 = inputSampleL + voltage;
+		*out2 = inputSampleR + voltage;
 
 		in1++;
 		in2++;
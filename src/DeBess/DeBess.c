@@ -5,7 +5,10 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define DEBESS_URI "https://hannesbraun.net/ns/lv2/airwindows/debess"
+#define DEBESSMONO_URI "https://hannesbraun.net/ns/lv2/airwindows/debessmono"
 
 typedef enum {
 	INPUT_L = 0,
@@ -29,21 +32,14 @@ typedef struct {
 	const float* filter;
 	const float* sense;
 
-	double sL[41], mL[41] /*, cL[41]*/;
-	double ratioAL;
-	double ratioBL;
-	double iirSampleAL;
-	double iirSampleBL;
-
-	double sR[41], mR[41] /*, cR[41]*/;
-	double ratioAR;
-	double ratioBR;
-	double iirSampleAR;
-	double iirSampleBR;
+	double s[41][2], m[41][2] /*, c[41][2]*/;
+	double ratioA[2];
+	double ratioB[2];
+	double iirSampleA[2];
+	double iirSampleB[2];
 
 	bool flip;
-	uint32_t fpdL;
-	uint32_t fpdR;
+	uint32_t fpd[2];
 } DeBess;
 
 static LV2_Handle instantiate(
@@ -92,43 +88,49 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 	}
 }
 
+// The mono variant has one input and one output, its controls follow at 2
+static void connect_port_mono(LV2_Handle instance, uint32_t port, void* data)
+{
+	DeBess* debess = (DeBess*) instance;
+
+	if (port == 0) {
+		debess->input[0] = (const float*) data;
+	} else if (port == 1) {
+		debess->output[0] = (float*) data;
+	} else {
+		connect_port(instance, port + 2, data);
+	}
+}
+
 static void activate(LV2_Handle instance)
 {
 	DeBess* debess = (DeBess*) instance;
 
 	for (int x = 0; x < 41; x++) {
-		debess->sL[x] = 0.0;
-		debess->mL[x] = 0.0;
-		// debess->cL[x] = 0.0;
-		debess->sR[x] = 0.0;
-		debess->mR[x] = 0.0;
-		// debess->cR[x] = 0.0;
+		for (int c = 0; c < 2; c++) {
+			debess->s[x][c] = 0.0;
+			debess->m[x][c] = 0.0;
+			// debess->c[x][c] = 0.0;
+		}
+	}
+	for (int c = 0; c < 2; c++) {
+		debess->ratioA[c] = 1.0;
+		debess->ratioB[c] = 1.0;
+		debess->iirSampleA[c] = 0.0;
+		debess->iirSampleB[c] = 0.0;
 	}
-	debess->ratioAL = 1.0;
-	debess->ratioBL = 1.0;
-	debess->iirSampleAL = 0.0;
-	debess->iirSampleBL = 0.0;
-	debess->ratioAR = 1.0;
-	debess->ratioBR = 1.0;
-	debess->iirSampleAR = 0.0;
-	debess->iirSampleBR = 0.0;
 
 	debess->flip = false;
-	debess->fpdL = 1.0;
-	while (debess->fpdL < 16386) debess->fpdL = rand() * UINT32_MAX;
-	debess->fpdR = 1.0;
-	while (debess->fpdR < 16386) debess->fpdR = rand() * UINT32_MAX;
+	for (int c = 0; c < 2; c++) {
+		debess->fpd[c] = 1.0;
+		while (debess->fpd[c] < 16386) debess->fpd[c] = rand() * UINT32_MAX;
+	}
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+// Processes the first `channels` inputs into the outputs. The slews are kept
+// side by side per channel, so the stereo loops over them work on both at once.
+static inline void run_channels(DeBess* debess, uint32_t sampleFrames, const int channels)
 {
-	DeBess* debess = (DeBess*) instance;
-
-	const float* in1 = debess->input[0];
-	const float* in2 = debess->input[1];
-	float* out1 = debess->output[0];
-	float* out2 = debess->output[1];
-
 	double overallscale = 1.0;
 	overallscale /= 44100.0;
 	overallscale *= debess->sampleRate;
@@ -141,96 +143,89 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	double iirAmount = *debess->filter;
 	float monitoring = *debess->sense;
 
-	while (sampleFrames-- > 0) {
-		double inputSampleL = *in1;
-		double inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = debess->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = debess->fpdR * 1.18e-17;
+	double drySample[2];
+	double inputSample[2];
+	double sense[2];
+
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		for (int c = 0; c < channels; c++) {
+			inputSample[c] = drySample[c] = debess->input[c][i];
+			if (fabs(inputSample[c]) < 1.18e-23) inputSample[c] = debess->fpd[c] * 1.18e-17;
 
-		debess->sL[0] = inputSampleL; // set up so both [0] and [1] will be input sample
-		debess->sR[0] = inputSampleR; // set up so both [0] and [1] will be input sample
+			debess->s[0][c] = inputSample[c]; // set up so both [0] and [1] will be input sample
+		}
 		// we only use the [1] so this is just where samples come in
 		for (int x = sharpness; x > 0; x--) {
-			debess->sL[x] = debess->sL[x - 1];
-			debess->sR[x] = debess->sR[x - 1];
+			for (int c = 0; c < channels; c++) debess->s[x][c] = debess->s[x - 1][c];
 		} // building up a set of slews
 
-		debess->mL[1] = (debess->sL[1] - debess->sL[2]) * ((debess->sL[1] - debess->sL[2]) / 1.3);
-		debess->mR[1] = (debess->sR[1] - debess->sR[2]) * ((debess->sR[1] - debess->sR[2]) / 1.3);
+		for (int c = 0; c < channels; c++) debess->m[1][c] = (debess->s[1][c] - debess->s[2][c]) * ((debess->s[1][c] - debess->s[2][c]) / 1.3);
 		for (int x = sharpness - 1; x > 1; x--) {
-			debess->mL[x] = (debess->sL[x] - debess->sL[x + 1]) * ((debess->sL[x - 1] - debess->sL[x]) / 1.3);
-			debess->mR[x] = (debess->sR[x] - debess->sR[x + 1]) * ((debess->sR[x - 1] - debess->sR[x]) / 1.3);
+			for (int c = 0; c < channels; c++) debess->m[x][c] = (debess->s[x][c] - debess->s[x + 1][c]) * ((debess->s[x - 1][c] - debess->s[x][c]) / 1.3);
 		} // building up a set of slews of slews
 
-		double senseL = fabs(debess->mL[1] - debess->mL[2]) * sharpness * sharpness;
-		double senseR = fabs(debess->mR[1] - debess->mR[2]) * sharpness * sharpness;
+		for (int c = 0; c < channels; c++) sense[c] = fabs(debess->m[1][c] - debess->m[2][c]) * sharpness * sharpness;
 		for (int x = sharpness - 1; x > 0; x--) {
-			double multL = fabs(debess->mL[x] - debess->mL[x + 1]) * sharpness * sharpness;
-			if (multL < 1.0) senseL *= multL;
-			double multR = fabs(debess->mR[x] - debess->mR[x + 1]) * sharpness * sharpness;
-			if (multR < 1.0) senseR *= multR;
+			for (int c = 0; c < channels; c++) {
+				double mult = fabs(debess->m[x][c] - debess->m[x + 1][c]) * sharpness * sharpness;
+				if (mult < 1.0) sense[c] *= mult;
+			}
 		} // sense is slews of slews times each other
 
-		senseL = 1.0 + (intensity * intensity * senseL);
-		if (senseL > intensity) {
-			senseL = intensity;
-		}
-		senseR = 1.0 + (intensity * intensity * senseR);
-		if (senseR > intensity) {
-			senseR = intensity;
+		for (int c = 0; c < channels; c++) {
+			sense[c] = 1.0 + (intensity * intensity * sense[c]);
+			if (sense[c] > intensity) {
+				sense[c] = intensity;
+			}
 		}
 
 		if (debess->flip) {
-			debess->iirSampleAL = (debess->iirSampleAL * (1 - iirAmount)) + (inputSampleL * iirAmount);
-			debess->iirSampleAR = (debess->iirSampleAR * (1 - iirAmount)) + (inputSampleR * iirAmount);
-			debess->ratioAL = (debess->ratioAL * (1.0 - speed)) + (senseL * speed);
-			debess->ratioAR = (debess->ratioAR * (1.0 - speed)) + (senseR * speed);
-			if (debess->ratioAL > depth) debess->ratioAL = depth;
-			if (debess->ratioAR > depth) debess->ratioAR = depth;
-			if (debess->ratioAL > 1.0) inputSampleL = debess->iirSampleAL + ((inputSampleL - debess->iirSampleAL) / debess->ratioAL);
-			if (debess->ratioAR > 1.0) inputSampleR = debess->iirSampleAR + ((inputSampleR - debess->iirSampleAR) / debess->ratioAR);
+			for (int c = 0; c < channels; c++) {
+				debess->iirSampleA[c] = (debess->iirSampleA[c] * (1 - iirAmount)) + (inputSample[c] * iirAmount);
+				debess->ratioA[c] = (debess->ratioA[c] * (1.0 - speed)) + (sense[c] * speed);
+				if (debess->ratioA[c] > depth) debess->ratioA[c] = depth;
+				if (debess->ratioA[c] > 1.0) inputSample[c] = debess->iirSampleA[c] + ((inputSample[c] - debess->iirSampleA[c]) / debess->ratioA[c]);
+			}
 		} else {
-			debess->iirSampleBL = (debess->iirSampleBL * (1 - iirAmount)) + (inputSampleL * iirAmount);
-			debess->iirSampleBR = (debess->iirSampleBR * (1 - iirAmount)) + (inputSampleR * iirAmount);
-			debess->ratioBL = (debess->ratioBL * (1.0 - speed)) + (senseL * speed);
-			debess->ratioBR = (debess->ratioBR * (1.0 - speed)) + (senseR * speed);
-			if (debess->ratioBL > depth) debess->ratioBL = depth;
-			if (debess->ratioBR > depth) debess->ratioBR = depth;
-			if (debess->ratioAL > 1.0) inputSampleL = debess->iirSampleBL + ((inputSampleL - debess->iirSampleBL) / debess->ratioBL);
-			if (debess->ratioAR > 1.0) inputSampleR = debess->iirSampleBR + ((inputSampleR - debess->iirSampleBR) / debess->ratioBR);
+			for (int c = 0; c < channels; c++) {
+				debess->iirSampleB[c] = (debess->iirSampleB[c] * (1 - iirAmount)) + (inputSample[c] * iirAmount);
+				debess->ratioB[c] = (debess->ratioB[c] * (1.0 - speed)) + (sense[c] * speed);
+				if (debess->ratioB[c] > depth) debess->ratioB[c] = depth;
+				if (debess->ratioA[c] > 1.0) inputSample[c] = debess->iirSampleB[c] + ((inputSample[c] - debess->iirSampleB[c]) / debess->ratioB[c]);
+			}
 		}
 		debess->flip = !debess->flip;
 
 		if (monitoring > 0.49999) {
-			inputSampleL = *in1 - inputSampleL;
-			inputSampleR = *in2 - inputSampleR;
+			for (int c = 0; c < channels; c++) inputSample[c] = drySample[c] - inputSample[c];
 		}
 		// sense monitoring
 
-		// begin 32 bit stereo floating point dither
-		int expon;
-		frexpf((float) inputSampleL, &expon);
-		debess->fpdL ^= debess->fpdL << 13;
-		debess->fpdL ^= debess->fpdL >> 17;
-		debess->fpdL ^= debess->fpdL << 5;
-		inputSampleL += (((double) debess->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		frexpf((float) inputSampleR, &expon);
-		debess->fpdR ^= debess->fpdR << 13;
-		debess->fpdR ^= debess->fpdR >> 17;
-		debess->fpdR ^= debess->fpdR << 5;
-		inputSampleR += (((double) debess->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		// end 32 bit stereo floating point dither
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+		// begin 32 bit floating point dither
+		for (int c = 0; c < channels; c++) {
+			int expon;
+			frexpf((float) inputSample[c], &expon);
+			debess->fpd[c] ^= debess->fpd[c] << 13;
+			debess->fpd[c] ^= debess->fpd[c] >> 17;
+			debess->fpd[c] ^= debess->fpd[c] << 5;
+			inputSample[c] += (((double) debess->fpd[c] - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+		}
+		// end 32 bit floating point dither
+
+		for (int c = 0; c < channels; c++) debess->output[c][i] = (float) inputSample[c];
 	}
 }
 
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((DeBess*) instance, sampleFrames, 2);
+}
+
+static void run_mono(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((DeBess*) instance, sampleFrames, 1);
+}
+
 static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
@@ -243,17 +238,25 @@ static const void* extension_data(const char* uri)
 	return NULL;
 }
 
-static const LV2_Descriptor descriptor = {
-	DEBESS_URI,
-	instantiate,
-	connect_port,
-	activate,
-	run,
-	deactivate,
-	cleanup,
-	extension_data};
+static const LV2_Descriptor descriptors[] = {
+	{DEBESS_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{DEBESSMONO_URI,
+	 instantiate,
+	 connect_port_mono,
+	 activate,
+	 run_mono,
+	 deactivate,
+	 cleanup,
+	 extension_data}};
 
 LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
 {
-	return index == 0 ? &descriptor : NULL;
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
 }
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define DESK_URI "https://hannesbraun.net/ns/lv2/airwindows/desk"
 
 typedef enum {
@@ -121,7 +123,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		bridgerectifier = fabs(slew * slewgain);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (slew > 0) slew = bridgerectifier / slewgain;
 		else slew = -(bridgerectifier / slewgain);
 
@@ -140,7 +142,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleL *= gain;
 		bridgerectifier = fabs(inputSampleL);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 
 		if (inputSampleL > 0) inputSampleL = bridgerectifier;
 		else inputSampleL = -bridgerectifier;
@@ -155,7 +157,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		bridgerectifier = fabs(slew * slewgain);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (slew > 0) slew = bridgerectifier / slewgain;
 		else slew = -(bridgerectifier / slewgain);
 
@@ -174,7 +176,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleR *= gain;
 		bridgerectifier = fabs(inputSampleR);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 
 		if (inputSampleR > 0) inputSampleR = bridgerectifier;
 		else inputSampleR = -bridgerectifier;
@@ -188,12 +190,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		desk->fpdL ^= desk->fpdL << 13;
 		desk->fpdL ^= desk->fpdL >> 17;
 		desk->fpdL ^= desk->fpdL << 5;
-		inputSampleL += (((double) desk->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) desk->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		desk->fpdR ^= desk->fpdR << 13;
 		desk->fpdR ^= desk->fpdR >> 17;
 		desk->fpdR ^= desk->fpdR << 5;
-		inputSampleR += (((double) desk->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) desk->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
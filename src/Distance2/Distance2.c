@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/dispatch.h"
+#include "../common/fastmath.h"
+
 #define DISTANCE2_URI "https://hannesbraun.net/ns/lv2/airwindows/distance2"
 
 typedef enum {
@@ -174,7 +177,7 @@ static void activate(LV2_Handle instance)
 	while (distance2->fpdR < 16386) distance2->fpdR = rand() * UINT32_MAX;
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+CPU_DISPATCH static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	Distance2* distance2 = (Distance2*) instance;
 
@@ -408,12 +411,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		distance2->fpdL ^= distance2->fpdL << 13;
 		distance2->fpdL ^= distance2->fpdL >> 17;
 		distance2->fpdL ^= distance2->fpdL << 5;
-		inputSampleL += (((double) distance2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) distance2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		distance2->fpdR ^= distance2->fpdR << 13;
 		distance2->fpdR ^= distance2->fpdR >> 17;
 		distance2->fpdR ^= distance2->fpdR << 5;
-		inputSampleR += (((double) distance2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) distance2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,6 +5,11 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/air.h"
+#include "../common/dispatch.h"
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define DOUBLELAY_URI "https://hannesbraun.net/ns/lv2/airwindows/doublelay"
 
 typedef enum {
@@ -55,15 +60,7 @@ typedef struct {
 	double feedbackR;
 	double bestyetL;
 	double bestyetR;
-	double airPrevL;
-	double airEvenL;
-	double airOddL;
-	double airFactorL;
-	double airPrevR;
-	double airEvenR;
-	double airOddR;
-	double airFactorR;
-	bool flip;
+	Air air;
 
 	double lastRefL[7];
 	double lastRefR[7];
@@ -71,6 +68,8 @@ typedef struct {
 
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	Silence silence;
 } Doublelay;
 
 static LV2_Handle instantiate(
@@ -157,15 +156,7 @@ static void activate(LV2_Handle instance)
 	doublelay->bestspliceR = 4;
 	doublelay->bestyetL = 1.0;
 	doublelay->bestyetR = 1.0;
-	doublelay->airPrevL = 0.0;
-	doublelay->airEvenL = 0.0;
-	doublelay->airOddL = 0.0;
-	doublelay->airFactorL = 0.0;
-	doublelay->airPrevR = 0.0;
-	doublelay->airEvenR = 0.0;
-	doublelay->airOddR = 0.0;
-	doublelay->airFactorR = 0.0;
-	doublelay->flip = false;
+	air_reset(&doublelay->air);
 
 	for (int count = 0; count < 6; count++) {
 		doublelay->lastRefL[count] = 0.0;
@@ -177,9 +168,11 @@ static void activate(LV2_Handle instance)
 	while (doublelay->fpdL < 16386) doublelay->fpdL = rand() * UINT32_MAX;
 	doublelay->fpdR = 1.0;
 	while (doublelay->fpdR < 16386) doublelay->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&doublelay->silence, 53020 * 4); // delay memory per channel, undersampled
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+CPU_DISPATCH static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	Doublelay* doublelay = (Doublelay*) instance;
 
@@ -188,6 +181,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = doublelay->output[0];
 	float* out2 = doublelay->output[1];
 
+	if (silence_skip(&doublelay->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	double overallscale = 1.0;
 	overallscale /= 44100.0;
 	const double sampleRate = doublelay->sampleRate;
@@ -267,37 +262,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			double drySampleR = inputSampleR;
 
 			// assign working variables
-			doublelay->airFactorL = doublelay->airPrevL - inputSampleL;
-			if (doublelay->flip) {
-				doublelay->airEvenL += doublelay->airFactorL;
-				doublelay->airOddL -= doublelay->airFactorL;
-				doublelay->airFactorL = doublelay->airEvenL;
-			} else {
-				doublelay->airOddL += doublelay->airFactorL;
-				doublelay->airEvenL -= doublelay->airFactorL;
-				doublelay->airFactorL = doublelay->airOddL;
-			}
-			doublelay->airOddL = (doublelay->airOddL - ((doublelay->airOddL - doublelay->airEvenL) / 256.0)) / 1.0001;
-			doublelay->airEvenL = (doublelay->airEvenL - ((doublelay->airEvenL - doublelay->airOddL) / 256.0)) / 1.0001;
-			doublelay->airPrevL = inputSampleL;
-			inputSampleL += doublelay->airFactorL;
-			// left
-			doublelay->airFactorR = doublelay->airPrevR - inputSampleR;
-			if (doublelay->flip) {
-				doublelay->airEvenR += doublelay->airFactorR;
-				doublelay->airOddR -= doublelay->airFactorR;
-				doublelay->airFactorR = doublelay->airEvenR;
-			} else {
-				doublelay->airOddR += doublelay->airFactorR;
-				doublelay->airEvenR -= doublelay->airFactorR;
-				doublelay->airFactorR = doublelay->airOddR;
-			}
-			doublelay->airOddR = (doublelay->airOddR - ((doublelay->airOddR - doublelay->airEvenR) / 256.0)) / 1.0001;
-			doublelay->airEvenR = (doublelay->airEvenR - ((doublelay->airEvenR - doublelay->airOddR) / 256.0)) / 1.0001;
-			doublelay->airPrevR = inputSampleR;
-			inputSampleR += doublelay->airFactorR;
-			// right
-			doublelay->flip = !doublelay->flip;
+			air_process(&doublelay->air, &inputSampleL, &inputSampleR);
 			// air, compensates for loss of highs in flanger's interpolation
 
 			inputSampleL += doublelay->feedbackL * feedbackDirect;
@@ -530,12 +495,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		doublelay->fpdL ^= doublelay->fpdL << 13;
 		doublelay->fpdL ^= doublelay->fpdL >> 17;
 		doublelay->fpdL ^= doublelay->fpdL << 5;
-		inputSampleL += (((double) doublelay->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) doublelay->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		doublelay->fpdR ^= doublelay->fpdR << 13;
 		doublelay->fpdR ^= doublelay->fpdR >> 17;
 		doublelay->fpdR ^= doublelay->fpdR << 5;
-		inputSampleR += (((double) doublelay->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) doublelay->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -546,6 +511,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&doublelay->silence, doublelay->output[0], doublelay->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
@@ -5,7 +5,10 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define DRIVE_URI "https://hannesbraun.net/ns/lv2/airwindows/drive"
+#define DRIVEMONO_URI "https://hannesbraun.net/ns/lv2/airwindows/drivemono"
 
 typedef enum {
 	INPUT_L = 0,
@@ -27,13 +30,10 @@ typedef struct {
 	const float* outLevel;
 	const float* dryWet;
 
-	uint32_t fpdL;
-	uint32_t fpdR;
+	uint32_t fpd[2];
 	// default stuff
-	double iirSampleAL;
-	double iirSampleBL;
-	double iirSampleAR;
-	double iirSampleBR;
+	double iirSampleA[2];
+	double iirSampleB[2];
 	bool fpFlip;
 } Drive;
 
@@ -80,30 +80,39 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 	}
 }
 
-static void activate(LV2_Handle instance)
+// The mono variant has one input and one output, its controls follow at 2
+static void connect_port_mono(LV2_Handle instance, uint32_t port, void* data)
 {
 	Drive* drive = (Drive*) instance;
 
-	drive->iirSampleAL = 0.0;
-	drive->iirSampleBL = 0.0;
-	drive->iirSampleAR = 0.0;
-	drive->iirSampleBR = 0.0;
-	drive->fpFlip = true;
-	drive->fpdL = 1.0;
-	while (drive->fpdL < 16386) drive->fpdL = rand() * UINT32_MAX;
-	drive->fpdR = 1.0;
-	while (drive->fpdR < 16386) drive->fpdR = rand() * UINT32_MAX;
+	if (port == 0) {
+		drive->input[0] = (const float*) data;
+	} else if (port == 1) {
+		drive->output[0] = (float*) data;
+	} else {
+		connect_port(instance, port + 2, data);
+	}
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+static void activate(LV2_Handle instance)
 {
 	Drive* drive = (Drive*) instance;
 
-	const float* in1 = drive->input[0];
-	const float* in2 = drive->input[1];
-	float* out1 = drive->output[0];
-	float* out2 = drive->output[1];
+	for (int c = 0; c < 2; c++) {
+		drive->iirSampleA[c] = 0.0;
+		drive->iirSampleB[c] = 0.0;
+	}
+	drive->fpFlip = true;
+	for (int c = 0; c < 2; c++) {
+		drive->fpd[c] = 1.0;
+		while (drive->fpd[c] < 16386) drive->fpd[c] = rand() * UINT32_MAX;
+	}
+}
 
+// Processes the first `channels` inputs into the outputs. The highpass flip is
+// shared, the filters and the dither have a lane per channel.
+static inline void run_channels(Drive* drive, uint32_t sampleFrames, const int channels)
+{
 	double overallscale = 1.0;
 	overallscale /= 44100.0;
 	overallscale *= drive->sampleRate;
@@ -116,88 +125,84 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	double glitch = 0.60;
 	double out;
 
-	double inputSampleL;
-	double inputSampleR;
-	double drySampleL;
-	double drySampleR;
+	double inputSample[2];
+	double drySample[2];
 
-	while (sampleFrames-- > 0) {
-		inputSampleL = *in1;
-		inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = drive->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = drive->fpdR * 1.18e-17;
-		drySampleL = inputSampleL;
-		drySampleR = inputSampleR;
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		for (int c = 0; c < channels; c++) {
+			inputSample[c] = drive->input[c][i];
+			if (fabs(inputSample[c]) < 1.18e-23) inputSample[c] = drive->fpd[c] * 1.18e-17;
+			drySample[c] = inputSample[c];
+		}
 
 		if (drive->fpFlip) {
-			drive->iirSampleAL = (drive->iirSampleAL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-			inputSampleL -= drive->iirSampleAL;
-			drive->iirSampleAR = (drive->iirSampleAR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-			inputSampleR -= drive->iirSampleAR;
+			for (int c = 0; c < channels; c++) {
+				drive->iirSampleA[c] = (drive->iirSampleA[c] * (1.0 - iirAmount)) + (inputSample[c] * iirAmount);
+				inputSample[c] -= drive->iirSampleA[c];
+			}
 		} else {
-			drive->iirSampleBL = (drive->iirSampleBL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-			inputSampleL -= drive->iirSampleBL;
-			drive->iirSampleBR = (drive->iirSampleBR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-			inputSampleR -= drive->iirSampleBR;
+			for (int c = 0; c < channels; c++) {
+				drive->iirSampleB[c] = (drive->iirSampleB[c] * (1.0 - iirAmount)) + (inputSample[c] * iirAmount);
+				inputSample[c] -= drive->iirSampleB[c];
+			}
 		}
 		// highpass section
 		drive->fpFlip = !drive->fpFlip;
 
-		if (inputSampleL > 1.0) inputSampleL = 1.0;
-		if (inputSampleL < -1.0) inputSampleL = -1.0;
-		if (inputSampleR > 1.0) inputSampleR = 1.0;
-		if (inputSampleR < -1.0) inputSampleR = -1.0;
+		for (int c = 0; c < channels; c++) {
+			if (inputSample[c] > 1.0) inputSample[c] = 1.0;
+			if (inputSample[c] < -1.0) inputSample[c] = -1.0;
+		}
 
 		out = driveone;
 		while (out > glitch) {
 			out -= glitch;
-			inputSampleL -= (inputSampleL * (fabs(inputSampleL) * glitch) * (fabs(inputSampleL) * glitch));
-			inputSampleL *= (1.0 + glitch);
-			inputSampleR -= (inputSampleR * (fabs(inputSampleR) * glitch) * (fabs(inputSampleR) * glitch));
-			inputSampleR *= (1.0 + glitch);
+			for (int c = 0; c < channels; c++) {
+				inputSample[c] -= (inputSample[c] * (fabs(inputSample[c]) * glitch) * (fabs(inputSample[c]) * glitch));
+				inputSample[c] *= (1.0 + glitch);
+			}
 		}
 		// that's taken care of the really high gain stuff
 
-		inputSampleL -= (inputSampleL * (fabs(inputSampleL) * out) * (fabs(inputSampleL) * out));
-		inputSampleL *= (1.0 + out);
-		inputSampleR -= (inputSampleR * (fabs(inputSampleR) * out) * (fabs(inputSampleR) * out));
-		inputSampleR *= (1.0 + out);
+		for (int c = 0; c < channels; c++) {
+			inputSample[c] -= (inputSample[c] * (fabs(inputSample[c]) * out) * (fabs(inputSample[c]) * out));
+			inputSample[c] *= (1.0 + out);
 
-		if (output < 1.0) {
-			inputSampleL *= output;
-			inputSampleR *= output;
-		}
-		if (wet < 1.0) {
-			inputSampleL = (drySampleL * dry) + (inputSampleL * wet);
-			inputSampleR = (drySampleR * dry) + (inputSampleR * wet);
+			if (output < 1.0) {
+				inputSample[c] *= output;
+			}
+			if (wet < 1.0) {
+				inputSample[c] = (drySample[c] * dry) + (inputSample[c] * wet);
+			}
 		}
 		// nice little output stage template: if we have another scale of floating point
 		// number, we really don't want to meaninglessly multiply that by 1.0.
 
-		// begin 32 bit stereo floating point dither
-		int expon;
-		frexpf((float) inputSampleL, &expon);
-		drive->fpdL ^= drive->fpdL << 13;
-		drive->fpdL ^= drive->fpdL >> 17;
-		drive->fpdL ^= drive->fpdL << 5;
-		inputSampleL += (((double) drive->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		frexpf((float) inputSampleR, &expon);
-		drive->fpdR ^= drive->fpdR << 13;
-		drive->fpdR ^= drive->fpdR >> 17;
-		drive->fpdR ^= drive->fpdR << 5;
-		inputSampleR += (((double) drive->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		// end 32 bit stereo floating point dither
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+		// begin 32 bit floating point dither
+		for (int c = 0; c < channels; c++) {
+			int expon;
+			frexpf((float) inputSample[c], &expon);
+			drive->fpd[c] ^= drive->fpd[c] << 13;
+			drive->fpd[c] ^= drive->fpd[c] >> 17;
+			drive->fpd[c] ^= drive->fpd[c] << 5;
+			inputSample[c] += (((double) drive->fpd[c] - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+		}
+		// end 32 bit floating point dither
+
+		for (int c = 0; c < channels; c++) drive->output[c][i] = (float) inputSample[c];
 	}
 }
 
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Drive*) instance, sampleFrames, 2);
+}
+
+static void run_mono(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Drive*) instance, sampleFrames, 1);
+}
+
 static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
@@ -210,17 +215,25 @@ static const void* extension_data(const char* uri)
 	return NULL;
 }
 
-static const LV2_Descriptor descriptor = {
-	DRIVE_URI,
-	instantiate,
-	connect_port,
-	activate,
-	run,
-	deactivate,
-	cleanup,
-	extension_data};
+static const LV2_Descriptor descriptors[] = {
+	{DRIVE_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{DRIVEMONO_URI,
+	 instantiate,
+	 connect_port_mono,
+	 activate,
+	 run_mono,
+	 deactivate,
+	 cleanup,
+	 extension_data}};
 
 LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
 {
-	return index == 0 ? &descriptor : NULL;
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
 }
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define DRUMSLAM_URI "https://hannesbraun.net/ns/lv2/airwindows/drumslam"
 
 typedef enum {
@@ -244,7 +246,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		double bridgerectifier = fabs(skew);
 		if (bridgerectifier > 3.1415926) bridgerectifier = 3.1415926;
 		// for skew we want it to go to zero effect again, so we use full range of the sine
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (skew > 0) skew = bridgerectifier * 3.1415926;
 		else skew = -bridgerectifier * 3.1415926;
 		// skew is now sined and clamped and then re-amplified again
@@ -255,11 +257,11 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bridgerectifier = fabs(midSampleL);
 		bridgerectifier += skew;
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		bridgerectifier *= drive;
 		bridgerectifier += skew;
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (midSampleL > 0) {
 			midSampleL = bridgerectifier;
 		} else {
@@ -273,7 +275,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bridgerectifier = fabs(skew);
 		if (bridgerectifier > 3.1415926) bridgerectifier = 3.1415926;
 		// for skew we want it to go to zero effect again, so we use full range of the sine
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (skew > 0) skew = bridgerectifier * 3.1415926;
 		else skew = -bridgerectifier * 3.1415926;
 		// skew is now sined and clamped and then re-amplified again
@@ -284,11 +286,11 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bridgerectifier = fabs(midSampleR);
 		bridgerectifier += skew;
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		bridgerectifier *= drive;
 		bridgerectifier += skew;
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (midSampleR > 0) {
 			midSampleR = bridgerectifier;
 		} else {
@@ -310,12 +312,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		drumSlam->fpdL ^= drumSlam->fpdL << 13;
 		drumSlam->fpdL ^= drumSlam->fpdL >> 17;
 		drumSlam->fpdL ^= drumSlam->fpdL << 5;
-		inputSampleL += (((double) drumSlam->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) drumSlam->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		drumSlam->fpdR ^= drumSlam->fpdR << 13;
 		drumSlam->fpdR ^= drumSlam->fpdR >> 17;
 		drumSlam->fpdR ^= drumSlam->fpdR << 5;
-		inputSampleR += (((double) drumSlam->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) drumSlam->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define DYNO_URI "https://hannesbraun.net/ns/lv2/airwindows/dyno"
 
 typedef enum {
@@ -88,10 +90,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		}
 
 		double dyno = pow(fabs(inputSampleL), 4);
-		if (dyno > 0.0) inputSampleL = (sin(inputSampleL * dyno) / dyno) * 1.1654321;
+		if (dyno > 0.0) inputSampleL = (fast_sin(inputSampleL * dyno) / dyno) * 1.1654321;
 		// dyno is the one that tries to raise peak energy
 		dyno = pow(fabs(inputSampleR), 4);
-		if (dyno > 0.0) inputSampleR = (sin(inputSampleR * dyno) / dyno) * 1.1654321;
+		if (dyno > 0.0) inputSampleR = (fast_sin(inputSampleR * dyno) / dyno) * 1.1654321;
 		// dyno is the one that tries to raise peak energy
 
 		// begin 32 bit stereo floating point dither
@@ -100,12 +102,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		dyno_instance->fpdL ^= dyno_instance->fpdL << 13;
 		dyno_instance->fpdL ^= dyno_instance->fpdL >> 17;
 		dyno_instance->fpdL ^= dyno_instance->fpdL << 5;
-		inputSampleL += (((double) dyno_instance->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) dyno_instance->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		dyno_instance->fpdR ^= dyno_instance->fpdR << 13;
 		dyno_instance->fpdR ^= dyno_instance->fpdR >> 17;
 		dyno_instance->fpdR ^= dyno_instance->fpdR << 5;
-		inputSampleR += (((double) dyno_instance->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) dyno_instance->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
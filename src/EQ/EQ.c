@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define EQ_URI "https://hannesbraun.net/ns/lv2/airwindows/eq"
 
 typedef enum {
@@ -527,7 +529,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bridgerectifier = fabs(highSampleL) * 1.57079633;
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 			// max value for sine function
-			if (densityA > 0) bridgerectifier = sin(bridgerectifier);
+			if (densityA > 0) bridgerectifier = fast_sin(bridgerectifier);
 			else bridgerectifier = 1 - cos(bridgerectifier);
 			// produce either boosted or starved version
 			if (highSampleL > 0) highSampleL = (highSampleL * (1 - outA)) + (bridgerectifier * outA);
@@ -538,7 +540,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bridgerectifier = fabs(highSampleR) * 1.57079633;
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 			// max value for sine function
-			if (densityA > 0) bridgerectifier = sin(bridgerectifier);
+			if (densityA > 0) bridgerectifier = fast_sin(bridgerectifier);
 			else bridgerectifier = 1 - cos(bridgerectifier);
 			// produce either boosted or starved version
 			if (highSampleR > 0) highSampleR = (highSampleR * (1 - outA)) + (bridgerectifier * outA);
@@ -549,7 +551,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bridgerectifier = fabs(midSampleL) * 1.57079633;
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 			// max value for sine function
-			if (densityB > 0) bridgerectifier = sin(bridgerectifier);
+			if (densityB > 0) bridgerectifier = fast_sin(bridgerectifier);
 			else bridgerectifier = 1 - cos(bridgerectifier);
 			// produce either boosted or starved version
 			if (midSampleL > 0) midSampleL = (midSampleL * (1 - outB)) + (bridgerectifier * outB);
@@ -560,7 +562,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bridgerectifier = fabs(midSampleR) * 1.57079633;
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 			// max value for sine function
-			if (densityB > 0) bridgerectifier = sin(bridgerectifier);
+			if (densityB > 0) bridgerectifier = fast_sin(bridgerectifier);
 			else bridgerectifier = 1 - cos(bridgerectifier);
 			// produce either boosted or starved version
 			if (midSampleR > 0) midSampleR = (midSampleR * (1 - outB)) + (bridgerectifier * outB);
@@ -571,7 +573,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bridgerectifier = fabs(bassSampleL) * 1.57079633;
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 			// max value for sine function
-			if (densityC > 0) bridgerectifier = sin(bridgerectifier);
+			if (densityC > 0) bridgerectifier = fast_sin(bridgerectifier);
 			else bridgerectifier = 1 - cos(bridgerectifier);
 			// produce either boosted or starved version
 			if (bassSampleL > 0) bassSampleL = (bassSampleL * (1 - outC)) + (bridgerectifier * outC);
@@ -582,7 +584,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			bridgerectifier = fabs(bassSampleR) * 1.57079633;
 			if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 			// max value for sine function
-			if (densityC > 0) bridgerectifier = sin(bridgerectifier);
+			if (densityC > 0) bridgerectifier = fast_sin(bridgerectifier);
 			else bridgerectifier = 1 - cos(bridgerectifier);
 			// produce either boosted or starved version
 			if (bassSampleR > 0) bassSampleR = (bassSampleR * (1 - outC)) + (bridgerectifier * outC);
@@ -665,12 +667,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		eq->fpdL ^= eq->fpdL << 13;
 		eq->fpdL ^= eq->fpdL >> 17;
 		eq->fpdL ^= eq->fpdL << 5;
-		inputSampleL += (((double) eq->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) eq->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		eq->fpdR ^= eq->fpdR << 13;
 		eq->fpdR ^= eq->fpdR >> 17;
 		eq->fpdR ^= eq->fpdR << 5;
-		inputSampleR += (((double) eq->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) eq->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define EDISDIM_URI "https://hannesbraun.net/ns/lv2/airwindows/edisdim"
 
 typedef enum {
@@ -100,14 +102,14 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		edisdim->fpdL ^= edisdim->fpdL << 13;
 		edisdim->fpdL ^= edisdim->fpdL >> 17;
 		edisdim->fpdL ^= edisdim->fpdL << 5;
-		mid += (((double) edisdim->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		mid += (((double) edisdim->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit floating point dither
 		// begin 32 bit floating point dither
 		frexpf((float) side, &expon);
 		edisdim->fpdR ^= edisdim->fpdR << 13;
 		edisdim->fpdR ^= edisdim->fpdR >> 17;
 		edisdim->fpdR ^= edisdim->fpdR << 5;
-		side += (((double) edisdim->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		side += (((double) edisdim->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit floating point dither
 
 		*out1 = (float) mid;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define EVERYSLEW_URI "https://hannesbraun.net/ns/lv2/airwindows/everyslew"
 
 typedef enum {
@@ -220,12 +222,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		everySlew->fpdL ^= everySlew->fpdL << 13;
 		everySlew->fpdL ^= everySlew->fpdL >> 17;
 		everySlew->fpdL ^= everySlew->fpdL << 5;
-		inputSampleL += (((double) everySlew->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) everySlew->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		everySlew->fpdR ^= everySlew->fpdR << 13;
 		everySlew->fpdR ^= everySlew->fpdR >> 17;
 		everySlew->fpdR ^= everySlew->fpdR << 5;
-		inputSampleR += (((double) everySlew->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) everySlew->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define EVERYTRIM_URI "https://hannesbraun.net/ns/lv2/airwindows/everytrim"
 
 typedef enum {
@@ -128,12 +130,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		everytrim->fpdL ^= everytrim->fpdL << 13;
 		everytrim->fpdL ^= everytrim->fpdL >> 17;
 		everytrim->fpdL ^= everytrim->fpdL << 5;
-		inputSampleL += (((double) everytrim->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) everytrim->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		everytrim->fpdR ^= everytrim->fpdR << 13;
 		everytrim->fpdR ^= everytrim->fpdR >> 17;
 		everytrim->fpdR ^= everytrim->fpdR << 5;
-		inputSampleR += (((double) everytrim->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) everytrim->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
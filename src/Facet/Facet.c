@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define FACET_URI "https://hannesbraun.net/ns/lv2/airwindows/facet"
 
 typedef enum {
@@ -102,12 +104,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		facet->fpdL ^= facet->fpdL << 13;
 		facet->fpdL ^= facet->fpdL >> 17;
 		facet->fpdL ^= facet->fpdL << 5;
-		inputSampleL += (((double) facet->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) facet->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		facet->fpdR ^= facet->fpdR << 13;
 		facet->fpdR ^= facet->fpdR >> 17;
 		facet->fpdR ^= facet->fpdR << 5;
-		inputSampleR += (((double) facet->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) facet->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
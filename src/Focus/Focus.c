@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define FOCUS_URI "https://hannesbraun.net/ns/lv2/airwindows/focus"
@@ -135,8 +137,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		double drySampleL = inputSampleL;
 		double drySampleR = inputSampleR;
 
-		inputSampleL = sin(inputSampleL);
-		inputSampleR = sin(inputSampleR);
+		inputSampleL = fast_sin(inputSampleL);
+		inputSampleR = fast_sin(inputSampleR);
 		// encode Console5: good cleanness
 
 		double tempSample = (inputSampleL * focus->figureL[2]) + focus->figureL[7];
@@ -154,8 +156,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR > 1.0) inputSampleR = 1.0;
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
-		inputSampleL = asin(inputSampleL);
-		inputSampleR = asin(inputSampleR);
+		inputSampleL = fast_asin(inputSampleL);
+		inputSampleR = fast_asin(inputSampleR);
 		// decode Console5
 
 		double groundSampleL = drySampleL - inputSampleL; // set up UnBox
@@ -180,15 +182,15 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 				if (inputSampleR > 1.2533141373155) inputSampleR = 1.2533141373155;
 				if (inputSampleR < -1.2533141373155) inputSampleR = -1.2533141373155;
 				// clip to 1.2533141373155 to reach maximum output
-				inputSampleL = sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL));
-				inputSampleR = sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR));
+				inputSampleL = fast_sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL));
+				inputSampleR = fast_sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR));
 				break;
 			case 3: { // Mojo
 				double mojo;
 				mojo = pow(fabs(inputSampleL), 0.25);
-				if (mojo > 0.0) inputSampleL = (sin(inputSampleL * mojo * M_PI * 0.5) / mojo) * 0.987654321;
+				if (mojo > 0.0) inputSampleL = (fast_sin(inputSampleL * mojo * M_PI * 0.5) / mojo) * 0.987654321;
 				mojo = pow(fabs(inputSampleR), 0.25);
-				if (mojo > 0.0) inputSampleR = (sin(inputSampleR * mojo * M_PI * 0.5) / mojo) * 0.987654321;
+				if (mojo > 0.0) inputSampleR = (fast_sin(inputSampleR * mojo * M_PI * 0.5) / mojo) * 0.987654321;
 				// mojo is the one that flattens WAAAAY out very softly before wavefolding
 				break;
 			}
@@ -196,9 +198,9 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			case 5: {
 				double dyno;
 				dyno = pow(fabs(inputSampleL), 4);
-				if (dyno > 0.0) inputSampleL = (sin(inputSampleL * dyno) / dyno) * 1.1654321;
+				if (dyno > 0.0) inputSampleL = (fast_sin(inputSampleL * dyno) / dyno) * 1.1654321;
 				dyno = pow(fabs(inputSampleR), 4);
-				if (dyno > 0.0) inputSampleR = (sin(inputSampleR * dyno) / dyno) * 1.1654321;
+				if (dyno > 0.0) inputSampleR = (fast_sin(inputSampleR * dyno) / dyno) * 1.1654321;
 				// dyno is the one that tries to raise peak energy
 				break;
 			}
@@ -209,8 +211,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 				if (inputSampleR > 1.570796326794897) inputSampleR = 1.570796326794897;
 				if (inputSampleR < -1.570796326794897) inputSampleR = -1.570796326794897;
 				// clip to 1.570796326794897 to reach maximum output
-				inputSampleL = sin(inputSampleL);
-				inputSampleR = sin(inputSampleR);
+				inputSampleL = fast_sin(inputSampleL);
+				inputSampleR = fast_sin(inputSampleR);
 				break;
 		}
 
@@ -233,12 +235,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		focus->fpdL ^= focus->fpdL << 13;
 		focus->fpdL ^= focus->fpdL >> 17;
 		focus->fpdL ^= focus->fpdL << 5;
-		inputSampleL += (((double) focus->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) focus->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		focus->fpdR ^= focus->fpdR << 13;
 		focus->fpdR ^= focus->fpdR >> 17;
 		focus->fpdR ^= focus->fpdR << 5;
-		inputSampleR += (((double) focus->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) focus->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
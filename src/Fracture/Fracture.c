@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define FRACTURE_URI "https://hannesbraun.net/ns/lv2/airwindows/fracture"
 
 typedef enum {
@@ -116,7 +118,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bridgerectifier = fabs(inputSampleL) * fracture;
 		if (bridgerectifier > fracture) bridgerectifier = fracture;
 		// max value for sine function
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleL > 0) inputSampleL = bridgerectifier;
 		else inputSampleL = -bridgerectifier;
 		// blend according to density control
@@ -124,7 +126,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bridgerectifier = fabs(inputSampleR) * fracture;
 		if (bridgerectifier > fracture) bridgerectifier = fracture;
 		// max value for sine function
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleR > 0) inputSampleR = bridgerectifier;
 		else inputSampleR = -bridgerectifier;
 		// blend according to density control
@@ -141,12 +143,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		fractureInstance->fpdL ^= fractureInstance->fpdL << 13;
 		fractureInstance->fpdL ^= fractureInstance->fpdL >> 17;
 		fractureInstance->fpdL ^= fractureInstance->fpdL << 5;
-		inputSampleL += (((double) fractureInstance->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) fractureInstance->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		fractureInstance->fpdR ^= fractureInstance->fpdR << 13;
 		fractureInstance->fpdR ^= fractureInstance->fpdR >> 17;
 		fractureInstance->fpdR ^= fractureInstance->fpdR << 5;
-		inputSampleR += (((double) fractureInstance->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) fractureInstance->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -1,10 +1,17 @@
 #include <lv2/core/lv2.h>
 
 #include <math.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/dispatch.h"
+#include "../common/fastmath.h"
+#include "../common/ramp.h"
+#include "../common/silence.h"
+
 #define GALACTIC_URI "https://hannesbraun.net/ns/lv2/airwindows/galactic"
+#define GALACTICCV_URI "https://hannesbraun.net/ns/lv2/airwindows/galacticcv"
 
 typedef enum {
 	INPUT_L = 0,
@@ -15,7 +22,12 @@ typedef enum {
 	BRIGHTNESS = 5,
 	DETUNE = 6,
 	BIGNESS = 7,
-	DRYWET = 8
+	DRYWET = 8,
+	REPLACE_CV = 9,
+	BRIGHTNESS_CV = 10,
+	DETUNE_CV = 11,
+	BIGNESS_CV = 12,
+	DRYWET_CV = 13
 } PortIndex;
 
 typedef struct {
@@ -27,6 +39,11 @@ typedef struct {
 	const float* detune;
 	const float* bigness;
 	const float* drywet;
+	const float* replaceCV;
+	const float* brightnessCV;
+	const float* detuneCV;
+	const float* bignessCV;
+	const float* drywetCV; // NULL unless the host connects the CV ports, which only Galactic CV has
 
 	double iirAL;
 	double iirBL;
@@ -104,6 +121,8 @@ typedef struct {
 	uint32_t fpdL;
 	uint32_t fpdR;
 	// default stuff
+
+	Silence silence;
 } Galactic;
 
 static LV2_Handle instantiate(
@@ -149,6 +168,21 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 		case DRYWET:
 			galactic->drywet = (float*) data;
 			break;
+		case REPLACE_CV:
+			galactic->replaceCV = (const float*) data;
+			break;
+		case BRIGHTNESS_CV:
+			galactic->brightnessCV = (const float*) data;
+			break;
+		case DETUNE_CV:
+			galactic->detuneCV = (const float*) data;
+			break;
+		case BIGNESS_CV:
+			galactic->bignessCV = (const float*) data;
+			break;
+		case DRYWET_CV:
+			galactic->drywetCV = (const float*) data;
+			break;
 	}
 }
 
@@ -260,9 +294,11 @@ static void activate(LV2_Handle instance)
 	while (galactic->fpdL < 16386) galactic->fpdL = rand() * UINT32_MAX;
 	galactic->fpdR = 1;
 	while (galactic->fpdR < 16386) galactic->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&galactic->silence, 66031 * 4); // delay memory per channel, undersampled
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+CPU_DISPATCH static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	Galactic* galactic = (Galactic*) instance;
 
@@ -271,6 +307,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = galactic->output[0];
 	float* out2 = galactic->output[1];
 
+	if (silence_skip(&galactic->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	double overallscale = 1.0;
 	overallscale /= 44100.0;
 	overallscale *= galactic->sampleRate;
@@ -284,240 +322,256 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		galactic->cycle = cycleEnd - 1;
 	}
 
-	double regen = 0.0625 + ((1.0 - *galactic->replace) * 0.0625);
-	double attenuate = (1.0 - (regen / 0.125)) * 1.333;
-	double lowpass = pow(1.00001 - (1.0 - *galactic->brightness), 2.0) / sqrt(overallscale);
-	double drift = pow(*galactic->detune, 3) * 0.001;
-	double size = (*galactic->bigness * 1.77) + 0.1;
-	double wet = 1.0 - (pow(1.0 - *galactic->drywet, 3));
-
-	galactic->delayI = 3407.0 * size;
-	galactic->delayJ = 1823.0 * size;
-	galactic->delayK = 859.0 * size;
-	galactic->delayL = 331.0 * size;
-	galactic->delayA = 4801.0 * size;
-	galactic->delayB = 2909.0 * size;
-	galactic->delayC = 1153.0 * size;
-	galactic->delayD = 461.0 * size;
-	galactic->delayE = 7607.0 * size;
-	galactic->delayF = 4217.0 * size;
-	galactic->delayG = 2269.0 * size;
-	galactic->delayH = 1597.0 * size;
-	galactic->delayM = 256;
-
-	while (sampleFrames-- > 0) {
-		double inputSampleL = *in1;
-		double inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = galactic->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = galactic->fpdR * 1.18e-17;
-		double drySampleL = inputSampleL;
-		double drySampleR = inputSampleR;
-
-		galactic->vibM += (galactic->oldfpd * drift);
-		if (galactic->vibM > (3.141592653589793238 * 2.0)) {
-			galactic->vibM = 0.0;
-			galactic->oldfpd = 0.4294967295 + (galactic->fpdL * 0.0000000000618);
+	// with the CV ports connected the coefficients follow them every RAMP_STEP
+	// frames and the dry/wet mix glides between the steps
+	const bool ramped = galactic->replaceCV || galactic->brightnessCV || galactic->detuneCV || galactic->bignessCV || galactic->drywetCV;
+	double wet = 1.0 - (pow(1.0 - ramp_value(galactic->drywet, galactic->drywetCV, 0), 3));
+	double wetRamp = 0.0;
+
+	for (uint32_t frame = 0; frame < sampleFrames;) {
+		const uint32_t span = ramp_span(ramped, frame, sampleFrames);
+
+		double regen = 0.0625 + ((1.0 - ramp_value(galactic->replace, galactic->replaceCV, frame)) * 0.0625);
+		double attenuate = (1.0 - (regen / 0.125)) * 1.333;
+		double lowpass = pow(1.00001 - (1.0 - ramp_value(galactic->brightness, galactic->brightnessCV, frame)), 2.0) / sqrt(overallscale);
+		double drift = pow(ramp_value(galactic->detune, galactic->detuneCV, frame), 3) * 0.001;
+		double size = (ramp_value(galactic->bigness, galactic->bignessCV, frame) * 1.77) + 0.1;
+		if (galactic->drywetCV) {
+			const double target = 1.0 - (pow(1.0 - ramp_value(galactic->drywet, galactic->drywetCV, frame + span - 1), 3));
+			wetRamp = ramp_to(wet, target, span);
 		}
 
-		galactic->aML[galactic->countM] = inputSampleL * attenuate;
-		galactic->aMR[galactic->countM] = inputSampleR * attenuate;
-		galactic->countM++;
-		if (galactic->countM < 0 || galactic->countM > galactic->delayM) galactic->countM = 0;
-
-		double offsetML = (sin(galactic->vibM) + 1.0) * 127;
-		double offsetMR = (sin(galactic->vibM + (3.141592653589793238 / 2.0)) + 1.0) * 127;
-		int workingML = galactic->countM + offsetML;
-		int workingMR = galactic->countM + offsetMR;
-		double interpolML = (galactic->aML[workingML - ((workingML > galactic->delayM) ? galactic->delayM + 1 : 0)] * (1 - (offsetML - floor(offsetML))));
-		interpolML += (galactic->aML[workingML + 1 - ((workingML + 1 > galactic->delayM) ? galactic->delayM + 1 : 0)] * ((offsetML - floor(offsetML))));
-		double interpolMR = (galactic->aMR[workingMR - ((workingMR > galactic->delayM) ? galactic->delayM + 1 : 0)] * (1 - (offsetMR - floor(offsetMR))));
-		interpolMR += (galactic->aMR[workingMR + 1 - ((workingMR + 1 > galactic->delayM) ? galactic->delayM + 1 : 0)] * ((offsetMR - floor(offsetMR))));
-		inputSampleL = interpolML;
-		inputSampleR = interpolMR;
-		// predelay that applies vibrato
-		// want vibrato speed AND depth like in MatrixVerb
-
-		galactic->iirAL = (galactic->iirAL * (1.0 - lowpass)) + (inputSampleL * lowpass);
-		inputSampleL = galactic->iirAL;
-		galactic->iirAR = (galactic->iirAR * (1.0 - lowpass)) + (inputSampleR * lowpass);
-		inputSampleR = galactic->iirAR;
-		// initial filter
-
-		galactic->cycle++;
-		if (galactic->cycle == cycleEnd) { // hit the end point and we do a reverb sample
-			galactic->aIL[galactic->countI] = inputSampleL + (galactic->feedbackAR * regen);
-			galactic->aJL[galactic->countJ] = inputSampleL + (galactic->feedbackBR * regen);
-			galactic->aKL[galactic->countK] = inputSampleL + (galactic->feedbackCR * regen);
-			galactic->aLL[galactic->countL] = inputSampleL + (galactic->feedbackDR * regen);
-			galactic->aIR[galactic->countI] = inputSampleR + (galactic->feedbackAL * regen);
-			galactic->aJR[galactic->countJ] = inputSampleR + (galactic->feedbackBL * regen);
-			galactic->aKR[galactic->countK] = inputSampleR + (galactic->feedbackCL * regen);
-			galactic->aLR[galactic->countL] = inputSampleR + (galactic->feedbackDL * regen);
-
-			galactic->countI++;
-			if (galactic->countI < 0 || galactic->countI > galactic->delayI) galactic->countI = 0;
-			galactic->countJ++;
-			if (galactic->countJ < 0 || galactic->countJ > galactic->delayJ) galactic->countJ = 0;
-			galactic->countK++;
-			if (galactic->countK < 0 || galactic->countK > galactic->delayK) galactic->countK = 0;
-			galactic->countL++;
-			if (galactic->countL < 0 || galactic->countL > galactic->delayL) galactic->countL = 0;
-
-			double outIL = galactic->aIL[galactic->countI - ((galactic->countI > galactic->delayI) ? galactic->delayI + 1 : 0)];
-			double outJL = galactic->aJL[galactic->countJ - ((galactic->countJ > galactic->delayJ) ? galactic->delayJ + 1 : 0)];
-			double outKL = galactic->aKL[galactic->countK - ((galactic->countK > galactic->delayK) ? galactic->delayK + 1 : 0)];
-			double outLL = galactic->aLL[galactic->countL - ((galactic->countL > galactic->delayL) ? galactic->delayL + 1 : 0)];
-			double outIR = galactic->aIR[galactic->countI - ((galactic->countI > galactic->delayI) ? galactic->delayI + 1 : 0)];
-			double outJR = galactic->aJR[galactic->countJ - ((galactic->countJ > galactic->delayJ) ? galactic->delayJ + 1 : 0)];
-			double outKR = galactic->aKR[galactic->countK - ((galactic->countK > galactic->delayK) ? galactic->delayK + 1 : 0)];
-			double outLR = galactic->aLR[galactic->countL - ((galactic->countL > galactic->delayL) ? galactic->delayL + 1 : 0)];
-			// first block: now we have four outputs
-
-			galactic->aAL[galactic->countA] = (outIL - (outJL + outKL + outLL));
-			galactic->aBL[galactic->countB] = (outJL - (outIL + outKL + outLL));
-			galactic->aCL[galactic->countC] = (outKL - (outIL + outJL + outLL));
-			galactic->aDL[galactic->countD] = (outLL - (outIL + outJL + outKL));
-			galactic->aAR[galactic->countA] = (outIR - (outJR + outKR + outLR));
-			galactic->aBR[galactic->countB] = (outJR - (outIR + outKR + outLR));
-			galactic->aCR[galactic->countC] = (outKR - (outIR + outJR + outLR));
-			galactic->aDR[galactic->countD] = (outLR - (outIR + outJR + outKR));
-
-			galactic->countA++;
-			if (galactic->countA < 0 || galactic->countA > galactic->delayA) galactic->countA = 0;
-			galactic->countB++;
-			if (galactic->countB < 0 || galactic->countB > galactic->delayB) galactic->countB = 0;
-			galactic->countC++;
-			if (galactic->countC < 0 || galactic->countC > galactic->delayC) galactic->countC = 0;
-			galactic->countD++;
-			if (galactic->countD < 0 || galactic->countD > galactic->delayD) galactic->countD = 0;
-
-			double outAL = galactic->aAL[galactic->countA - ((galactic->countA > galactic->delayA) ? galactic->delayA + 1 : 0)];
-			double outBL = galactic->aBL[galactic->countB - ((galactic->countB > galactic->delayB) ? galactic->delayB + 1 : 0)];
-			double outCL = galactic->aCL[galactic->countC - ((galactic->countC > galactic->delayC) ? galactic->delayC + 1 : 0)];
-			double outDL = galactic->aDL[galactic->countD - ((galactic->countD > galactic->delayD) ? galactic->delayD + 1 : 0)];
-			double outAR = galactic->aAR[galactic->countA - ((galactic->countA > galactic->delayA) ? galactic->delayA + 1 : 0)];
-			double outBR = galactic->aBR[galactic->countB - ((galactic->countB > galactic->delayB) ? galactic->delayB + 1 : 0)];
-			double outCR = galactic->aCR[galactic->countC - ((galactic->countC > galactic->delayC) ? galactic->delayC + 1 : 0)];
-			double outDR = galactic->aDR[galactic->countD - ((galactic->countD > galactic->delayD) ? galactic->delayD + 1 : 0)];
-			// second block: four more outputs
-
-			galactic->aEL[galactic->countE] = (outAL - (outBL + outCL + outDL));
-			galactic->aFL[galactic->countF] = (outBL - (outAL + outCL + outDL));
-			galactic->aGL[galactic->countG] = (outCL - (outAL + outBL + outDL));
-			galactic->aHL[galactic->countH] = (outDL - (outAL + outBL + outCL));
-			galactic->aER[galactic->countE] = (outAR - (outBR + outCR + outDR));
-			galactic->aFR[galactic->countF] = (outBR - (outAR + outCR + outDR));
-			galactic->aGR[galactic->countG] = (outCR - (outAR + outBR + outDR));
-			galactic->aHR[galactic->countH] = (outDR - (outAR + outBR + outCR));
-
-			galactic->countE++;
-			if (galactic->countE < 0 || galactic->countE > galactic->delayE) galactic->countE = 0;
-			galactic->countF++;
-			if (galactic->countF < 0 || galactic->countF > galactic->delayF) galactic->countF = 0;
-			galactic->countG++;
-			if (galactic->countG < 0 || galactic->countG > galactic->delayG) galactic->countG = 0;
-			galactic->countH++;
-			if (galactic->countH < 0 || galactic->countH > galactic->delayH) galactic->countH = 0;
-
-			double outEL = galactic->aEL[galactic->countE - ((galactic->countE > galactic->delayE) ? galactic->delayE + 1 : 0)];
-			double outFL = galactic->aFL[galactic->countF - ((galactic->countF > galactic->delayF) ? galactic->delayF + 1 : 0)];
-			double outGL = galactic->aGL[galactic->countG - ((galactic->countG > galactic->delayG) ? galactic->delayG + 1 : 0)];
-			double outHL = galactic->aHL[galactic->countH - ((galactic->countH > galactic->delayH) ? galactic->delayH + 1 : 0)];
-			double outER = galactic->aER[galactic->countE - ((galactic->countE > galactic->delayE) ? galactic->delayE + 1 : 0)];
-			double outFR = galactic->aFR[galactic->countF - ((galactic->countF > galactic->delayF) ? galactic->delayF + 1 : 0)];
-			double outGR = galactic->aGR[galactic->countG - ((galactic->countG > galactic->delayG) ? galactic->delayG + 1 : 0)];
-			double outHR = galactic->aHR[galactic->countH - ((galactic->countH > galactic->delayH) ? galactic->delayH + 1 : 0)];
-			// third block: final outputs
-
-			galactic->feedbackAL = (outEL - (outFL + outGL + outHL));
-			galactic->feedbackBL = (outFL - (outEL + outGL + outHL));
-			galactic->feedbackCL = (outGL - (outEL + outFL + outHL));
-			galactic->feedbackDL = (outHL - (outEL + outFL + outGL));
-			galactic->feedbackAR = (outER - (outFR + outGR + outHR));
-			galactic->feedbackBR = (outFR - (outER + outGR + outHR));
-			galactic->feedbackCR = (outGR - (outER + outFR + outHR));
-			galactic->feedbackDR = (outHR - (outER + outFR + outGR));
-			// which we need to feed back into the input again, a bit
-
-			inputSampleL = (outEL + outFL + outGL + outHL) / 8.0;
-			inputSampleR = (outER + outFR + outGR + outHR) / 8.0;
-			// and take the final combined sum of outputs
-			if (cycleEnd == 4) {
-				galactic->lastRefL[0] = galactic->lastRefL[4]; // start from previous last
-				galactic->lastRefL[2] = (galactic->lastRefL[0] + inputSampleL) / 2; // half
-				galactic->lastRefL[1] = (galactic->lastRefL[0] + galactic->lastRefL[2]) / 2; // one quarter
-				galactic->lastRefL[3] = (galactic->lastRefL[2] + inputSampleL) / 2; // three quarters
-				galactic->lastRefL[4] = inputSampleL; // full
-				galactic->lastRefR[0] = galactic->lastRefR[4]; // start from previous last
-				galactic->lastRefR[2] = (galactic->lastRefR[0] + inputSampleR) / 2; // half
-				galactic->lastRefR[1] = (galactic->lastRefR[0] + galactic->lastRefR[2]) / 2; // one quarter
-				galactic->lastRefR[3] = (galactic->lastRefR[2] + inputSampleR) / 2; // three quarters
-				galactic->lastRefR[4] = inputSampleR; // full
-			}
-			if (cycleEnd == 3) {
-				galactic->lastRefL[0] = galactic->lastRefL[3]; // start from previous last
-				galactic->lastRefL[2] = (galactic->lastRefL[0] + galactic->lastRefL[0] + inputSampleL) / 3; // third
-				galactic->lastRefL[1] = (galactic->lastRefL[0] + inputSampleL + inputSampleL) / 3; // two thirds
-				galactic->lastRefL[3] = inputSampleL; // full
-				galactic->lastRefR[0] = galactic->lastRefR[3]; // start from previous last
-				galactic->lastRefR[2] = (galactic->lastRefR[0] + galactic->lastRefR[0] + inputSampleR) / 3; // third
-				galactic->lastRefR[1] = (galactic->lastRefR[0] + inputSampleR + inputSampleR) / 3; // two thirds
-				galactic->lastRefR[3] = inputSampleR; // full
+		galactic->delayI = 3407.0 * size;
+		galactic->delayJ = 1823.0 * size;
+		galactic->delayK = 859.0 * size;
+		galactic->delayL = 331.0 * size;
+		galactic->delayA = 4801.0 * size;
+		galactic->delayB = 2909.0 * size;
+		galactic->delayC = 1153.0 * size;
+		galactic->delayD = 461.0 * size;
+		galactic->delayE = 7607.0 * size;
+		galactic->delayF = 4217.0 * size;
+		galactic->delayG = 2269.0 * size;
+		galactic->delayH = 1597.0 * size;
+		galactic->delayM = 256;
+
+		for (uint32_t end = frame + span; frame < end; frame++) {
+			double inputSampleL = *in1;
+			double inputSampleR = *in2;
+			if (fabs(inputSampleL) < 1.18e-23) inputSampleL = galactic->fpdL * 1.18e-17;
+			if (fabs(inputSampleR) < 1.18e-23) inputSampleR = galactic->fpdR * 1.18e-17;
+			double drySampleL = inputSampleL;
+			double drySampleR = inputSampleR;
+
+			galactic->vibM += (galactic->oldfpd * drift);
+			if (galactic->vibM > (3.141592653589793238 * 2.0)) {
+				galactic->vibM = 0.0;
+				galactic->oldfpd = 0.4294967295 + (galactic->fpdL * 0.0000000000618);
 			}
-			if (cycleEnd == 2) {
-				galactic->lastRefL[0] = galactic->lastRefL[2]; // start from previous last
-				galactic->lastRefL[1] = (galactic->lastRefL[0] + inputSampleL) / 2; // half
-				galactic->lastRefL[2] = inputSampleL; // full
-				galactic->lastRefR[0] = galactic->lastRefR[2]; // start from previous last
-				galactic->lastRefR[1] = (galactic->lastRefR[0] + inputSampleR) / 2; // half
-				galactic->lastRefR[2] = inputSampleR; // full
-			}
-			if (cycleEnd == 1) {
-				galactic->lastRefL[0] = inputSampleL;
-				galactic->lastRefR[0] = inputSampleR;
+
+			galactic->aML[galactic->countM] = inputSampleL * attenuate;
+			galactic->aMR[galactic->countM] = inputSampleR * attenuate;
+			galactic->countM++;
+			if (galactic->countM < 0 || galactic->countM > galactic->delayM) galactic->countM = 0;
+
+			double offsetML = (sin(galactic->vibM) + 1.0) * 127;
+			double offsetMR = (sin(galactic->vibM + (3.141592653589793238 / 2.0)) + 1.0) * 127;
+			int workingML = galactic->countM + offsetML;
+			int workingMR = galactic->countM + offsetMR;
+			double interpolML = (galactic->aML[workingML - ((workingML > galactic->delayM) ? galactic->delayM + 1 : 0)] * (1 - (offsetML - floor(offsetML))));
+			interpolML += (galactic->aML[workingML + 1 - ((workingML + 1 > galactic->delayM) ? galactic->delayM + 1 : 0)] * ((offsetML - floor(offsetML))));
+			double interpolMR = (galactic->aMR[workingMR - ((workingMR > galactic->delayM) ? galactic->delayM + 1 : 0)] * (1 - (offsetMR - floor(offsetMR))));
+			interpolMR += (galactic->aMR[workingMR + 1 - ((workingMR + 1 > galactic->delayM) ? galactic->delayM + 1 : 0)] * ((offsetMR - floor(offsetMR))));
+			inputSampleL = interpolML;
+			inputSampleR = interpolMR;
+			// predelay that applies vibrato
+			// want vibrato speed AND depth like in MatrixVerb
+
+			galactic->iirAL = (galactic->iirAL * (1.0 - lowpass)) + (inputSampleL * lowpass);
+			inputSampleL = galactic->iirAL;
+			galactic->iirAR = (galactic->iirAR * (1.0 - lowpass)) + (inputSampleR * lowpass);
+			inputSampleR = galactic->iirAR;
+			// initial filter
+
+			galactic->cycle++;
+			if (galactic->cycle == cycleEnd) { // hit the end point and we do a reverb sample
+				galactic->aIL[galactic->countI] = inputSampleL + (galactic->feedbackAR * regen);
+				galactic->aJL[galactic->countJ] = inputSampleL + (galactic->feedbackBR * regen);
+				galactic->aKL[galactic->countK] = inputSampleL + (galactic->feedbackCR * regen);
+				galactic->aLL[galactic->countL] = inputSampleL + (galactic->feedbackDR * regen);
+				galactic->aIR[galactic->countI] = inputSampleR + (galactic->feedbackAL * regen);
+				galactic->aJR[galactic->countJ] = inputSampleR + (galactic->feedbackBL * regen);
+				galactic->aKR[galactic->countK] = inputSampleR + (galactic->feedbackCL * regen);
+				galactic->aLR[galactic->countL] = inputSampleR + (galactic->feedbackDL * regen);
+
+				galactic->countI++;
+				if (galactic->countI < 0 || galactic->countI > galactic->delayI) galactic->countI = 0;
+				galactic->countJ++;
+				if (galactic->countJ < 0 || galactic->countJ > galactic->delayJ) galactic->countJ = 0;
+				galactic->countK++;
+				if (galactic->countK < 0 || galactic->countK > galactic->delayK) galactic->countK = 0;
+				galactic->countL++;
+				if (galactic->countL < 0 || galactic->countL > galactic->delayL) galactic->countL = 0;
+
+				double outIL = galactic->aIL[galactic->countI - ((galactic->countI > galactic->delayI) ? galactic->delayI + 1 : 0)];
+				double outJL = galactic->aJL[galactic->countJ - ((galactic->countJ > galactic->delayJ) ? galactic->delayJ + 1 : 0)];
+				double outKL = galactic->aKL[galactic->countK - ((galactic->countK > galactic->delayK) ? galactic->delayK + 1 : 0)];
+				double outLL = galactic->aLL[galactic->countL - ((galactic->countL > galactic->delayL) ? galactic->delayL + 1 : 0)];
+				double outIR = galactic->aIR[galactic->countI - ((galactic->countI > galactic->delayI) ? galactic->delayI + 1 : 0)];
+				double outJR = galactic->aJR[galactic->countJ - ((galactic->countJ > galactic->delayJ) ? galactic->delayJ + 1 : 0)];
+				double outKR = galactic->aKR[galactic->countK - ((galactic->countK > galactic->delayK) ? galactic->delayK + 1 : 0)];
+				double outLR = galactic->aLR[galactic->countL - ((galactic->countL > galactic->delayL) ? galactic->delayL + 1 : 0)];
+				// first block: now we have four outputs
+
+				galactic->aAL[galactic->countA] = (outIL - (outJL + outKL + outLL));
+				galactic->aBL[galactic->countB] = (outJL - (outIL + outKL + outLL));
+				galactic->aCL[galactic->countC] = (outKL - (outIL + outJL + outLL));
+				galactic->aDL[galactic->countD] = (outLL - (outIL + outJL + outKL));
+				galactic->aAR[galactic->countA] = (outIR - (outJR + outKR + outLR));
+				galactic->aBR[galactic->countB] = (outJR - (outIR + outKR + outLR));
+				galactic->aCR[galactic->countC] = (outKR - (outIR + outJR + outLR));
+				galactic->aDR[galactic->countD] = (outLR - (outIR + outJR + outKR));
+
+				galactic->countA++;
+				if (galactic->countA < 0 || galactic->countA > galactic->delayA) galactic->countA = 0;
+				galactic->countB++;
+				if (galactic->countB < 0 || galactic->countB > galactic->delayB) galactic->countB = 0;
+				galactic->countC++;
+				if (galactic->countC < 0 || galactic->countC > galactic->delayC) galactic->countC = 0;
+				galactic->countD++;
+				if (galactic->countD < 0 || galactic->countD > galactic->delayD) galactic->countD = 0;
+
+				double outAL = galactic->aAL[galactic->countA - ((galactic->countA > galactic->delayA) ? galactic->delayA + 1 : 0)];
+				double outBL = galactic->aBL[galactic->countB - ((galactic->countB > galactic->delayB) ? galactic->delayB + 1 : 0)];
+				double outCL = galactic->aCL[galactic->countC - ((galactic->countC > galactic->delayC) ? galactic->delayC + 1 : 0)];
+				double outDL = galactic->aDL[galactic->countD - ((galactic->countD > galactic->delayD) ? galactic->delayD + 1 : 0)];
+				double outAR = galactic->aAR[galactic->countA - ((galactic->countA > galactic->delayA) ? galactic->delayA + 1 : 0)];
+				double outBR = galactic->aBR[galactic->countB - ((galactic->countB > galactic->delayB) ? galactic->delayB + 1 : 0)];
+				double outCR = galactic->aCR[galactic->countC - ((galactic->countC > galactic->delayC) ? galactic->delayC + 1 : 0)];
+				double outDR = galactic->aDR[galactic->countD - ((galactic->countD > galactic->delayD) ? galactic->delayD + 1 : 0)];
+				// second block: four more outputs
+
+				galactic->aEL[galactic->countE] = (outAL - (outBL + outCL + outDL));
+				galactic->aFL[galactic->countF] = (outBL - (outAL + outCL + outDL));
+				galactic->aGL[galactic->countG] = (outCL - (outAL + outBL + outDL));
+				galactic->aHL[galactic->countH] = (outDL - (outAL + outBL + outCL));
+				galactic->aER[galactic->countE] = (outAR - (outBR + outCR + outDR));
+				galactic->aFR[galactic->countF] = (outBR - (outAR + outCR + outDR));
+				galactic->aGR[galactic->countG] = (outCR - (outAR + outBR + outDR));
+				galactic->aHR[galactic->countH] = (outDR - (outAR + outBR + outCR));
+
+				galactic->countE++;
+				if (galactic->countE < 0 || galactic->countE > galactic->delayE) galactic->countE = 0;
+				galactic->countF++;
+				if (galactic->countF < 0 || galactic->countF > galactic->delayF) galactic->countF = 0;
+				galactic->countG++;
+				if (galactic->countG < 0 || galactic->countG > galactic->delayG) galactic->countG = 0;
+				galactic->countH++;
+				if (galactic->countH < 0 || galactic->countH > galactic->delayH) galactic->countH = 0;
+
+				double outEL = galactic->aEL[galactic->countE - ((galactic->countE > galactic->delayE) ? galactic->delayE + 1 : 0)];
+				double outFL = galactic->aFL[galactic->countF - ((galactic->countF > galactic->delayF) ? galactic->delayF + 1 : 0)];
+				double outGL = galactic->aGL[galactic->countG - ((galactic->countG > galactic->delayG) ? galactic->delayG + 1 : 0)];
+				double outHL = galactic->aHL[galactic->countH - ((galactic->countH > galactic->delayH) ? galactic->delayH + 1 : 0)];
+				double outER = galactic->aER[galactic->countE - ((galactic->countE > galactic->delayE) ? galactic->delayE + 1 : 0)];
+				double outFR = galactic->aFR[galactic->countF - ((galactic->countF > galactic->delayF) ? galactic->delayF + 1 : 0)];
+				double outGR = galactic->aGR[galactic->countG - ((galactic->countG > galactic->delayG) ? galactic->delayG + 1 : 0)];
+				double outHR = galactic->aHR[galactic->countH - ((galactic->countH > galactic->delayH) ? galactic->delayH + 1 : 0)];
+				// third block: final outputs
+
+				galactic->feedbackAL = (outEL - (outFL + outGL + outHL));
+				galactic->feedbackBL = (outFL - (outEL + outGL + outHL));
+				galactic->feedbackCL = (outGL - (outEL + outFL + outHL));
+				galactic->feedbackDL = (outHL - (outEL + outFL + outGL));
+				galactic->feedbackAR = (outER - (outFR + outGR + outHR));
+				galactic->feedbackBR = (outFR - (outER + outGR + outHR));
+				galactic->feedbackCR = (outGR - (outER + outFR + outHR));
+				galactic->feedbackDR = (outHR - (outER + outFR + outGR));
+				// which we need to feed back into the input again, a bit
+
+				inputSampleL = (outEL + outFL + outGL + outHL) / 8.0;
+				inputSampleR = (outER + outFR + outGR + outHR) / 8.0;
+				// and take the final combined sum of outputs
+				if (cycleEnd == 4) {
+					galactic->lastRefL[0] = galactic->lastRefL[4]; // start from previous last
+					galactic->lastRefL[2] = (galactic->lastRefL[0] + inputSampleL) / 2; // half
+					galactic->lastRefL[1] = (galactic->lastRefL[0] + galactic->lastRefL[2]) / 2; // one quarter
+					galactic->lastRefL[3] = (galactic->lastRefL[2] + inputSampleL) / 2; // three quarters
+					galactic->lastRefL[4] = inputSampleL; // full
+					galactic->lastRefR[0] = galactic->lastRefR[4]; // start from previous last
+					galactic->lastRefR[2] = (galactic->lastRefR[0] + inputSampleR) / 2; // half
+					galactic->lastRefR[1] = (galactic->lastRefR[0] + galactic->lastRefR[2]) / 2; // one quarter
+					galactic->lastRefR[3] = (galactic->lastRefR[2] + inputSampleR) / 2; // three quarters
+					galactic->lastRefR[4] = inputSampleR; // full
+				}
+				if (cycleEnd == 3) {
+					galactic->lastRefL[0] = galactic->lastRefL[3]; // start from previous last
+					galactic->lastRefL[2] = (galactic->lastRefL[0] + galactic->lastRefL[0] + inputSampleL) / 3; // third
+					galactic->lastRefL[1] = (galactic->lastRefL[0] + inputSampleL + inputSampleL) / 3; // two thirds
+					galactic->lastRefL[3] = inputSampleL; // full
+					galactic->lastRefR[0] = galactic->lastRefR[3]; // start from previous last
+					galactic->lastRefR[2] = (galactic->lastRefR[0] + galactic->lastRefR[0] + inputSampleR) / 3; // third
+					galactic->lastRefR[1] = (galactic->lastRefR[0] + inputSampleR + inputSampleR) / 3; // two thirds
+					galactic->lastRefR[3] = inputSampleR; // full
+				}
+				if (cycleEnd == 2) {
+					galactic->lastRefL[0] = galactic->lastRefL[2]; // start from previous last
+					galactic->lastRefL[1] = (galactic->lastRefL[0] + inputSampleL) / 2; // half
+					galactic->lastRefL[2] = inputSampleL; // full
+					galactic->lastRefR[0] = galactic->lastRefR[2]; // start from previous last
+					galactic->lastRefR[1] = (galactic->lastRefR[0] + inputSampleR) / 2; // half
+					galactic->lastRefR[2] = inputSampleR; // full
+				}
+				if (cycleEnd == 1) {
+					galactic->lastRefL[0] = inputSampleL;
+					galactic->lastRefR[0] = inputSampleR;
+				}
+				galactic->cycle = 0; // reset
+				inputSampleL = galactic->lastRefL[galactic->cycle];
+				inputSampleR = galactic->lastRefR[galactic->cycle];
+			} else {
+				inputSampleL = galactic->lastRefL[galactic->cycle];
+				inputSampleR = galactic->lastRefR[galactic->cycle];
+				// we are going through our references now
 			}
-			galactic->cycle = 0; // reset
-			inputSampleL = galactic->lastRefL[galactic->cycle];
-			inputSampleR = galactic->lastRefR[galactic->cycle];
-		} else {
-			inputSampleL = galactic->lastRefL[galactic->cycle];
-			inputSampleR = galactic->lastRefR[galactic->cycle];
-			// we are going through our references now
-		}
 
-		galactic->iirBL = (galactic->iirBL * (1.0 - lowpass)) + (inputSampleL * lowpass);
-		inputSampleL = galactic->iirBL;
-		galactic->iirBR = (galactic->iirBR * (1.0 - lowpass)) + (inputSampleR * lowpass);
-		inputSampleR = galactic->iirBR;
-		// end filter
+			galactic->iirBL = (galactic->iirBL * (1.0 - lowpass)) + (inputSampleL * lowpass);
+			inputSampleL = galactic->iirBL;
+			galactic->iirBR = (galactic->iirBR * (1.0 - lowpass)) + (inputSampleR * lowpass);
+			inputSampleR = galactic->iirBR;
+			// end filter
 
-		if (wet < 1.0) {
-			inputSampleL = (inputSampleL * wet) + (drySampleL * (1.0 - wet));
-			inputSampleR = (inputSampleR * wet) + (drySampleR * (1.0 - wet));
+			if (wet < 1.0) {
+				inputSampleL = (inputSampleL * wet) + (drySampleL * (1.0 - wet));
+				inputSampleR = (inputSampleR * wet) + (drySampleR * (1.0 - wet));
+			}
+			wet += wetRamp;
+
+			// begin 32 bit stereo floating point dither
+			int expon;
+			frexpf((float) inputSampleL, &expon);
+			galactic->fpdL ^= galactic->fpdL << 13;
+			galactic->fpdL ^= galactic->fpdL >> 17;
+			galactic->fpdL ^= galactic->fpdL << 5;
+			inputSampleL += ((((double) galactic->fpdL) - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+			frexpf((float) inputSampleR, &expon);
+			galactic->fpdR ^= galactic->fpdR << 13;
+			galactic->fpdR ^= galactic->fpdR >> 17;
+			galactic->fpdR ^= galactic->fpdR << 5;
+			inputSampleR += ((((double) galactic->fpdL) - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+			// end 32 bit stereo floating point dither
+
+			*out1 = (float) inputSampleL;
+			*out2 = (float) inputSampleR;
+
+			in1++;
+			in2++;
+			out1++;
+			out2++;
 		}
-
-		// begin 32 bit stereo floating point dither
-		int expon;
-		frexpf((float) inputSampleL, &expon);
-		galactic->fpdL ^= galactic->fpdL << 13;
-		galactic->fpdL ^= galactic->fpdL >> 17;
-		galactic->fpdL ^= galactic->fpdL << 5;
-		inputSampleL += ((((double) galactic->fpdL) - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		frexpf((float) inputSampleR, &expon);
-		galactic->fpdR ^= galactic->fpdR << 13;
-		galactic->fpdR ^= galactic->fpdR >> 17;
-		galactic->fpdR ^= galactic->fpdR << 5;
-		inputSampleR += ((((double) galactic->fpdL) - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		// end 32 bit stereo floating point dither
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
 	}
+
+	silence_track(&galactic->silence, galactic->output[0], galactic->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
@@ -532,17 +586,25 @@ static const void* extension_data(const char* uri)
 	return NULL;
 }
 
-static const LV2_Descriptor descriptor = {
-	GALACTIC_URI,
-	instantiate,
-	connect_port,
-	activate,
-	run,
-	deactivate,
-	cleanup,
-	extension_data};
+static const LV2_Descriptor descriptors[] = {
+	{GALACTIC_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{GALACTICCV_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data}};
 
 LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
 {
-	return index == 0 ? &descriptor : NULL;
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
 }
@@ -5,6 +5,10 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/air.h"
+#include "../common/dispatch.h"
+#include "../common/fastmath.h"
+
 #define GLITCHSHIFTER_URI "https://hannesbraun.net/ns/lv2/airwindows/glitchshifter"
 
 typedef enum {
@@ -19,6 +23,16 @@ typedef enum {
 	DRY_WET = 8
 } PortIndex;
 
+typedef struct {
+	int32_t offset[258];
+	int32_t pastzero[258];
+	int32_t previous[258];
+	int32_t third[258];
+	int32_t fourth[258];
+	int crosses;
+	int realzeroes;
+} ZeroCrosses; // registry of source zero crosses to splice to, per channel
+
 typedef struct {
 	const float* input[2];
 	float* output[2];
@@ -29,50 +43,28 @@ typedef struct {
 	const float* dryWet;
 
 	int32_t pL[131076];
-	int32_t offsetL[258];
-	int32_t pastzeroL[258];
-	int32_t previousL[258];
-	int32_t thirdL[258];
-	int32_t fourthL[258];
+	ZeroCrosses crossesL;
 	int32_t tempL;
 	int32_t lasttempL;
 	int32_t thirdtempL;
 	int32_t fourthtempL;
 	int32_t sincezerocrossL;
-	int crossesL;
-	int realzeroesL;
 	double positionL;
 	bool splicingL;
 
-	double airPrevL;
-	double airEvenL;
-	double airOddL;
-	double airFactorL;
-
 	int32_t pR[131076];
-	int32_t offsetR[258];
-	int32_t pastzeroR[258];
-	int32_t previousR[258];
-	int32_t thirdR[258];
-	int32_t fourthR[258];
+	ZeroCrosses crossesR;
 	int32_t tempR;
 	int32_t lasttempR;
 	int32_t thirdtempR;
 	int32_t fourthtempR;
 	int32_t sincezerocrossR;
-	int crossesR;
-	int realzeroesR;
 	double positionR;
 	bool splicingR;
 
-	double airPrevR;
-	double airEvenR;
-	double airOddR;
-	double airFactorR;
-
 	int gcount;
 	int32_t lastwidth;
-	bool flip;
+	Air air;
 	uint32_t fpdL;
 	uint32_t fpdR;
 } GlitchShifter;
@@ -122,6 +114,86 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 	}
 }
 
+static inline void zero_crosses_clear(ZeroCrosses* z)
+{
+	for (int count = 0; count < 257; count++) {
+		z->offset[count] = 0;
+		z->pastzero[count] = 0;
+		z->previous[count] = 0;
+		z->third[count] = 0;
+		z->fourth[count] = 0;
+	}
+	z->crosses = 0;
+	z->realzeroes = 0;
+}
+
+static inline void zero_crosses_register(ZeroCrosses* z, const int32_t* p, int count, int countone, int counttwo)
+{
+	if ((p[countone] > 0 && p[count] < 0) || (p[countone] < 0 && p[count] > 0)) // source crossed zero
+	{
+		z->crosses++;
+		z->realzeroes++;
+		if (z->crosses > 256) {
+			z->crosses = 0;
+		} // wrap crosses to keep adding new crosses
+		if (z->realzeroes > 256) {
+			z->realzeroes = 256;
+		} // don't wrap realzeroes, full buffer, use all
+		z->offset[z->crosses] = count;
+		z->pastzero[z->crosses] = p[count];
+		z->previous[z->crosses] = p[countone];
+		z->third[z->crosses] = p[counttwo];
+		// we load the zero crosses register with crosses to examine
+	} // we just put in a source zero cross in the registry
+}
+
+static inline int zero_crosses_best(const ZeroCrosses* z, int32_t temp, int32_t lasttemp, int32_t thirdtemp, int32_t fourthtemp, double bias)
+{
+	int32_t distance[256];
+	int unwrapped = 257 - z->crosses;
+	if (unwrapped > z->realzeroes) unwrapped = z->realzeroes;
+	// the scanned crosses are two contiguous runs of the registry, scored without branches
+	for (int scan = 0; scan < unwrapped; scan++) {
+		int scanone = scan + z->crosses;
+		distance[scan] = (temp - z->pastzero[scanone]) + (lasttemp - z->previous[scanone]) + (thirdtemp - z->third[scanone]) + (fourthtemp - z->fourth[scanone]);
+	}
+	for (int scan = unwrapped; scan < z->realzeroes; scan++) {
+		int scanone = scan + z->crosses - 256;
+		distance[scan] = (temp - z->pastzero[scanone]) + (lasttemp - z->previous[scanone]) + (thirdtemp - z->third[scanone]) + (fourthtemp - z->fourth[scanone]);
+	}
+
+	double diff = 99999999.0;
+	int best = 0;
+	for (int scan = (z->realzeroes - 1); scan >= 0; scan--) {
+		// try to track the real most recent ones more closely
+		double howdiff = (double) distance[scan];
+		// got difference factor between things
+		howdiff -= (double) (scan * bias);
+		// try to bias in favor of more recent crosses
+		if (howdiff < diff) {
+			diff = howdiff;
+			best = scan + z->crosses;
+			if (best > 256) {
+				best -= 256;
+			}
+		}
+	} // now we have 'best' as the closest match to the current rate of zero cross and positioning- a splice.
+	return best;
+}
+
+// Same result as adding or subtracting width until 0 <= count <= width, but
+// without looping when a change of width leaves a tap far out of range
+static inline int wrap_count(int count, int width)
+{
+	if (count < 0) {
+		count %= width;
+		if (count < 0) count += width;
+	} else if (count > width) {
+		count = ((count - 1) % width) + 1;
+	}
+	return count;
+}
+
 static void activate(LV2_Handle instance)
 {
 	GlitchShifter* glitchShifter = (GlitchShifter*) instance;
@@ -130,49 +202,27 @@ static void activate(LV2_Handle instance)
 		glitchShifter->pL[count] = 0;
 		glitchShifter->pR[count] = 0;
 	}
-	for (int count = 0; count < 257; count++) {
-		glitchShifter->offsetL[count] = 0;
-		glitchShifter->pastzeroL[count] = 0;
-		glitchShifter->previousL[count] = 0;
-		glitchShifter->thirdL[count] = 0;
-		glitchShifter->fourthL[count] = 0;
-		glitchShifter->offsetR[count] = 0;
-		glitchShifter->pastzeroR[count] = 0;
-		glitchShifter->previousR[count] = 0;
-		glitchShifter->thirdR[count] = 0;
-		glitchShifter->fourthR[count] = 0;
-	}
-	glitchShifter->crossesL = 0;
-	glitchShifter->realzeroesL = 0;
+	zero_crosses_clear(&glitchShifter->crossesL);
+	zero_crosses_clear(&glitchShifter->crossesR);
 	glitchShifter->tempL = 0;
 	glitchShifter->lasttempL = 0;
 	glitchShifter->thirdtempL = 0;
 	glitchShifter->fourthtempL = 0;
 	glitchShifter->sincezerocrossL = 0;
-	glitchShifter->airPrevL = 0.0;
-	glitchShifter->airEvenL = 0.0;
-	glitchShifter->airOddL = 0.0;
-	glitchShifter->airFactorL = 0.0;
 	glitchShifter->positionL = 0.0;
 	glitchShifter->splicingL = false;
 
-	glitchShifter->crossesR = 0;
-	glitchShifter->realzeroesR = 0;
 	glitchShifter->tempR = 0;
 	glitchShifter->lasttempR = 0;
 	glitchShifter->thirdtempR = 0;
 	glitchShifter->fourthtempR = 0;
 	glitchShifter->sincezerocrossR = 0;
-	glitchShifter->airPrevR = 0.0;
-	glitchShifter->airEvenR = 0.0;
-	glitchShifter->airOddR = 0.0;
-	glitchShifter->airFactorR = 0.0;
 	glitchShifter->positionR = 0.0;
 	glitchShifter->splicingR = false;
 
 	glitchShifter->gcount = 0;
 	glitchShifter->lastwidth = 16386;
-	glitchShifter->flip = false;
+	air_reset(&glitchShifter->air);
 
 	glitchShifter->fpdL = 1.0;
 	while (glitchShifter->fpdL < 16386) glitchShifter->fpdL = rand() * UINT32_MAX;
@@ -180,7 +230,7 @@ static void activate(LV2_Handle instance)
 	while (glitchShifter->fpdR < 16386) glitchShifter->fpdR = rand() * UINT32_MAX;
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+CPU_DISPATCH static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	GlitchShifter* glitchShifter = (GlitchShifter*) instance;
 
@@ -207,44 +257,14 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		double drySampleL = inputSampleL;
 		double drySampleR = inputSampleR;
 
-		glitchShifter->airFactorL = glitchShifter->airPrevL - inputSampleL;
-		if (glitchShifter->flip) {
-			glitchShifter->airEvenL += glitchShifter->airFactorL;
-			glitchShifter->airOddL -= glitchShifter->airFactorL;
-			glitchShifter->airFactorL = glitchShifter->airEvenL;
-		} else {
-			glitchShifter->airOddL += glitchShifter->airFactorL;
-			glitchShifter->airEvenL -= glitchShifter->airFactorL;
-			glitchShifter->airFactorL = glitchShifter->airOddL;
-		}
-		glitchShifter->airOddL = (glitchShifter->airOddL - ((glitchShifter->airOddL - glitchShifter->airEvenL) / 256.0)) / 1.0001;
-		glitchShifter->airEvenL = (glitchShifter->airEvenL - ((glitchShifter->airEvenL - glitchShifter->airOddL) / 256.0)) / 1.0001;
-		glitchShifter->airPrevL = inputSampleL;
-		inputSampleL += glitchShifter->airFactorL;
-
-		glitchShifter->airFactorR = glitchShifter->airPrevR - inputSampleR;
-		if (glitchShifter->flip) {
-			glitchShifter->airEvenR += glitchShifter->airFactorR;
-			glitchShifter->airOddR -= glitchShifter->airFactorR;
-			glitchShifter->airFactorR = glitchShifter->airEvenR;
-		} else {
-			glitchShifter->airOddR += glitchShifter->airFactorR;
-			glitchShifter->airEvenR -= glitchShifter->airFactorR;
-			glitchShifter->airFactorR = glitchShifter->airOddR;
-		}
-		glitchShifter->airOddR = (glitchShifter->airOddR - ((glitchShifter->airOddR - glitchShifter->airEvenR) / 256.0)) / 1.0001;
-		glitchShifter->airEvenR = (glitchShifter->airEvenR - ((glitchShifter->airEvenR - glitchShifter->airOddR) / 256.0)) / 1.0001;
-		glitchShifter->airPrevR = inputSampleR;
-		inputSampleR += glitchShifter->airFactorR;
-
-		glitchShifter->flip = !glitchShifter->flip;
+		air_process(&glitchShifter->air, &inputSampleL, &inputSampleR);
 		// air, compensates for loss of highs of interpolation
 
 		if (glitchShifter->lastwidth != width) {
-			glitchShifter->crossesL = 0;
-			glitchShifter->realzeroesL = 0;
-			glitchShifter->crossesR = 0;
-			glitchShifter->realzeroesR = 0;
+			glitchShifter->crossesL.crosses = 0;
+			glitchShifter->crossesL.realzeroes = 0;
+			glitchShifter->crossesR.crosses = 0;
+			glitchShifter->crossesR.realzeroes = 0;
 			glitchShifter->lastwidth = width;
 		}
 		// global: changing this resets both channels
@@ -256,24 +276,9 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		int count = glitchShifter->gcount;
 		int countone = count - 1;
 		int counttwo = count - 2;
-		while (count < 0) {
-			count += width;
-		}
-		while (countone < 0) {
-			countone += width;
-		}
-		while (counttwo < 0) {
-			counttwo += width;
-		}
-		while (count > width) {
-			count -= width;
-		} // this can only happen with very insane variables
-		while (countone > width) {
-			countone -= width;
-		}
-		while (counttwo > width) {
-			counttwo -= width;
-		}
+		count = wrap_count(count, width);
+		countone = wrap_count(countone, width);
+		counttwo = wrap_count(counttwo, width);
 		// yay sanity checks
 		// now we have counts zero, one, two, none of which have sanity checked values
 		// we are tracking most recent samples and must SUBTRACT.
@@ -283,106 +288,39 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		glitchShifter->pR[count + width] = glitchShifter->pR[count] = (int) ((inputSampleR * 8388352.0) + (double) (glitchShifter->lasttempR * feedback));
 		// double buffer -8388352 to 8388352 is equal to 24 bit linear space
 
-		if ((glitchShifter->pL[countone] > 0 && glitchShifter->pL[count] < 0) || (glitchShifter->pL[countone] < 0 && glitchShifter->pL[count] > 0)) // source crossed zero
-		{
-			glitchShifter->crossesL++;
-			glitchShifter->realzeroesL++;
-			if (glitchShifter->crossesL > 256) {
-				glitchShifter->crossesL = 0;
-			} // wrap crosses to keep adding new crosses
-			if (glitchShifter->realzeroesL > 256) {
-				glitchShifter->realzeroesL = 256;
-			} // don't wrap realzeroes, full buffer, use all
-			glitchShifter->offsetL[glitchShifter->crossesL] = count;
-			glitchShifter->pastzeroL[glitchShifter->crossesL] = glitchShifter->pL[count];
-			glitchShifter->previousL[glitchShifter->crossesL] = glitchShifter->pL[countone];
-			glitchShifter->thirdL[glitchShifter->crossesL] = glitchShifter->pL[counttwo];
-			// we load the zero crosses register with crosses to examine
-		} // we just put in a source zero cross in the registry
-
-		if ((glitchShifter->pR[countone] > 0 && glitchShifter->pR[count] < 0) || (glitchShifter->pR[countone] < 0 && glitchShifter->pR[count] > 0)) // source crossed zero
-		{
-			glitchShifter->crossesR++;
-			glitchShifter->realzeroesR++;
-			if (glitchShifter->crossesR > 256) {
-				glitchShifter->crossesR = 0;
-			} // wrap crosses to keep adding new crosses
-			if (glitchShifter->realzeroesR > 256) {
-				glitchShifter->realzeroesR = 256;
-			} // don't wrap realzeroes, full buffer, use all
-			glitchShifter->offsetR[glitchShifter->crossesR] = count;
-			glitchShifter->pastzeroR[glitchShifter->crossesR] = glitchShifter->pR[count];
-			glitchShifter->previousR[glitchShifter->crossesR] = glitchShifter->pR[countone];
-			glitchShifter->thirdR[glitchShifter->crossesR] = glitchShifter->pR[counttwo];
-			// we load the zero crosses register with crosses to examine
-		} // we just put in a source zero cross in the registry
+		zero_crosses_register(&glitchShifter->crossesL, glitchShifter->pL, count, countone, counttwo);
+		zero_crosses_register(&glitchShifter->crossesR, glitchShifter->pR, count, countone, counttwo);
 		// in this we don't update count at all, so we can run them one after another because this is
 		// feeding the system, not tracking the output of two parallel but non-matching output taps
 
 		glitchShifter->positionL -= speed; // this is individual to each channel!
 
 		if (glitchShifter->positionL > width) { // we just caught up to the buffer end
-			if (glitchShifter->realzeroesL > 0) { // we just caught up to the buffer end with zero crosses in the bin
-				glitchShifter->positionL = 0;
-				double diff = 99999999.0;
-				int best = 0; // these can be local, I think
-				int scan;
-				for (scan = (glitchShifter->realzeroesL - 1); scan >= 0; scan--) {
-					int scanone = scan + glitchShifter->crossesL;
-					if (scanone > 256) {
-						scanone -= 256;
-					}
-					// try to track the real most recent ones more closely
-					double howdiff = (double) ((glitchShifter->tempL - glitchShifter->pastzeroL[scanone]) + (glitchShifter->lasttempL - glitchShifter->previousL[scanone]) + (glitchShifter->thirdtempL - glitchShifter->thirdL[scanone]) + (glitchShifter->fourthtempL - glitchShifter->fourthL[scanone]));
-					// got difference factor between things
-					howdiff -= (double) (scan * bias);
-					// try to bias in favor of more recent crosses
-					if (howdiff < diff) {
-						diff = howdiff;
-						best = scanone;
-					}
-				} // now we have 'best' as the closest match to the current rate of zero cross and positioning- a splice.
-				glitchShifter->positionL = glitchShifter->offsetL[best] - glitchShifter->sincezerocrossL;
-				glitchShifter->crossesL = 0;
-				glitchShifter->realzeroesL = 0;
+			if (glitchShifter->crossesL.realzeroes > 0) { // we just caught up to the buffer end with zero crosses in the bin
+				int best = zero_crosses_best(&glitchShifter->crossesL, glitchShifter->tempL, glitchShifter->lasttempL, glitchShifter->thirdtempL, glitchShifter->fourthtempL, bias);
+				glitchShifter->positionL = glitchShifter->crossesL.offset[best] - glitchShifter->sincezerocrossL;
+				glitchShifter->crossesL.crosses = 0;
+				glitchShifter->crossesL.realzeroes = 0;
 				glitchShifter->splicingL = true; // we just kicked the delay tap back, changing positionL
 			} else { // we just caught up to the buffer end with no crosses- glitch speeds.
 				glitchShifter->positionL -= width;
-				glitchShifter->crossesL = 0;
-				glitchShifter->realzeroesL = 0;
+				glitchShifter->crossesL.crosses = 0;
+				glitchShifter->crossesL.realzeroes = 0;
 				glitchShifter->splicingL = true; // so, hard splice it.
 			}
 		}
 
 		if (glitchShifter->positionL < 0) { // we just caught up to the dry tap.
-			if (glitchShifter->realzeroesL > 0) { // we just caught up to the dry tap with zero crosses in the bin
-				glitchShifter->positionL = 0;
-				double diff = 99999999.0;
-				int best = 0; // these can be local, I think
-				int scan;
-				for (scan = (glitchShifter->realzeroesL - 1); scan >= 0; scan--) {
-					int scanone = scan + glitchShifter->crossesL;
-					if (scanone > 256) {
-						scanone -= 256;
-					}
-					// try to track the real most recent ones more closely
-					double howdiff = (double) ((glitchShifter->tempL - glitchShifter->pastzeroL[scanone]) + (glitchShifter->lasttempL - glitchShifter->previousL[scanone]) + (glitchShifter->thirdtempL - glitchShifter->thirdL[scanone]) + (glitchShifter->fourthtempL - glitchShifter->fourthL[scanone]));
-					// got difference factor between things
-					howdiff -= (double) (scan * bias);
-					// try to bias in favor of more recent crosses
-					if (howdiff < diff) {
-						diff = howdiff;
-						best = scanone;
-					}
-				} // now we have 'best' as the closest match to the current rate of zero cross and positioning- a splice.
-				glitchShifter->positionL = glitchShifter->offsetL[best] - glitchShifter->sincezerocrossL;
-				glitchShifter->crossesL = 0;
-				glitchShifter->realzeroesL = 0;
+			if (glitchShifter->crossesL.realzeroes > 0) { // we just caught up to the dry tap with zero crosses in the bin
+				int best = zero_crosses_best(&glitchShifter->crossesL, glitchShifter->tempL, glitchShifter->lasttempL, glitchShifter->thirdtempL, glitchShifter->fourthtempL, bias);
+				glitchShifter->positionL = glitchShifter->crossesL.offset[best] - glitchShifter->sincezerocrossL;
+				glitchShifter->crossesL.crosses = 0;
+				glitchShifter->crossesL.realzeroes = 0;
 				glitchShifter->splicingL = true; // we just kicked the delay tap back, changing positionL
 			} else { // we just caught up to the dry tap with no crosses- glitch speeds.
 				glitchShifter->positionL += width;
-				glitchShifter->crossesL = 0;
-				glitchShifter->realzeroesL = 0;
+				glitchShifter->crossesL.crosses = 0;
+				glitchShifter->crossesL.realzeroes = 0;
 				glitchShifter->splicingL = true; // so, hard splice it.
 			}
 		}
@@ -390,67 +328,31 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		glitchShifter->positionR -= speed; // this is individual to each channel!
 
 		if (glitchShifter->positionR > width) { // we just caught up to the buffer end
-			if (glitchShifter->realzeroesR > 0) { // we just caught up to the buffer end with zero crosses in the bin
-				glitchShifter->positionR = 0;
-				double diff = 99999999.0;
-				int best = 0; // these can be local, I think
-				int scan;
-				for (scan = (glitchShifter->realzeroesR - 1); scan >= 0; scan--) {
-					int scanone = scan + glitchShifter->crossesR;
-					if (scanone > 256) {
-						scanone -= 256;
-					}
-					// try to track the real most recent ones more closely
-					double howdiff = (double) ((glitchShifter->tempR - glitchShifter->pastzeroR[scanone]) + (glitchShifter->lasttempR - glitchShifter->previousR[scanone]) + (glitchShifter->thirdtempR - glitchShifter->thirdR[scanone]) + (glitchShifter->fourthtempR - glitchShifter->fourthR[scanone]));
-					// got difference factor between things
-					howdiff -= (double) (scan * bias);
-					// try to bias in favor of more recent crosses
-					if (howdiff < diff) {
-						diff = howdiff;
-						best = scanone;
-					}
-				} // now we have 'best' as the closest match to the current rate of zero cross and positioning- a splice.
-				glitchShifter->positionR = glitchShifter->offsetR[best] - glitchShifter->sincezerocrossR;
-				glitchShifter->crossesR = 0;
-				glitchShifter->realzeroesR = 0;
-				glitchShifter->splicingR = true; // we just kicked the delay tap back, changing positionL
+			if (glitchShifter->crossesR.realzeroes > 0) { // we just caught up to the buffer end with zero crosses in the bin
+				int best = zero_crosses_best(&glitchShifter->crossesR, glitchShifter->tempR, glitchShifter->lasttempR, glitchShifter->thirdtempR, glitchShifter->fourthtempR, bias);
+				glitchShifter->positionR = glitchShifter->crossesR.offset[best] - glitchShifter->sincezerocrossR;
+				glitchShifter->crossesR.crosses = 0;
+				glitchShifter->crossesR.realzeroes = 0;
+				glitchShifter->splicingR = true; // we just kicked the delay tap back, changing positionR
 			} else { // we just caught up to the buffer end with no crosses- glitch speeds.
 				glitchShifter->positionR -= width;
-				glitchShifter->crossesR = 0;
-				glitchShifter->realzeroesR = 0;
+				glitchShifter->crossesR.crosses = 0;
+				glitchShifter->crossesR.realzeroes = 0;
 				glitchShifter->splicingR = true; // so, hard splice it.
 			}
 		}
 
 		if (glitchShifter->positionR < 0) { // we just caught up to the dry tap.
-			if (glitchShifter->realzeroesR > 0) { // we just caught up to the dry tap with zero crosses in the bin
-				glitchShifter->positionR = 0;
-				double diff = 99999999.0;
-				int best = 0; // these can be local, I think
-				int scan;
-				for (scan = (glitchShifter->realzeroesR - 1); scan >= 0; scan--) {
-					int scanone = scan + glitchShifter->crossesR;
-					if (scanone > 256) {
-						scanone -= 256;
-					}
-					// try to track the real most recent ones more closely
-					double howdiff = (double) ((glitchShifter->tempR - glitchShifter->pastzeroR[scanone]) + (glitchShifter->lasttempR - glitchShifter->previousR[scanone]) + (glitchShifter->thirdtempR - glitchShifter->thirdR[scanone]) + (glitchShifter->fourthtempR - glitchShifter->fourthR[scanone]));
-					// got difference factor between things
-					howdiff -= (double) (scan * bias);
-					// try to bias in favor of more recent crosses
-					if (howdiff < diff) {
-						diff = howdiff;
-						best = scanone;
-					}
-				} // now we have 'best' as the closest match to the current rate of zero cross and positioning- a splice.
-				glitchShifter->positionR = glitchShifter->offsetR[best] - glitchShifter->sincezerocrossR;
-				glitchShifter->crossesR = 0;
-				glitchShifter->realzeroesR = 0;
-				glitchShifter->splicingR = true; // we just kicked the delay tap back, changing positionL
+			if (glitchShifter->crossesR.realzeroes > 0) { // we just caught up to the dry tap with zero crosses in the bin
+				int best = zero_crosses_best(&glitchShifter->crossesR, glitchShifter->tempR, glitchShifter->lasttempR, glitchShifter->thirdtempR, glitchShifter->fourthtempR, bias);
+				glitchShifter->positionR = glitchShifter->crossesR.offset[best] - glitchShifter->sincezerocrossR;
+				glitchShifter->crossesR.crosses = 0;
+				glitchShifter->crossesR.realzeroes = 0;
+				glitchShifter->splicingR = true; // we just kicked the delay tap back, changing positionR
 			} else { // we just caught up to the dry tap with no crosses- glitch speeds.
 				glitchShifter->positionR += width;
-				glitchShifter->crossesR = 0;
-				glitchShifter->realzeroesR = 0;
+				glitchShifter->crossesR.crosses = 0;
+				glitchShifter->crossesR.realzeroes = 0;
 				glitchShifter->splicingR = true; // so, hard splice it.
 			}
 		}
@@ -461,24 +363,9 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		counttwo = count + 2;
 		// now we have counts zero, one, two, none of which have sanity checked values
 		// we are interpolating, we ADD
-		while (count < 0) {
-			count += width;
-		}
-		while (countone < 0) {
-			countone += width;
-		}
-		while (counttwo < 0) {
-			counttwo += width;
-		}
-		while (count > width) {
-			count -= width;
-		} // this can only happen with very insane variables
-		while (countone > width) {
-			countone -= width;
-		}
-		while (counttwo > width) {
-			counttwo -= width;
-		}
+		count = wrap_count(count, width);
+		countone = wrap_count(countone, width);
+		counttwo = wrap_count(counttwo, width);
 
 		// here's where we do our shift against the rotating buffer
 		glitchShifter->tempL = 0;
@@ -514,24 +401,9 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		counttwo = count + 2;
 		// now we have counts zero, one, two, none of which have sanity checked values
 		// we are interpolating, we ADD
-		while (count < 0) {
-			count += width;
-		}
-		while (countone < 0) {
-			countone += width;
-		}
-		while (counttwo < 0) {
-			counttwo += width;
-		}
-		while (count > width) {
-			count -= width;
-		} // this can only happen with very insane variables
-		while (countone > width) {
-			countone -= width;
-		}
-		while (counttwo > width) {
-			counttwo -= width;
-		}
+		count = wrap_count(count, width);
+		countone = wrap_count(countone, width);
+		counttwo = wrap_count(counttwo, width);
 
 		glitchShifter->tempR = 0;
 		glitchShifter->tempR += (int) (glitchShifter->pR[count] * (1 - (glitchShifter->positionR - floor(glitchShifter->positionR)))); // less as value moves away from .0
@@ -583,12 +455,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		glitchShifter->fpdL ^= glitchShifter->fpdL << 13;
 		glitchShifter->fpdL ^= glitchShifter->fpdL >> 17;
 		glitchShifter->fpdL ^= glitchShifter->fpdL << 5;
-		inputSampleL += (((double) glitchShifter->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) glitchShifter->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		glitchShifter->fpdR ^= glitchShifter->fpdR << 13;
 		glitchShifter->fpdR ^= glitchShifter->fpdR >> 17;
 		glitchShifter->fpdR ^= glitchShifter->fpdR << 5;
-		inputSampleR += (((double) glitchShifter->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) glitchShifter->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define GOLDENSLEW_URI "https://hannesbraun.net/ns/lv2/airwindows/goldenslew"
 
 typedef enum {
@@ -166,12 +168,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		goldenSlew->fpdL ^= goldenSlew->fpdL << 13;
 		goldenSlew->fpdL ^= goldenSlew->fpdL >> 17;
 		goldenSlew->fpdL ^= goldenSlew->fpdL << 5;
-		inputSampleL += (((double) goldenSlew->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) goldenSlew->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		goldenSlew->fpdR ^= goldenSlew->fpdR << 13;
 		goldenSlew->fpdR ^= goldenSlew->fpdR >> 17;
 		goldenSlew->fpdR ^= goldenSlew->fpdR << 5;
-		inputSampleR += (((double) goldenSlew->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) goldenSlew->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
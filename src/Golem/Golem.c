@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define GOLEM_URI "https://hannesbraun.net/ns/lv2/airwindows/golem"
 
 typedef enum {
@@ -160,12 +162,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		golem->fpdL ^= golem->fpdL << 13;
 		golem->fpdL ^= golem->fpdL >> 17;
 		golem->fpdL ^= golem->fpdL << 5;
-		inputSampleL += (((double) golem->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) golem->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		golem->fpdR ^= golem->fpdR << 13;
 		golem->fpdR ^= golem->fpdR >> 17;
 		golem->fpdR ^= golem->fpdR << 5;
-		inputSampleR += (((double) golem->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) golem->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
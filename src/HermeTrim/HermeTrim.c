@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define HERMETRIM_URI "https://hannesbraun.net/ns/lv2/airwindows/hermetrim"
 
 typedef enum {
@@ -128,12 +130,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		hermetrim->fpdL ^= hermetrim->fpdL << 13;
 		hermetrim->fpdL ^= hermetrim->fpdL >> 17;
 		hermetrim->fpdL ^= hermetrim->fpdL << 5;
-		inputSampleL += (((double) hermetrim->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) hermetrim->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		hermetrim->fpdR ^= hermetrim->fpdR << 13;
 		hermetrim->fpdR ^= hermetrim->fpdR >> 17;
 		hermetrim->fpdR ^= hermetrim->fpdR << 5;
-		inputSampleR += (((double) hermetrim->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) hermetrim->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
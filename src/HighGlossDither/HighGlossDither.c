@@ -5,7 +5,13 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/blocklength.h"
+#include "../common/dispatch.h"
+
 #define HIGHGLOSSDITHER_URI "https://hannesbraun.net/ns/lv2/airwindows/highglossdither"
+#define HIGHGLOSSDITHER_CHUNK 256
+#define HIGHGLOSSDITHER_CHUNK_MAX 8192
+#define HOTBIN_TABLE_SIZE 17011
 
 typedef enum {
 	INPUT_L = 0,
@@ -18,12 +24,21 @@ typedef struct {
 	const float* input[2];
 	float* output[2];
 
-	int position;
+	uint32_t position;
 	bool flip;
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	// The tail of the quadratic modulo chain (% 1709, % 173, % 17 and the
+	// final scaling) only depends on what is left after % 17011
+	int8_t hotbinTable[HOTBIN_TABLE_SIZE];
+
+	uint32_t chunk; // frames per pass, a whole run if the host bounds it
+	int* hotbin;
 } HighGlossDither;
 
+static void cleanup(LV2_Handle instance);
+
 static LV2_Handle instantiate(
 	const LV2_Descriptor* descriptor,
 	double rate,
@@ -31,6 +46,26 @@ static LV2_Handle instantiate(
 	const LV2_Feature* const* features)
 {
 	HighGlossDither* highGlossDither = (HighGlossDither*) calloc(1, sizeof(HighGlossDither));
+	if (!highGlossDither) return NULL;
+
+	highGlossDither->chunk = block_length_chunk(block_length_from_features(features), HIGHGLOSSDITHER_CHUNK, HIGHGLOSSDITHER_CHUNK_MAX);
+	highGlossDither->hotbin = (int*) calloc(highGlossDither->chunk, sizeof(int));
+	if (!highGlossDither->hotbin) {
+		cleanup(highGlossDither);
+		return NULL;
+	}
+
+	for (int x = 0; x < HOTBIN_TABLE_SIZE; x++) {
+		int hotbinA = x * x;
+		hotbinA = hotbinA % 1709;
+		hotbinA *= hotbinA;
+		hotbinA = hotbinA % 173;
+		hotbinA *= hotbinA;
+		hotbinA = hotbinA % 17;
+		hotbinA *= 0.0635;
+		highGlossDither->hotbinTable[x] = hotbinA;
+	}
+
 	return (LV2_Handle) highGlossDither;
 }
 
@@ -62,7 +97,7 @@ static void activate(LV2_Handle instance)
 	highGlossDither->flip = false;
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+CPU_DISPATCH static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	HighGlossDither* highGlossDither = (HighGlossDither*) instance;
 
@@ -71,54 +106,56 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = highGlossDither->output[0];
 	float* out2 = highGlossDither->output[1];
 
-	int hotbinA;
-
-	double inputSampleL;
-	double inputSampleR;
-
-	while (sampleFrames-- > 0) {
-		inputSampleL = *in1;
-		inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = highGlossDither->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = highGlossDither->fpdR * 1.18e-17;
-
-		inputSampleL *= 8388608.0;
-		inputSampleR *= 8388608.0;
-		// 0-1 is now one bit, now we dither
-
-		highGlossDither->position += 1;
-		// Note- uses integer overflow as a 'mod' operator
-		hotbinA = highGlossDither->position * highGlossDither->position;
-		hotbinA = hotbinA % 170003;
-		hotbinA *= hotbinA;
-		hotbinA = hotbinA % 17011;
-		hotbinA *= hotbinA;
-		hotbinA = hotbinA % 1709;
-		hotbinA *= hotbinA;
-		hotbinA = hotbinA % 173;
-		hotbinA *= hotbinA;
-		hotbinA = hotbinA % 17;
-		hotbinA *= 0.0635;
-		if (highGlossDither->flip) hotbinA = -hotbinA;
-
-		inputSampleL += hotbinA;
-		inputSampleR += hotbinA;
-		inputSampleL = floor(inputSampleL);
-		inputSampleR = floor(inputSampleR);
-		// Quadratic dither
-
-		highGlossDither->flip = !highGlossDither->flip;
-
-		inputSampleL /= 8388608.0;
-		inputSampleR /= 8388608.0;
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+	const uint32_t chunk = highGlossDither->chunk;
+	int* hotbin = highGlossDither->hotbin;
+
+	while (sampleFrames > 0) {
+		uint32_t frames = sampleFrames < chunk ? sampleFrames : chunk;
+
+		for (uint32_t i = 0; i < frames; i++) {
+			highGlossDither->position += 1;
+			// Note- uses integer overflow as a 'mod' operator
+			// Squares are kept unsigned, which is what optimized builds of the
+			// former signed version computed
+			uint32_t hotbinA = highGlossDither->position * highGlossDither->position;
+			hotbinA = hotbinA % 170003;
+			hotbinA *= hotbinA;
+			hotbinA = hotbinA % 17011;
+			int hotbinB = highGlossDither->hotbinTable[hotbinA];
+			if (highGlossDither->flip) hotbinB = -hotbinB;
+			hotbin[i] = hotbinB;
+
+			highGlossDither->flip = !highGlossDither->flip;
+		}
+
+		for (uint32_t i = 0; i < frames; i++) {
+			double inputSampleL = in1[i];
+			double inputSampleR = in2[i];
+			if (fabs(inputSampleL) < 1.18e-23) inputSampleL = highGlossDither->fpdL * 1.18e-17;
+			if (fabs(inputSampleR) < 1.18e-23) inputSampleR = highGlossDither->fpdR * 1.18e-17;
+
+			inputSampleL *= 8388608.0;
+			inputSampleR *= 8388608.0;
+			// 0-1 is now one bit, now we dither
+
+			inputSampleL += hotbin[i];
+			inputSampleR += hotbin[i];
+			inputSampleL = floor(inputSampleL);
+			inputSampleR = floor(inputSampleR);
+			// Quadratic dither
+
+			inputSampleL /= 8388608.0;
+			inputSampleR /= 8388608.0;
+
+			out1[i] = (float) inputSampleL;
+			out2[i] = (float) inputSampleR;
+		}
+
+		in1 += frames;
+		in2 += frames;
+		out1 += frames;
+		out2 += frames;
+		sampleFrames -= frames;
 	}
 }
 
@@ -126,7 +163,10 @@ static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
 {
-	free(instance);
+	HighGlossDither* highGlossDither = (HighGlossDither*) instance;
+
+	free(highGlossDither->hotbin);
+	free(highGlossDither);
 }
 
 static const void* extension_data(const char* uri)
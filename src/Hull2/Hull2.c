@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define HULL2_URI "https://hannesbraun.net/ns/lv2/airwindows/hull2"
 
 typedef enum {
@@ -209,12 +211,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		hull2->fpdL ^= hull2->fpdL << 13;
 		hull2->fpdL ^= hull2->fpdL >> 17;
 		hull2->fpdL ^= hull2->fpdL << 5;
-		inputSampleL += (((double) hull2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) hull2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		hull2->fpdR ^= hull2->fpdR << 13;
 		hull2->fpdR ^= hull2->fpdR >> 17;
 		hull2->fpdR ^= hull2->fpdR << 5;
-		inputSampleR += (((double) hull2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) hull2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define HYPERSOFT_URI "https://hannesbraun.net/ns/lv2/airwindows/hypersoft"
 
 typedef enum {
@@ -119,13 +121,13 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleL *= inputGain;
 		inputSampleR *= inputGain;
 
-		inputSampleL = sin(inputSampleL);
-		inputSampleL += (sin(inputSampleL * 2.0) / 2.0);
-		inputSampleR = sin(inputSampleR);
-		inputSampleR += (sin(inputSampleR * 2.0) / 2.0);
+		inputSampleL = fast_sin(inputSampleL);
+		inputSampleL += (fast_sin(inputSampleL * 2.0) / 2.0);
+		inputSampleR = fast_sin(inputSampleR);
+		inputSampleR += (fast_sin(inputSampleR * 2.0) / 2.0);
 		for (int count = 2; count < stages; count++) {
-			inputSampleL += ((sin(inputSampleL * (double) count) / (double) pow(count, 3)) * fmax(0.0, 1.0 - fabs((inputSampleL - hypersoft->lastSampleL) * bright * (double) (count * count))));
-			inputSampleR += ((sin(inputSampleR * (double) count) / (double) pow(count, 3)) * fmax(0.0, 1.0 - fabs((inputSampleR - hypersoft->lastSampleR) * bright * (double) (count * count))));
+			inputSampleL += ((fast_sin(inputSampleL * (double) count) / (double) pow(count, 3)) * fmax(0.0, 1.0 - fabs((inputSampleL - hypersoft->lastSampleL) * bright * (double) (count * count))));
+			inputSampleR += ((fast_sin(inputSampleR * (double) count) / (double) pow(count, 3)) * fmax(0.0, 1.0 - fabs((inputSampleR - hypersoft->lastSampleR) * bright * (double) (count * count))));
 		}
 		hypersoft->lastSampleL = inputSampleL;
 		hypersoft->lastSampleR = inputSampleR;
@@ -139,12 +141,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		hypersoft->fpdL ^= hypersoft->fpdL << 13;
 		hypersoft->fpdL ^= hypersoft->fpdL >> 17;
 		hypersoft->fpdL ^= hypersoft->fpdL << 5;
-		inputSampleL += (((double) hypersoft->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) hypersoft->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		hypersoft->fpdR ^= hypersoft->fpdR << 13;
 		hypersoft->fpdR ^= hypersoft->fpdR >> 17;
 		hypersoft->fpdR ^= hypersoft->fpdR << 5;
-		inputSampleR += (((double) hypersoft->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) hypersoft->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define HYPERSONIC_URI "https://hannesbraun.net/ns/lv2/airwindows/hypersonic"
@@ -256,12 +258,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		hypersonic->fpdL ^= hypersonic->fpdL << 13;
 		hypersonic->fpdL ^= hypersonic->fpdL >> 17;
 		hypersonic->fpdL ^= hypersonic->fpdL << 5;
-		inputSampleL += (((double) hypersonic->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) hypersonic->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		hypersonic->fpdR ^= hypersonic->fpdR << 13;
 		hypersonic->fpdR ^= hypersonic->fpdR >> 17;
 		hypersonic->fpdR ^= hypersonic->fpdR << 5;
-		inputSampleR += (((double) hypersonic->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) hypersonic->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define INFINITY_URI "https://hannesbraun.net/ns/lv2/airwindows/infinity"
@@ -94,6 +97,8 @@ typedef struct {
 
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	Silence silence;
 } Infinity;
 
 static LV2_Handle instantiate(
@@ -228,6 +233,8 @@ static void activate(LV2_Handle instance)
 	while (infinity->fpdL < 16386) infinity->fpdL = rand() * UINT32_MAX;
 	infinity->fpdR = 1.0;
 	while (infinity->fpdR < 16386) infinity->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&infinity->silence, 71843); // delay memory per channel
 }
 
 static void run(LV2_Handle instance, uint32_t sampleFrames)
@@ -239,6 +246,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = infinity->output[0];
 	float* out2 = infinity->output[1];
 
+	if (silence_skip(&infinity->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	const float filter = *infinity->filter;
 
 	infinity->biquadC[0] = infinity->biquadB[0] = infinity->biquadA[0] = ((pow(filter, 2) * 9900.0) + 100.0) / infinity->sampleRate;
@@ -524,8 +533,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
 
-		inputSampleL = asin(inputSampleL);
-		inputSampleR = asin(inputSampleR);
+		inputSampleL = fast_asin(inputSampleL);
+		inputSampleR = fast_asin(inputSampleR);
 
 		tempSampleL = (inputSampleL * infinity->biquadC[2]) + infinity->biquadC[7];
 		infinity->biquadC[7] = (inputSampleL * infinity->biquadC[3]) - (tempSampleL * infinity->biquadC[5]) + infinity->biquadC[8];
@@ -548,12 +557,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		infinity->fpdL ^= infinity->fpdL << 13;
 		infinity->fpdL ^= infinity->fpdL >> 17;
 		infinity->fpdL ^= infinity->fpdL << 5;
-		inputSampleL += (((double) infinity->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) infinity->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		infinity->fpdR ^= infinity->fpdR << 13;
 		infinity->fpdR ^= infinity->fpdR >> 17;
 		infinity->fpdR ^= infinity->fpdR << 5;
-		inputSampleR += (((double) infinity->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) infinity->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -564,6 +573,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&infinity->silence, infinity->output[0], infinity->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
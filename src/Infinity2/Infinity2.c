@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define INFINITY2_URI "https://hannesbraun.net/ns/lv2/airwindows/infinity2"
@@ -98,6 +101,8 @@ typedef struct {
 
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	Silence silence;
 } Infinity2;
 
 static LV2_Handle instantiate(
@@ -238,6 +243,8 @@ static void activate(LV2_Handle instance)
 	while (infinity2->fpdL < 16386) infinity2->fpdL = rand() * UINT32_MAX;
 	infinity2->fpdR = 1.0;
 	while (infinity2->fpdR < 16386) infinity2->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&infinity2->silence, 71843); // delay memory per channel
 }
 
 static void run(LV2_Handle instance, uint32_t sampleFrames)
@@ -249,6 +256,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = infinity2->output[0];
 	float* out2 = infinity2->output[1];
 
+	if (silence_skip(&infinity2->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	const float filter = *infinity2->filter;
 
 	infinity2->biquadC[0] = infinity2->biquadB[0] = infinity2->biquadA[0] = ((pow(filter, 2) * 9900.0) + 100.0) / infinity2->sampleRate;
@@ -551,8 +560,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
 
-		inputSampleL = asin(inputSampleL);
-		inputSampleR = asin(inputSampleR);
+		inputSampleL = fast_asin(inputSampleL);
+		inputSampleR = fast_asin(inputSampleR);
 
 		tempSampleL = (inputSampleL * infinity2->biquadC[2]) + infinity2->biquadC[7];
 		infinity2->biquadC[7] = (inputSampleL * infinity2->biquadC[3]) - (tempSampleL * infinity2->biquadC[5]) + infinity2->biquadC[8];
@@ -575,12 +584,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		infinity2->fpdL ^= infinity2->fpdL << 13;
 		infinity2->fpdL ^= infinity2->fpdL >> 17;
 		infinity2->fpdL ^= infinity2->fpdL << 5;
-		inputSampleL += (((double) infinity2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) infinity2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		infinity2->fpdR ^= infinity2->fpdR << 13;
 		infinity2->fpdR ^= infinity2->fpdR >> 17;
 		infinity2->fpdR ^= infinity2->fpdR << 5;
-		inputSampleR += (((double) infinity2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) infinity2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -591,6 +600,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&infinity2->silence, infinity2->output[0], infinity2->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define INFLAMER_URI "https://hannesbraun.net/ns/lv2/airwindows/inflamer"
 
 typedef enum {
@@ -320,12 +322,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inflamer->fpdL ^= inflamer->fpdL << 13;
 		inflamer->fpdL ^= inflamer->fpdL >> 17;
 		inflamer->fpdL ^= inflamer->fpdL << 5;
-		inputSampleL += (((double) inflamer->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) inflamer->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		inflamer->fpdR ^= inflamer->fpdR << 13;
 		inflamer->fpdR ^= inflamer->fpdR >> 17;
 		inflamer->fpdR ^= inflamer->fpdR << 5;
-		inputSampleR += (((double) inflamer->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) inflamer->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define INFRASONIC_URI "https://hannesbraun.net/ns/lv2/airwindows/infrasonic"
@@ -68,21 +70,6 @@ static void activate(LV2_Handle instance)
 		infrasonic->biquadD[x] = 0.0;
 		infrasonic->biquadE[x] = 0.0;
 	}
-	infrasonic->fpdL = 1.0;
-	while (infrasonic->fpdL < 16386) infrasonic->fpdL = rand() * UINT32_MAX;
-	infrasonic->fpdR = 1.0;
-	while (infrasonic->fpdR < 16386) infrasonic->fpdR = rand() * UINT32_MAX;
-}
-
-static void run(LV2_Handle instance, uint32_t sampleFrames)
-{
-	Infrasonic* infrasonic = (Infrasonic*) instance;
-
-	const float* in1 = infrasonic->input[0];
-	const float* in2 = infrasonic->input[1];
-	float* out1 = infrasonic->output[0];
-	float* out2 = infrasonic->output[1];
-
 	const double init = 20.0 / infrasonic->sampleRate;
 	infrasonic->biquadA[0] = init;
 	infrasonic->biquadB[0] = init;
@@ -135,6 +122,21 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	infrasonic->biquadE[5] = 2.0 * (K * K - 1.0) * norm;
 	infrasonic->biquadE[6] = (1.0 - K / infrasonic->biquadE[1] + K * K) * norm;
 
+	infrasonic->fpdL = 1.0;
+	while (infrasonic->fpdL < 16386) infrasonic->fpdL = rand() * UINT32_MAX;
+	infrasonic->fpdR = 1.0;
+	while (infrasonic->fpdR < 16386) infrasonic->fpdR = rand() * UINT32_MAX;
+}
+
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	Infrasonic* infrasonic = (Infrasonic*) instance;
+
+	const float* in1 = infrasonic->input[0];
+	const float* in2 = infrasonic->input[1];
+	float* out1 = infrasonic->output[0];
+	float* out2 = infrasonic->output[1];
+
 	while (sampleFrames-- > 0) {
 		double inputSampleL = *in1;
 		double inputSampleR = *in2;
@@ -217,12 +219,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		infrasonic->fpdL ^= infrasonic->fpdL << 13;
 		infrasonic->fpdL ^= infrasonic->fpdL >> 17;
 		infrasonic->fpdL ^= infrasonic->fpdL << 5;
-		inputSampleL += (((double) infrasonic->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) infrasonic->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		infrasonic->fpdR ^= infrasonic->fpdR << 13;
 		infrasonic->fpdR ^= infrasonic->fpdR >> 17;
 		infrasonic->fpdR ^= infrasonic->fpdR << 5;
-		inputSampleR += (((double) infrasonic->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) infrasonic->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define INTERSTAGE_URI "https://hannesbraun.net/ns/lv2/airwindows/interstage"
 
 typedef enum {
@@ -180,12 +182,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		interstage->fpdL ^= interstage->fpdL << 13;
 		interstage->fpdL ^= interstage->fpdL >> 17;
 		interstage->fpdL ^= interstage->fpdL << 5;
-		inputSampleL += (((double) interstage->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) interstage->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		interstage->fpdR ^= interstage->fpdR << 13;
 		interstage->fpdR ^= interstage->fpdR >> 17;
 		interstage->fpdR ^= interstage->fpdR << 5;
-		inputSampleR += (((double) interstage->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) interstage->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define IRONOXIDECLASSIC2_URI "https://hannesbraun.net/ns/lv2/airwindows/ironoxideclassic2"
@@ -241,14 +243,14 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		double bridgerectifierL = fabs(inputSampleL);
 		if (bridgerectifierL > 1.57079633) bridgerectifierL = 1.57079633;
-		bridgerectifierL = sin(bridgerectifierL);
+		bridgerectifierL = fast_sin(bridgerectifierL);
 		if (inputSampleL > 0.0) inputSampleL = bridgerectifierL;
 		else inputSampleL = -bridgerectifierL;
 		// preliminary gain stage using antialiasing
 
 		double bridgerectifierR = fabs(inputSampleR);
 		if (bridgerectifierR > 1.57079633) bridgerectifierR = 1.57079633;
-		bridgerectifierR = sin(bridgerectifierR);
+		bridgerectifierR = fast_sin(bridgerectifierR);
 		if (inputSampleR > 0.0) inputSampleR = bridgerectifierR;
 		else inputSampleR = -bridgerectifierR;
 		// preliminary gain stage using antialiasing
@@ -500,7 +502,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		bridgerectifierL = fabs(inputSampleL);
 		if (bridgerectifierL > 1.57079633) bridgerectifierL = 1.57079633;
-		bridgerectifierL = sin(bridgerectifierL);
+		bridgerectifierL = fast_sin(bridgerectifierL);
 		// can use as an output limiter
 		if (inputSampleL > 0.0) inputSampleL = bridgerectifierL;
 		else inputSampleL = -bridgerectifierL;
@@ -508,7 +510,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		bridgerectifierR = fabs(inputSampleR);
 		if (bridgerectifierR > 1.57079633) bridgerectifierR = 1.57079633;
-		bridgerectifierR = sin(bridgerectifierR);
+		bridgerectifierR = fast_sin(bridgerectifierR);
 		// can use as an output limiter
 		if (inputSampleR > 0.0) inputSampleR = bridgerectifierR;
 		else inputSampleR = -bridgerectifierR;
@@ -541,12 +543,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		ironOxideClassic2->fpdL ^= ironOxideClassic2->fpdL << 13;
 		ironOxideClassic2->fpdL ^= ironOxideClassic2->fpdL >> 17;
 		ironOxideClassic2->fpdL ^= ironOxideClassic2->fpdL << 5;
-		inputSampleL += (((double) ironOxideClassic2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) ironOxideClassic2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		ironOxideClassic2->fpdR ^= ironOxideClassic2->fpdR << 13;
 		ironOxideClassic2->fpdR ^= ironOxideClassic2->fpdR >> 17;
 		ironOxideClassic2->fpdR ^= ironOxideClassic2->fpdR << 5;
-		inputSampleR += (((double) ironOxideClassic2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) ironOxideClassic2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define LRCONVOLVE_URI "https://hannesbraun.net/ns/lv2/airwindows/lrconvolve"
 
 typedef enum {
@@ -90,12 +92,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		lrConvolve->fpdL ^= lrConvolve->fpdL << 13;
 		lrConvolve->fpdL ^= lrConvolve->fpdL >> 17;
 		lrConvolve->fpdL ^= lrConvolve->fpdL << 5;
-		inputSampleL += (((double) lrConvolve->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) lrConvolve->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		lrConvolve->fpdR ^= lrConvolve->fpdR << 13;
 		lrConvolve->fpdR ^= lrConvolve->fpdR >> 17;
 		lrConvolve->fpdR ^= lrConvolve->fpdR << 5;
-		inputSampleR += (((double) lrConvolve->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) lrConvolve->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
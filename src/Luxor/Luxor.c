@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define LUXOR_URI "https://hannesbraun.net/ns/lv2/airwindows/luxor"
 
 typedef enum {
@@ -279,7 +281,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > breakup) bridgerectifier = breakup;
 			// max value for sine function, 'breakup' modeling for trashed console tone
 			// more hardness = more solidness behind breakup modeling. more softness, more 'grunge' and sag
-			bridgerectifier = sin(bridgerectifier) / hardness;
+			bridgerectifier = fast_sin(bridgerectifier) / hardness;
 			// do the sine factor, scale back to proper amount
 			if (inputSampleL > 0) inputSampleL = bridgerectifier + threshold;
 			else inputSampleL = -(bridgerectifier + threshold);
@@ -291,7 +293,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (bridgerectifier > breakup) bridgerectifier = breakup;
 			// max value for sine function, 'breakup' modeling for trashed console tone
 			// more hardness = more solidness behind breakup modeling. more softness, more 'grunge' and sag
-			bridgerectifier = sin(bridgerectifier) / hardness;
+			bridgerectifier = fast_sin(bridgerectifier) / hardness;
 			// do the sine factor, scale back to proper amount
 			if (inputSampleR > 0) inputSampleR = bridgerectifier + threshold;
 			else inputSampleR = -(bridgerectifier + threshold);
@@ -312,12 +314,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		luxor->fpdL ^= luxor->fpdL << 13;
 		luxor->fpdL ^= luxor->fpdL >> 17;
 		luxor->fpdL ^= luxor->fpdL << 5;
-		inputSampleL += (((double) luxor->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) luxor->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		luxor->fpdR ^= luxor->fpdR << 13;
 		luxor->fpdR ^= luxor->fpdR >> 17;
 		luxor->fpdR ^= luxor->fpdR << 5;
-		inputSampleR += (((double) luxor->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) luxor->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define MV_URI "https://hannesbraun.net/ns/lv2/airwindows/mv"
 
 typedef enum {
@@ -169,6 +172,8 @@ typedef struct {
 	int alpX, delayX;
 	int alpY, delayY;
 	int alpZ, delayZ;
+
+	Silence silence;
 } MV;
 
 static LV2_Handle instantiate(
@@ -438,6 +443,8 @@ static void activate(LV2_Handle instance)
 	while (mv->fpdL < 16386) mv->fpdL = rand() * UINT32_MAX;
 	mv->fpdR = 1.0;
 	while (mv->fpdR < 16386) mv->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&mv->silence, 236424); // delay memory per channel
 }
 
 static void run(LV2_Handle instance, uint32_t sampleFrames)
@@ -449,6 +456,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = mv->output[0];
 	float* out2 = mv->output[1];
 
+	if (silence_skip(&mv->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	int allpasstemp;
 	double avgtemp;
 	const int stage = *mv->depth * 27.0;
@@ -476,8 +485,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleL += mv->feedbackL;
 		inputSampleR += mv->feedbackR;
 
-		inputSampleL = sin(inputSampleL);
-		inputSampleR = sin(inputSampleR);
+		inputSampleL = fast_sin(inputSampleL);
+		inputSampleR = fast_sin(inputSampleR);
 
 		switch (stage) {
 			case 27:
@@ -1304,8 +1313,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
 
-		inputSampleL = asin(inputSampleL);
-		inputSampleR = asin(inputSampleR);
+		inputSampleL = fast_asin(inputSampleL);
+		inputSampleR = fast_asin(inputSampleR);
 
 		if (wet != 1.0) {
 			inputSampleL = (inputSampleL * wet) + (drySampleL * (1.0 - wet));
@@ -1319,12 +1328,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		mv->fpdL ^= mv->fpdL << 13;
 		mv->fpdL ^= mv->fpdL >> 17;
 		mv->fpdL ^= mv->fpdL << 5;
-		inputSampleL += (((double) mv->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) mv->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		mv->fpdR ^= mv->fpdR << 13;
 		mv->fpdR ^= mv->fpdR >> 17;
 		mv->fpdR ^= mv->fpdR << 5;
-		inputSampleR += (((double) mv->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) mv->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -1335,6 +1344,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&mv->silence, mv->output[0], mv->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
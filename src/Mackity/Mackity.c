@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define MACKITY_URI "https://hannesbraun.net/ns/lv2/airwindows/mackity"
@@ -202,12 +204,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		mackity->fpdL ^= mackity->fpdL << 13;
 		mackity->fpdL ^= mackity->fpdL >> 17;
 		mackity->fpdL ^= mackity->fpdL << 5;
-		inputSampleL += (((double) mackity->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) mackity->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		mackity->fpdR ^= mackity->fpdR << 13;
 		mackity->fpdR ^= mackity->fpdR >> 17;
 		mackity->fpdR ^= mackity->fpdR << 5;
-		inputSampleR += (((double) mackity->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) mackity->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,8 +5,27 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/blocklength.h"
+#include "../common/fastmath.h"
+
 #define MASTERING_URI "https://hannesbraun.net/ns/lv2/airwindows/mastering"
 
+#define MASTERING_CHUNK 256
+#define MASTERING_CHUNK_MAX 8192
+
+// Mastering sums its bands and runs Zoom and Sinew in long double, like the
+// original. Where long double is slow (software quad on aarch64) or no wider
+// than double, build with MASTERING_COMPENSATED: everything runs on doubles,
+// and the rounding error of the band splits, the band sum and the Sinew
+// follower is carried along in compensation terms (double-double) instead.
+#ifdef MASTERING_COMPENSATED
+typedef double mastering_t;
+#define MASTERING_FABS fabs
+#else
+typedef long double mastering_t;
+#define MASTERING_FABS fabsl
+#endif
+
 typedef enum {
 	INPUT_L = 0,
 	INPUT_R = 1,
@@ -100,10 +119,12 @@ typedef struct {
 	double kalM[kal_total];
 	double kalS[kal_total];
 
-	long double lastSinewL;
-	long double lastSinewR;
+	mastering_t lastSinewL;
+	mastering_t lastSinewR;
 	// this is overkill, used to run both Zoom and Sinew stages as they are after
 	// the summing in StoneFire, which sums three doubles to a long double.
+	double lastSinewLostL;
+	double lastSinewLostR; // low part of lastSinew, MASTERING_COMPENSATED only
 
 	double lastSampleL;
 	double intermediateL[16];
@@ -114,27 +135,6 @@ typedef struct {
 	bool wasPosClipR;
 	bool wasNegClipR; // Stereo ClipOnly2
 
-	int quantA;
-	int quantB;
-	float expectedSlew;
-	float testA;
-	float testB;
-	double correction;
-	double shapedSampleL;
-	double shapedSampleR;
-	double currentDither;
-	double ditherL;
-	double ditherR;
-	bool cutbinsL;
-	bool cutbinsR;
-	int hotbinA;
-	int hotbinB;
-	double benfordize;
-	double totalA;
-	double totalB;
-	double outputSample;
-	int expon; // internal dither variables
-
 	double NSOddL; // dither section!
 	double NSEvenL;
 	double prevShapeL;
@@ -151,8 +151,16 @@ typedef struct {
 
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	uint32_t chunk; // frames per pass, a whole run if the host bounds it
+	mastering_t* bufferL;
+	mastering_t* bufferR;
+	double* noiseL;
+	double* noiseR;
 } Mastering;
 
+static void cleanup(LV2_Handle instance);
+
 static LV2_Handle instantiate(
 	const LV2_Descriptor* descriptor,
 	double rate,
@@ -160,7 +168,18 @@ static LV2_Handle instantiate(
 	const LV2_Feature* const* features)
 {
 	Mastering* mastering = (Mastering*) calloc(1, sizeof(Mastering));
+	if (!mastering) return NULL;
 	mastering->sampleRate = rate;
+
+	mastering->chunk = block_length_chunk(block_length_from_features(features), MASTERING_CHUNK, MASTERING_CHUNK_MAX);
+	mastering->bufferL = (mastering_t*) calloc(mastering->chunk, sizeof(mastering_t));
+	mastering->bufferR = (mastering_t*) calloc(mastering->chunk, sizeof(mastering_t));
+	mastering->noiseL = (double*) calloc(mastering->chunk, sizeof(double));
+	mastering->noiseR = (double*) calloc(mastering->chunk, sizeof(double));
+	if (!mastering->bufferL || !mastering->bufferR || !mastering->noiseL || !mastering->noiseR) {
+		cleanup(mastering);
+		return NULL;
+	}
 	return (LV2_Handle) mastering;
 }
 
@@ -214,6 +233,8 @@ static void activate(LV2_Handle instance)
 
 	mastering->lastSinewL = 0.0;
 	mastering->lastSinewR = 0.0;
+	mastering->lastSinewLostL = 0.0;
+	mastering->lastSinewLostR = 0.0;
 
 	mastering->lastSampleL = 0.0;
 	mastering->wasPosClipL = false;
@@ -226,28 +247,6 @@ static void activate(LV2_Handle instance)
 		mastering->intermediateR[x] = 0.0;
 	}
 
-	mastering->quantA = 0;
-	mastering->quantB = 1;
-	mastering->expectedSlew = 0.0;
-	mastering->testA = 0.0;
-	mastering->testB = 0.0;
-	mastering->correction = 0.0;
-	mastering->shapedSampleL = 0.0;
-	mastering->shapedSampleR = 0.0;
-	mastering->currentDither = 0.0;
-	mastering->ditherL = 0.0;
-	mastering->ditherR = 0.0;
-	mastering->cutbinsL = false;
-	mastering->cutbinsR = false;
-	mastering->hotbinA = 0;
-	mastering->hotbinB = 0;
-	mastering->benfordize = 0.0;
-	mastering->totalA = 0.0;
-	mastering->totalB = 0.0;
-	mastering->outputSample = 0.0;
-	mastering->expon = 0; // internal dither variables
-	// these didn't like to be defined inside a case statement
-
 	mastering->NSOddL = 0.0;
 	mastering->NSEvenL = 0.0;
 	mastering->prevShapeL = 0.0;
@@ -292,6 +291,604 @@ static void activate(LV2_Handle instance)
 	while (mastering->fpdR < 16386) mastering->fpdR = rand() * UINT32_MAX;
 }
 
+#ifdef MASTERING_COMPENSATED
+// a + b, with the exact rounding error of that sum in *lost (Knuth's TwoSum)
+static inline double two_sum(double a, double b, double* lost)
+{
+	double sum = a + b;
+	double bb = sum - a;
+	*lost = (a - (sum - bb)) + (b - bb);
+	return sum;
+}
+#endif
+
+// Splits a band off: returns a - b, and whatever the subtraction dropped in *lost
+static inline mastering_t split_band(mastering_t a, mastering_t b, double* lost)
+{
+#ifdef MASTERING_COMPENSATED
+	return two_sum(a, -b, lost);
+#else
+	*lost = 0.0;
+	return a - b;
+#endif
+}
+
+// Sums the bands in order, sub first. lost is what split_band dropped, already
+// weighted by the band gains, and goes into the compensation term with the
+// rounding error of the sum itself.
+static inline mastering_t sum_bands(mastering_t sub, mastering_t bass, mastering_t mid, mastering_t treble, double lost)
+{
+#ifdef MASTERING_COMPENSATED
+	double error;
+	double sum = two_sum(sub, bass, &error);
+	lost += error;
+	sum = two_sum(sum, mid, &error);
+	lost += error;
+	sum = two_sum(sum, treble, &error);
+	lost += error;
+	return sum + lost;
+#else
+	(void) lost;
+	mastering_t sum = sub;
+	sum += bass;
+	sum += mid;
+	sum += treble;
+	return sum;
+#endif
+}
+
+// Sinew's slew follower, which creeps towards the input by at most sinew per
+// sample. The compensated mode keeps the low part of that running sum in *lost.
+static inline void sinew_follow(mastering_t* lastSinew, double* lost, mastering_t inputSample, double threshSinew)
+{
+	mastering_t temp = inputSample;
+	mastering_t sinew = threshSinew * cos(*lastSinew * *lastSinew);
+#ifdef MASTERING_COMPENSATED
+	double step = 0.0;
+	if (inputSample - *lastSinew > sinew) step = sinew;
+	if (-(inputSample - *lastSinew) > sinew) step = -sinew;
+	if (step != 0.0) temp = two_sum(*lastSinew, step + *lost, lost);
+	else *lost = 0.0;
+#else
+	(void) lost;
+	if (inputSample - *lastSinew > sinew) temp = *lastSinew + sinew;
+	if (-(inputSample - *lastSinew) > sinew) temp = *lastSinew - sinew;
+#endif
+	*lastSinew = temp;
+}
+
+// Mastering runs in two passes over a chunk of samples. The first runs Drive,
+// the band split and zoom (Scope, Skronk, Girth), ClipOnly2 and Sinew (Glue),
+// the second is one kernel for the selected dither, so the dither mode is only
+// dispatched once per chunk. The stages of the first pass stay in one loop:
+// they are long chains of dependent long double operations, and interleaving
+// the two channels and the dither noise is what keeps the FPU busy.
+// The R entries of the air and kal arrays mirror the L ones, so the stages
+// index either channel with the L names.
+
+typedef struct {
+	double overallscale;
+	double kalMid;
+	double kalSub;
+	double bassZoom;
+	double midZoom;
+	double trebleZoom;
+	mastering_t subGain;
+	mastering_t bassGain;
+	mastering_t midGain;
+	mastering_t trebleGain;
+	mastering_t driveIn;
+	mastering_t driveOut;
+	int spacing;
+	double threshSinew;
+	double depthSinew;
+} MasteringStages;
+
+// Air3: returns what is left below the treble
+static inline mastering_t air3(double* air, mastering_t drySample, double overallscale)
+{
+	air[pvSL4] = air[pvAL4] - air[pvAL3];
+	air[pvSL3] = air[pvAL3] - air[pvAL2];
+	air[pvSL2] = air[pvAL2] - air[pvAL1];
+	air[pvSL1] = air[pvAL1] - drySample;
+	air[accSL3] = air[pvSL4] - air[pvSL3];
+	air[accSL2] = air[pvSL3] - air[pvSL2];
+	air[accSL1] = air[pvSL2] - air[pvSL1];
+	air[acc2SL2] = air[accSL3] - air[accSL2];
+	air[acc2SL1] = air[accSL2] - air[accSL1];
+	air[outAL] = -(air[pvAL1] + air[pvSL3] + air[acc2SL2] - ((air[acc2SL2] + air[acc2SL1]) * 0.5));
+	air[gainAL] *= 0.5;
+	air[gainAL] += MASTERING_FABS(drySample - air[outAL]) * 0.5;
+	if (air[gainAL] > 0.3 * sqrt(overallscale)) air[gainAL] = 0.3 * sqrt(overallscale);
+	air[pvAL4] = air[pvAL3];
+	air[pvAL3] = air[pvAL2];
+	air[pvAL2] = air[pvAL1];
+	air[pvAL1] = (air[gainAL] * air[outAL]) + drySample;
+	mastering_t mid = drySample - ((air[outAL] * 0.5) + (drySample * (0.457 - (0.017 * overallscale))));
+	mastering_t temp = (mid + air[gndavgL]) * 0.5;
+	air[gndavgL] = mid;
+	return temp;
+}
+
+// Kalman: returns the lows below the crossover set by kalFreq
+static inline mastering_t kalman(double* kal, mastering_t sample, double kalFreq)
+{
+	kal[prevSlewL3] += kal[prevSampL3] - kal[prevSampL2];
+	kal[prevSlewL3] *= 0.5;
+	kal[prevSlewL2] += kal[prevSampL2] - kal[prevSampL1];
+	kal[prevSlewL2] *= 0.5;
+	kal[prevSlewL1] += kal[prevSampL1] - sample;
+	kal[prevSlewL1] *= 0.5;
+	// make slews from each set of samples used
+	kal[accSlewL2] += kal[prevSlewL3] - kal[prevSlewL2];
+	kal[accSlewL2] *= 0.5;
+	kal[accSlewL1] += kal[prevSlewL2] - kal[prevSlewL1];
+	kal[accSlewL1] *= 0.5;
+	// differences between slews: rate of change of rate of change
+	kal[accSlewL3] += (kal[accSlewL2] - kal[accSlewL1]);
+	kal[accSlewL3] *= 0.5;
+	// entering the abyss, what even is this
+	kal[kalOutL] += kal[prevSampL1] + kal[prevSlewL2] + kal[accSlewL3];
+	kal[kalOutL] *= 0.5;
+
+	// resynthesizing predicted result (all iir smoothed)
+	kal[kalGainL] += MASTERING_FABS(sample - kal[kalOutL]) * kalFreq * 8.0;
+	kal[kalGainL] *= 0.5;
+	// madness takes its toll. Kalman Gain: how much dry to retain
+	if (kal[kalGainL] > kalFreq * 0.5) kal[kalGainL] = kalFreq * 0.5;
+	// attempts to avoid explosions
+	kal[kalOutL] += (sample * (1.0 - (0.68 + (kalFreq * 0.157))));
+	// this is for tuning a really complete cancellation up around Nyquist
+	kal[prevSampL3] = kal[prevSampL2];
+	kal[prevSampL2] = kal[prevSampL1];
+	kal[prevSampL1] = (kal[kalGainL] * kal[kalOutL]) + ((1.0 - kal[kalGainL]) * sample);
+	// feed the chain of previous samples
+	mastering_t low = (kal[kalOutL] + kal[kalAvgL]) * 0.5;
+	kal[kalAvgL] = kal[kalOutL];
+	return low;
+}
+
+static inline mastering_t zoom(mastering_t band, double zoom)
+{
+	if (zoom > 0.0) {
+		double closer = band * 1.57079633;
+		if (closer > 1.57079633) closer = 1.57079633;
+		if (closer < -1.57079633) closer = -1.57079633;
+		band = (band * (1.0 - zoom)) + (sin(closer) * zoom);
+	} // zooming in will make the body of the sound louder: it's just Density
+	if (zoom < 0.0) {
+		double farther = MASTERING_FABS(band) * 1.57079633;
+		if (farther > 1.57079633) farther = 1.0;
+		else farther = 1.0 - cos(farther);
+		if (band > 0.0) band = (band * (1.0 + zoom)) - (farther * zoom * 1.57079633);
+		if (band < 0.0) band = (band * (1.0 + zoom)) + (farther * zoom * 1.57079633);
+	} // zooming out boosts the hottest peaks but cuts back softer stuff
+	return band;
+}
+
+// begin ClipOnly2 as a little, compressed chunk that can be dropped into code
+static inline double clip_only2(double* lastSample, double* intermediate, bool* wasPosClip, bool* wasNegClip, int spacing, mastering_t inputSample)
+{
+	if (inputSample > 4.0) inputSample = 4.0;
+	if (inputSample < -4.0) inputSample = -4.0;
+	if (*wasPosClip == true) { // current will be over
+		if (inputSample < *lastSample) *lastSample = 0.7058208 + (inputSample * 0.2609148);
+		else *lastSample = 0.2491717 + (*lastSample * 0.7390851);
+	}
+	*wasPosClip = false;
+	if (inputSample > 0.9549925859) {
+		*wasPosClip = true;
+		inputSample = 0.7058208 + (*lastSample * 0.2609148);
+	}
+	if (*wasNegClip == true) { // current will be -over
+		if (inputSample > *lastSample) *lastSample = -0.7058208 + (inputSample * 0.2609148);
+		else *lastSample = -0.2491717 + (*lastSample * 0.7390851);
+	}
+	*wasNegClip = false;
+	if (inputSample < -0.9549925859) {
+		*wasNegClip = true;
+		inputSample = -0.7058208 + (*lastSample * 0.2609148);
+	}
+	intermediate[spacing] = inputSample;
+	double outputSample = *lastSample; // Latency is however many samples equals one 44.1k sample
+	for (int x = spacing; x > 0; x--) intermediate[x - 1] = intermediate[x];
+	*lastSample = intermediate[0]; // run a little buffer to handle this
+	return outputSample;
+}
+// end ClipOnly2 as a little, compressed chunk that can be dropped into code
+
+static inline void fpd_advance(uint32_t* fpd)
+{
+	*fpd ^= *fpd << 13;
+	*fpd ^= *fpd >> 17;
+	*fpd ^= *fpd << 5;
+}
+
+// TPDF noise, rerolled up to three times while left and right are too close
+static inline void tpdf_wide_noise(uint32_t* fpdL, uint32_t* fpdR, double* noiseL, double* noiseR)
+{
+	double ditherL = -1.0;
+	ditherL += ((double) *fpdL / UINT32_MAX);
+	fpd_advance(fpdL);
+	ditherL += ((double) *fpdL / UINT32_MAX);
+	// TPDF: two 0-1 random noises
+
+	double ditherR = -1.0;
+	ditherR += ((double) *fpdR / UINT32_MAX);
+	fpd_advance(fpdR);
+	ditherR += ((double) *fpdR / UINT32_MAX);
+	// TPDF: two 0-1 random noises
+
+	if (fabs(ditherL - ditherR) < 0.5) {
+		ditherL = -1.0;
+		ditherL += ((double) *fpdL / UINT32_MAX);
+		fpd_advance(fpdL);
+		ditherL += ((double) *fpdL / UINT32_MAX);
+	}
+
+	if (fabs(ditherL - ditherR) < 0.5) {
+		ditherR = -1.0;
+		ditherR += ((double) *fpdR / UINT32_MAX);
+		fpd_advance(fpdR);
+		ditherR += ((double) *fpdR / UINT32_MAX);
+	}
+
+	if (fabs(ditherL - ditherR) < 0.5) {
+		ditherL = -1.0;
+		ditherL += ((double) *fpdL / UINT32_MAX);
+		fpd_advance(fpdL);
+		ditherL += ((double) *fpdL / UINT32_MAX);
+	}
+
+	*noiseL = ditherL;
+	*noiseR = ditherR;
+}
+
+static inline void paul_wide_noise(uint32_t* fpdL, uint32_t* fpdR, double* previousDitherL, double* previousDitherR, double* noiseL, double* noiseR)
+{
+	// Paul Frindle: It's true that the dither itself can sound different
+	// if it's given a different freq response and you get to hear it.
+	// The one we use most is triangular single pole high pass dither.
+	// It's not freq bent enough to sound odd, but is slightly less audible than
+	// flat dither. It can also be easily made by taking one sample of dither
+	// away from the previous one - this gives you the triangular PDF and the
+	// filtering in one go :-)
+
+	double currentDither = ((double) *fpdL / UINT32_MAX);
+	double ditherL = currentDither;
+	ditherL -= *previousDitherL;
+	*previousDitherL = currentDither;
+	// TPDF: two 0-1 random noises
+
+	currentDither = ((double) *fpdR / UINT32_MAX);
+	double ditherR = currentDither;
+	ditherR -= *previousDitherR;
+	*previousDitherR = currentDither;
+	// TPDF: two 0-1 random noises
+
+	if (fabs(ditherL - ditherR) < 0.5) {
+		fpd_advance(fpdL);
+		currentDither = ((double) *fpdL / UINT32_MAX);
+		ditherL = currentDither;
+		ditherL -= *previousDitherL;
+		*previousDitherL = currentDither;
+	}
+
+	if (fabs(ditherL - ditherR) < 0.5) {
+		fpd_advance(fpdR);
+		currentDither = ((double) *fpdR / UINT32_MAX);
+		ditherR = currentDither;
+		ditherR -= *previousDitherR;
+		*previousDitherR = currentDither;
+	}
+
+	if (fabs(ditherL - ditherR) < 0.5) {
+		fpd_advance(fpdL);
+		currentDither = ((double) *fpdL / UINT32_MAX);
+		ditherL = currentDither;
+		ditherL -= *previousDitherL;
+		*previousDitherL = currentDither;
+	}
+
+	*noiseL = ditherL;
+	*noiseR = ditherR;
+}
+
+// The first pass. The settings are copied into a local, so that the stores to
+// the filter state can't alias them. The noise of the TPDFWide, PaulWide and
+// floating point dithers is drawn here too, as fpd also fills in digital silence
+// at the input and has to advance sample by sample.
+static void process_stages(Mastering* mastering, const float* in1, const float* in2, mastering_t* bufferL, mastering_t* bufferR, double* noiseL, double* noiseR, uint32_t frames, const MasteringStages* settings, int dither)
+{
+	const MasteringStages stages = *settings;
+	double* air = mastering->air;
+	double* kalM = mastering->kalM;
+	double* kalS = mastering->kalS;
+	double lastSample[2] = {mastering->lastSampleL, mastering->lastSampleR};
+	double* intermediate[2] = {mastering->intermediateL, mastering->intermediateR};
+	bool wasPosClip[2] = {mastering->wasPosClipL, mastering->wasPosClipR};
+	bool wasNegClip[2] = {mastering->wasNegClipL, mastering->wasNegClipR};
+	mastering_t lastSinewL = mastering->lastSinewL;
+	mastering_t lastSinewR = mastering->lastSinewR;
+	double lastSinewLostL = mastering->lastSinewLostL;
+	double lastSinewLostR = mastering->lastSinewLostR;
+	uint32_t fpdL = mastering->fpdL;
+	uint32_t fpdR = mastering->fpdR;
+
+	for (uint32_t i = 0; i < frames; i++) {
+		mastering_t inputSampleL = in1[i];
+		mastering_t inputSampleR = in2[i];
+		if (MASTERING_FABS(inputSampleL) < 1.18e-23) inputSampleL = fpdL * 1.18e-17;
+		if (MASTERING_FABS(inputSampleR) < 1.18e-23) inputSampleR = fpdR * 1.18e-17;
+		inputSampleL *= stages.driveIn;
+		inputSampleR *= stages.driveIn;
+		double lostTrebleL, lostTrebleR, lostMidL, lostMidR, lostBassL, lostBassR;
+
+		mastering_t midL = air3(air + pvAL1, inputSampleL, stages.overallscale);
+		mastering_t midR = air3(air + pvAR1, inputSampleR, stages.overallscale);
+		mastering_t trebleL = split_band(inputSampleL, midL, &lostTrebleL);
+		mastering_t trebleR = split_band(inputSampleR, midR, &lostTrebleR);
+		mastering_t bassL = kalman(kalM + prevSampL1, midL, stages.kalMid);
+		mastering_t bassR = kalman(kalM + prevSampR1, midR, stages.kalMid);
+		midL = split_band(midL, bassL, &lostMidL);
+		midR = split_band(midR, bassR, &lostMidR);
+		mastering_t subL = kalman(kalS + prevSampL1, bassL, stages.kalSub);
+		mastering_t subR = kalman(kalS + prevSampR1, bassR, stages.kalSub);
+		bassL = split_band(bassL, subL, &lostBassL);
+		bassR = split_band(bassR, subR, &lostBassR);
+
+		bassL = zoom(bassL, stages.bassZoom);
+		bassR = zoom(bassR, stages.bassZoom);
+		midL = zoom(midL, stages.midZoom);
+		midR = zoom(midR, stages.midZoom);
+		trebleL = zoom(trebleL, stages.trebleZoom);
+		trebleR = zoom(trebleR, stages.trebleZoom);
+		inputSampleL = sum_bands(subL * stages.subGain, bassL * stages.bassGain, midL * stages.midGain, trebleL * stages.trebleGain, (lostBassL * stages.bassGain) + (lostMidL * stages.midGain) + (lostTrebleL * stages.trebleGain));
+		inputSampleR = sum_bands(subR * stages.subGain, bassR * stages.bassGain, midR * stages.midGain, trebleR * stages.trebleGain, (lostBassR * stages.bassGain) + (lostMidR * stages.midGain) + (lostTrebleR * stages.trebleGain));
+
+		inputSampleL *= stages.driveOut;
+		inputSampleR *= stages.driveOut;
+		inputSampleL = clip_only2(&lastSample[0], intermediate[0], &wasPosClip[0], &wasNegClip[0], stages.spacing, inputSampleL);
+		inputSampleR = clip_only2(&lastSample[1], intermediate[1], &wasPosClip[1], &wasNegClip[1], stages.spacing, inputSampleR);
+
+		sinew_follow(&lastSinewL, &lastSinewLostL, inputSampleL, stages.threshSinew);
+		bufferL[i] = (inputSampleL * (1.0 - stages.depthSinew)) + (lastSinewL * stages.depthSinew);
+		sinew_follow(&lastSinewR, &lastSinewLostR, inputSampleR, stages.threshSinew);
+		bufferR[i] = (inputSampleR * (1.0 - stages.depthSinew)) + (lastSinewR * stages.depthSinew);
+		// run Sinew to stop excess slews, but run a dry/wet to allow a range of brights
+
+		switch (dither) {
+			case 2:
+				tpdf_wide_noise(&fpdL, &fpdR, &noiseL[i], &noiseR[i]);
+				break;
+			case 3:
+				paul_wide_noise(&fpdL, &fpdR, &mastering->previousDitherL, &mastering->previousDitherR, &noiseL[i], &noiseR[i]);
+				break;
+			case 5:
+				fpd_advance(&fpdL);
+				fpd_advance(&fpdR);
+				noiseL[i] = (double) fpdL - (uint32_t) 0x7fffffff;
+				noiseR[i] = (double) fpdR - (uint32_t) 0x7fffffff;
+				break;
+		}
+	}
+
+	mastering->lastSampleL = lastSample[0];
+	mastering->lastSampleR = lastSample[1];
+	mastering->wasPosClipL = wasPosClip[0];
+	mastering->wasPosClipR = wasPosClip[1];
+	mastering->wasNegClipL = wasNegClip[0];
+	mastering->wasNegClipR = wasNegClip[1];
+	mastering->lastSinewL = lastSinewL;
+	mastering->lastSinewR = lastSinewR;
+	mastering->lastSinewLostL = lastSinewLostL;
+	mastering->lastSinewLostR = lastSinewLostR;
+	mastering->fpdL = fpdL;
+	mastering->fpdR = fpdR;
+}
+
+// Dark: picks whichever of the two quantizations departs least from the
+// average slew of the previous output, and keeps that in darkSample
+static inline int dark(double* darkSample, int depth, int quantA, int quantB)
+{
+	// to do this style of dither, we quantize in either direction and then
+	// do a reconstruction of what the result will be for each choice.
+	// We then evaluate which one we like, and keep a history of what we previously had
+
+	float expectedSlew = 0;
+	for (int x = 0; x < depth; x++) {
+		expectedSlew += (darkSample[x + 1] - darkSample[x]);
+	}
+	expectedSlew /= depth; // we have an average of all recent slews
+	// we are doing that to voice the thing down into the upper mids a bit
+	// it mustn't just soften the brightest treble, it must smooth high mids too
+
+	float testA = fabs((darkSample[0] - quantA) - expectedSlew);
+	float testB = fabs((darkSample[0] - quantB) - expectedSlew);
+
+	int quant = testA < testB ? quantA : quantB;
+	// select whichever one departs LEAST from the vector of averaged
+	// reconstructed previous final samples. This will force a kind of dithering
+	// as it'll make the output end up as smooth as possible
+
+	for (int x = depth; x >= 0; x--) {
+		darkSample[x + 1] = darkSample[x];
+	}
+	darkSample[0] = quant;
+	return quant;
+}
+
+static void dither_dark(Mastering* mastering, const mastering_t* bufferL, const mastering_t* bufferR, float* out1, float* out2, uint32_t frames, int depth)
+{
+	for (uint32_t i = 0; i < frames; i++) {
+		mastering_t inputSampleL = bufferL[i] * 8388608.0;
+		mastering_t inputSampleR = bufferR[i] * 8388608.0; // we will apply the 24 bit Dark
+
+		inputSampleL = dark(mastering->darkSampleL, depth, floor(inputSampleL), floor(inputSampleL + 1.0));
+		inputSampleR = dark(mastering->darkSampleR, depth, floor(inputSampleR), floor(inputSampleR + 1.0));
+
+		out1[i] = (float) (inputSampleL / 8388608.0);
+		out2[i] = (float) (inputSampleR / 8388608.0);
+	} // Dark (Monitoring2)
+}
+
+static inline void ten_nines(double* NSOdd, double* NSEven, double* prevShape, double* darkSample, int depth, bool flip, mastering_t* inputSample)
+{
+	double correction = 0;
+	if (flip) {
+		*NSOdd = (*NSOdd * 0.9999999999) + *prevShape;
+		*NSEven = (*NSEven * 0.9999999999) - *prevShape;
+		correction = *NSOdd;
+	} else {
+		*NSOdd = (*NSOdd * 0.9999999999) - *prevShape;
+		*NSEven = (*NSEven * 0.9999999999) + *prevShape;
+		correction = *NSEven;
+	}
+	double shapedSample = *inputSample + correction;
+	// end Ten Nines
+
+	*inputSample = dark(darkSample, depth, floor(shapedSample), floor(shapedSample + 1.0));
+
+	*prevShape = (floor(shapedSample) - *inputSample) * 0.9999999999;
+	// end Ten Nines
+}
+
+static void dither_ten_nines(Mastering* mastering, const mastering_t* bufferL, const mastering_t* bufferR, float* out1, float* out2, uint32_t frames, int depth)
+{
+	for (uint32_t i = 0; i < frames; i++) {
+		mastering_t inputSampleL = bufferL[i] * 8388608.0;
+		mastering_t inputSampleR = bufferR[i] * 8388608.0; // we will apply the 24 bit Dark
+
+		ten_nines(&mastering->NSOddL, &mastering->NSEvenL, &mastering->prevShapeL, mastering->darkSampleL, depth, mastering->flip, &inputSampleL);
+		ten_nines(&mastering->NSOddR, &mastering->NSEvenR, &mastering->prevShapeR, mastering->darkSampleR, depth, mastering->flip, &inputSampleR);
+		mastering->flip = !mastering->flip;
+
+		out1[i] = (float) (inputSampleL / 8388608.0);
+		out2[i] = (float) (inputSampleR / 8388608.0);
+	} // Ten Nines (which goes into Dark in Monitoring3)
+}
+
+// TPDFWide (a good neutral with the width enhancement) and PaulWide (brighter
+// neutral that's still TPDF and wide) only differ in their noise
+static void dither_wide(const mastering_t* bufferL, const mastering_t* bufferR, float* out1, float* out2, const double* noiseL, const double* noiseR, uint32_t frames)
+{
+	for (uint32_t i = 0; i < frames; i++) {
+		mastering_t inputSampleL = bufferL[i] * 8388608.0;
+		mastering_t inputSampleR = bufferR[i] * 8388608.0;
+
+		inputSampleL = floor(inputSampleL + noiseL[i]);
+		inputSampleR = floor(inputSampleR + noiseR[i]);
+
+		out1[i] = (float) (inputSampleL / 8388608.0);
+		out2[i] = (float) (inputSampleR / 8388608.0);
+	}
+}
+
+static inline double benford_total(const double* byn)
+{
+	double total = 0.0;
+	total += (301 - byn[1]);
+	total += (176 - byn[2]);
+	total += (125 - byn[3]);
+	total += (97 - byn[4]);
+	total += (79 - byn[5]);
+	total += (67 - byn[6]);
+	total += (58 - byn[7]);
+	total += (51 - byn[8]);
+	total += (46 - byn[9]);
+	return total;
+}
+
+// Benford bin of the leading digit, 10 if there is none
+static inline int benford_bin(double benfordize)
+{
+	while (benfordize >= 1.0) benfordize /= 10;
+	while (benfordize < 1.0 && benfordize > 0.0000001) benfordize *= 10;
+	int hotbin = floor(benfordize);
+	return (hotbin > 0) && (hotbin < 10) ? hotbin : 10;
+}
+
+static inline void njad(double* byn, double* noiseShaping, mastering_t* inputSample)
+{
+	bool cutbins = false;
+	mastering_t drySample = *inputSample;
+	*inputSample -= *noiseShaping;
+
+	int hotbinA = benford_bin(floor(*inputSample));
+	// hotbin becomes the Benford bin value for this number floored
+	double totalA = 0.0;
+	if (hotbinA < 10) {
+		byn[hotbinA] += 1;
+		if (byn[hotbinA] > 982) cutbins = true;
+		totalA = benford_total(byn);
+		byn[hotbinA] -= 1;
+	}
+	// produce total number- smaller is closer to Benford real
+	int hotbinB = benford_bin(ceil(*inputSample));
+	// hotbin becomes the Benford bin value for this number ceiled
+	double totalB = 0.0;
+	if (hotbinB < 10) {
+		byn[hotbinB] += 1;
+		if (byn[hotbinB] > 982) cutbins = true;
+		totalB = benford_total(byn);
+		byn[hotbinB] -= 1;
+	}
+	// produce total number- smaller is closer to Benford real
+	double outputSample;
+	if (totalA < totalB) {
+		byn[hotbinA] += 1;
+		outputSample = floor(*inputSample);
+	} else {
+		byn[hotbinB] += 1;
+		outputSample = floor(*inputSample + 1);
+	}
+	// assign the relevant one to the delay line
+	// and floor/ceil signal accordingly
+	if (cutbins) {
+		for (int bin = 1; bin <= 10; bin++) byn[bin] *= 0.99;
+	}
+	*noiseShaping += outputSample - drySample;
+	if (*noiseShaping > MASTERING_FABS(*inputSample)) *noiseShaping = MASTERING_FABS(*inputSample);
+	if (*noiseShaping < -MASTERING_FABS(*inputSample)) *noiseShaping = -MASTERING_FABS(*inputSample);
+}
+
+static void dither_njad(Mastering* mastering, const mastering_t* bufferL, const mastering_t* bufferR, float* out1, float* out2, uint32_t frames)
+{
+	for (uint32_t i = 0; i < frames; i++) {
+		mastering_t inputSampleL = bufferL[i] * 8388608.0;
+		mastering_t inputSampleR = bufferR[i] * 8388608.0;
+
+		njad(mastering->bynL, &mastering->noiseShapingL, &inputSampleL);
+		njad(mastering->bynR, &mastering->noiseShapingR, &inputSampleR);
+
+		inputSampleL /= 8388608.0;
+		if (inputSampleL > 1.0) inputSampleL = 1.0;
+		if (inputSampleL < -1.0) inputSampleL = -1.0;
+		inputSampleR /= 8388608.0;
+		if (inputSampleR > 1.0) inputSampleR = 1.0;
+		if (inputSampleR < -1.0) inputSampleR = -1.0;
+		out1[i] = (float) inputSampleL;
+		out2[i] = (float) inputSampleR;
+	} // NJAD (Monitoring. Brightest)
+}
+
+static void dither_float(const mastering_t* bufferL, const mastering_t* bufferR, float* out1, float* out2, const double* noiseL, const double* noiseR, uint32_t frames)
+{
+	for (uint32_t i = 0; i < frames; i++) {
+		// begin 32 bit stereo floating point dither
+		mastering_t inputSampleL = bufferL[i];
+		mastering_t inputSampleR = bufferR[i];
+		int expon;
+		frexpf((float) inputSampleL, &expon);
+		inputSampleL += (noiseL[i] * 5.5e-36l * fast_pow2i(expon + 62));
+		frexpf((float) inputSampleR, &expon);
+		inputSampleR += (noiseR[i] * 5.5e-36l * fast_pow2i(expon + 62));
+		out1[i] = (float) inputSampleL;
+		out2[i] = (float) inputSampleR;
+		// end 32 bit stereo floating point dither
+	} // Bypass for saving floating point files directly
+}
+
 static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	Mastering* mastering = (Mastering*) instance;
@@ -305,853 +902,79 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	overallscale /= 44100.0;
 	overallscale *= mastering->sampleRate;
 
-	double threshSinew = (0.25 + ((1.0 - *mastering->glue) * 0.333)) / overallscale;
-	double depthSinew = 1.0 - pow(1.0 - *mastering->glue, 2.0);
+	MasteringStages stages;
+	stages.overallscale = overallscale;
+
+	stages.threshSinew = (0.25 + ((1.0 - *mastering->glue) * 0.333)) / overallscale;
+	stages.depthSinew = 1.0 - pow(1.0 - *mastering->glue, 2.0);
 
-	double trebleZoom = *mastering->scope - 0.5;
-	long double trebleGain = (trebleZoom * fabs(trebleZoom)) + 1.0;
-	if (trebleGain > 1.0) trebleGain = pow(trebleGain, 3.0 + sqrt(overallscale));
+	stages.trebleZoom = *mastering->scope - 0.5;
+	stages.trebleGain = (stages.trebleZoom * fabs(stages.trebleZoom)) + 1.0;
+	if (stages.trebleGain > 1.0) stages.trebleGain = pow(stages.trebleGain, 3.0 + sqrt(overallscale));
 	// this boost is necessary to adapt to higher sample rates
 
-	double midZoom = *mastering->skronk - 0.5;
-	long double midGain = (midZoom * fabs(midZoom)) + 1.0;
-	double kalMid = 0.35 - (*mastering->skronk * 0.25); // crossover frequency between mid/bass
-	double kalSub = 0.45 + (*mastering->skronk * 0.25); // crossover frequency between bass/sub
+	stages.midZoom = *mastering->skronk - 0.5;
+	stages.midGain = (stages.midZoom * fabs(stages.midZoom)) + 1.0;
+	stages.kalMid = 0.35 - (*mastering->skronk * 0.25); // crossover frequency between mid/bass
+	stages.kalSub = 0.45 + (*mastering->skronk * 0.25); // crossover frequency between bass/sub
 
-	double bassZoom = (*mastering->girth * 0.5) - 0.25;
-	long double bassGain = (-bassZoom * fabs(bassZoom)) + 1.0; // control inverted
-	long double subGain = ((*mastering->girth * 0.25) - 0.125) + 1.0;
-	if (subGain < 1.0) subGain = 1.0; // very small sub shift, only pos.
+	stages.bassZoom = (*mastering->girth * 0.5) - 0.25;
+	stages.bassGain = (-stages.bassZoom * fabs(stages.bassZoom)) + 1.0; // control inverted
+	stages.subGain = ((*mastering->girth * 0.25) - 0.125) + 1.0;
+	if (stages.subGain < 1.0) stages.subGain = 1.0; // very small sub shift, only pos.
 
-	long double driveIn = (*mastering->drive - 0.5) + 1.0;
-	long double driveOut = (-(*mastering->drive - 0.5) * fabs(*mastering->drive - 0.5)) + 1.0;
+	stages.driveIn = (*mastering->drive - 0.5) + 1.0;
+	stages.driveOut = (-(*mastering->drive - 0.5) * fabs(*mastering->drive - 0.5)) + 1.0;
 
-	int spacing = floor(overallscale); // should give us working basic scaling, usually 2 or 4
-	if (spacing < 1) spacing = 1;
-	if (spacing > 16) spacing = 16;
+	stages.spacing = floor(overallscale); // should give us working basic scaling, usually 2 or 4
+	if (stages.spacing < 1) stages.spacing = 1;
+	if (stages.spacing > 16) stages.spacing = 16;
 	int dither = ((int) (*mastering->dither));
 	if (dither > 5) {
 		dither = 5;
 	}
+	if (dither < 0) {
+		dither = 0; // the switch below has to write the outputs
+	}
 	int depth = (int) (17.0 * overallscale);
 	if (depth < 3) depth = 3;
 	if (depth > 98) depth = 98; // for Dark
 
-	while (sampleFrames-- > 0) {
-		long double inputSampleL = *in1;
-		long double inputSampleR = *in2;
-		if (fabsl(inputSampleL) < 1.18e-23) inputSampleL = mastering->fpdL * 1.18e-17;
-		if (fabsl(inputSampleR) < 1.18e-23) inputSampleR = mastering->fpdR * 1.18e-17;
-		inputSampleL *= driveIn;
-		inputSampleR *= driveIn;
-		long double drySampleL = inputSampleL;
-		long double drySampleR = inputSampleR;
-
-		// begin Air3L
-		mastering->air[pvSL4] = mastering->air[pvAL4] - mastering->air[pvAL3];
-		mastering->air[pvSL3] = mastering->air[pvAL3] - mastering->air[pvAL2];
-		mastering->air[pvSL2] = mastering->air[pvAL2] - mastering->air[pvAL1];
-		mastering->air[pvSL1] = mastering->air[pvAL1] - inputSampleL;
-		mastering->air[accSL3] = mastering->air[pvSL4] - mastering->air[pvSL3];
-		mastering->air[accSL2] = mastering->air[pvSL3] - mastering->air[pvSL2];
-		mastering->air[accSL1] = mastering->air[pvSL2] - mastering->air[pvSL1];
-		mastering->air[acc2SL2] = mastering->air[accSL3] - mastering->air[accSL2];
-		mastering->air[acc2SL1] = mastering->air[accSL2] - mastering->air[accSL1];
-		mastering->air[outAL] = -(mastering->air[pvAL1] + mastering->air[pvSL3] + mastering->air[acc2SL2] - ((mastering->air[acc2SL2] + mastering->air[acc2SL1]) * 0.5));
-		mastering->air[gainAL] *= 0.5;
-		mastering->air[gainAL] += fabsl(drySampleL - mastering->air[outAL]) * 0.5;
-		if (mastering->air[gainAL] > 0.3 * sqrt(overallscale)) mastering->air[gainAL] = 0.3 * sqrt(overallscale);
-		mastering->air[pvAL4] = mastering->air[pvAL3];
-		mastering->air[pvAL3] = mastering->air[pvAL2];
-		mastering->air[pvAL2] = mastering->air[pvAL1];
-		mastering->air[pvAL1] = (mastering->air[gainAL] * mastering->air[outAL]) + drySampleL;
-		long double midL = drySampleL - ((mastering->air[outAL] * 0.5) + (drySampleL * (0.457 - (0.017 * overallscale))));
-		long double temp = (midL + mastering->air[gndavgL]) * 0.5;
-		mastering->air[gndavgL] = midL;
-		midL = temp;
-		long double trebleL = drySampleL - midL;
-		// end Air3L
-
-		// begin Air3R
-		mastering->air[pvSR4] = mastering->air[pvAR4] - mastering->air[pvAR3];
-		mastering->air[pvSR3] = mastering->air[pvAR3] - mastering->air[pvAR2];
-		mastering->air[pvSR2] = mastering->air[pvAR2] - mastering->air[pvAR1];
-		mastering->air[pvSR1] = mastering->air[pvAR1] - inputSampleR;
-		mastering->air[accSR3] = mastering->air[pvSR4] - mastering->air[pvSR3];
-		mastering->air[accSR2] = mastering->air[pvSR3] - mastering->air[pvSR2];
-		mastering->air[accSR1] = mastering->air[pvSR2] - mastering->air[pvSR1];
-		mastering->air[acc2SR2] = mastering->air[accSR3] - mastering->air[accSR2];
-		mastering->air[acc2SR1] = mastering->air[accSR2] - mastering->air[accSR1];
-		mastering->air[outAR] = -(mastering->air[pvAR1] + mastering->air[pvSR3] + mastering->air[acc2SR2] - ((mastering->air[acc2SR2] + mastering->air[acc2SR1]) * 0.5));
-		mastering->air[gainAR] *= 0.5;
-		mastering->air[gainAR] += fabsl(drySampleR - mastering->air[outAR]) * 0.5;
-		if (mastering->air[gainAR] > 0.3 * sqrt(overallscale)) mastering->air[gainAR] = 0.3 * sqrt(overallscale);
-		mastering->air[pvAR4] = mastering->air[pvAR3];
-		mastering->air[pvAR3] = mastering->air[pvAR2];
-		mastering->air[pvAR2] = mastering->air[pvAR1];
-		mastering->air[pvAR1] = (mastering->air[gainAR] * mastering->air[outAR]) + drySampleR;
-		long double midR = drySampleR - ((mastering->air[outAR] * 0.5) + (drySampleR * (0.457 - (0.017 * overallscale))));
-		temp = (midR + mastering->air[gndavgR]) * 0.5;
-		mastering->air[gndavgR] = midR;
-		midR = temp;
-		long double trebleR = drySampleR - midR;
-		// end Air3R
-
-		// begin KalmanML
-		temp = midL;
-		mastering->kalM[prevSlewL3] += mastering->kalM[prevSampL3] - mastering->kalM[prevSampL2];
-		mastering->kalM[prevSlewL3] *= 0.5;
-		mastering->kalM[prevSlewL2] += mastering->kalM[prevSampL2] - mastering->kalM[prevSampL1];
-		mastering->kalM[prevSlewL2] *= 0.5;
-		mastering->kalM[prevSlewL1] += mastering->kalM[prevSampL1] - midL;
-		mastering->kalM[prevSlewL1] *= 0.5;
-		// make slews from each set of samples used
-		mastering->kalM[accSlewL2] += mastering->kalM[prevSlewL3] - mastering->kalM[prevSlewL2];
-		mastering->kalM[accSlewL2] *= 0.5;
-		mastering->kalM[accSlewL1] += mastering->kalM[prevSlewL2] - mastering->kalM[prevSlewL1];
-		mastering->kalM[accSlewL1] *= 0.5;
-		// differences between slews: rate of change of rate of change
-		mastering->kalM[accSlewL3] += (mastering->kalM[accSlewL2] - mastering->kalM[accSlewL1]);
-		mastering->kalM[accSlewL3] *= 0.5;
-		// entering the abyss, what even is this
-		mastering->kalM[kalOutL] += mastering->kalM[prevSampL1] + mastering->kalM[prevSlewL2] + mastering->kalM[accSlewL3];
-		mastering->kalM[kalOutL] *= 0.5;
-
-		// resynthesizing predicted result (all iir smoothed)
-		mastering->kalM[kalGainL] += fabsl(temp - mastering->kalM[kalOutL]) * kalMid * 8.0;
-		mastering->kalM[kalGainL] *= 0.5;
-		// madness takes its toll. Kalman Gain: how much dry to retain
-		if (mastering->kalM[kalGainL] > kalMid * 0.5) mastering->kalM[kalGainL] = kalMid * 0.5;
-		// attempts to avoid explosions
-		mastering->kalM[kalOutL] += (temp * (1.0 - (0.68 + (kalMid * 0.157))));
-		// this is for tuning a really complete cancellation up around Nyquist
-		mastering->kalM[prevSampL3] = mastering->kalM[prevSampL2];
-		mastering->kalM[prevSampL2] = mastering->kalM[prevSampL1];
-		mastering->kalM[prevSampL1] = (mastering->kalM[kalGainL] * mastering->kalM[kalOutL]) + ((1.0 - mastering->kalM[kalGainL]) * temp);
-		// feed the chain of previous samples
-		long double bassL = (mastering->kalM[kalOutL] + mastering->kalM[kalAvgL]) * 0.5;
-		mastering->kalM[kalAvgL] = mastering->kalM[kalOutL];
-		midL -= bassL;
-		// end KalmanML
-
-		// begin KalmanMR
-		temp = midR;
-		mastering->kalM[prevSlewR3] += mastering->kalM[prevSampR3] - mastering->kalM[prevSampR2];
-		mastering->kalM[prevSlewR3] *= 0.5;
-		mastering->kalM[prevSlewR2] += mastering->kalM[prevSampR2] - mastering->kalM[prevSampR1];
-		mastering->kalM[prevSlewR2] *= 0.5;
-		mastering->kalM[prevSlewR1] += mastering->kalM[prevSampR1] - midR;
-		mastering->kalM[prevSlewR1] *= 0.5;
-		// make slews from each set of samples used
-		mastering->kalM[accSlewR2] += mastering->kalM[prevSlewR3] - mastering->kalM[prevSlewR2];
-		mastering->kalM[accSlewR2] *= 0.5;
-		mastering->kalM[accSlewR1] += mastering->kalM[prevSlewR2] - mastering->kalM[prevSlewR1];
-		mastering->kalM[accSlewR1] *= 0.5;
-		// differences between slews: rate of change of rate of change
-		mastering->kalM[accSlewR3] += (mastering->kalM[accSlewR2] - mastering->kalM[accSlewR1]);
-		mastering->kalM[accSlewR3] *= 0.5;
-		// entering the abyss, what even is this
-		mastering->kalM[kalOutR] += mastering->kalM[prevSampR1] + mastering->kalM[prevSlewR2] + mastering->kalM[accSlewR3];
-		mastering->kalM[kalOutR] *= 0.5;
-
-		// resynthesizing predicted result (all iir smoothed)
-		mastering->kalM[kalGainR] += fabsl(temp - mastering->kalM[kalOutR]) * kalMid * 8.0;
-		mastering->kalM[kalGainR] *= 0.5;
-		// madness takes its toll. Kalman Gain: how much dry to retain
-		if (mastering->kalM[kalGainR] > kalMid * 0.5) mastering->kalM[kalGainR] = kalMid * 0.5;
-		// attempts to avoid explosions
-		mastering->kalM[kalOutR] += (temp * (1.0 - (0.68 + (kalMid * 0.157))));
-		// this is for tuning a really complete cancellation up around Nyquist
-		mastering->kalM[prevSampR3] = mastering->kalM[prevSampR2];
-		mastering->kalM[prevSampR2] = mastering->kalM[prevSampR1];
-		mastering->kalM[prevSampR1] = (mastering->kalM[kalGainR] * mastering->kalM[kalOutR]) + ((1.0 - mastering->kalM[kalGainR]) * temp);
-		// feed the chain of previous samples
-		long double bassR = (mastering->kalM[kalOutR] + mastering->kalM[kalAvgR]) * 0.5;
-		mastering->kalM[kalAvgR] = mastering->kalM[kalOutR];
-		midR -= bassR;
-		// end KalmanMR
-
-		// begin KalmanSL
-		temp = bassL;
-		mastering->kalS[prevSlewL3] += mastering->kalS[prevSampL3] - mastering->kalS[prevSampL2];
-		mastering->kalS[prevSlewL3] *= 0.5;
-		mastering->kalS[prevSlewL2] += mastering->kalS[prevSampL2] - mastering->kalS[prevSampL1];
-		mastering->kalS[prevSlewL2] *= 0.5;
-		mastering->kalS[prevSlewL1] += mastering->kalS[prevSampL1] - bassL;
-		mastering->kalS[prevSlewL1] *= 0.5;
-		// make slews from each set of samples used
-		mastering->kalS[accSlewL2] += mastering->kalS[prevSlewL3] - mastering->kalS[prevSlewL2];
-		mastering->kalS[accSlewL2] *= 0.5;
-		mastering->kalS[accSlewL1] += mastering->kalS[prevSlewL2] - mastering->kalS[prevSlewL1];
-		mastering->kalS[accSlewL1] *= 0.5;
-		// differences between slews: rate of change of rate of change
-		mastering->kalS[accSlewL3] += (mastering->kalS[accSlewL2] - mastering->kalS[accSlewL1]);
-		mastering->kalS[accSlewL3] *= 0.5;
-		// entering the abyss, what even is this
-		mastering->kalS[kalOutL] += mastering->kalS[prevSampL1] + mastering->kalS[prevSlewL2] + mastering->kalS[accSlewL3];
-		mastering->kalS[kalOutL] *= 0.5;
-		// resynthesizing predicted result (all iir smoothed)
-		mastering->kalS[kalGainL] += fabsl(temp - mastering->kalS[kalOutL]) * kalSub * 8.0;
-		mastering->kalS[kalGainL] *= 0.5;
-		// madness takes its toll. Kalman Gain: how much dry to retain
-		if (mastering->kalS[kalGainL] > kalSub * 0.5) mastering->kalS[kalGainL] = kalSub * 0.5;
-		// attempts to avoid explosions
-		mastering->kalS[kalOutL] += (temp * (1.0 - (0.68 + (kalSub * 0.157))));
-		// this is for tuning a really complete cancellation up around Nyquist
-		mastering->kalS[prevSampL3] = mastering->kalS[prevSampL2];
-		mastering->kalS[prevSampL2] = mastering->kalS[prevSampL1];
-		mastering->kalS[prevSampL1] = (mastering->kalS[kalGainL] * mastering->kalS[kalOutL]) + ((1.0 - mastering->kalS[kalGainL]) * temp);
-		// feed the chain of previous samples
-		long double subL = (mastering->kalS[kalOutL] + mastering->kalS[kalAvgL]) * 0.5;
-		mastering->kalS[kalAvgL] = mastering->kalS[kalOutL];
-		bassL -= subL;
-		// end KalmanSL
-
-		// begin KalmanSR
-		temp = bassR;
-		mastering->kalS[prevSlewR3] += mastering->kalS[prevSampR3] - mastering->kalS[prevSampR2];
-		mastering->kalS[prevSlewR3] *= 0.5;
-		mastering->kalS[prevSlewR2] += mastering->kalS[prevSampR2] - mastering->kalS[prevSampR1];
-		mastering->kalS[prevSlewR2] *= 0.5;
-		mastering->kalS[prevSlewR1] += mastering->kalS[prevSampR1] - bassR;
-		mastering->kalS[prevSlewR1] *= 0.5;
-		// make slews from each set of samples used
-		mastering->kalS[accSlewR2] += mastering->kalS[prevSlewR3] - mastering->kalS[prevSlewR2];
-		mastering->kalS[accSlewR2] *= 0.5;
-		mastering->kalS[accSlewR1] += mastering->kalS[prevSlewR2] - mastering->kalS[prevSlewR1];
-		mastering->kalS[accSlewR1] *= 0.5;
-		// differences between slews: rate of change of rate of change
-		mastering->kalS[accSlewR3] += (mastering->kalS[accSlewR2] - mastering->kalS[accSlewR1]);
-		mastering->kalS[accSlewR3] *= 0.5;
-		// entering the abyss, what even is this
-		mastering->kalS[kalOutR] += mastering->kalS[prevSampR1] + mastering->kalS[prevSlewR2] + mastering->kalS[accSlewR3];
-		mastering->kalS[kalOutR] *= 0.5;
-		// resynthesizing predicted result (all iir smoothed)
-		mastering->kalS[kalGainR] += fabsl(temp - mastering->kalS[kalOutR]) * kalSub * 8.0;
-		mastering->kalS[kalGainR] *= 0.5;
-		// madness takes its toll. Kalman Gain: how much dry to retain
-		if (mastering->kalS[kalGainR] > kalSub * 0.5) mastering->kalS[kalGainR] = kalSub * 0.5;
-		// attempts to avoid explosions
-		mastering->kalS[kalOutR] += (temp * (1.0 - (0.68 + (kalSub * 0.157))));
-		// this is for tuning a really complete cancellation up around Nyquist
-		mastering->kalS[prevSampR3] = mastering->kalS[prevSampR2];
-		mastering->kalS[prevSampR2] = mastering->kalS[prevSampR1];
-		mastering->kalS[prevSampR1] = (mastering->kalS[kalGainR] * mastering->kalS[kalOutR]) + ((1.0 - mastering->kalS[kalGainR]) * temp);
-		// feed the chain of previous samples
-		long double subR = (mastering->kalS[kalOutR] + mastering->kalS[kalAvgR]) * 0.5;
-		mastering->kalS[kalAvgR] = mastering->kalS[kalOutR];
-		bassR -= subR;
-		// end KalmanSR
-		inputSampleL = (subL * subGain);
-		inputSampleR = (subR * subGain);
-
-		if (bassZoom > 0.0) {
-			double closer = bassL * 1.57079633;
-			if (closer > 1.57079633) closer = 1.57079633;
-			if (closer < -1.57079633) closer = -1.57079633;
-			bassL = (bassL * (1.0 - bassZoom)) + (sin(closer) * bassZoom);
-			closer = bassR * 1.57079633;
-			if (closer > 1.57079633) closer = 1.57079633;
-			if (closer < -1.57079633) closer = -1.57079633;
-			bassR = (bassR * (1.0 - bassZoom)) + (sin(closer) * bassZoom);
-		} // zooming in will make the body of the sound louder: it's just Density
-		if (bassZoom < 0.0) {
-			double farther = fabsl(bassL) * 1.57079633;
-			if (farther > 1.57079633) farther = 1.0;
-			else farther = 1.0 - cos(farther);
-			if (bassL > 0.0) bassL = (bassL * (1.0 + bassZoom)) - (farther * bassZoom * 1.57079633);
-			if (bassL < 0.0) bassL = (bassL * (1.0 + bassZoom)) + (farther * bassZoom * 1.57079633);
-			farther = fabsl(bassR) * 1.57079633;
-			if (farther > 1.57079633) farther = 1.0;
-			else farther = 1.0 - cos(farther);
-			if (bassR > 0.0) bassR = (bassR * (1.0 + bassZoom)) - (farther * bassZoom * 1.57079633);
-			if (bassR < 0.0) bassR = (bassR * (1.0 + bassZoom)) + (farther * bassZoom * 1.57079633);
-		} // zooming out boosts the hottest peaks but cuts back softer stuff
-		inputSampleL += (bassL * bassGain);
-		inputSampleR += (bassR * bassGain);
-
-		if (midZoom > 0.0) {
-			double closer = midL * 1.57079633;
-			if (closer > 1.57079633) closer = 1.57079633;
-			if (closer < -1.57079633) closer = -1.57079633;
-			midL = (midL * (1.0 - midZoom)) + (sin(closer) * midZoom);
-			closer = midR * 1.57079633;
-			if (closer > 1.57079633) closer = 1.57079633;
-			if (closer < -1.57079633) closer = -1.57079633;
-			midR = (midR * (1.0 - midZoom)) + (sin(closer) * midZoom);
-		} // zooming in will make the body of the sound louder: it's just Density
-		if (midZoom < 0.0) {
-			double farther = fabsl(midL) * 1.57079633;
-			if (farther > 1.57079633) farther = 1.0;
-			else farther = 1.0 - cos(farther);
-			if (midL > 0.0) midL = (midL * (1.0 + midZoom)) - (farther * midZoom * 1.57079633);
-			if (midL < 0.0) midL = (midL * (1.0 + midZoom)) + (farther * midZoom * 1.57079633);
-			farther = fabsl(midR) * 1.57079633;
-			if (farther > 1.57079633) farther = 1.0;
-			else farther = 1.0 - cos(farther);
-			if (midR > 0.0) midR = (midR * (1.0 + midZoom)) - (farther * midZoom * 1.57079633);
-			if (midR < 0.0) midR = (midR * (1.0 + midZoom)) + (farther * midZoom * 1.57079633);
-		} // zooming out boosts the hottest peaks but cuts back softer stuff
-		inputSampleL += (midL * midGain);
-		inputSampleR += (midR * midGain);
-
-		if (trebleZoom > 0.0) {
-			double closer = trebleL * 1.57079633;
-			if (closer > 1.57079633) closer = 1.57079633;
-			if (closer < -1.57079633) closer = -1.57079633;
-			trebleL = (trebleL * (1.0 - trebleZoom)) + (sin(closer) * trebleZoom);
-			closer = trebleR * 1.57079633;
-			if (closer > 1.57079633) closer = 1.57079633;
-			if (closer < -1.57079633) closer = -1.57079633;
-			trebleR = (trebleR * (1.0 - trebleZoom)) + (sin(closer) * trebleZoom);
-		} // zooming in will make the body of the sound louder: it's just Density
-		if (trebleZoom < 0.0) {
-			double farther = fabsl(trebleL) * 1.57079633;
-			if (farther > 1.57079633) farther = 1.0;
-			else farther = 1.0 - cos(farther);
-			if (trebleL > 0.0) trebleL = (trebleL * (1.0 + trebleZoom)) - (farther * trebleZoom * 1.57079633);
-			if (trebleL < 0.0) trebleL = (trebleL * (1.0 + trebleZoom)) + (farther * trebleZoom * 1.57079633);
-			farther = fabsl(trebleR) * 1.57079633;
-			if (farther > 1.57079633) farther = 1.0;
-			else farther = 1.0 - cos(farther);
-			if (trebleR > 0.0) trebleR = (trebleR * (1.0 + trebleZoom)) - (farther * trebleZoom * 1.57079633);
-			if (trebleR < 0.0) trebleR = (trebleR * (1.0 + trebleZoom)) + (farther * trebleZoom * 1.57079633);
-		} // zooming out boosts the hottest peaks but cuts back softer stuff
-		inputSampleL += (trebleL * trebleGain);
-		inputSampleR += (trebleR * trebleGain);
-
-		inputSampleL *= driveOut;
-		inputSampleR *= driveOut;
-
-		// begin ClipOnly2 stereo as a little, compressed chunk that can be dropped into code
-		if (inputSampleL > 4.0) inputSampleL = 4.0;
-		if (inputSampleL < -4.0) inputSampleL = -4.0;
-		if (mastering->wasPosClipL == true) { // current will be over
-			if (inputSampleL < mastering->lastSampleL) mastering->lastSampleL = 0.7058208 + (inputSampleL * 0.2609148);
-			else mastering->lastSampleL = 0.2491717 + (mastering->lastSampleL * 0.7390851);
-		}
-		mastering->wasPosClipL = false;
-		if (inputSampleL > 0.9549925859) {
-			mastering->wasPosClipL = true;
-			inputSampleL = 0.7058208 + (mastering->lastSampleL * 0.2609148);
-		}
-		if (mastering->wasNegClipL == true) { // current will be -over
-			if (inputSampleL > mastering->lastSampleL) mastering->lastSampleL = -0.7058208 + (inputSampleL * 0.2609148);
-			else mastering->lastSampleL = -0.2491717 + (mastering->lastSampleL * 0.7390851);
-		}
-		mastering->wasNegClipL = false;
-		if (inputSampleL < -0.9549925859) {
-			mastering->wasNegClipL = true;
-			inputSampleL = -0.7058208 + (mastering->lastSampleL * 0.2609148);
-		}
-		mastering->intermediateL[spacing] = inputSampleL;
-		inputSampleL = mastering->lastSampleL; // Latency is however many samples equals one 44.1k sample
-		for (int x = spacing; x > 0; x--) mastering->intermediateL[x - 1] = mastering->intermediateL[x];
-		mastering->lastSampleL = mastering->intermediateL[0]; // run a little buffer to handle this
-
-		if (inputSampleR > 4.0) inputSampleR = 4.0;
-		if (inputSampleR < -4.0) inputSampleR = -4.0;
-		if (mastering->wasPosClipR == true) { // current will be over
-			if (inputSampleR < mastering->lastSampleR) mastering->lastSampleR = 0.7058208 + (inputSampleR * 0.2609148);
-			else mastering->lastSampleR = 0.2491717 + (mastering->lastSampleR * 0.7390851);
-		}
-		mastering->wasPosClipR = false;
-		if (inputSampleR > 0.9549925859) {
-			mastering->wasPosClipR = true;
-			inputSampleR = 0.7058208 + (mastering->lastSampleR * 0.2609148);
-		}
-		if (mastering->wasNegClipR == true) { // current will be -over
-			if (inputSampleR > mastering->lastSampleR) mastering->lastSampleR = -0.7058208 + (inputSampleR * 0.2609148);
-			else mastering->lastSampleR = -0.2491717 + (mastering->lastSampleR * 0.7390851);
-		}
-		mastering->wasNegClipR = false;
-		if (inputSampleR < -0.9549925859) {
-			mastering->wasNegClipR = true;
-			inputSampleR = -0.7058208 + (mastering->lastSampleR * 0.2609148);
-		}
-		mastering->intermediateR[spacing] = inputSampleR;
-		inputSampleR = mastering->lastSampleR; // Latency is however many samples equals one 44.1k sample
-		for (int x = spacing; x > 0; x--) mastering->intermediateR[x - 1] = mastering->intermediateR[x];
-		mastering->lastSampleR = mastering->intermediateR[0]; // run a little buffer to handle this
-		// end ClipOnly2 stereo as a little, compressed chunk that can be dropped into code
-
-		temp = inputSampleL;
-		long double sinew = threshSinew * cos(mastering->lastSinewL * mastering->lastSinewL);
-		if (inputSampleL - mastering->lastSinewL > sinew) temp = mastering->lastSinewL + sinew;
-		if (-(inputSampleL - mastering->lastSinewL) > sinew) temp = mastering->lastSinewL - sinew;
-		mastering->lastSinewL = temp;
-		inputSampleL = (inputSampleL * (1.0 - depthSinew)) + (mastering->lastSinewL * depthSinew);
-		temp = inputSampleR;
-		sinew = threshSinew * cos(mastering->lastSinewR * mastering->lastSinewR);
-		if (inputSampleR - mastering->lastSinewR > sinew) temp = mastering->lastSinewR + sinew;
-		if (-(inputSampleR - mastering->lastSinewR) > sinew) temp = mastering->lastSinewR - sinew;
-		mastering->lastSinewR = temp;
-		inputSampleR = (inputSampleR * (1.0 - depthSinew)) + (mastering->lastSinewR * depthSinew);
-		// run Sinew to stop excess slews, but run a dry/wet to allow a range of brights
+	const uint32_t chunk = mastering->chunk;
+	mastering_t* bufferL = mastering->bufferL;
+	mastering_t* bufferR = mastering->bufferR;
+	double* noiseL = mastering->noiseL;
+	double* noiseR = mastering->noiseR;
+
+	while (sampleFrames > 0) {
+		uint32_t frames = sampleFrames < chunk ? sampleFrames : chunk;
+
+		process_stages(mastering, in1, in2, bufferL, bufferR, noiseL, noiseR, frames, &stages, dither);
 
 		switch (dither) {
 			case 0:
-				// begin Dark
-				inputSampleL *= 8388608.0;
-				inputSampleR *= 8388608.0; // we will apply the 24 bit Dark
-				// We are doing it first Left, then Right, because the loops may run faster if
-				// they aren't too jammed full of variables. This means re-running code.
-
-				// begin left
-				mastering->quantA = floor(inputSampleL);
-				mastering->quantB = floor(inputSampleL + 1.0);
-				// to do this style of dither, we quantize in either direction and then
-				// do a reconstruction of what the result will be for each choice.
-				// We then evaluate which one we like, and keep a history of what we previously had
-
-				mastering->expectedSlew = 0;
-				for (int x = 0; x < depth; x++) {
-					mastering->expectedSlew += (mastering->darkSampleL[x + 1] - mastering->darkSampleL[x]);
-				}
-				mastering->expectedSlew /= depth; // we have an average of all recent slews
-				// we are doing that to voice the thing down into the upper mids a bit
-				// it mustn't just soften the brightest treble, it must smooth high mids too
-
-				mastering->testA = fabs((mastering->darkSampleL[0] - mastering->quantA) - mastering->expectedSlew);
-				mastering->testB = fabs((mastering->darkSampleL[0] - mastering->quantB) - mastering->expectedSlew);
-
-				if (mastering->testA < mastering->testB) inputSampleL = mastering->quantA;
-				else inputSampleL = mastering->quantB;
-				// select whichever one departs LEAST from the vector of averaged
-				// reconstructed previous final samples. This will force a kind of dithering
-				// as it'll make the output end up as smooth as possible
-
-				for (int x = depth; x >= 0; x--) {
-					mastering->darkSampleL[x + 1] = mastering->darkSampleL[x];
-				}
-				mastering->darkSampleL[0] = inputSampleL;
-				// end Dark left
-
-				// begin right
-				mastering->quantA = floor(inputSampleR);
-				mastering->quantB = floor(inputSampleR + 1.0);
-				// to do this style of dither, we quantize in either direction and then
-				// do a reconstruction of what the result will be for each choice.
-				// We then evaluate which one we like, and keep a history of what we previously had
-
-				mastering->expectedSlew = 0;
-				for (int x = 0; x < depth; x++) {
-					mastering->expectedSlew += (mastering->darkSampleR[x + 1] - mastering->darkSampleR[x]);
-				}
-				mastering->expectedSlew /= depth; // we have an average of all recent slews
-				// we are doing that to voice the thing down into the upper mids a bit
-				// it mustn't just soften the brightest treble, it must smooth high mids too
-
-				mastering->testA = fabs((mastering->darkSampleR[0] - mastering->quantA) - mastering->expectedSlew);
-				mastering->testB = fabs((mastering->darkSampleR[0] - mastering->quantB) - mastering->expectedSlew);
-
-				if (mastering->testA < mastering->testB) inputSampleR = mastering->quantA;
-				else inputSampleR = mastering->quantB;
-				// select whichever one departs LEAST from the vector of averaged
-				// reconstructed previous final samples. This will force a kind of dithering
-				// as it'll make the output end up as smooth as possible
-
-				for (int x = depth; x >= 0; x--) {
-					mastering->darkSampleR[x + 1] = mastering->darkSampleR[x];
-				}
-				mastering->darkSampleR[0] = inputSampleR;
-				// end Dark right
-
-				inputSampleL /= 8388608.0;
-				inputSampleR /= 8388608.0;
-				break; // Dark (Monitoring2)
+				dither_dark(mastering, bufferL, bufferR, out1, out2, frames, depth);
+				break;
 			case 1:
-				// begin Dark	 for Ten Nines
-				inputSampleL *= 8388608.0;
-				inputSampleR *= 8388608.0; // we will apply the 24 bit Dark
-				// We are doing it first Left, then Right, because the loops may run faster if
-				// they aren't too jammed full of variables. This means re-running code.
-
-				// begin L
-				mastering->correction = 0;
-				if (mastering->flip) {
-					mastering->NSOddL = (mastering->NSOddL * 0.9999999999) + mastering->prevShapeL;
-					mastering->NSEvenL = (mastering->NSEvenL * 0.9999999999) - mastering->prevShapeL;
-					mastering->correction = mastering->NSOddL;
-				} else {
-					mastering->NSOddL = (mastering->NSOddL * 0.9999999999) - mastering->prevShapeL;
-					mastering->NSEvenL = (mastering->NSEvenL * 0.9999999999) + mastering->prevShapeL;
-					mastering->correction = mastering->NSEvenL;
-				}
-				mastering->shapedSampleL = inputSampleL + mastering->correction;
-				// end Ten Nines L
-
-				// begin Dark L
-				mastering->quantA = floor(mastering->shapedSampleL);
-				mastering->quantB = floor(mastering->shapedSampleL + 1.0);
-				// to do this style of dither, we quantize in either direction and then
-				// do a reconstruction of what the result will be for each choice.
-				// We then evaluate which one we like, and keep a history of what we previously had
-
-				mastering->expectedSlew = 0;
-				for (int x = 0; x < depth; x++) {
-					mastering->expectedSlew += (mastering->darkSampleL[x + 1] - mastering->darkSampleL[x]);
-				}
-				mastering->expectedSlew /= depth; // we have an average of all recent slews
-				// we are doing that to voice the thing down into the upper mids a bit
-				// it mustn't just soften the brightest treble, it must smooth high mids too
-
-				mastering->testA = fabs((mastering->darkSampleL[0] - mastering->quantA) - mastering->expectedSlew);
-				mastering->testB = fabs((mastering->darkSampleL[0] - mastering->quantB) - mastering->expectedSlew);
-
-				if (mastering->testA < mastering->testB) inputSampleL = mastering->quantA;
-				else inputSampleL = mastering->quantB;
-				// select whichever one departs LEAST from the vector of averaged
-				// reconstructed previous final samples. This will force a kind of dithering
-				// as it'll make the output end up as smooth as possible
-
-				for (int x = depth; x >= 0; x--) {
-					mastering->darkSampleL[x + 1] = mastering->darkSampleL[x];
-				}
-				mastering->darkSampleL[0] = inputSampleL;
-				// end Dark L
-
-				mastering->prevShapeL = (floor(mastering->shapedSampleL) - inputSampleL) * 0.9999999999;
-				// end Ten Nines L
-
-				// begin R
-				mastering->correction = 0;
-				if (mastering->flip) {
-					mastering->NSOddR = (mastering->NSOddR * 0.9999999999) + mastering->prevShapeR;
-					mastering->NSEvenR = (mastering->NSEvenR * 0.9999999999) - mastering->prevShapeR;
-					mastering->correction = mastering->NSOddR;
-				} else {
-					mastering->NSOddR = (mastering->NSOddR * 0.9999999999) - mastering->prevShapeR;
-					mastering->NSEvenR = (mastering->NSEvenR * 0.9999999999) + mastering->prevShapeR;
-					mastering->correction = mastering->NSEvenR;
-				}
-				mastering->shapedSampleR = inputSampleR + mastering->correction;
-				// end Ten Nines R
-
-				// begin Dark R
-				mastering->quantA = floor(mastering->shapedSampleR);
-				mastering->quantB = floor(mastering->shapedSampleR + 1.0);
-				// to do this style of dither, we quantize in either direction and then
-				// do a reconstruction of what the result will be for each choice.
-				// We then evaluate which one we like, and keep a history of what we previously had
-
-				mastering->expectedSlew = 0;
-				for (int x = 0; x < depth; x++) {
-					mastering->expectedSlew += (mastering->darkSampleR[x + 1] - mastering->darkSampleR[x]);
-				}
-				mastering->expectedSlew /= depth; // we have an average of all recent slews
-				// we are doing that to voice the thing down into the upper mids a bit
-				// it mustn't just soften the brightest treble, it must smooth high mids too
-
-				mastering->testA = fabs((mastering->darkSampleR[0] - mastering->quantA) - mastering->expectedSlew);
-				mastering->testB = fabs((mastering->darkSampleR[0] - mastering->quantB) - mastering->expectedSlew);
-
-				if (mastering->testA < mastering->testB) inputSampleR = mastering->quantA;
-				else inputSampleR = mastering->quantB;
-				// select whichever one departs LEAST from the vector of averaged
-				// reconstructed previous final samples. This will force a kind of dithering
-				// as it'll make the output end up as smooth as possible
-
-				for (int x = depth; x >= 0; x--) {
-					mastering->darkSampleR[x + 1] = mastering->darkSampleR[x];
-				}
-				mastering->darkSampleR[0] = inputSampleR;
-				// end Dark R
-
-				mastering->prevShapeR = (floor(mastering->shapedSampleR) - inputSampleR) * 0.9999999999;
-				// end Ten Nines
-				mastering->flip = !mastering->flip;
-
-				inputSampleL /= 8388608.0;
-				inputSampleR /= 8388608.0;
-				break; // Ten Nines (which goes into Dark in Monitoring3)
+				dither_ten_nines(mastering, bufferL, bufferR, out1, out2, frames, depth);
+				break;
 			case 2:
-				inputSampleL *= 8388608.0;
-				inputSampleR *= 8388608.0;
-
-				mastering->ditherL = -1.0;
-				mastering->ditherL += ((double) mastering->fpdL / UINT32_MAX);
-				mastering->fpdL ^= mastering->fpdL << 13;
-				mastering->fpdL ^= mastering->fpdL >> 17;
-				mastering->fpdL ^= mastering->fpdL << 5;
-				mastering->ditherL += ((double) mastering->fpdL / UINT32_MAX);
-				// TPDF: two 0-1 random noises
-
-				mastering->ditherR = -1.0;
-				mastering->ditherR += ((double) mastering->fpdR / UINT32_MAX);
-				mastering->fpdR ^= mastering->fpdR << 13;
-				mastering->fpdR ^= mastering->fpdR >> 17;
-				mastering->fpdR ^= mastering->fpdR << 5;
-				mastering->ditherR += ((double) mastering->fpdR / UINT32_MAX);
-				// TPDF: two 0-1 random noises
-
-				if (fabs(mastering->ditherL - mastering->ditherR) < 0.5) {
-					mastering->ditherL = -1.0;
-					mastering->ditherL += ((double) mastering->fpdL / UINT32_MAX);
-					mastering->fpdL ^= mastering->fpdL << 13;
-					mastering->fpdL ^= mastering->fpdL >> 17;
-					mastering->fpdL ^= mastering->fpdL << 5;
-					mastering->ditherL += ((double) mastering->fpdL / UINT32_MAX);
-				}
-
-				if (fabs(mastering->ditherL - mastering->ditherR) < 0.5) {
-					mastering->ditherR = -1.0;
-					mastering->ditherR += ((double) mastering->fpdR / UINT32_MAX);
-					mastering->fpdR ^= mastering->fpdR << 13;
-					mastering->fpdR ^= mastering->fpdR >> 17;
-					mastering->fpdR ^= mastering->fpdR << 5;
-					mastering->ditherR += ((double) mastering->fpdR / UINT32_MAX);
-				}
-
-				if (fabs(mastering->ditherL - mastering->ditherR) < 0.5) {
-					mastering->ditherL = -1.0;
-					mastering->ditherL += ((double) mastering->fpdL / UINT32_MAX);
-					mastering->fpdL ^= mastering->fpdL << 13;
-					mastering->fpdL ^= mastering->fpdL >> 17;
-					mastering->fpdL ^= mastering->fpdL << 5;
-					mastering->ditherL += ((double) mastering->fpdL / UINT32_MAX);
-				}
-
-				inputSampleL = floor(inputSampleL + mastering->ditherL);
-				inputSampleR = floor(inputSampleR + mastering->ditherR);
-
-				inputSampleL /= 8388608.0;
-				inputSampleR /= 8388608.0;
-				break; // TPDFWide (a good neutral with the width enhancement)
 			case 3:
-				inputSampleL *= 8388608.0;
-				inputSampleR *= 8388608.0;
-				// Paul Frindle: It's true that the dither itself can sound different
-				// if it's given a different freq response and you get to hear it.
-				// The one we use most is triangular single pole high pass dither.
-				// It's not freq bent enough to sound odd, but is slightly less audible than
-				// flat dither. It can also be easily made by taking one sample of dither
-				// away from the previous one - this gives you the triangular PDF and the
-				// filtering in one go :-)
-
-				mastering->currentDither = ((double) mastering->fpdL / UINT32_MAX);
-				mastering->ditherL = mastering->currentDither;
-				mastering->ditherL -= mastering->previousDitherL;
-				mastering->previousDitherL = mastering->currentDither;
-				// TPDF: two 0-1 random noises
-
-				mastering->currentDither = ((double) mastering->fpdR / UINT32_MAX);
-				mastering->ditherR = mastering->currentDither;
-				mastering->ditherR -= mastering->previousDitherR;
-				mastering->previousDitherR = mastering->currentDither;
-				// TPDF: two 0-1 random noises
-
-				if (fabs(mastering->ditherL - mastering->ditherR) < 0.5) {
-					mastering->fpdL ^= mastering->fpdL << 13;
-					mastering->fpdL ^= mastering->fpdL >> 17;
-					mastering->fpdL ^= mastering->fpdL << 5;
-					mastering->currentDither = ((double) mastering->fpdL / UINT32_MAX);
-					mastering->ditherL = mastering->currentDither;
-					mastering->ditherL -= mastering->previousDitherL;
-					mastering->previousDitherL = mastering->currentDither;
-				}
-
-				if (fabs(mastering->ditherL - mastering->ditherR) < 0.5) {
-					mastering->fpdR ^= mastering->fpdR << 13;
-					mastering->fpdR ^= mastering->fpdR >> 17;
-					mastering->fpdR ^= mastering->fpdR << 5;
-					mastering->currentDither = ((double) mastering->fpdR / UINT32_MAX);
-					mastering->ditherR = mastering->currentDither;
-					mastering->ditherR -= mastering->previousDitherR;
-					mastering->previousDitherR = mastering->currentDither;
-				}
-
-				if (fabs(mastering->ditherL - mastering->ditherR) < 0.5) {
-					mastering->fpdL ^= mastering->fpdL << 13;
-					mastering->fpdL ^= mastering->fpdL >> 17;
-					mastering->fpdL ^= mastering->fpdL << 5;
-					mastering->currentDither = ((double) mastering->fpdL / UINT32_MAX);
-					mastering->ditherL = mastering->currentDither;
-					mastering->ditherL -= mastering->previousDitherL;
-					mastering->previousDitherL = mastering->currentDither;
-				}
-
-				inputSampleL = floor(inputSampleL + mastering->ditherL);
-				inputSampleR = floor(inputSampleR + mastering->ditherR);
-
-				inputSampleL /= 8388608.0;
-				inputSampleR /= 8388608.0;
-				break; // PaulWide (brighter neutral that's still TPDF and wide)
+				dither_wide(bufferL, bufferR, out1, out2, noiseL, noiseR, frames);
+				break;
 			case 4:
-				inputSampleL *= 8388608.0;
-				inputSampleR *= 8388608.0;
-				mastering->cutbinsL = false;
-				mastering->cutbinsR = false;
-				drySampleL = inputSampleL; // re-using in NJAD
-				inputSampleL -= mastering->noiseShapingL;
-				// NJAD L
-				mastering->benfordize = floor(inputSampleL);
-				while (mastering->benfordize >= 1.0) mastering->benfordize /= 10;
-				while (mastering->benfordize < 1.0 && mastering->benfordize > 0.0000001) mastering->benfordize *= 10;
-				mastering->hotbinA = floor(mastering->benfordize);
-				// hotbin becomes the Benford bin value for this number floored
-				mastering->totalA = 0.0;
-				if ((mastering->hotbinA > 0) && (mastering->hotbinA < 10)) {
-					mastering->bynL[mastering->hotbinA] += 1;
-					if (mastering->bynL[mastering->hotbinA] > 982) mastering->cutbinsL = true;
-					mastering->totalA += (301 - mastering->bynL[1]);
-					mastering->totalA += (176 - mastering->bynL[2]);
-					mastering->totalA += (125 - mastering->bynL[3]);
-					mastering->totalA += (97 - mastering->bynL[4]);
-					mastering->totalA += (79 - mastering->bynL[5]);
-					mastering->totalA += (67 - mastering->bynL[6]);
-					mastering->totalA += (58 - mastering->bynL[7]);
-					mastering->totalA += (51 - mastering->bynL[8]);
-					mastering->totalA += (46 - mastering->bynL[9]);
-					mastering->bynL[mastering->hotbinA] -= 1;
-				} else mastering->hotbinA = 10;
-				// produce total number- smaller is closer to Benford real
-				mastering->benfordize = ceil(inputSampleL);
-				while (mastering->benfordize >= 1.0) mastering->benfordize /= 10;
-				while (mastering->benfordize < 1.0 && mastering->benfordize > 0.0000001) mastering->benfordize *= 10;
-				mastering->hotbinB = floor(mastering->benfordize);
-				// hotbin becomes the Benford bin value for this number ceiled
-				mastering->totalB = 0.0;
-				if ((mastering->hotbinB > 0) && (mastering->hotbinB < 10)) {
-					mastering->bynL[mastering->hotbinB] += 1;
-					if (mastering->bynL[mastering->hotbinB] > 982) mastering->cutbinsL = true;
-					mastering->totalB += (301 - mastering->bynL[1]);
-					mastering->totalB += (176 - mastering->bynL[2]);
-					mastering->totalB += (125 - mastering->bynL[3]);
-					mastering->totalB += (97 - mastering->bynL[4]);
-					mastering->totalB += (79 - mastering->bynL[5]);
-					mastering->totalB += (67 - mastering->bynL[6]);
-					mastering->totalB += (58 - mastering->bynL[7]);
-					mastering->totalB += (51 - mastering->bynL[8]);
-					mastering->totalB += (46 - mastering->bynL[9]);
-					mastering->bynL[mastering->hotbinB] -= 1;
-				} else mastering->hotbinB = 10;
-				// produce total number- smaller is closer to Benford real
-				if (mastering->totalA < mastering->totalB) {
-					mastering->bynL[mastering->hotbinA] += 1;
-					mastering->outputSample = floor(inputSampleL);
-				} else {
-					mastering->bynL[mastering->hotbinB] += 1;
-					mastering->outputSample = floor(inputSampleL + 1);
-				}
-				// assign the relevant one to the delay line
-				// and floor/ceil signal accordingly
-				if (mastering->cutbinsL) {
-					mastering->bynL[1] *= 0.99;
-					mastering->bynL[2] *= 0.99;
-					mastering->bynL[3] *= 0.99;
-					mastering->bynL[4] *= 0.99;
-					mastering->bynL[5] *= 0.99;
-					mastering->bynL[6] *= 0.99;
-					mastering->bynL[7] *= 0.99;
-					mastering->bynL[8] *= 0.99;
-					mastering->bynL[9] *= 0.99;
-					mastering->bynL[10] *= 0.99;
-				}
-				mastering->noiseShapingL += mastering->outputSample - drySampleL;
-				if (mastering->noiseShapingL > fabsl(inputSampleL)) mastering->noiseShapingL = fabsl(inputSampleL);
-				if (mastering->noiseShapingL < -fabsl(inputSampleL)) mastering->noiseShapingL = -fabsl(inputSampleL);
-				inputSampleL /= 8388608.0;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				// finished NJAD L
-
-				// NJAD R
-				drySampleR = inputSampleR;
-				inputSampleR -= mastering->noiseShapingR;
-				mastering->benfordize = floor(inputSampleR);
-				while (mastering->benfordize >= 1.0) mastering->benfordize /= 10;
-				while (mastering->benfordize < 1.0 && mastering->benfordize > 0.0000001) mastering->benfordize *= 10;
-				mastering->hotbinA = floor(mastering->benfordize);
-				// hotbin becomes the Benford bin value for this number floored
-				mastering->totalA = 0.0;
-				if ((mastering->hotbinA > 0) && (mastering->hotbinA < 10)) {
-					mastering->bynR[mastering->hotbinA] += 1;
-					if (mastering->bynR[mastering->hotbinA] > 982) mastering->cutbinsR = true;
-					mastering->totalA += (301 - mastering->bynR[1]);
-					mastering->totalA += (176 - mastering->bynR[2]);
-					mastering->totalA += (125 - mastering->bynR[3]);
-					mastering->totalA += (97 - mastering->bynR[4]);
-					mastering->totalA += (79 - mastering->bynR[5]);
-					mastering->totalA += (67 - mastering->bynR[6]);
-					mastering->totalA += (58 - mastering->bynR[7]);
-					mastering->totalA += (51 - mastering->bynR[8]);
-					mastering->totalA += (46 - mastering->bynR[9]);
-					mastering->bynR[mastering->hotbinA] -= 1;
-				} else mastering->hotbinA = 10;
-				// produce total number- smaller is closer to Benford real
-				mastering->benfordize = ceil(inputSampleR);
-				while (mastering->benfordize >= 1.0) mastering->benfordize /= 10;
-				while (mastering->benfordize < 1.0 && mastering->benfordize > 0.0000001) mastering->benfordize *= 10;
-				mastering->hotbinB = floor(mastering->benfordize);
-				// hotbin becomes the Benford bin value for this number ceiled
-				mastering->totalB = 0.0;
-				if ((mastering->hotbinB > 0) && (mastering->hotbinB < 10)) {
-					mastering->bynR[mastering->hotbinB] += 1;
-					if (mastering->bynR[mastering->hotbinB] > 982) mastering->cutbinsR = true;
-					mastering->totalB += (301 - mastering->bynR[1]);
-					mastering->totalB += (176 - mastering->bynR[2]);
-					mastering->totalB += (125 - mastering->bynR[3]);
-					mastering->totalB += (97 - mastering->bynR[4]);
-					mastering->totalB += (79 - mastering->bynR[5]);
-					mastering->totalB += (67 - mastering->bynR[6]);
-					mastering->totalB += (58 - mastering->bynR[7]);
-					mastering->totalB += (51 - mastering->bynR[8]);
-					mastering->totalB += (46 - mastering->bynR[9]);
-					mastering->bynR[mastering->hotbinB] -= 1;
-				} else mastering->hotbinB = 10;
-				// produce total number- smaller is closer to Benford real
-				if (mastering->totalA < mastering->totalB) {
-					mastering->bynR[mastering->hotbinA] += 1;
-					mastering->outputSample = floor(inputSampleR);
-				} else {
-					mastering->bynR[mastering->hotbinB] += 1;
-					mastering->outputSample = floor(inputSampleR + 1);
-				}
-				// assign the relevant one to the delay line
-				// and floor/ceil signal accordingly
-				if (mastering->cutbinsR) {
-					mastering->bynR[1] *= 0.99;
-					mastering->bynR[2] *= 0.99;
-					mastering->bynR[3] *= 0.99;
-					mastering->bynR[4] *= 0.99;
-					mastering->bynR[5] *= 0.99;
-					mastering->bynR[6] *= 0.99;
-					mastering->bynR[7] *= 0.99;
-					mastering->bynR[8] *= 0.99;
-					mastering->bynR[9] *= 0.99;
-					mastering->bynR[10] *= 0.99;
-				}
-				mastering->noiseShapingR += mastering->outputSample - drySampleR;
-				if (mastering->noiseShapingR > fabsl(inputSampleR)) mastering->noiseShapingR = fabsl(inputSampleR);
-				if (mastering->noiseShapingR < -fabsl(inputSampleR)) mastering->noiseShapingR = -fabsl(inputSampleR);
-				inputSampleR /= 8388608.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-				break; // NJAD (Monitoring. Brightest)
+				dither_njad(mastering, bufferL, bufferR, out1, out2, frames);
+				break;
 			case 5:
-				// begin 32 bit stereo floating point dither
-				frexpf((float) inputSampleL, &mastering->expon);
-				mastering->fpdL ^= mastering->fpdL << 13;
-				mastering->fpdL ^= mastering->fpdL >> 17;
-				mastering->fpdL ^= mastering->fpdL << 5;
-				inputSampleL += (((double) mastering->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, mastering->expon + 62));
-				frexpf((float) inputSampleR, &mastering->expon);
-				mastering->fpdR ^= mastering->fpdR << 13;
-				mastering->fpdR ^= mastering->fpdR >> 17;
-				mastering->fpdR ^= mastering->fpdR << 5;
-				inputSampleR += (((double) mastering->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, mastering->expon + 62));
-				// end 32 bit stereo floating point dither
-				break; // Bypass for saving floating point files directly
+				dither_float(bufferL, bufferR, out1, out2, noiseL, noiseR, frames);
+				break;
 		}
 
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+		in1 += frames;
+		in2 += frames;
+		out1 += frames;
+		out2 += frames;
+		sampleFrames -= frames;
 	}
 }
 
@@ -1159,7 +982,13 @@ static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
 {
-	free(instance);
+	Mastering* mastering = (Mastering*) instance;
+
+	free(mastering->bufferL);
+	free(mastering->bufferR);
+	free(mastering->noiseL);
+	free(mastering->noiseR);
+	free(mastering);
 }
 
 static const void* extension_data(const char* uri)
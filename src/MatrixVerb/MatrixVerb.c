@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define MATRIXVERB_URI "https://hannesbraun.net/ns/lv2/airwindows/matrixverb"
@@ -100,6 +103,8 @@ typedef struct {
 
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	Silence silence;
 } MatrixVerb;
 
 static LV2_Handle instantiate(
@@ -276,6 +281,8 @@ static void activate(LV2_Handle instance)
 	while (matrixVerb->fpdL < 16386) matrixVerb->fpdL = rand() * UINT32_MAX;
 	matrixVerb->fpdR = 1.0;
 	while (matrixVerb->fpdR < 16386) matrixVerb->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&matrixVerb->silence, 71843); // delay memory per channel
 }
 
 static void run(LV2_Handle instance, uint32_t sampleFrames)
@@ -287,6 +294,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = matrixVerb->output[0];
 	float* out2 = matrixVerb->output[1];
 
+	if (silence_skip(&matrixVerb->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	double overallscale = 1.0;
 	overallscale /= 44100.0;
 	overallscale *= matrixVerb->sampleRate;
@@ -379,8 +388,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleR *= wet;
 		// we're going to use this as a kind of balance since the reverb buildup can be so large
 
-		inputSampleL = sin(inputSampleL);
-		inputSampleR = sin(inputSampleR);
+		inputSampleL = fast_sin(inputSampleL);
+		inputSampleR = fast_sin(inputSampleR);
 
 		double allpassIL = inputSampleL;
 		double allpassJL = inputSampleL;
@@ -681,8 +690,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
 
-		inputSampleL = asin(inputSampleL);
-		inputSampleR = asin(inputSampleR);
+		inputSampleL = fast_asin(inputSampleL);
+		inputSampleR = fast_asin(inputSampleR);
 
 		tempSampleL = (inputSampleL * matrixVerb->biquadC[2]) + matrixVerb->biquadC[7];
 		matrixVerb->biquadC[7] = (inputSampleL * matrixVerb->biquadC[3]) - (tempSampleL * matrixVerb->biquadC[5]) + matrixVerb->biquadC[8];
@@ -705,12 +714,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		matrixVerb->fpdL ^= matrixVerb->fpdL << 13;
 		matrixVerb->fpdL ^= matrixVerb->fpdL >> 17;
 		matrixVerb->fpdL ^= matrixVerb->fpdL << 5;
-		inputSampleL += (((double) matrixVerb->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) matrixVerb->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		matrixVerb->fpdR ^= matrixVerb->fpdR << 13;
 		matrixVerb->fpdR ^= matrixVerb->fpdR >> 17;
 		matrixVerb->fpdR ^= matrixVerb->fpdR << 5;
-		inputSampleR += (((double) matrixVerb->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) matrixVerb->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -721,6 +730,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&matrixVerb->silence, matrixVerb->output[0], matrixVerb->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
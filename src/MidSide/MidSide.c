@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define MIDSIDE_URI "https://hannesbraun.net/ns/lv2/airwindows/midside"
 
 typedef enum {
@@ -101,13 +103,13 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		midside->fpdL ^= midside->fpdL << 13;
 		midside->fpdL ^= midside->fpdL >> 17;
 		midside->fpdL ^= midside->fpdL << 5;
-		mid += (((double) midside->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		mid += (((double) midside->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit floating point dither
 		frexpf((float) side, &expon);
 		midside->fpdR ^= midside->fpdR << 13;
 		midside->fpdR ^= midside->fpdR >> 17;
 		midside->fpdR ^= midside->fpdR << 5;
-		side += (((double) midside->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		side += (((double) midside->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit floating point dither
 
 		*out1 = (float) mid;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define MONOAM_URI "https://hannesbraun.net/ns/lv2/airwindows/monoam"
 
 typedef enum {
@@ -123,12 +125,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		moNoam->fpdL ^= moNoam->fpdL << 13;
 		moNoam->fpdL ^= moNoam->fpdL >> 17;
 		moNoam->fpdL ^= moNoam->fpdL << 5;
-		inputSampleL += (((double) moNoam->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) moNoam->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		moNoam->fpdR ^= moNoam->fpdR << 13;
 		moNoam->fpdR ^= moNoam->fpdR >> 17;
 		moNoam->fpdR ^= moNoam->fpdR << 5;
-		inputSampleR += (((double) moNoam->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) moNoam->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
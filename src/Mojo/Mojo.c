@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define MOJO_URI "https://hannesbraun.net/ns/lv2/airwindows/mojo"
@@ -90,10 +92,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		}
 
 		double mojo = pow(fabs(inputSampleL), 0.25);
-		if (mojo > 0.0) inputSampleL = (sin(inputSampleL * mojo * M_PI * 0.5) / mojo) * 0.987654321;
+		if (mojo > 0.0) inputSampleL = (fast_sin(inputSampleL * mojo * M_PI * 0.5) / mojo) * 0.987654321;
 		// mojo is the one that flattens WAAAAY out very softly before wavefolding
 		mojo = pow(fabs(inputSampleR), 0.25);
-		if (mojo > 0.0) inputSampleR = (sin(inputSampleR * mojo * M_PI * 0.5) / mojo) * 0.987654321;
+		if (mojo > 0.0) inputSampleR = (fast_sin(inputSampleR * mojo * M_PI * 0.5) / mojo) * 0.987654321;
 		// mojo is the one that flattens WAAAAY out very softly before wavefolding
 
 		// begin 32 bit stereo floating point dither
@@ -102,12 +104,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		mojoInstance->fpdL ^= mojoInstance->fpdL << 13;
 		mojoInstance->fpdL ^= mojoInstance->fpdL >> 17;
 		mojoInstance->fpdL ^= mojoInstance->fpdL << 5;
-		inputSampleL += (((double) mojoInstance->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) mojoInstance->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		mojoInstance->fpdR ^= mojoInstance->fpdR << 13;
 		mojoInstance->fpdR ^= mojoInstance->fpdR >> 17;
 		mojoInstance->fpdR ^= mojoInstance->fpdR << 5;
-		inputSampleR += (((double) mojoInstance->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) mojoInstance->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
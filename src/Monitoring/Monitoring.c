@@ -5,10 +5,17 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/blocklength.h"
+#include "../common/dispatch.h"
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define MONITORING_URI "https://hannesbraun.net/ns/lv2/airwindows/monitoring"
 
+#define MONITORING_CHUNK 256
+#define MONITORING_CHUNK_MAX 8192
+
 typedef enum {
 	INPUT_L = 0,
 	INPUT_R = 1,
@@ -50,8 +57,14 @@ typedef struct {
 
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	uint32_t chunk; // frames per pass, a whole run if the host bounds it
+	double* bufferL;
+	double* bufferR;
 } Monitoring;
 
+static void cleanup(LV2_Handle instance);
+
 static LV2_Handle instantiate(
 	const LV2_Descriptor* descriptor,
 	double rate,
@@ -59,7 +72,16 @@ static LV2_Handle instantiate(
 	const LV2_Feature* const* features)
 {
 	Monitoring* monitoring = (Monitoring*) calloc(1, sizeof(Monitoring));
+	if (!monitoring) return NULL;
 	monitoring->sampleRate = rate;
+
+	monitoring->chunk = block_length_chunk(block_length_from_features(features), MONITORING_CHUNK, MONITORING_CHUNK_MAX);
+	monitoring->bufferL = (double*) calloc(monitoring->chunk, sizeof(double));
+	monitoring->bufferR = (double*) calloc(monitoring->chunk, sizeof(double));
+	if (!monitoring->bufferL || !monitoring->bufferR) {
+		cleanup(monitoring);
+		return NULL;
+	}
 	return (LV2_Handle) monitoring;
 }
 
@@ -198,7 +220,368 @@ static void activate(LV2_Handle instance)
 	while (monitoring->fpdR < 16386) monitoring->fpdR = rand() * UINT32_MAX;
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+// Each monitoring mode is its own block kernel working in place on a chunk of
+// double samples, so the mode is only dispatched once per chunk.
+
+static inline void asin_clip(double* inputSampleL, double* inputSampleR)
+{
+	if (*inputSampleL > 1.0) *inputSampleL = 1.0;
+	if (*inputSampleL < -1.0) *inputSampleL = -1.0;
+	*inputSampleL = fast_asin(*inputSampleL);
+	if (*inputSampleR > 1.0) *inputSampleR = 1.0;
+	if (*inputSampleR < -1.0) *inputSampleR = -1.0;
+	*inputSampleR = fast_asin(*inputSampleR);
+	// amplitude aspect
+}
+
+static inline void midiverb_allpass(double* bufL, double* bufR, int* x, int m, double* inputSampleL, double* inputSampleR)
+{
+	int allpasstemp = *x - 1;
+	if (allpasstemp < 0 || allpasstemp > m) allpasstemp = m;
+	*inputSampleL -= bufL[allpasstemp] * 0.5;
+	bufL[*x] = *inputSampleL;
+	*inputSampleL *= 0.5;
+	*inputSampleR -= bufR[allpasstemp] * 0.5;
+	bufR[*x] = *inputSampleR;
+	*inputSampleR *= 0.5;
+	(*x)--;
+	if (*x < 0 || *x > m) {
+		*x = m;
+	}
+	*inputSampleL += bufL[*x];
+	*inputSampleR += bufR[*x];
+	// a single Midiverb-style allpass
+}
+
+static inline void darkened_allpass(double* bufL, double* bufR, int* x, int m, double* inputSampleL, double* inputSampleR)
+{
+	int allpasstemp = *x - 1;
+	if (allpasstemp < 0 || allpasstemp > m) allpasstemp = m;
+	*inputSampleL -= bufL[allpasstemp] * 0.5;
+	bufL[*x] = *inputSampleL;
+	*inputSampleL *= 0.5;
+	*inputSampleR -= bufR[allpasstemp] * 0.5;
+	bufR[*x] = *inputSampleR;
+	*inputSampleR *= 0.5;
+
+	(*x)--;
+	if (*x < 0 || *x > m) {
+		*x = m;
+	}
+	*inputSampleL += bufL[*x] * 0.5;
+	*inputSampleR += bufR[*x] * 0.5;
+	if (*x == m) {
+		*inputSampleL += bufL[0] * 0.5;
+		*inputSampleR += bufR[0] * 0.5;
+	} else {
+		*inputSampleL += bufL[*x + 1] * 0.5;
+		*inputSampleR += bufR[*x + 1] * 0.5;
+	}
+	// a darkened Midiverb-style allpass
+}
+
+static void process_peaks(Monitoring* monitoring, double* bufferL, double* bufferR, uint32_t frames, int am, int bm, int cm, int dm)
+{
+	for (uint32_t i = 0; i < frames; i++) {
+		double inputSampleL = bufferL[i];
+		double inputSampleR = bufferR[i];
+
+		asin_clip(&inputSampleL, &inputSampleR);
+		midiverb_allpass(monitoring->aL, monitoring->aR, &monitoring->ax, am, &inputSampleL, &inputSampleR);
+		asin_clip(&inputSampleL, &inputSampleR);
+		midiverb_allpass(monitoring->bL, monitoring->bR, &monitoring->bx, bm, &inputSampleL, &inputSampleR);
+		asin_clip(&inputSampleL, &inputSampleR);
+		midiverb_allpass(monitoring->cL, monitoring->cR, &monitoring->cx, cm, &inputSampleL, &inputSampleR);
+		asin_clip(&inputSampleL, &inputSampleR);
+		midiverb_allpass(monitoring->dL, monitoring->dR, &monitoring->dx, dm, &inputSampleL, &inputSampleR);
+		asin_clip(&inputSampleL, &inputSampleR);
+
+		bufferL[i] = inputSampleL * 0.63679;
+		bufferR[i] = inputSampleR * 0.63679; // scale it to 0dB output at full blast
+		// PeaksOnly
+	}
+}
+
+static void process_slew(Monitoring* monitoring, double* bufferL, double* bufferR, uint32_t frames)
+{
+	const double trim = 2.302585092994045684017991; // natural logarithm of 10
+	double lastSampleL = monitoring->lastSampleL;
+	double lastSampleR = monitoring->lastSampleR;
+
+	for (uint32_t i = 0; i < frames; i++) {
+		double slewSample = (bufferL[i] - lastSampleL) * trim;
+		lastSampleL = bufferL[i];
+		if (slewSample > 1.0) slewSample = 1.0;
+		if (slewSample < -1.0) slewSample = -1.0;
+		bufferL[i] = slewSample;
+		slewSample = (bufferR[i] - lastSampleR) * trim;
+		lastSampleR = bufferR[i];
+		if (slewSample > 1.0) slewSample = 1.0;
+		if (slewSample < -1.0) slewSample = -1.0;
+		bufferR[i] = slewSample;
+		// SlewOnly
+	}
+
+	monitoring->lastSampleL = lastSampleL;
+	monitoring->lastSampleR = lastSampleR;
+}
+
+static void process_subs(Monitoring* monitoring, double* bufferL, double* bufferR, uint32_t frames, double overallscale)
+{
+	const double iirAmount = (2250 / 44100.0) / overallscale;
+	double* iirL[26] = {
+		&monitoring->iirSampleAL, &monitoring->iirSampleBL, &monitoring->iirSampleCL, &monitoring->iirSampleDL,
+		&monitoring->iirSampleEL, &monitoring->iirSampleFL, &monitoring->iirSampleGL, &monitoring->iirSampleHL,
+		&monitoring->iirSampleIL, &monitoring->iirSampleJL, &monitoring->iirSampleKL, &monitoring->iirSampleLL,
+		&monitoring->iirSampleML, &monitoring->iirSampleNL, &monitoring->iirSampleOL, &monitoring->iirSamplePL,
+		&monitoring->iirSampleQL, &monitoring->iirSampleRL, &monitoring->iirSampleSL, &monitoring->iirSampleTL,
+		&monitoring->iirSampleUL, &monitoring->iirSampleVL, &monitoring->iirSampleWL, &monitoring->iirSampleXL,
+		&monitoring->iirSampleYL, &monitoring->iirSampleZL};
+	double* iirR[26] = {
+		&monitoring->iirSampleAR, &monitoring->iirSampleBR, &monitoring->iirSampleCR, &monitoring->iirSampleDR,
+		&monitoring->iirSampleER, &monitoring->iirSampleFR, &monitoring->iirSampleGR, &monitoring->iirSampleHR,
+		&monitoring->iirSampleIR, &monitoring->iirSampleJR, &monitoring->iirSampleKR, &monitoring->iirSampleLR,
+		&monitoring->iirSampleMR, &monitoring->iirSampleNR, &monitoring->iirSampleOR, &monitoring->iirSamplePR,
+		&monitoring->iirSampleQR, &monitoring->iirSampleRR, &monitoring->iirSampleSR, &monitoring->iirSampleTR,
+		&monitoring->iirSampleUR, &monitoring->iirSampleVR, &monitoring->iirSampleWR, &monitoring->iirSampleXR,
+		&monitoring->iirSampleYR, &monitoring->iirSampleZR};
+
+	// The 26 poles run stage by stage over the whole chunk, keeping every
+	// intermediate stage in the buffer instead of in per-sample locals.
+	double gain = 1.42;
+	for (uint32_t i = 0; i < frames; i++) {
+		bufferL[i] *= gain;
+		bufferR[i] *= gain;
+	}
+	for (int stage = 0; stage < 26; stage++) {
+		gain = ((gain - 1) * 0.75) + 1;
+		const double stageGain = stage < 25 ? gain : 1.0; // the last pole is not boosted
+		double iirSampleL = *iirL[stage];
+		double iirSampleR = *iirR[stage];
+		for (uint32_t i = 0; i < frames; i++) {
+			iirSampleL = (iirSampleL * (1.0 - iirAmount)) + (bufferL[i] * iirAmount);
+			double inputSampleL = iirSampleL;
+			iirSampleR = (iirSampleR * (1.0 - iirAmount)) + (bufferR[i] * iirAmount);
+			double inputSampleR = iirSampleR;
+			inputSampleL *= stageGain;
+			inputSampleR *= stageGain;
+			if (inputSampleL > 1.0) inputSampleL = 1.0;
+			if (inputSampleL < -1.0) inputSampleL = -1.0;
+			if (inputSampleR > 1.0) inputSampleR = 1.0;
+			if (inputSampleR < -1.0) inputSampleR = -1.0;
+			bufferL[i] = inputSampleL;
+			bufferR[i] = inputSampleR;
+		}
+		*iirL[stage] = iirSampleL;
+		*iirR[stage] = iirSampleR;
+	}
+	// SubsOnly
+}
+
+static void process_mid_side(double* bufferL, double* bufferR, uint32_t frames, bool sideOnly)
+{
+	for (uint32_t i = 0; i < frames; i++) {
+		double mid = bufferL[i] + bufferR[i];
+		double side = bufferL[i] - bufferR[i];
+		if (!sideOnly) side = 0.0;
+		else mid = 0.0; // mono monitoring, or side-only monitoring
+		bufferL[i] = (mid + side) / 2.0;
+		bufferR[i] = (mid - side) / 2.0;
+	}
+}
+
+static void process_bandpass(Monitoring* monitoring, double* bufferL, double* bufferR, uint32_t frames, int processing)
+{
+	double* biquadL = monitoring->biquadL;
+	double* biquadR = monitoring->biquadR;
+
+	for (uint32_t i = 0; i < frames; i++) {
+		double inputSampleL = bufferL[i];
+		double inputSampleR = bufferR[i];
+
+		// Bandpass: changes in EQ are up in the variable defining, not here
+		// 7 Vinyl, 8 9 10 Aurat, 11 Phone
+		if (processing == 9) {
+			inputSampleR = (inputSampleL + inputSampleR) * 0.5;
+			inputSampleL = 0.0;
+		}
+		if (processing == 10) {
+			inputSampleL = (inputSampleL + inputSampleR) * 0.5;
+			inputSampleR = 0.0;
+		}
+		if (processing == 11) {
+			double M = (inputSampleL + inputSampleR) * 0.5;
+			inputSampleL = M;
+			inputSampleR = M;
+		}
+
+		inputSampleL = fast_sin(inputSampleL);
+		inputSampleR = fast_sin(inputSampleR);
+		// encode Console5: good cleanness
+
+		double tempSampleL = (inputSampleL * biquadL[2]) + biquadL[7];
+		biquadL[7] = (-tempSampleL * biquadL[5]) + biquadL[8];
+		biquadL[8] = (inputSampleL * biquadL[4]) - (tempSampleL * biquadL[6]);
+		inputSampleL = tempSampleL; // like mono AU, 7 and 8 store L channel
+
+		double tempSampleR = (inputSampleR * biquadR[2]) + biquadR[7];
+		biquadR[7] = (-tempSampleR * biquadR[5]) + biquadR[8];
+		biquadR[8] = (inputSampleR * biquadR[4]) - (tempSampleR * biquadR[6]);
+		inputSampleR = tempSampleR; // we are using the mono configuration
+
+		// without the clip in asin_clip, you can get a NaN condition where it spits out DC offset at full blast!
+		asin_clip(&inputSampleL, &inputSampleR);
+
+		bufferL[i] = inputSampleL;
+		bufferR[i] = inputSampleR;
+	}
+}
+
+static void process_cans(Monitoring* monitoring, double* bufferL, double* bufferR, uint32_t frames, int am, int dm, int processing, double overallscale)
+{
+	// we do a volume compensation immediately to gain stage stuff cleanly
+	static const double trim[4] = {0.855, 0.748, 0.713, 0.680};
+	// Cans A suppresses the crossfeed more, Cans B makes it louder
+	static const double crossfeed[4] = {0.125, 0.25, 0.30, 0.35};
+	const double inputTrim = trim[processing - 12];
+	const double crossfeedLevel = crossfeed[processing - 12];
+	const double bass = (processing * processing * 0.00001) / overallscale;
+	// we are using the iir filters from out of SubsOnly
+
+	for (uint32_t i = 0; i < frames; i++) {
+		double inputSampleL = bufferL[i] * inputTrim;
+		double inputSampleR = bufferR[i] * inputTrim;
+		inputSampleL = fast_sin(inputSampleL);
+		inputSampleR = fast_sin(inputSampleR);
+		double drySampleL = inputSampleL;
+		double drySampleR = inputSampleR; // everything runs 'inside' Console
+
+		double mid = inputSampleL + inputSampleR;
+		double side = inputSampleL - inputSampleR;
+		monitoring->iirSampleAL = (monitoring->iirSampleAL * (1.0 - (bass * 0.618))) + (side * bass * 0.618);
+		side = side - monitoring->iirSampleAL;
+		inputSampleL = (mid + side) / 2.0;
+		inputSampleR = (mid - side) / 2.0;
+		// bass narrowing filter
+
+		darkened_allpass(monitoring->aL, monitoring->aR, &monitoring->ax, am, &inputSampleL, &inputSampleR);
+
+		inputSampleL *= crossfeedLevel;
+		inputSampleR *= crossfeedLevel;
+
+		drySampleL += inputSampleR;
+		drySampleR += inputSampleL; // the crossfeed
+
+		darkened_allpass(monitoring->dL, monitoring->dR, &monitoring->dx, dm, &inputSampleL, &inputSampleR);
+		// which is stretching the previous one even more
+
+		inputSampleL *= 0.25;
+		inputSampleR *= 0.25;
+		// for all versions of Cans the second level of bloom is this far down
+		// and, remains on the opposite speaker rather than crossing again to the original side
+
+		drySampleL += inputSampleR;
+		drySampleR += inputSampleL; // add the crossfeed and very faint extra verbyness
+
+		inputSampleL = drySampleL;
+		inputSampleR = drySampleR; // and output our can-opened headphone feed
+
+		mid = inputSampleL + inputSampleR;
+		side = inputSampleL - inputSampleR;
+		monitoring->iirSampleAR = (monitoring->iirSampleAR * (1.0 - bass)) + (side * bass);
+		side = side - monitoring->iirSampleAR;
+		inputSampleL = (mid + side) / 2.0;
+		inputSampleR = (mid - side) / 2.0;
+		// bass narrowing filter
+
+		asin_clip(&inputSampleL, &inputSampleR);
+		// ConsoleBuss processing
+
+		bufferL[i] = inputSampleL;
+		bufferR[i] = inputSampleR;
+	}
+}
+
+static void process_vtrick(double* bufferL, double* bufferR, uint32_t frames)
+{
+	for (uint32_t i = 0; i < frames; i++) {
+		double inputSample = (bufferL[i] + bufferR[i]) * 0.5;
+		bufferL[i] = -inputSample;
+		bufferR[i] = inputSample;
+	}
+}
+
+static inline void njad(double* byn, double* noiseShaping, double* sample, double scale)
+{
+	double inputSample = *sample * scale;
+	bool cutbins = false;
+	double drySample = inputSample;
+	inputSample -= *noiseShaping;
+	double benfordize = floor(inputSample);
+	while (benfordize >= 1.0) benfordize /= 10;
+	while (benfordize < 1.0 && benfordize > 0.0000001) benfordize *= 10;
+	int hotbinA = floor(benfordize);
+	// hotbin becomes the Benford bin value for this number floored
+	double totalA = 0;
+	if ((hotbinA > 0) && (hotbinA < 10)) {
+		byn[hotbinA] += 1;
+		if (byn[hotbinA] > 982) cutbins = true;
+		totalA += (301 - byn[1]);
+		totalA += (176 - byn[2]);
+		totalA += (125 - byn[3]);
+		totalA += (97 - byn[4]);
+		totalA += (79 - byn[5]);
+		totalA += (67 - byn[6]);
+		totalA += (58 - byn[7]);
+		totalA += (51 - byn[8]);
+		totalA += (46 - byn[9]);
+		byn[hotbinA] -= 1;
+	} else hotbinA = 10;
+	// produce total number- smaller is closer to Benford real
+	benfordize = ceil(inputSample);
+	while (benfordize >= 1.0) benfordize /= 10;
+	while (benfordize < 1.0 && benfordize > 0.0000001) benfordize *= 10;
+	int hotbinB = floor(benfordize);
+	// hotbin becomes the Benford bin value for this number ceiled
+	double totalB = 0;
+	if ((hotbinB > 0) && (hotbinB < 10)) {
+		byn[hotbinB] += 1;
+		if (byn[hotbinB] > 982) cutbins = true;
+		totalB += (301 - byn[1]);
+		totalB += (176 - byn[2]);
+		totalB += (125 - byn[3]);
+		totalB += (97 - byn[4]);
+		totalB += (79 - byn[5]);
+		totalB += (67 - byn[6]);
+		totalB += (58 - byn[7]);
+		totalB += (51 - byn[8]);
+		totalB += (46 - byn[9]);
+		byn[hotbinB] -= 1;
+	} else hotbinB = 10;
+	// produce total number- smaller is closer to Benford real
+	double outputSample;
+	if (totalA < totalB) {
+		byn[hotbinA] += 1;
+		outputSample = floor(inputSample);
+	} else {
+		byn[hotbinB] += 1;
+		outputSample = floor(inputSample + 1);
+	}
+	// assign the relevant one to the delay line
+	// and floor/ceil signal accordingly
+	if (cutbins) {
+		for (int x = 1; x < 11; x++) byn[x] *= 0.99;
+	}
+	*noiseShaping += outputSample - drySample;
+	if (*noiseShaping > fabs(inputSample)) *noiseShaping = fabs(inputSample);
+	if (*noiseShaping < -fabs(inputSample)) *noiseShaping = -fabs(inputSample);
+	inputSample = outputSample / scale;
+	if (inputSample > 1.0) inputSample = 1.0;
+	if (inputSample < -1.0) inputSample = -1.0;
+	*sample = inputSample;
+}
+
+CPU_DISPATCH static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	Monitoring* monitoring = (Monitoring*) instance;
 
@@ -222,7 +605,6 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	int bm = (int) 179.0 * overallscale;
 	int cm = (int) 191.0 * overallscale;
 	int dm = (int) 223.0 * overallscale; // these are 'good' primes, spacing out the allpasses
-	int allpasstemp;
 	// for PeaksOnly
 	monitoring->biquadL[0] = 0.0375 / overallscale;
 	monitoring->biquadL[1] = 0.1575; // define as AURAT, MONORAT, MONOLAT unless overridden
@@ -259,842 +641,77 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	monitoring->biquadR[6] = (1.0 - K / monitoring->biquadR[1] + K * K) * norm;
 	// for Bandpasses
 
-	while (sampleFrames-- > 0) {
-		double inputSampleL = *in1;
-		double inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = monitoring->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = monitoring->fpdR * 1.18e-17;
+	const double ditherScale = processing == 1 ? 32768.0 : 8388608.0; // or 16 bit option
+	// for literally everything else we will apply the 24 bit NJAD
+	// on the not unreasonable assumption that we are very likely playing back on 24 bit DAC
+	// if we're not, then all we did was apply a Benford Realness function at 24 bits down.
+
+	const uint32_t chunk = monitoring->chunk;
+	double* bufferL = monitoring->bufferL;
+	double* bufferR = monitoring->bufferR;
+
+	while (sampleFrames > 0) {
+		uint32_t frames = sampleFrames < chunk ? sampleFrames : chunk;
+
+		for (uint32_t i = 0; i < frames; i++) {
+			double inputSampleL = in1[i];
+			double inputSampleR = in2[i];
+			if (fabs(inputSampleL) < 1.18e-23) inputSampleL = monitoring->fpdL * 1.18e-17;
+			if (fabs(inputSampleR) < 1.18e-23) inputSampleR = monitoring->fpdR * 1.18e-17;
+			bufferL[i] = inputSampleL;
+			bufferR[i] = inputSampleR;
+		}
 
 		switch (processing) {
 			case 0:
 			case 1:
 				break;
 			case 2:
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				inputSampleL = asin(inputSampleL);
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-				inputSampleR = asin(inputSampleR);
-				// amplitude aspect
-				allpasstemp = monitoring->ax - 1;
-				if (allpasstemp < 0 || allpasstemp > am) allpasstemp = am;
-				inputSampleL -= monitoring->aL[allpasstemp] * 0.5;
-				monitoring->aL[monitoring->ax] = inputSampleL;
-				inputSampleL *= 0.5;
-				inputSampleR -= monitoring->aR[allpasstemp] * 0.5;
-				monitoring->aR[monitoring->ax] = inputSampleR;
-				inputSampleR *= 0.5;
-				monitoring->ax--;
-				if (monitoring->ax < 0 || monitoring->ax > am) {
-					monitoring->ax = am;
-				}
-				inputSampleL += (monitoring->aL[monitoring->ax]);
-				inputSampleR += (monitoring->aR[monitoring->ax]);
-				// a single Midiverb-style allpass
-
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				inputSampleL = asin(inputSampleL);
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-				inputSampleR = asin(inputSampleR);
-				// amplitude aspect
-
-				allpasstemp = monitoring->bx - 1;
-				if (allpasstemp < 0 || allpasstemp > bm) allpasstemp = bm;
-				inputSampleL -= monitoring->bL[allpasstemp] * 0.5;
-				monitoring->bL[monitoring->bx] = inputSampleL;
-				inputSampleL *= 0.5;
-				inputSampleR -= monitoring->bR[allpasstemp] * 0.5;
-				monitoring->bR[monitoring->bx] = inputSampleR;
-				inputSampleR *= 0.5;
-				monitoring->bx--;
-				if (monitoring->bx < 0 || monitoring->bx > bm) {
-					monitoring->bx = bm;
-				}
-				inputSampleL += (monitoring->bL[monitoring->bx]);
-				inputSampleR += (monitoring->bR[monitoring->bx]);
-				// a single Midiverb-style allpass
-
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				inputSampleL = asin(inputSampleL);
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-				inputSampleR = asin(inputSampleR);
-				// amplitude aspect
-
-				allpasstemp = monitoring->cx - 1;
-				if (allpasstemp < 0 || allpasstemp > cm) allpasstemp = cm;
-				inputSampleL -= monitoring->cL[allpasstemp] * 0.5;
-				monitoring->cL[monitoring->cx] = inputSampleL;
-				inputSampleL *= 0.5;
-				inputSampleR -= monitoring->cR[allpasstemp] * 0.5;
-				monitoring->cR[monitoring->cx] = inputSampleR;
-				inputSampleR *= 0.5;
-				monitoring->cx--;
-				if (monitoring->cx < 0 || monitoring->cx > cm) {
-					monitoring->cx = cm;
-				}
-				inputSampleL += (monitoring->cL[monitoring->cx]);
-				inputSampleR += (monitoring->cR[monitoring->cx]);
-				// a single Midiverb-style allpass
-
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				inputSampleL = asin(inputSampleL);
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-				inputSampleR = asin(inputSampleR);
-				// amplitude aspect
-
-				allpasstemp = monitoring->dx - 1;
-				if (allpasstemp < 0 || allpasstemp > dm) allpasstemp = dm;
-				inputSampleL -= monitoring->dL[allpasstemp] * 0.5;
-				monitoring->dL[monitoring->dx] = inputSampleL;
-				inputSampleL *= 0.5;
-				inputSampleR -= monitoring->dR[allpasstemp] * 0.5;
-				monitoring->dR[monitoring->dx] = inputSampleR;
-				inputSampleR *= 0.5;
-				monitoring->dx--;
-				if (monitoring->dx < 0 || monitoring->dx > dm) {
-					monitoring->dx = dm;
-				}
-				inputSampleL += (monitoring->dL[monitoring->dx]);
-				inputSampleR += (monitoring->dR[monitoring->dx]);
-				// a single Midiverb-style allpass
-
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				inputSampleL = asin(inputSampleL);
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-				inputSampleR = asin(inputSampleR);
-				// amplitude aspect
-
-				inputSampleL *= 0.63679;
-				inputSampleR *= 0.63679; // scale it to 0dB output at full blast
-				// PeaksOnly
+				process_peaks(monitoring, bufferL, bufferR, frames, am, bm, cm, dm);
+				break;
+			case 3:
+				process_slew(monitoring, bufferL, bufferR, frames);
+				break;
+			case 4:
+				process_subs(monitoring, bufferL, bufferR, frames, overallscale);
 				break;
-			case 3: {
-				double trim;
-				trim = 2.302585092994045684017991; // natural logarithm of 10
-				double slewSample;
-				slewSample = (inputSampleL - monitoring->lastSampleL) * trim;
-				monitoring->lastSampleL = inputSampleL;
-				if (slewSample > 1.0) slewSample = 1.0;
-				if (slewSample < -1.0) slewSample = -1.0;
-				inputSampleL = slewSample;
-				slewSample = (inputSampleR - monitoring->lastSampleR) * trim;
-				monitoring->lastSampleR = inputSampleR;
-				if (slewSample > 1.0) slewSample = 1.0;
-				if (slewSample < -1.0) slewSample = -1.0;
-				inputSampleR = slewSample;
-				// SlewOnly
-			} break;
-			case 4: {
-				double iirAmount;
-				iirAmount = (2250 / 44100.0) / overallscale;
-				double gain;
-				gain = 1.42;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-
-				monitoring->iirSampleAL = (monitoring->iirSampleAL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleAL;
-				monitoring->iirSampleAR = (monitoring->iirSampleAR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleAR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleBL = (monitoring->iirSampleBL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleBL;
-				monitoring->iirSampleBR = (monitoring->iirSampleBR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleBR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleCL = (monitoring->iirSampleCL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleCL;
-				monitoring->iirSampleCR = (monitoring->iirSampleCR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleCR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleDL = (monitoring->iirSampleDL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleDL;
-				monitoring->iirSampleDR = (monitoring->iirSampleDR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleDR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleEL = (monitoring->iirSampleEL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleEL;
-				monitoring->iirSampleER = (monitoring->iirSampleER * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleER;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleFL = (monitoring->iirSampleFL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleFL;
-				monitoring->iirSampleFR = (monitoring->iirSampleFR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleFR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleGL = (monitoring->iirSampleGL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleGL;
-				monitoring->iirSampleGR = (monitoring->iirSampleGR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleGR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleHL = (monitoring->iirSampleHL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleHL;
-				monitoring->iirSampleHR = (monitoring->iirSampleHR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleHR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleIL = (monitoring->iirSampleIL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleIL;
-				monitoring->iirSampleIR = (monitoring->iirSampleIR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleIR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleJL = (monitoring->iirSampleJL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleJL;
-				monitoring->iirSampleJR = (monitoring->iirSampleJR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleJR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleKL = (monitoring->iirSampleKL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleKL;
-				monitoring->iirSampleKR = (monitoring->iirSampleKR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleKR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleLL = (monitoring->iirSampleLL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleLL;
-				monitoring->iirSampleLR = (monitoring->iirSampleLR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleLR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleML = (monitoring->iirSampleML * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleML;
-				monitoring->iirSampleMR = (monitoring->iirSampleMR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleMR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleNL = (monitoring->iirSampleNL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleNL;
-				monitoring->iirSampleNR = (monitoring->iirSampleNR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleNR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleOL = (monitoring->iirSampleOL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleOL;
-				monitoring->iirSampleOR = (monitoring->iirSampleOR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleOR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSamplePL = (monitoring->iirSamplePL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSamplePL;
-				monitoring->iirSamplePR = (monitoring->iirSamplePR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSamplePR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleQL = (monitoring->iirSampleQL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleQL;
-				monitoring->iirSampleQR = (monitoring->iirSampleQR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleQR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleRL = (monitoring->iirSampleRL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleRL;
-				monitoring->iirSampleRR = (monitoring->iirSampleRR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleRR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleSL = (monitoring->iirSampleSL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleSL;
-				monitoring->iirSampleSR = (monitoring->iirSampleSR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleSR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleTL = (monitoring->iirSampleTL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleTL;
-				monitoring->iirSampleTR = (monitoring->iirSampleTR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleTR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleUL = (monitoring->iirSampleUL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleUL;
-				monitoring->iirSampleUR = (monitoring->iirSampleUR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleUR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleVL = (monitoring->iirSampleVL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleVL;
-				monitoring->iirSampleVR = (monitoring->iirSampleVR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleVR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleWL = (monitoring->iirSampleWL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleWL;
-				monitoring->iirSampleWR = (monitoring->iirSampleWR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleWR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleXL = (monitoring->iirSampleXL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleXL;
-				monitoring->iirSampleXR = (monitoring->iirSampleXR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleXR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleYL = (monitoring->iirSampleYL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleYL;
-				monitoring->iirSampleYR = (monitoring->iirSampleYR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleYR;
-				inputSampleL *= gain;
-				inputSampleR *= gain;
-				gain = ((gain - 1) * 0.75) + 1;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-
-				monitoring->iirSampleZL = (monitoring->iirSampleZL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
-				inputSampleL = monitoring->iirSampleZL;
-				monitoring->iirSampleZR = (monitoring->iirSampleZR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
-				inputSampleR = monitoring->iirSampleZR;
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-				// SubsOnly
-			} break;
 			case 5:
-			case 6: {
-				double mid;
-				mid = inputSampleL + inputSampleR;
-				double side;
-				side = inputSampleL - inputSampleR;
-				if (processing < 6) side = 0.0;
-				else mid = 0.0; // mono monitoring, or side-only monitoring
-				inputSampleL = (mid + side) / 2.0;
-				inputSampleR = (mid - side) / 2.0;
-			} break;
+			case 6:
+				process_mid_side(bufferL, bufferR, frames, processing == 6);
+				break;
 			case 7:
 			case 8:
 			case 9:
 			case 10:
 			case 11:
-				// Bandpass: changes in EQ are up in the variable defining, not here
-				// 7 Vinyl, 8 9 10 Aurat, 11 Phone
-				if (processing == 9) {
-					inputSampleR = (inputSampleL + inputSampleR) * 0.5;
-					inputSampleL = 0.0;
-				}
-				if (processing == 10) {
-					inputSampleL = (inputSampleL + inputSampleR) * 0.5;
-					inputSampleR = 0.0;
-				}
-				if (processing == 11) {
-					double M;
-					M = (inputSampleL + inputSampleR) * 0.5;
-					inputSampleL = M;
-					inputSampleR = M;
-				}
-
-				inputSampleL = sin(inputSampleL);
-				inputSampleR = sin(inputSampleR);
-				// encode Console5: good cleanness
-
-				double tempSampleL;
-				tempSampleL = (inputSampleL * monitoring->biquadL[2]) + monitoring->biquadL[7];
-				monitoring->biquadL[7] = (-tempSampleL * monitoring->biquadL[5]) + monitoring->biquadL[8];
-				monitoring->biquadL[8] = (inputSampleL * monitoring->biquadL[4]) - (tempSampleL * monitoring->biquadL[6]);
-				inputSampleL = tempSampleL; // like mono AU, 7 and 8 store L channel
-
-				double tempSampleR;
-				tempSampleR = (inputSampleR * monitoring->biquadR[2]) + monitoring->biquadR[7];
-				monitoring->biquadR[7] = (-tempSampleR * monitoring->biquadR[5]) + monitoring->biquadR[8];
-				monitoring->biquadR[8] = (inputSampleR * monitoring->biquadR[4]) - (tempSampleR * monitoring->biquadR[6]);
-				inputSampleR = tempSampleR; // we are using the mono configuration
-
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-				// without this, you can get a NaN condition where it spits out DC offset at full blast!
-				inputSampleL = asin(inputSampleL);
-				inputSampleR = asin(inputSampleR);
-				// amplitude aspect
+				process_bandpass(monitoring, bufferL, bufferR, frames, processing);
 				break;
 			case 12:
 			case 13:
 			case 14:
-			case 15: {
-				double mid;
-				double side;
-				if (processing == 12) {
-					inputSampleL *= 0.855;
-					inputSampleR *= 0.855;
-				}
-				if (processing == 13) {
-					inputSampleL *= 0.748;
-					inputSampleR *= 0.748;
-				}
-				if (processing == 14) {
-					inputSampleL *= 0.713;
-					inputSampleR *= 0.713;
-				}
-				if (processing == 15) {
-					inputSampleL *= 0.680;
-					inputSampleR *= 0.680;
-				}
-				// we do a volume compensation immediately to gain stage stuff cleanly
-				inputSampleL = sin(inputSampleL);
-				inputSampleR = sin(inputSampleR);
-				double drySampleL;
-				drySampleL = inputSampleL;
-				double drySampleR;
-				drySampleR = inputSampleR; // everything runs 'inside' Console
-				double bass;
-				bass = (processing * processing * 0.00001) / overallscale;
-				// we are using the iir filters from out of SubsOnly
-
-				mid = inputSampleL + inputSampleR;
-				side = inputSampleL - inputSampleR;
-				monitoring->iirSampleAL = (monitoring->iirSampleAL * (1.0 - (bass * 0.618))) + (side * bass * 0.618);
-				side = side - monitoring->iirSampleAL;
-				inputSampleL = (mid + side) / 2.0;
-				inputSampleR = (mid - side) / 2.0;
-				// bass narrowing filter
-
-				allpasstemp = monitoring->ax - 1;
-				if (allpasstemp < 0 || allpasstemp > am) allpasstemp = am;
-				inputSampleL -= monitoring->aL[allpasstemp] * 0.5;
-				monitoring->aL[monitoring->ax] = inputSampleL;
-				inputSampleL *= 0.5;
-				inputSampleR -= monitoring->aR[allpasstemp] * 0.5;
-				monitoring->aR[monitoring->ax] = inputSampleR;
-				inputSampleR *= 0.5;
-
-				monitoring->ax--;
-				if (monitoring->ax < 0 || monitoring->ax > am) {
-					monitoring->ax = am;
-				}
-				inputSampleL += (monitoring->aL[monitoring->ax]) * 0.5;
-				inputSampleR += (monitoring->aR[monitoring->ax]) * 0.5;
-				if (monitoring->ax == am) {
-					inputSampleL += (monitoring->aL[0]) * 0.5;
-					inputSampleR += (monitoring->aR[0]) * 0.5;
-				} else {
-					inputSampleL += (monitoring->aL[monitoring->ax + 1]) * 0.5;
-					inputSampleR += (monitoring->aR[monitoring->ax + 1]) * 0.5;
-				}
-				// a darkened Midiverb-style allpass
-
-				if (processing == 12) {
-					inputSampleL *= 0.125;
-					inputSampleR *= 0.125;
-				}
-				if (processing == 13) {
-					inputSampleL *= 0.25;
-					inputSampleR *= 0.25;
-				}
-				if (processing == 14) {
-					inputSampleL *= 0.30;
-					inputSampleR *= 0.30;
-				}
-				if (processing == 15) {
-					inputSampleL *= 0.35;
-					inputSampleR *= 0.35;
-				}
-				// Cans A suppresses the crossfeed more, Cans B makes it louder
-
-				drySampleL += inputSampleR;
-				drySampleR += inputSampleL; // the crossfeed
-
-				allpasstemp = monitoring->dx - 1;
-				if (allpasstemp < 0 || allpasstemp > dm) allpasstemp = dm;
-				inputSampleL -= monitoring->dL[allpasstemp] * 0.5;
-				monitoring->dL[monitoring->dx] = inputSampleL;
-				inputSampleL *= 0.5;
-				inputSampleR -= monitoring->dR[allpasstemp] * 0.5;
-				monitoring->dR[monitoring->dx] = inputSampleR;
-				inputSampleR *= 0.5;
-
-				monitoring->dx--;
-				if (monitoring->dx < 0 || monitoring->dx > dm) {
-					monitoring->dx = dm;
-				}
-				inputSampleL += (monitoring->dL[monitoring->dx]) * 0.5;
-				inputSampleR += (monitoring->dR[monitoring->dx]) * 0.5;
-				if (monitoring->dx == dm) {
-					inputSampleL += (monitoring->dL[0]) * 0.5;
-					inputSampleR += (monitoring->dR[0]) * 0.5;
-				} else {
-					inputSampleL += (monitoring->dL[monitoring->dx + 1]) * 0.5;
-					inputSampleR += (monitoring->dR[monitoring->dx + 1]) * 0.5;
-				}
-				// a darkened Midiverb-style allpass, which is stretching the previous one even more
-
-				inputSampleL *= 0.25;
-				inputSampleR *= 0.25;
-				// for all versions of Cans the second level of bloom is this far down
-				// and, remains on the opposite speaker rather than crossing again to the original side
-
-				drySampleL += inputSampleR;
-				drySampleR += inputSampleL; // add the crossfeed and very faint extra verbyness
-
-				inputSampleL = drySampleL;
-				inputSampleR = drySampleR; // and output our can-opened headphone feed
-
-				mid = inputSampleL + inputSampleR;
-				side = inputSampleL - inputSampleR;
-				monitoring->iirSampleAR = (monitoring->iirSampleAR * (1.0 - bass)) + (side * bass);
-				side = side - monitoring->iirSampleAR;
-				inputSampleL = (mid + side) / 2.0;
-				inputSampleR = (mid - side) / 2.0;
-				// bass narrowing filter
-
-				if (inputSampleL > 1.0) inputSampleL = 1.0;
-				if (inputSampleL < -1.0) inputSampleL = -1.0;
-				inputSampleL = asin(inputSampleL);
-				if (inputSampleR > 1.0) inputSampleR = 1.0;
-				if (inputSampleR < -1.0) inputSampleR = -1.0;
-				inputSampleR = asin(inputSampleR);
-				// ConsoleBuss processing
-			} break;
-			case 16: {
-				double inputSample = (inputSampleL + inputSampleR) * 0.5;
-				inputSampleL = -inputSample;
-				inputSampleR = inputSample;
-			} break;
+			case 15:
+				process_cans(monitoring, bufferL, bufferR, frames, am, dm, processing, overallscale);
+				break;
+			case 16:
+				process_vtrick(bufferL, bufferR, frames);
+				break;
 		}
 
 		// begin Not Just Another Dither
-		if (processing == 1) {
-			inputSampleL = inputSampleL * 32768.0; // or 16 bit option
-			inputSampleR = inputSampleR * 32768.0; // or 16 bit option
-		} else {
-			inputSampleL = inputSampleL * 8388608.0; // for literally everything else
-			inputSampleR = inputSampleR * 8388608.0; // we will apply the 24 bit NJAD
-		} // on the not unreasonable assumption that we are very likely playing back on 24 bit DAC
-		// if we're not, then all we did was apply a Benford Realness function at 24 bits down.
-
-		bool cutbinsL;
-		cutbinsL = false;
-		bool cutbinsR;
-		cutbinsR = false;
-		double drySampleL;
-		drySampleL = inputSampleL;
-		double drySampleR;
-		drySampleR = inputSampleR;
-		inputSampleL -= monitoring->noiseShapingL;
-		inputSampleR -= monitoring->noiseShapingR;
-		// NJAD L
-		double benfordize;
-		benfordize = floor(inputSampleL);
-		while (benfordize >= 1.0) benfordize /= 10;
-		while (benfordize < 1.0 && benfordize > 0.0000001) benfordize *= 10;
-		int hotbinA;
-		hotbinA = floor(benfordize);
-		// hotbin becomes the Benford bin value for this number floored
-		double totalA;
-		totalA = 0;
-		if ((hotbinA > 0) && (hotbinA < 10)) {
-			monitoring->bynL[hotbinA] += 1;
-			if (monitoring->bynL[hotbinA] > 982) cutbinsL = true;
-			totalA += (301 - monitoring->bynL[1]);
-			totalA += (176 - monitoring->bynL[2]);
-			totalA += (125 - monitoring->bynL[3]);
-			totalA += (97 - monitoring->bynL[4]);
-			totalA += (79 - monitoring->bynL[5]);
-			totalA += (67 - monitoring->bynL[6]);
-			totalA += (58 - monitoring->bynL[7]);
-			totalA += (51 - monitoring->bynL[8]);
-			totalA += (46 - monitoring->bynL[9]);
-			monitoring->bynL[hotbinA] -= 1;
-		} else hotbinA = 10;
-		// produce total number- smaller is closer to Benford real
-		benfordize = ceil(inputSampleL);
-		while (benfordize >= 1.0) benfordize /= 10;
-		while (benfordize < 1.0 && benfordize > 0.0000001) benfordize *= 10;
-		int hotbinB;
-		hotbinB = floor(benfordize);
-		// hotbin becomes the Benford bin value for this number ceiled
-		double totalB;
-		totalB = 0;
-		if ((hotbinB > 0) && (hotbinB < 10)) {
-			monitoring->bynL[hotbinB] += 1;
-			if (monitoring->bynL[hotbinB] > 982) cutbinsL = true;
-			totalB += (301 - monitoring->bynL[1]);
-			totalB += (176 - monitoring->bynL[2]);
-			totalB += (125 - monitoring->bynL[3]);
-			totalB += (97 - monitoring->bynL[4]);
-			totalB += (79 - monitoring->bynL[5]);
-			totalB += (67 - monitoring->bynL[6]);
-			totalB += (58 - monitoring->bynL[7]);
-			totalB += (51 - monitoring->bynL[8]);
-			totalB += (46 - monitoring->bynL[9]);
-			monitoring->bynL[hotbinB] -= 1;
-		} else hotbinB = 10;
-		// produce total number- smaller is closer to Benford real
-		double outputSample;
-		if (totalA < totalB) {
-			monitoring->bynL[hotbinA] += 1;
-			outputSample = floor(inputSampleL);
-		} else {
-			monitoring->bynL[hotbinB] += 1;
-			outputSample = floor(inputSampleL + 1);
-		}
-		// assign the relevant one to the delay line
-		// and floor/ceil signal accordingly
-		if (cutbinsL) {
-			monitoring->bynL[1] *= 0.99;
-			monitoring->bynL[2] *= 0.99;
-			monitoring->bynL[3] *= 0.99;
-			monitoring->bynL[4] *= 0.99;
-			monitoring->bynL[5] *= 0.99;
-			monitoring->bynL[6] *= 0.99;
-			monitoring->bynL[7] *= 0.99;
-			monitoring->bynL[8] *= 0.99;
-			monitoring->bynL[9] *= 0.99;
-			monitoring->bynL[10] *= 0.99;
-		}
-		monitoring->noiseShapingL += outputSample - drySampleL;
-		if (monitoring->noiseShapingL > fabs(inputSampleL)) monitoring->noiseShapingL = fabs(inputSampleL);
-		if (monitoring->noiseShapingL < -fabs(inputSampleL)) monitoring->noiseShapingL = -fabs(inputSampleL);
-		if (processing == 1) inputSampleL = outputSample / 32768.0;
-		else inputSampleL = outputSample / 8388608.0;
-		if (inputSampleL > 1.0) inputSampleL = 1.0;
-		if (inputSampleL < -1.0) inputSampleL = -1.0;
-		// finished NJAD L
-
-		// NJAD R
-		benfordize = floor(inputSampleR);
-		while (benfordize >= 1.0) benfordize /= 10;
-		while (benfordize < 1.0 && benfordize > 0.0000001) benfordize *= 10;
-		hotbinA = floor(benfordize);
-		// hotbin becomes the Benford bin value for this number floored
-		totalA = 0;
-		if ((hotbinA > 0) && (hotbinA < 10)) {
-			monitoring->bynR[hotbinA] += 1;
-			if (monitoring->bynR[hotbinA] > 982) cutbinsR = true;
-			totalA += (301 - monitoring->bynR[1]);
-			totalA += (176 - monitoring->bynR[2]);
-			totalA += (125 - monitoring->bynR[3]);
-			totalA += (97 - monitoring->bynR[4]);
-			totalA += (79 - monitoring->bynR[5]);
-			totalA += (67 - monitoring->bynR[6]);
-			totalA += (58 - monitoring->bynR[7]);
-			totalA += (51 - monitoring->bynR[8]);
-			totalA += (46 - monitoring->bynR[9]);
-			monitoring->bynR[hotbinA] -= 1;
-		} else hotbinA = 10;
-		// produce total number- smaller is closer to Benford real
-		benfordize = ceil(inputSampleR);
-		while (benfordize >= 1.0) benfordize /= 10;
-		while (benfordize < 1.0 && benfordize > 0.0000001) benfordize *= 10;
-		hotbinB = floor(benfordize);
-		// hotbin becomes the Benford bin value for this number ceiled
-		totalB = 0;
-		if ((hotbinB > 0) && (hotbinB < 10)) {
-			monitoring->bynR[hotbinB] += 1;
-			if (monitoring->bynR[hotbinB] > 982) cutbinsR = true;
-			totalB += (301 - monitoring->bynR[1]);
-			totalB += (176 - monitoring->bynR[2]);
-			totalB += (125 - monitoring->bynR[3]);
-			totalB += (97 - monitoring->bynR[4]);
-			totalB += (79 - monitoring->bynR[5]);
-			totalB += (67 - monitoring->bynR[6]);
-			totalB += (58 - monitoring->bynR[7]);
-			totalB += (51 - monitoring->bynR[8]);
-			totalB += (46 - monitoring->bynR[9]);
-			monitoring->bynR[hotbinB] -= 1;
-		} else hotbinB = 10;
-		// produce total number- smaller is closer to Benford real
-		if (totalA < totalB) {
-			monitoring->bynR[hotbinA] += 1;
-			outputSample = floor(inputSampleR);
-		} else {
-			monitoring->bynR[hotbinB] += 1;
-			outputSample = floor(inputSampleR + 1);
-		}
-		// assign the relevant one to the delay line
-		// and floor/ceil signal accordingly
-		if (cutbinsR) {
-			monitoring->bynR[1] *= 0.99;
-			monitoring->bynR[2] *= 0.99;
-			monitoring->bynR[3] *= 0.99;
-			monitoring->bynR[4] *= 0.99;
-			monitoring->bynR[5] *= 0.99;
-			monitoring->bynR[6] *= 0.99;
-			monitoring->bynR[7] *= 0.99;
-			monitoring->bynR[8] *= 0.99;
-			monitoring->bynR[9] *= 0.99;
-			monitoring->bynR[10] *= 0.99;
+		for (uint32_t i = 0; i < frames; i++) {
+			njad(monitoring->bynL, &monitoring->noiseShapingL, &bufferL[i], ditherScale);
+			njad(monitoring->bynR, &monitoring->noiseShapingR, &bufferR[i], ditherScale);
+			// does not use 32 bit stereo floating point dither
+
+			out1[i] = (float) bufferL[i];
+			out2[i] = (float) bufferR[i];
 		}
-		monitoring->noiseShapingR += outputSample - drySampleR;
-		if (monitoring->noiseShapingR > fabs(inputSampleR)) monitoring->noiseShapingR = fabs(inputSampleR);
-		if (monitoring->noiseShapingR < -fabs(inputSampleR)) monitoring->noiseShapingR = -fabs(inputSampleR);
-		if (processing == 1) inputSampleR = outputSample / 32768.0;
-		else inputSampleR = outputSample / 8388608.0;
-		if (inputSampleR > 1.0) inputSampleR = 1.0;
-		if (inputSampleR < -1.0) inputSampleR = -1.0;
-		// finished NJAD R
-
-		// does not use 32 bit stereo floating point dither
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+
+		in1 += frames;
+		in2 += frames;
+		out1 += frames;
+		out2 += frames;
+		sampleFrames -= frames;
 	}
 }
 
@@ -1102,7 +719,11 @@ static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
 {
-	free(instance);
+	Monitoring* monitoring = (Monitoring*) instance;
+
+	free(monitoring->bufferL);
+	free(monitoring->bufferR);
+	free(monitoring);
 }
 
 static const void* extension_data(const char* uri)
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define NIKOLA_URI "https://hannesbraun.net/ns/lv2/airwindows/nikola"
 
 typedef enum {
@@ -2971,12 +2973,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		nikola->fpdL ^= nikola->fpdL << 13;
 		nikola->fpdL ^= nikola->fpdL >> 17;
 		nikola->fpdL ^= nikola->fpdL << 5;
-		inputSampleL += (((double) nikola->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) nikola->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		nikola->fpdR ^= nikola->fpdR << 13;
 		nikola->fpdR ^= nikola->fpdR >> 17;
 		nikola->fpdR ^= nikola->fpdR << 5;
-		inputSampleR += (((double) nikola->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) nikola->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
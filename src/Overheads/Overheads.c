@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define OVERHEADS_URI "https://hannesbraun.net/ns/lv2/airwindows/overheads"
 
 typedef enum {
@@ -148,12 +150,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		overheads->fpdL ^= overheads->fpdL << 13;
 		overheads->fpdL ^= overheads->fpdL >> 17;
 		overheads->fpdL ^= overheads->fpdL << 5;
-		inputSampleL += (((double) overheads->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) overheads->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		overheads->fpdR ^= overheads->fpdR << 13;
 		overheads->fpdR ^= overheads->fpdR >> 17;
 		overheads->fpdR ^= overheads->fpdR << 5;
-		inputSampleR += (((double) overheads->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) overheads->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
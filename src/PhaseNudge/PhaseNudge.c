@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define PHASENUDGE_URI "https://hannesbraun.net/ns/lv2/airwindows/phasenudge"
 
 typedef enum {
@@ -114,12 +116,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleR /= 4.0;
 
 		bridgerectifier = fabs(inputSampleL);
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleL > 0) inputSampleL = bridgerectifier;
 		else inputSampleL = -bridgerectifier;
 
 		bridgerectifier = fabs(inputSampleR);
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleR > 0) inputSampleR = bridgerectifier;
 		else inputSampleR = -bridgerectifier;
 
@@ -178,12 +180,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		phaseNudge->fpdL ^= phaseNudge->fpdL << 13;
 		phaseNudge->fpdL ^= phaseNudge->fpdL >> 17;
 		phaseNudge->fpdL ^= phaseNudge->fpdL << 5;
-		inputSampleL += (((double) phaseNudge->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) phaseNudge->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		phaseNudge->fpdR ^= phaseNudge->fpdR << 13;
 		phaseNudge->fpdR ^= phaseNudge->fpdR >> 17;
 		phaseNudge->fpdR ^= phaseNudge->fpdR << 5;
-		inputSampleR += (((double) phaseNudge->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) phaseNudge->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,6 +5,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/dispatch.h"
+#include "../common/fastmath.h"
+
 #define PITCHNASTY_URI "https://hannesbraun.net/ns/lv2/airwindows/pitchnasty"
 
 typedef enum {
@@ -114,7 +117,7 @@ static void activate(LV2_Handle instance)
 	while (pitchNasty->fpdR < 16386) pitchNasty->fpdR = rand() * UINT32_MAX;
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+CPU_DISPATCH static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	PitchNasty* pitchNasty = (PitchNasty*) instance;
 
@@ -205,12 +208,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		pitchNasty->fpdL ^= pitchNasty->fpdL << 13;
 		pitchNasty->fpdL ^= pitchNasty->fpdL >> 17;
 		pitchNasty->fpdL ^= pitchNasty->fpdL << 5;
-		inputSampleL += (((double) pitchNasty->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) pitchNasty->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		pitchNasty->fpdR ^= pitchNasty->fpdR << 13;
 		pitchNasty->fpdR ^= pitchNasty->fpdR >> 17;
 		pitchNasty->fpdR ^= pitchNasty->fpdR << 5;
-		inputSampleR += (((double) pitchNasty->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) pitchNasty->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
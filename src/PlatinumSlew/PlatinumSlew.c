@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define PLATINUMSLEW_URI "https://hannesbraun.net/ns/lv2/airwindows/platinumslew"
 
 typedef enum {
@@ -189,12 +191,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		platinumSlew->fpdL ^= platinumSlew->fpdL << 13;
 		platinumSlew->fpdL ^= platinumSlew->fpdL >> 17;
 		platinumSlew->fpdL ^= platinumSlew->fpdL << 5;
-		inputSampleL += (((double) platinumSlew->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) platinumSlew->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		platinumSlew->fpdR ^= platinumSlew->fpdR << 13;
 		platinumSlew->fpdR ^= platinumSlew->fpdR >> 17;
 		platinumSlew->fpdR ^= platinumSlew->fpdR << 5;
-		inputSampleR += (((double) platinumSlew->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) platinumSlew->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define POCKETVERBS_URI "https://hannesbraun.net/ns/lv2/airwindows/pocketverbs"
 
 typedef enum {
@@ -248,6 +251,8 @@ typedef struct {
 
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	Silence silence;
 } PocketVerbs;
 
 static LV2_Handle instantiate(
@@ -835,6 +840,8 @@ static void activate(LV2_Handle instance)
 	while (pocketverbs->fpdL < 16386) pocketverbs->fpdL = rand() * UINT32_MAX;
 	pocketverbs->fpdR = 1.0;
 	while (pocketverbs->fpdR < 16386) pocketverbs->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&pocketverbs->silence, 472848); // delay memory per channel
 }
 
 static void run(LV2_Handle instance, uint32_t sampleFrames)
@@ -846,6 +853,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = pocketverbs->output[0];
 	float* out2 = pocketverbs->output[1];
 
+	if (silence_skip(&pocketverbs->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	int verbtype = ((int) *pocketverbs->type) + 1;
 	if (verbtype > 6) {
 		verbtype = 6;
@@ -1795,12 +1804,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		inputSampleL *= gain;
 		bridgerectifier = fabs(inputSampleL);
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleL > 0) inputSampleL = bridgerectifier;
 		else inputSampleL = -bridgerectifier;
 		inputSampleR *= gain;
 		bridgerectifier = fabs(inputSampleR);
-		bridgerectifier = sin(bridgerectifier);
+		bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleR > 0) inputSampleR = bridgerectifier;
 		else inputSampleR = -bridgerectifier;
 		// here we apply the ADT2 console-on-steroids trick
@@ -13563,12 +13572,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		pocketverbs->fpdL ^= pocketverbs->fpdL << 13;
 		pocketverbs->fpdL ^= pocketverbs->fpdL >> 17;
 		pocketverbs->fpdL ^= pocketverbs->fpdL << 5;
-		inputSampleL += (((double) pocketverbs->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) pocketverbs->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		pocketverbs->fpdR ^= pocketverbs->fpdR << 13;
 		pocketverbs->fpdR ^= pocketverbs->fpdR >> 17;
 		pocketverbs->fpdR ^= pocketverbs->fpdR << 5;
-		inputSampleR += (((double) pocketverbs->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) pocketverbs->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -13579,6 +13588,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&pocketverbs->silence, pocketverbs->output[0], pocketverbs->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define POINT_URI "https://hannesbraun.net/ns/lv2/airwindows/point"
 
 typedef enum {
@@ -179,12 +181,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		point->fpdL ^= point->fpdL << 13;
 		point->fpdL ^= point->fpdL >> 17;
 		point->fpdL ^= point->fpdL << 5;
-		inputSampleL += (((double) point->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) point->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		point->fpdR ^= point->fpdR << 13;
 		point->fpdR ^= point->fpdR >> 17;
 		point->fpdR ^= point->fpdR << 5;
-		inputSampleR += (((double) point->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) point->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define POP_URI "https://hannesbraun.net/ns/lv2/airwindows/pop"
 
 typedef enum {
@@ -323,7 +325,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		double bridgerectifier = fabs(inputSampleL);
 		if (bridgerectifier > 1.2533141373155) bridgerectifier = 1.2533141373155;
-		bridgerectifier = sin(bridgerectifier * fabs(bridgerectifier)) / ((fabs(bridgerectifier) == 0.0) ? 1 : fabs(bridgerectifier));
+		bridgerectifier = fast_sin(bridgerectifier * fabs(bridgerectifier)) / ((fabs(bridgerectifier) == 0.0) ? 1 : fabs(bridgerectifier));
 		// using Spiral instead of Density algorithm
 		if (inputSampleL > 0) inputSampleL = (inputSampleL * coefficientL) + (bridgerectifier * (1 - coefficientL));
 		else inputSampleL = (inputSampleL * coefficientL) - (bridgerectifier * (1 - coefficientL));
@@ -331,7 +333,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		bridgerectifier = fabs(inputSampleR);
 		if (bridgerectifier > 1.2533141373155) bridgerectifier = 1.2533141373155;
-		bridgerectifier = sin(bridgerectifier * fabs(bridgerectifier)) / ((fabs(bridgerectifier) == 0.0) ? 1 : fabs(bridgerectifier));
+		bridgerectifier = fast_sin(bridgerectifier * fabs(bridgerectifier)) / ((fabs(bridgerectifier) == 0.0) ? 1 : fabs(bridgerectifier));
 		// using Spiral instead of Density algorithm
 		if (inputSampleR > 0) inputSampleR = (inputSampleR * coefficientR) + (bridgerectifier * (1 - coefficientR));
 		else inputSampleR = (inputSampleR * coefficientR) - (bridgerectifier * (1 - coefficientR));
@@ -354,12 +356,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		pop->fpdL ^= pop->fpdL << 13;
 		pop->fpdL ^= pop->fpdL >> 17;
 		pop->fpdL ^= pop->fpdL << 5;
-		inputSampleL += (((double) pop->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) pop->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		pop->fpdR ^= pop->fpdR << 13;
 		pop->fpdR ^= pop->fpdR >> 17;
 		pop->fpdR ^= pop->fpdR << 5;
-		inputSampleR += (((double) pop->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) pop->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
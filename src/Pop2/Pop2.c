@@ -5,7 +5,11 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/lanes.h"
+
 #define POP2_URI "https://hannesbraun.net/ns/lv2/airwindows/pop2"
+#define POP2MONO_URI "https://hannesbraun.net/ns/lv2/airwindows/pop2mono"
 
 typedef enum {
 	INPUT_L = 0,
@@ -29,36 +33,23 @@ typedef struct {
 	const float* drive;
 	const float* dryWet;
 
-	uint32_t fpdL;
-	uint32_t fpdR;
+	uint32_t fpd[2];
 	// default stuff
 
-	double muVaryL;
-	double muAttackL;
-	double muNewSpeedL;
-	double muSpeedAL;
-	double muSpeedBL;
-	double muCoefficientAL;
-	double muCoefficientBL;
-
-	double muVaryR;
-	double muAttackR;
-	double muNewSpeedR;
-	double muSpeedAR;
-	double muSpeedBR;
-	double muCoefficientAR;
-	double muCoefficientBR;
+	double muVary[2];
+	double muAttack[2];
+	double muNewSpeed[2];
+	double muSpeedA[2];
+	double muSpeedB[2];
+	double muCoefficientA[2];
+	double muCoefficientB[2];
 
 	bool flip;
 
-	double lastSampleL;
-	double intermediateL[16];
-	bool wasPosClipL;
-	bool wasNegClipL;
-	double lastSampleR;
-	double intermediateR[16];
-	bool wasPosClipR;
-	bool wasNegClipR; // Stereo ClipOnly2
+	double lastSample[2];
+	double intermediate[2][16];
+	bool wasPosClip[2];
+	bool wasNegClip[2]; // ClipOnly2 per channel
 } Pop2;
 
 static LV2_Handle instantiate(
@@ -107,54 +98,51 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 	}
 }
 
+// The mono variant has one input and one output, its controls follow at 2
+static void connect_port_mono(LV2_Handle instance, uint32_t port, void* data)
+{
+	Pop2* pop2 = (Pop2*) instance;
+
+	if (port == 0) {
+		pop2->input[0] = (const float*) data;
+	} else if (port == 1) {
+		pop2->output[0] = (float*) data;
+	} else {
+		connect_port(instance, port + 2, data);
+	}
+}
+
 static void activate(LV2_Handle instance)
 {
 	Pop2* pop2 = (Pop2*) instance;
 
-	pop2->fpdL = 1.0;
-	while (pop2->fpdL < 16386) pop2->fpdL = rand() * UINT32_MAX;
-	pop2->fpdR = 1.0;
-	while (pop2->fpdR < 16386) pop2->fpdR = rand() * UINT32_MAX;
-
-	pop2->lastSampleL = 0.0;
-	pop2->wasPosClipL = false;
-	pop2->wasNegClipL = false;
-	pop2->lastSampleR = 0.0;
-	pop2->wasPosClipR = false;
-	pop2->wasNegClipR = false;
-	for (int x = 0; x < 16; x++) {
-		pop2->intermediateL[x] = 0.0;
-		pop2->intermediateR[x] = 0.0;
+	for (int c = 0; c < 2; c++) {
+		pop2->fpd[c] = 1.0;
+		while (pop2->fpd[c] < 16386) pop2->fpd[c] = rand() * UINT32_MAX;
 	}
 
-	pop2->muVaryL = 0.0;
-	pop2->muAttackL = 0.0;
-	pop2->muNewSpeedL = 1000.0;
-	pop2->muSpeedAL = 1000.0;
-	pop2->muSpeedBL = 1000.0;
-	pop2->muCoefficientAL = 1.0;
-	pop2->muCoefficientBL = 1.0;
-
-	pop2->muVaryR = 0.0;
-	pop2->muAttackR = 0.0;
-	pop2->muNewSpeedR = 1000.0;
-	pop2->muSpeedAR = 1000.0;
-	pop2->muSpeedBR = 1000.0;
-	pop2->muCoefficientAR = 1.0;
-	pop2->muCoefficientBR = 1.0;
+	for (int c = 0; c < 2; c++) {
+		pop2->lastSample[c] = 0.0;
+		pop2->wasPosClip[c] = false;
+		pop2->wasNegClip[c] = false;
+		for (int x = 0; x < 16; x++) pop2->intermediate[c][x] = 0.0;
+
+		pop2->muVary[c] = 0.0;
+		pop2->muAttack[c] = 0.0;
+		pop2->muNewSpeed[c] = 1000.0;
+		pop2->muSpeedA[c] = 1000.0;
+		pop2->muSpeedB[c] = 1000.0;
+		pop2->muCoefficientA[c] = 1.0;
+		pop2->muCoefficientB[c] = 1.0;
+	}
 
 	pop2->flip = false;
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+// Processes the first `channels` inputs into the outputs. Only the flip between
+// the A and B compressor coefficients is shared between the channels.
+static inline void run_channels(Pop2* pop2, uint32_t sampleFrames, const int channels)
 {
-	Pop2* pop2 = (Pop2*) instance;
-
-	const float* in1 = pop2->input[0];
-	const float* in2 = pop2->input[1];
-	float* out1 = pop2->output[0];
-	float* out2 = pop2->output[1];
-
 	double overallscale = 1.0;
 	overallscale /= 44100.0;
 	overallscale *= pop2->sampleRate;
@@ -172,198 +160,136 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	double wet = *pop2->dryWet;
 	// compressor section
 
-	while (sampleFrames-- > 0) {
-		double inputSampleL = *in1;
-		double inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = pop2->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = pop2->fpdR * 1.18e-17;
-		double drySampleL = inputSampleL;
-		double drySampleR = inputSampleR;
+	double inputSample[2];
+	double drySample[2];
 
-		// begin compressor section
-		inputSampleL *= muPreGain;
-		inputSampleR *= muPreGain;
-		// adjust coefficients for L
-		if (pop2->flip) {
-			if (fabs(inputSampleL) > threshold) {
-				pop2->muVaryL = threshold / fabs(inputSampleL);
-				pop2->muAttackL = sqrt(fabs(pop2->muSpeedAL));
-				pop2->muCoefficientAL = pop2->muCoefficientAL * (pop2->muAttackL - 1.0);
-				if (pop2->muVaryL < threshold) pop2->muCoefficientAL = pop2->muCoefficientAL + threshold;
-				else pop2->muCoefficientAL = pop2->muCoefficientAL + pop2->muVaryL;
-				pop2->muCoefficientAL = pop2->muCoefficientAL / pop2->muAttackL;
-				pop2->muNewSpeedL = pop2->muSpeedAL * (pop2->muSpeedAL - 1.0);
-				pop2->muNewSpeedL = pop2->muNewSpeedL + release;
-				pop2->muSpeedAL = pop2->muNewSpeedL / pop2->muSpeedAL;
-				if (pop2->muSpeedAL > maxRelease) pop2->muSpeedAL = maxRelease;
-			} else {
-				pop2->muCoefficientAL = pop2->muCoefficientAL * ((pop2->muSpeedAL * pop2->muSpeedAL) - 1.0);
-				pop2->muCoefficientAL = pop2->muCoefficientAL + 1.0;
-				pop2->muCoefficientAL = pop2->muCoefficientAL / (pop2->muSpeedAL * pop2->muSpeedAL);
-				pop2->muNewSpeedL = pop2->muSpeedAL * (pop2->muSpeedAL - 1.0);
-				pop2->muNewSpeedL = pop2->muNewSpeedL + attack;
-				pop2->muSpeedAL = pop2->muNewSpeedL / pop2->muSpeedAL;
-			}
-		} else {
-			if (fabs(inputSampleL) > threshold) {
-				pop2->muVaryL = threshold / fabs(inputSampleL);
-				pop2->muAttackL = sqrt(fabs(pop2->muSpeedBL));
-				pop2->muCoefficientBL = pop2->muCoefficientBL * (pop2->muAttackL - 1);
-				if (pop2->muVaryL < threshold) pop2->muCoefficientBL = pop2->muCoefficientBL + threshold;
-				else pop2->muCoefficientBL = pop2->muCoefficientBL + pop2->muVaryL;
-				pop2->muCoefficientBL = pop2->muCoefficientBL / pop2->muAttackL;
-				pop2->muNewSpeedL = pop2->muSpeedBL * (pop2->muSpeedBL - 1.0);
-				pop2->muNewSpeedL = pop2->muNewSpeedL + release;
-				pop2->muSpeedBL = pop2->muNewSpeedL / pop2->muSpeedBL;
-				if (pop2->muSpeedBL > maxRelease) pop2->muSpeedBL = maxRelease;
-			} else {
-				pop2->muCoefficientBL = pop2->muCoefficientBL * ((pop2->muSpeedBL * pop2->muSpeedBL) - 1.0);
-				pop2->muCoefficientBL = pop2->muCoefficientBL + 1.0;
-				pop2->muCoefficientBL = pop2->muCoefficientBL / (pop2->muSpeedBL * pop2->muSpeedBL);
-				pop2->muNewSpeedL = pop2->muSpeedBL * (pop2->muSpeedBL - 1.0);
-				pop2->muNewSpeedL = pop2->muNewSpeedL + attack;
-				pop2->muSpeedBL = pop2->muNewSpeedL / pop2->muSpeedBL;
-			}
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		for (int c = 0; c < channels; c++) {
+			inputSample[c] = pop2->input[c][i];
+			if (fabs(inputSample[c]) < 1.18e-23) inputSample[c] = pop2->fpd[c] * 1.18e-17;
+			drySample[c] = inputSample[c];
 		}
-		// got coefficients, adjusted speeds for L
 
-		// adjust coefficients for R
+		// begin compressor section
+		for (int c = 0; c < channels; c++) inputSample[c] *= muPreGain;
+		// adjust coefficients
 		if (pop2->flip) {
-			if (fabs(inputSampleR) > threshold) {
-				pop2->muVaryR = threshold / fabs(inputSampleR);
-				pop2->muAttackR = sqrt(fabs(pop2->muSpeedAR));
-				pop2->muCoefficientAR = pop2->muCoefficientAR * (pop2->muAttackR - 1.0);
-				if (pop2->muVaryR < threshold) pop2->muCoefficientAR = pop2->muCoefficientAR + threshold;
-				else pop2->muCoefficientAR = pop2->muCoefficientAR + pop2->muVaryR;
-				pop2->muCoefficientAR = pop2->muCoefficientAR / pop2->muAttackR;
-				pop2->muNewSpeedR = pop2->muSpeedAR * (pop2->muSpeedAR - 1.0);
-				pop2->muNewSpeedR = pop2->muNewSpeedR + release;
-				pop2->muSpeedAR = pop2->muNewSpeedR / pop2->muSpeedAR;
-				if (pop2->muSpeedAR > maxRelease) pop2->muSpeedAR = maxRelease;
-			} else {
-				pop2->muCoefficientAR = pop2->muCoefficientAR * ((pop2->muSpeedAR * pop2->muSpeedAR) - 1.0);
-				pop2->muCoefficientAR = pop2->muCoefficientAR + 1.0;
-				pop2->muCoefficientAR = pop2->muCoefficientAR / (pop2->muSpeedAR * pop2->muSpeedAR);
-				pop2->muNewSpeedR = pop2->muSpeedAR * (pop2->muSpeedAR - 1.0);
-				pop2->muNewSpeedR = pop2->muNewSpeedR + attack;
-				pop2->muSpeedAR = pop2->muNewSpeedR / pop2->muSpeedAR;
+			LANES_UNROLL
+			for (int c = 0; c < channels; c++) {
+				if (fabs(inputSample[c]) > threshold) {
+					pop2->muVary[c] = threshold / fabs(inputSample[c]);
+					pop2->muAttack[c] = sqrt(fabs(pop2->muSpeedA[c]));
+					pop2->muCoefficientA[c] = pop2->muCoefficientA[c] * (pop2->muAttack[c] - 1.0);
+					if (pop2->muVary[c] < threshold) pop2->muCoefficientA[c] = pop2->muCoefficientA[c] + threshold;
+					else pop2->muCoefficientA[c] = pop2->muCoefficientA[c] + pop2->muVary[c];
+					pop2->muCoefficientA[c] = pop2->muCoefficientA[c] / pop2->muAttack[c];
+					pop2->muNewSpeed[c] = pop2->muSpeedA[c] * (pop2->muSpeedA[c] - 1.0);
+					pop2->muNewSpeed[c] = pop2->muNewSpeed[c] + release;
+					pop2->muSpeedA[c] = pop2->muNewSpeed[c] / pop2->muSpeedA[c];
+					if (pop2->muSpeedA[c] > maxRelease) pop2->muSpeedA[c] = maxRelease;
+				} else {
+					pop2->muCoefficientA[c] = pop2->muCoefficientA[c] * ((pop2->muSpeedA[c] * pop2->muSpeedA[c]) - 1.0);
+					pop2->muCoefficientA[c] = pop2->muCoefficientA[c] + 1.0;
+					pop2->muCoefficientA[c] = pop2->muCoefficientA[c] / (pop2->muSpeedA[c] * pop2->muSpeedA[c]);
+					pop2->muNewSpeed[c] = pop2->muSpeedA[c] * (pop2->muSpeedA[c] - 1.0);
+					pop2->muNewSpeed[c] = pop2->muNewSpeed[c] + attack;
+					pop2->muSpeedA[c] = pop2->muNewSpeed[c] / pop2->muSpeedA[c];
+				}
 			}
 		} else {
-			if (fabs(inputSampleR) > threshold) {
-				pop2->muVaryR = threshold / fabs(inputSampleR);
-				pop2->muAttackR = sqrt(fabs(pop2->muSpeedBR));
-				pop2->muCoefficientBR = pop2->muCoefficientBR * (pop2->muAttackR - 1);
-				if (pop2->muVaryR < threshold) pop2->muCoefficientBR = pop2->muCoefficientBR + threshold;
-				else pop2->muCoefficientBR = pop2->muCoefficientBR + pop2->muVaryR;
-				pop2->muCoefficientBR = pop2->muCoefficientBR / pop2->muAttackR;
-				pop2->muNewSpeedR = pop2->muSpeedBR * (pop2->muSpeedBR - 1.0);
-				pop2->muNewSpeedR = pop2->muNewSpeedR + release;
-				pop2->muSpeedBR = pop2->muNewSpeedR / pop2->muSpeedBR;
-				if (pop2->muSpeedBR > maxRelease) pop2->muSpeedBR = maxRelease;
-			} else {
-				pop2->muCoefficientBR = pop2->muCoefficientBR * ((pop2->muSpeedBR * pop2->muSpeedBR) - 1.0);
-				pop2->muCoefficientBR = pop2->muCoefficientBR + 1.0;
-				pop2->muCoefficientBR = pop2->muCoefficientBR / (pop2->muSpeedBR * pop2->muSpeedBR);
-				pop2->muNewSpeedR = pop2->muSpeedBR * (pop2->muSpeedBR - 1.0);
-				pop2->muNewSpeedR = pop2->muNewSpeedR + attack;
-				pop2->muSpeedBR = pop2->muNewSpeedR / pop2->muSpeedBR;
+			LANES_UNROLL
+			for (int c = 0; c < channels; c++) {
+				if (fabs(inputSample[c]) > threshold) {
+					pop2->muVary[c] = threshold / fabs(inputSample[c]);
+					pop2->muAttack[c] = sqrt(fabs(pop2->muSpeedB[c]));
+					pop2->muCoefficientB[c] = pop2->muCoefficientB[c] * (pop2->muAttack[c] - 1);
+					if (pop2->muVary[c] < threshold) pop2->muCoefficientB[c] = pop2->muCoefficientB[c] + threshold;
+					else pop2->muCoefficientB[c] = pop2->muCoefficientB[c] + pop2->muVary[c];
+					pop2->muCoefficientB[c] = pop2->muCoefficientB[c] / pop2->muAttack[c];
+					pop2->muNewSpeed[c] = pop2->muSpeedB[c] * (pop2->muSpeedB[c] - 1.0);
+					pop2->muNewSpeed[c] = pop2->muNewSpeed[c] + release;
+					pop2->muSpeedB[c] = pop2->muNewSpeed[c] / pop2->muSpeedB[c];
+					if (pop2->muSpeedB[c] > maxRelease) pop2->muSpeedB[c] = maxRelease;
+				} else {
+					pop2->muCoefficientB[c] = pop2->muCoefficientB[c] * ((pop2->muSpeedB[c] * pop2->muSpeedB[c]) - 1.0);
+					pop2->muCoefficientB[c] = pop2->muCoefficientB[c] + 1.0;
+					pop2->muCoefficientB[c] = pop2->muCoefficientB[c] / (pop2->muSpeedB[c] * pop2->muSpeedB[c]);
+					pop2->muNewSpeed[c] = pop2->muSpeedB[c] * (pop2->muSpeedB[c] - 1.0);
+					pop2->muNewSpeed[c] = pop2->muNewSpeed[c] + attack;
+					pop2->muSpeedB[c] = pop2->muNewSpeed[c] / pop2->muSpeedB[c];
+				}
 			}
 		}
-		// got coefficients, adjusted speeds for R
+		// got coefficients, adjusted speeds
 
 		if (pop2->flip) {
-			inputSampleL *= pow(pop2->muCoefficientAL, 2);
-			inputSampleR *= pow(pop2->muCoefficientAR, 2);
+			for (int c = 0; c < channels; c++) inputSample[c] *= pow(pop2->muCoefficientA[c], 2);
 		} else {
-			inputSampleL *= pow(pop2->muCoefficientBL, 2);
-			inputSampleR *= pow(pop2->muCoefficientBR, 2);
+			for (int c = 0; c < channels; c++) inputSample[c] *= pow(pop2->muCoefficientB[c], 2);
 		}
-		inputSampleL *= muMakeupGain;
-		inputSampleR *= muMakeupGain;
+		for (int c = 0; c < channels; c++) inputSample[c] *= muMakeupGain;
 		pop2->flip = !pop2->flip;
 		// end compressor section
 
-		// begin ClipOnly2 stereo as a little, compressed chunk that can be dropped into code
-		if (inputSampleL > 4.0) inputSampleL = 4.0;
-		if (inputSampleL < -4.0) inputSampleL = -4.0;
-		if (pop2->wasPosClipL == true) { // current will be over
-			if (inputSampleL < pop2->lastSampleL) pop2->lastSampleL = 0.7058208 + (inputSampleL * 0.2609148);
-			else pop2->lastSampleL = 0.2491717 + (pop2->lastSampleL * 0.7390851);
-		}
-		pop2->wasPosClipL = false;
-		if (inputSampleL > 0.9549925859) {
-			pop2->wasPosClipL = true;
-			inputSampleL = 0.7058208 + (pop2->lastSampleL * 0.2609148);
-		}
-		if (pop2->wasNegClipL == true) { // current will be -over
-			if (inputSampleL > pop2->lastSampleL) pop2->lastSampleL = -0.7058208 + (inputSampleL * 0.2609148);
-			else pop2->lastSampleL = -0.2491717 + (pop2->lastSampleL * 0.7390851);
-		}
-		pop2->wasNegClipL = false;
-		if (inputSampleL < -0.9549925859) {
-			pop2->wasNegClipL = true;
-			inputSampleL = -0.7058208 + (pop2->lastSampleL * 0.2609148);
-		}
-		pop2->intermediateL[spacing] = inputSampleL;
-		inputSampleL = pop2->lastSampleL; // Latency is however many samples equals one 44.1k sample
-		for (int x = spacing; x > 0; x--) pop2->intermediateL[x - 1] = pop2->intermediateL[x];
-		pop2->lastSampleL = pop2->intermediateL[0]; // run a little buffer to handle this
-
-		if (inputSampleR > 4.0) inputSampleR = 4.0;
-		if (inputSampleR < -4.0) inputSampleR = -4.0;
-		if (pop2->wasPosClipR == true) { // current will be over
-			if (inputSampleR < pop2->lastSampleR) pop2->lastSampleR = 0.7058208 + (inputSampleR * 0.2609148);
-			else pop2->lastSampleR = 0.2491717 + (pop2->lastSampleR * 0.7390851);
-		}
-		pop2->wasPosClipR = false;
-		if (inputSampleR > 0.9549925859) {
-			pop2->wasPosClipR = true;
-			inputSampleR = 0.7058208 + (pop2->lastSampleR * 0.2609148);
-		}
-		if (pop2->wasNegClipR == true) { // current will be -over
-			if (inputSampleR > pop2->lastSampleR) pop2->lastSampleR = -0.7058208 + (inputSampleR * 0.2609148);
-			else pop2->lastSampleR = -0.2491717 + (pop2->lastSampleR * 0.7390851);
-		}
-		pop2->wasNegClipR = false;
-		if (inputSampleR < -0.9549925859) {
-			pop2->wasNegClipR = true;
-			inputSampleR = -0.7058208 + (pop2->lastSampleR * 0.2609148);
+		// begin ClipOnly2 as a little, compressed chunk that can be dropped into code
+		LANES_UNROLL
+		for (int c = 0; c < channels; c++) {
+			if (inputSample[c] > 4.0) inputSample[c] = 4.0;
+			if (inputSample[c] < -4.0) inputSample[c] = -4.0;
+			if (pop2->wasPosClip[c] == true) { // current will be over
+				if (inputSample[c] < pop2->lastSample[c]) pop2->lastSample[c] = 0.7058208 + (inputSample[c] * 0.2609148);
+				else pop2->lastSample[c] = 0.2491717 + (pop2->lastSample[c] * 0.7390851);
+			}
+			pop2->wasPosClip[c] = false;
+			if (inputSample[c] > 0.9549925859) {
+				pop2->wasPosClip[c] = true;
+				inputSample[c] = 0.7058208 + (pop2->lastSample[c] * 0.2609148);
+			}
+			if (pop2->wasNegClip[c] == true) { // current will be -over
+				if (inputSample[c] > pop2->lastSample[c]) pop2->lastSample[c] = -0.7058208 + (inputSample[c] * 0.2609148);
+				else pop2->lastSample[c] = -0.2491717 + (pop2->lastSample[c] * 0.7390851);
+			}
+			pop2->wasNegClip[c] = false;
+			if (inputSample[c] < -0.9549925859) {
+				pop2->wasNegClip[c] = true;
+				inputSample[c] = -0.7058208 + (pop2->lastSample[c] * 0.2609148);
+			}
+			pop2->intermediate[c][spacing] = inputSample[c];
+			inputSample[c] = pop2->lastSample[c]; // Latency is however many samples equals one 44.1k sample
+			for (int x = spacing; x > 0; x--) pop2->intermediate[c][x - 1] = pop2->intermediate[c][x];
+			pop2->lastSample[c] = pop2->intermediate[c][0]; // run a little buffer to handle this
 		}
-		pop2->intermediateR[spacing] = inputSampleR;
-		inputSampleR = pop2->lastSampleR; // Latency is however many samples equals one 44.1k sample
-		for (int x = spacing; x > 0; x--) pop2->intermediateR[x - 1] = pop2->intermediateR[x];
-		pop2->lastSampleR = pop2->intermediateR[0]; // run a little buffer to handle this
-		// end ClipOnly2 stereo as a little, compressed chunk that can be dropped into code
+		// end ClipOnly2 as a little, compressed chunk that can be dropped into code
 
 		if (wet < 1.0) {
-			inputSampleL = (drySampleL * (1.0 - wet)) + (inputSampleL * wet);
-			inputSampleR = (drySampleR * (1.0 - wet)) + (inputSampleR * wet);
+			for (int c = 0; c < channels; c++) inputSample[c] = (drySample[c] * (1.0 - wet)) + (inputSample[c] * wet);
 		}
 
-		// begin 32 bit stereo floating point dither
-		int expon;
-		frexpf((float) inputSampleL, &expon);
-		pop2->fpdL ^= pop2->fpdL << 13;
-		pop2->fpdL ^= pop2->fpdL >> 17;
-		pop2->fpdL ^= pop2->fpdL << 5;
-		inputSampleL += (((double) pop2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		frexpf((float) inputSampleR, &expon);
-		pop2->fpdR ^= pop2->fpdR << 13;
-		pop2->fpdR ^= pop2->fpdR >> 17;
-		pop2->fpdR ^= pop2->fpdR << 5;
-		inputSampleR += (((double) pop2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		// end 32 bit stereo floating point dither
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+		// begin 32 bit floating point dither
+		for (int c = 0; c < channels; c++) {
+			int expon;
+			frexpf((float) inputSample[c], &expon);
+			pop2->fpd[c] ^= pop2->fpd[c] << 13;
+			pop2->fpd[c] ^= pop2->fpd[c] >> 17;
+			pop2->fpd[c] ^= pop2->fpd[c] << 5;
+			inputSample[c] += (((double) pop2->fpd[c] - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+		}
+		// end 32 bit floating point dither
+
+		for (int c = 0; c < channels; c++) pop2->output[c][i] = (float) inputSample[c];
 	}
 }
 
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Pop2*) instance, sampleFrames, 2);
+}
+
+static void run_mono(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Pop2*) instance, sampleFrames, 1);
+}
+
 static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
@@ -376,17 +302,25 @@ static const void* extension_data(const char* uri)
 	return NULL;
 }
 
-static const LV2_Descriptor descriptor = {
-	POP2_URI,
-	instantiate,
-	connect_port,
-	activate,
-	run,
-	deactivate,
-	cleanup,
-	extension_data};
+static const LV2_Descriptor descriptors[] = {
+	{POP2_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{POP2MONO_URI,
+	 instantiate,
+	 connect_port_mono,
+	 activate,
+	 run_mono,
+	 deactivate,
+	 cleanup,
+	 extension_data}};
 
 LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
 {
-	return index == 0 ? &descriptor : NULL;
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
 }
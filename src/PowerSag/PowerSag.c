@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define POWERSAG_URI "https://hannesbraun.net/ns/lv2/airwindows/powersag"
 
 typedef enum {
@@ -135,7 +137,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bridgerectifier = fabs(inputSampleL);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 		// max value for sine function
-		if (thickness > 0) bridgerectifier = sin(bridgerectifier);
+		if (thickness > 0) bridgerectifier = fast_sin(bridgerectifier);
 		else bridgerectifier = 1 - cos(bridgerectifier);
 		// produce either boosted or starved version
 		if (inputSampleL > 0) inputSampleL = (inputSampleL * (1 - out)) + (bridgerectifier * out);
@@ -165,7 +167,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bridgerectifier = fabs(inputSampleR);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 		// max value for sine function
-		if (thickness > 0) bridgerectifier = sin(bridgerectifier);
+		if (thickness > 0) bridgerectifier = fast_sin(bridgerectifier);
 		else bridgerectifier = 1 - cos(bridgerectifier);
 		// produce either boosted or starved version
 		if (inputSampleR > 0) inputSampleR = (inputSampleR * (1 - out)) + (bridgerectifier * out);
@@ -182,12 +184,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		powerSag->fpdL ^= powerSag->fpdL << 13;
 		powerSag->fpdL ^= powerSag->fpdL >> 17;
 		powerSag->fpdL ^= powerSag->fpdL << 5;
-		inputSampleL += (((double) powerSag->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) powerSag->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		powerSag->fpdR ^= powerSag->fpdR << 13;
 		powerSag->fpdR ^= powerSag->fpdR >> 17;
 		powerSag->fpdR ^= powerSag->fpdR << 5;
-		inputSampleR += (((double) powerSag->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) powerSag->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
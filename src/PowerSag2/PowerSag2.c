@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define POWERSAG2_URI "https://hannesbraun.net/ns/lv2/airwindows/powersag2"
 
 typedef enum {
@@ -147,12 +149,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		powerSag2->fpdL ^= powerSag2->fpdL << 13;
 		powerSag2->fpdL ^= powerSag2->fpdL >> 17;
 		powerSag2->fpdL ^= powerSag2->fpdL << 5;
-		inputSampleL += (((double) powerSag2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) powerSag2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		powerSag2->fpdR ^= powerSag2->fpdR << 13;
 		powerSag2->fpdR ^= powerSag2->fpdR >> 17;
 		powerSag2->fpdR ^= powerSag2->fpdR << 5;
-		inputSampleR += (((double) powerSag2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) powerSag2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
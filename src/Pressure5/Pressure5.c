@@ -4,10 +4,16 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include "../common/fastmath.h"
+#include "../common/fused.h"
+#include "../common/lanes.h"
 
 #define M_PI 3.14159265358979323846264338327950288
 
 #define PRESSURE5_URI "https://hannesbraun.net/ns/lv2/airwindows/pressure5"
+#define PRESSURE5MONO_URI "https://hannesbraun.net/ns/lv2/airwindows/pressure5mono"
 
 typedef enum {
 	INPUT_L = 0,
@@ -62,19 +68,14 @@ typedef struct {
 	double fixA[fix_total];
 	double fixB[fix_total]; // fixed frequency biquad filter for ultrasonics, stereo
 
-	double lastSampleL;
-	double intermediateL[16];
-	bool wasPosClipL;
-	bool wasNegClipL;
-	double lastSampleR;
-	double intermediateR[16];
-	bool wasPosClipR;
-	bool wasNegClipR; // Stereo ClipOnly2
+	double lastSample[2];
+	double intermediate[2][16];
+	bool wasPosClip[2];
+	bool wasNegClip[2]; // ClipOnly2 per channel
 
 	double slewMax; // to adust mewiness
 
-	uint32_t fpdL;
-	uint32_t fpdR;
+	uint32_t fpd[2];
 } Pressure5;
 
 static LV2_Handle instantiate(
@@ -126,6 +127,20 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 	}
 }
 
+// The mono variant has one input and one output, its controls follow at 2
+static void connect_port_mono(LV2_Handle instance, uint32_t port, void* data)
+{
+	Pressure5* pressure5 = (Pressure5*) instance;
+
+	if (port == 0) {
+		pressure5->input[0] = (const float*) data;
+	} else if (port == 1) {
+		pressure5->output[0] = (float*) data;
+	} else {
+		connect_port(instance, port + 2, data);
+	}
+}
+
 static void activate(LV2_Handle instance)
 {
 	Pressure5* pressure5 = (Pressure5*) instance;
@@ -140,33 +155,26 @@ static void activate(LV2_Handle instance)
 		pressure5->fixA[x] = 0.0;
 		pressure5->fixB[x] = 0.0;
 	}
-	pressure5->lastSampleL = 0.0;
-	pressure5->wasPosClipL = false;
-	pressure5->wasNegClipL = false;
-	pressure5->lastSampleR = 0.0;
-	pressure5->wasPosClipR = false;
-	pressure5->wasNegClipR = false;
-	for (int x = 0; x < 16; x++) {
-		pressure5->intermediateL[x] = 0.0;
-		pressure5->intermediateR[x] = 0.0;
+	for (int c = 0; c < 2; c++) {
+		pressure5->lastSample[c] = 0.0;
+		pressure5->wasPosClip[c] = false;
+		pressure5->wasNegClip[c] = false;
+		for (int x = 0; x < 16; x++) pressure5->intermediate[c][x] = 0.0;
 	}
 	pressure5->slewMax = 0.0;
 
-	pressure5->fpdL = 1.0;
-	while (pressure5->fpdL < 16386) pressure5->fpdL = rand() * UINT32_MAX;
-	pressure5->fpdR = 1.0;
-	while (pressure5->fpdR < 16386) pressure5->fpdR = rand() * UINT32_MAX;
+	for (int c = 0; c < 2; c++) {
+		pressure5->fpd[c] = 1.0;
+		while (pressure5->fpd[c] < 16386) pressure5->fpd[c] = rand() * UINT32_MAX;
+	}
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+// Processes the first `channels` inputs into the outputs, or the samples in
+// place for process(). The compressor is linked: it follows the loudest channel
+// and applies the same gain to all, so the mono variant only listens to its one
+// channel.
+static inline void run_channels(Pressure5* pressure5, uint32_t sampleFrames, const int channels, double* const* samples, const bool dither)
 {
-	Pressure5* pressure5 = (Pressure5*) instance;
-
-	const float* in1 = pressure5->input[0];
-	const float* in2 = pressure5->input[1];
-	float* out1 = pressure5->output[0];
-	float* out2 = pressure5->output[1];
-
 	double overallscale = 1.0;
 	overallscale /= 44100.0;
 	overallscale *= pressure5->sampleRate;
@@ -201,31 +209,33 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	for (int x = 0; x < fix_sL1; x++) pressure5->fixB[x] = pressure5->fixA[x];
 	// make the second filter same as the first, don't use sample slots
 
-	while (sampleFrames-- > 0) {
-		double inputSampleL = *in1;
-		double inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = pressure5->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = pressure5->fpdR * 1.18e-17;
-		double drySampleL = inputSampleL;
-		double drySampleR = inputSampleR;
+	double inputSample[2];
+	double drySample[2];
 
-		inputSampleL = inputSampleL * muMakeupGain;
-		inputSampleR = inputSampleR * muMakeupGain;
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		for (int c = 0; c < channels; c++) {
+			inputSample[c] = samples ? samples[c][i] : pressure5->input[c][i];
+			if (fabs(inputSample[c]) < 1.18e-23) inputSample[c] = pressure5->fpd[c] * 1.18e-17;
+			drySample[c] = inputSample[c];
+
+			inputSample[c] = inputSample[c] * muMakeupGain;
+		}
 
 		if (pressure5->fixA[fix_freq] < 0.4999) {
-			double temp = (inputSampleL * pressure5->fixA[fix_a0]) + pressure5->fixA[fix_sL1];
-			pressure5->fixA[fix_sL1] = (inputSampleL * pressure5->fixA[fix_a1]) - (temp * pressure5->fixA[fix_b1]) + pressure5->fixA[fix_sL2];
-			pressure5->fixA[fix_sL2] = (inputSampleL * pressure5->fixA[fix_a2]) - (temp * pressure5->fixA[fix_b2]);
-			inputSampleL = temp;
-			temp = (inputSampleR * pressure5->fixA[fix_a0]) + pressure5->fixA[fix_sR1];
-			pressure5->fixA[fix_sR1] = (inputSampleR * pressure5->fixA[fix_a1]) - (temp * pressure5->fixA[fix_b1]) + pressure5->fixA[fix_sR2];
-			pressure5->fixA[fix_sR2] = (inputSampleR * pressure5->fixA[fix_a2]) - (temp * pressure5->fixA[fix_b2]);
-			inputSampleR = temp; // fixed biquad filtering ultrasonics before Pressure
+			for (int c = 0; c < channels; c++) {
+				double* state = pressure5->fixA + fix_sL1 + 2 * c;
+				double temp = (inputSample[c] * pressure5->fixA[fix_a0]) + state[0];
+				state[0] = (inputSample[c] * pressure5->fixA[fix_a1]) - (temp * pressure5->fixA[fix_b1]) + state[1];
+				state[1] = (inputSample[c] * pressure5->fixA[fix_a2]) - (temp * pressure5->fixA[fix_b2]);
+				inputSample[c] = temp; // fixed biquad filtering ultrasonics before Pressure
+			}
 		}
 
-		double inputSense = fabs(inputSampleL);
-		if (fabs(inputSampleR) > inputSense)
-			inputSense = fabs(inputSampleR);
+		double inputSense = fabs(inputSample[0]);
+		for (int c = 1; c < channels; c++) {
+			if (fabs(inputSample[c]) > inputSense)
+				inputSense = fabs(inputSample[c]);
+		}
 		// we will take the greater of either channel and just use that, then apply the result
 		// to both stereo channels.
 
@@ -282,123 +292,101 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			if (positivemu) coefficient = pow(pressure5->muCoefficientA, 2);
 			else coefficient = sqrt(pressure5->muCoefficientA);
 			coefficient = (coefficient * mewiness) + (pressure5->muCoefficientA * (1.0 - mewiness));
-			inputSampleL *= coefficient;
-			inputSampleR *= coefficient;
 		} else {
 			if (positivemu) coefficient = pow(pressure5->muCoefficientB, 2);
 			else coefficient = sqrt(pressure5->muCoefficientB);
 			coefficient = (coefficient * mewiness) + (pressure5->muCoefficientB * (1.0 - mewiness));
-			inputSampleL *= coefficient;
-			inputSampleR *= coefficient;
 		}
+		for (int c = 0; c < channels; c++) inputSample[c] *= coefficient;
 		// applied compression with vari-vari-µ-µ-µ-µ-µ-µ-is-the-kitten-song o/~
 		// applied gain correction to control output level- tends to constrain sound rather than inflate it
 
 		if (outputGain != 1.0) {
-			inputSampleL *= outputGain;
-			inputSampleR *= outputGain;
+			for (int c = 0; c < channels; c++) inputSample[c] *= outputGain;
 		}
 
 		pressure5->flip = !pressure5->flip;
 
 		if (pressure5->fixB[fix_freq] < 0.49999) {
-			double temp = (inputSampleL * pressure5->fixB[fix_a0]) + pressure5->fixB[fix_sL1];
-			pressure5->fixB[fix_sL1] = (inputSampleL * pressure5->fixB[fix_a1]) - (temp * pressure5->fixB[fix_b1]) + pressure5->fixB[fix_sL2];
-			pressure5->fixB[fix_sL2] = (inputSampleL * pressure5->fixB[fix_a2]) - (temp * pressure5->fixB[fix_b2]);
-			inputSampleL = temp;
-			temp = (inputSampleR * pressure5->fixB[fix_a0]) + pressure5->fixB[fix_sR1];
-			pressure5->fixB[fix_sR1] = (inputSampleR * pressure5->fixB[fix_a1]) - (temp * pressure5->fixB[fix_b1]) + pressure5->fixB[fix_sR2];
-			pressure5->fixB[fix_sR2] = (inputSampleR * pressure5->fixB[fix_a2]) - (temp * pressure5->fixB[fix_b2]);
-			inputSampleR = temp; // fixed biquad filtering ultrasonics between Pressure and ClipOnly
+			for (int c = 0; c < channels; c++) {
+				double* state = pressure5->fixB + fix_sL1 + 2 * c;
+				double temp = (inputSample[c] * pressure5->fixB[fix_a0]) + state[0];
+				state[0] = (inputSample[c] * pressure5->fixB[fix_a1]) - (temp * pressure5->fixB[fix_b1]) + state[1];
+				state[1] = (inputSample[c] * pressure5->fixB[fix_a2]) - (temp * pressure5->fixB[fix_b2]);
+				inputSample[c] = temp; // fixed biquad filtering ultrasonics between Pressure and ClipOnly
+			}
 		}
 
 		if (wet != 1.0) {
-			inputSampleL = (inputSampleL * wet) + (drySampleL * (1.0 - wet));
-			inputSampleR = (inputSampleR * wet) + (drySampleR * (1.0 - wet));
+			for (int c = 0; c < channels; c++) inputSample[c] = (inputSample[c] * wet) + (drySample[c] * (1.0 - wet));
 		}
 		// Dry/Wet control, BEFORE ClipOnly
 
-		pressure5->slewMax = fabs(inputSampleL - pressure5->lastSampleL);
-		if (pressure5->slewMax < fabs(inputSampleR - pressure5->lastSampleR)) pressure5->slewMax = fabs(inputSampleR - pressure5->lastSampleR);
+		pressure5->slewMax = fabs(inputSample[0] - pressure5->lastSample[0]);
+		for (int c = 1; c < channels; c++) {
+			if (pressure5->slewMax < fabs(inputSample[c] - pressure5->lastSample[c])) pressure5->slewMax = fabs(inputSample[c] - pressure5->lastSample[c]);
+		}
 		// set up for fiddling with mewiness. Largest amount of slew in any direction
 
-		// begin ClipOnly2 stereo as a little, compressed chunk that can be dropped into code
-		if (inputSampleL > 4.0) inputSampleL = 4.0;
-		if (inputSampleL < -4.0) inputSampleL = -4.0;
-		if (pressure5->wasPosClipL == true) { // current will be over
-			if (inputSampleL < pressure5->lastSampleL) pressure5->lastSampleL = 0.7058208 + (inputSampleL * 0.2609148);
-			else pressure5->lastSampleL = 0.2491717 + (pressure5->lastSampleL * 0.7390851);
-		}
-		pressure5->wasPosClipL = false;
-		if (inputSampleL > 0.9549925859) {
-			pressure5->wasPosClipL = true;
-			inputSampleL = 0.7058208 + (pressure5->lastSampleL * 0.2609148);
-		}
-		if (pressure5->wasNegClipL == true) { // current will be -over
-			if (inputSampleL > pressure5->lastSampleL) pressure5->lastSampleL = -0.7058208 + (inputSampleL * 0.2609148);
-			else pressure5->lastSampleL = -0.2491717 + (pressure5->lastSampleL * 0.7390851);
-		}
-		pressure5->wasNegClipL = false;
-		if (inputSampleL < -0.9549925859) {
-			pressure5->wasNegClipL = true;
-			inputSampleL = -0.7058208 + (pressure5->lastSampleL * 0.2609148);
-		}
-		pressure5->intermediateL[spacing] = inputSampleL;
-		inputSampleL = pressure5->lastSampleL; // Latency is however many samples equals one 44.1k sample
-		for (int x = spacing; x > 0; x--) pressure5->intermediateL[x - 1] = pressure5->intermediateL[x];
-		pressure5->lastSampleL = pressure5->intermediateL[0]; // run a little buffer to handle this
-
-		if (inputSampleR > 4.0) inputSampleR = 4.0;
-		if (inputSampleR < -4.0) inputSampleR = -4.0;
-		if (pressure5->wasPosClipR == true) { // current will be over
-			if (inputSampleR < pressure5->lastSampleR) pressure5->lastSampleR = 0.7058208 + (inputSampleR * 0.2609148);
-			else pressure5->lastSampleR = 0.2491717 + (pressure5->lastSampleR * 0.7390851);
-		}
-		pressure5->wasPosClipR = false;
-		if (inputSampleR > 0.9549925859) {
-			pressure5->wasPosClipR = true;
-			inputSampleR = 0.7058208 + (pressure5->lastSampleR * 0.2609148);
-		}
-		if (pressure5->wasNegClipR == true) { // current will be -over
-			if (inputSampleR > pressure5->lastSampleR) pressure5->lastSampleR = -0.7058208 + (inputSampleR * 0.2609148);
-			else pressure5->lastSampleR = -0.2491717 + (pressure5->lastSampleR * 0.7390851);
-		}
-		pressure5->wasNegClipR = false;
-		if (inputSampleR < -0.9549925859) {
-			pressure5->wasNegClipR = true;
-			inputSampleR = -0.7058208 + (pressure5->lastSampleR * 0.2609148);
+		// begin ClipOnly2 as a little, compressed chunk that can be dropped into code
+		LANES_UNROLL
+		for (int c = 0; c < channels; c++) {
+			if (inputSample[c] > 4.0) inputSample[c] = 4.0;
+			if (inputSample[c] < -4.0) inputSample[c] = -4.0;
+			if (pressure5->wasPosClip[c] == true) { // current will be over
+				if (inputSample[c] < pressure5->lastSample[c]) pressure5->lastSample[c] = 0.7058208 + (inputSample[c] * 0.2609148);
+				else pressure5->lastSample[c] = 0.2491717 + (pressure5->lastSample[c] * 0.7390851);
+			}
+			pressure5->wasPosClip[c] = false;
+			if (inputSample[c] > 0.9549925859) {
+				pressure5->wasPosClip[c] = true;
+				inputSample[c] = 0.7058208 + (pressure5->lastSample[c] * 0.2609148);
+			}
+			if (pressure5->wasNegClip[c] == true) { // current will be -over
+				if (inputSample[c] > pressure5->lastSample[c]) pressure5->lastSample[c] = -0.7058208 + (inputSample[c] * 0.2609148);
+				else pressure5->lastSample[c] = -0.2491717 + (pressure5->lastSample[c] * 0.7390851);
+			}
+			pressure5->wasNegClip[c] = false;
+			if (inputSample[c] < -0.9549925859) {
+				pressure5->wasNegClip[c] = true;
+				inputSample[c] = -0.7058208 + (pressure5->lastSample[c] * 0.2609148);
+			}
+			pressure5->intermediate[c][spacing] = inputSample[c];
+			inputSample[c] = pressure5->lastSample[c]; // Latency is however many samples equals one 44.1k sample
+			for (int x = spacing; x > 0; x--) pressure5->intermediate[c][x - 1] = pressure5->intermediate[c][x];
+			pressure5->lastSample[c] = pressure5->intermediate[c][0]; // run a little buffer to handle this
 		}
-		pressure5->intermediateR[spacing] = inputSampleR;
-		inputSampleR = pressure5->lastSampleR; // Latency is however many samples equals one 44.1k sample
-		for (int x = spacing; x > 0; x--) pressure5->intermediateR[x - 1] = pressure5->intermediateR[x];
-		pressure5->lastSampleR = pressure5->intermediateR[0]; // run a little buffer to handle this
-		// end ClipOnly2 stereo as a little, compressed chunk that can be dropped into code
+		// end ClipOnly2 as a little, compressed chunk that can be dropped into code
 		// final clip runs AFTER the Dry/Wet. It serves as a safety clip even if you're not full wet
 
-		// begin 32 bit stereo floating point dither
-		int expon;
-		frexpf((float) inputSampleL, &expon);
-		pressure5->fpdL ^= pressure5->fpdL << 13;
-		pressure5->fpdL ^= pressure5->fpdL >> 17;
-		pressure5->fpdL ^= pressure5->fpdL << 5;
-		inputSampleL += (((double) pressure5->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		frexpf((float) inputSampleR, &expon);
-		pressure5->fpdR ^= pressure5->fpdR << 13;
-		pressure5->fpdR ^= pressure5->fpdR >> 17;
-		pressure5->fpdR ^= pressure5->fpdR << 5;
-		inputSampleR += (((double) pressure5->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		// end 32 bit stereo floating point dither
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+		// begin 32 bit floating point dither
+		for (int c = 0; c < channels; c++) {
+			int expon;
+			frexpf((float) inputSample[c], &expon);
+			pressure5->fpd[c] ^= pressure5->fpd[c] << 13;
+			pressure5->fpd[c] ^= pressure5->fpd[c] >> 17;
+			pressure5->fpd[c] ^= pressure5->fpd[c] << 5;
+			if (dither) inputSample[c] += (((double) pressure5->fpd[c] - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+		}
+		// end 32 bit floating point dither
+
+		for (int c = 0; c < channels; c++) {
+			if (samples) samples[c][i] = inputSample[c];
+			else pressure5->output[c][i] = (float) inputSample[c];
+		}
 	}
 }
 
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Pressure5*) instance, sampleFrames, 2, NULL, true);
+}
+
+static void run_mono(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((Pressure5*) instance, sampleFrames, 1, NULL, true);
+}
+
 static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
@@ -406,22 +394,47 @@ static void cleanup(LV2_Handle instance)
 	free(instance);
 }
 
+static void process(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_channels((Pressure5*) instance, sampleFrames, 2, samples, dither);
+}
+
+static void process_mono(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_channels((Pressure5*) instance, sampleFrames, 1, samples, dither);
+}
+
 static const void* extension_data(const char* uri)
 {
-	return NULL;
+	static const AirwindowsFused fused = {process};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const void* extension_data_mono(const char* uri)
+{
+	static const AirwindowsFused fused = {process_mono};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
 }
 
-static const LV2_Descriptor descriptor = {
-	PRESSURE5_URI,
-	instantiate,
-	connect_port,
-	activate,
-	run,
-	deactivate,
-	cleanup,
-	extension_data};
+static const LV2_Descriptor descriptors[] = {
+	{PRESSURE5_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{PRESSURE5MONO_URI,
+	 instantiate,
+	 connect_port_mono,
+	 activate,
+	 run_mono,
+	 deactivate,
+	 cleanup,
+	 extension_data_mono}};
 
 LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
 {
-	return index == 0 ? &descriptor : NULL;
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
 }
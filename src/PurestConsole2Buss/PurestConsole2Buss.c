@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define PURESTCONSOLE2BUSS_URI "https://hannesbraun.net/ns/lv2/airwindows/purestconsole2buss"
@@ -115,8 +117,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
 
-		inputSampleL = asin(inputSampleL);
-		inputSampleR = asin(inputSampleR);
+		inputSampleL = fast_asin(inputSampleL);
+		inputSampleR = fast_asin(inputSampleR);
 		// amplitude aspect
 
 		// begin 32 bit stereo floating point dither
@@ -125,12 +127,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		purestConsole2Buss->fpdL ^= purestConsole2Buss->fpdL << 13;
 		purestConsole2Buss->fpdL ^= purestConsole2Buss->fpdL >> 17;
 		purestConsole2Buss->fpdL ^= purestConsole2Buss->fpdL << 5;
-		inputSampleL += (((double) purestConsole2Buss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) purestConsole2Buss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		purestConsole2Buss->fpdR ^= purestConsole2Buss->fpdR << 13;
 		purestConsole2Buss->fpdR ^= purestConsole2Buss->fpdR >> 17;
 		purestConsole2Buss->fpdR ^= purestConsole2Buss->fpdR << 5;
-		inputSampleR += (((double) purestConsole2Buss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) purestConsole2Buss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define PURESTCONSOLE2CHANNEL_URI "https://hannesbraun.net/ns/lv2/airwindows/purestconsole2channel"
@@ -115,8 +117,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 		if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
 
-		inputSampleL = sin(inputSampleL);
-		inputSampleR = sin(inputSampleR);
+		inputSampleL = fast_sin(inputSampleL);
+		inputSampleR = fast_sin(inputSampleR);
 		// amplitude aspect
 
 		// begin 32 bit stereo floating point dither
@@ -125,12 +127,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		purestConsole2Channel->fpdL ^= purestConsole2Channel->fpdL << 13;
 		purestConsole2Channel->fpdL ^= purestConsole2Channel->fpdL >> 17;
 		purestConsole2Channel->fpdL ^= purestConsole2Channel->fpdL << 5;
-		inputSampleL += (((double) purestConsole2Channel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) purestConsole2Channel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		purestConsole2Channel->fpdR ^= purestConsole2Channel->fpdR << 13;
 		purestConsole2Channel->fpdR ^= purestConsole2Channel->fpdR >> 17;
 		purestConsole2Channel->fpdR ^= purestConsole2Channel->fpdR << 5;
-		inputSampleR += (((double) purestConsole2Channel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) purestConsole2Channel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
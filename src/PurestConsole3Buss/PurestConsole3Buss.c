@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define PURESTCONSOLE3BUSS_URI "https://hannesbraun.net/ns/lv2/airwindows/purestconsole3buss"
 
 typedef enum {
@@ -85,12 +87,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		purestConsole3Buss->fpdL ^= purestConsole3Buss->fpdL << 13;
 		purestConsole3Buss->fpdL ^= purestConsole3Buss->fpdL >> 17;
 		purestConsole3Buss->fpdL ^= purestConsole3Buss->fpdL << 5;
-		inputSampleL += (((double) purestConsole3Buss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) purestConsole3Buss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		purestConsole3Buss->fpdR ^= purestConsole3Buss->fpdR << 13;
 		purestConsole3Buss->fpdR ^= purestConsole3Buss->fpdR >> 17;
 		purestConsole3Buss->fpdR ^= purestConsole3Buss->fpdR << 5;
-		inputSampleR += (((double) purestConsole3Buss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) purestConsole3Buss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
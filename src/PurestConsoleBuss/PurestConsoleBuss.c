@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define PURESTCONSOLEBUSS_URI "https://hannesbraun.net/ns/lv2/airwindows/purestconsolebuss"
 
 typedef enum {
@@ -84,8 +86,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
 
-		inputSampleL = asin(inputSampleL);
-		inputSampleR = asin(inputSampleR);
+		inputSampleL = fast_asin(inputSampleL);
+		inputSampleR = fast_asin(inputSampleR);
 		// amplitude aspect
 
 		// begin 32 bit stereo floating point dither
@@ -94,12 +96,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		purestConsoleBuss->fpdL ^= purestConsoleBuss->fpdL << 13;
 		purestConsoleBuss->fpdL ^= purestConsoleBuss->fpdL >> 17;
 		purestConsoleBuss->fpdL ^= purestConsoleBuss->fpdL << 5;
-		inputSampleL += (((double) purestConsoleBuss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) purestConsoleBuss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		purestConsoleBuss->fpdR ^= purestConsoleBuss->fpdR << 13;
 		purestConsoleBuss->fpdR ^= purestConsoleBuss->fpdR >> 17;
 		purestConsoleBuss->fpdR ^= purestConsoleBuss->fpdR << 5;
-		inputSampleR += (((double) purestConsoleBuss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) purestConsoleBuss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define PURESTCONSOLECHANNEL_URI "https://hannesbraun.net/ns/lv2/airwindows/purestconsolechannel"
 
 typedef enum {
@@ -78,8 +80,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = purestConsoleChannel->fpdL * 1.18e-17;
 		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = purestConsoleChannel->fpdR * 1.18e-17;
 
-		inputSampleL = sin(inputSampleL);
-		inputSampleR = sin(inputSampleR);
+		inputSampleL = fast_sin(inputSampleL);
+		inputSampleR = fast_sin(inputSampleR);
 		// amplitude aspect
 
 		// begin 32 bit stereo floating point dither
@@ -88,12 +90,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		purestConsoleChannel->fpdL ^= purestConsoleChannel->fpdL << 13;
 		purestConsoleChannel->fpdL ^= purestConsoleChannel->fpdL >> 17;
 		purestConsoleChannel->fpdL ^= purestConsoleChannel->fpdL << 5;
-		inputSampleL += (((double) purestConsoleChannel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) purestConsoleChannel->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		purestConsoleChannel->fpdR ^= purestConsoleChannel->fpdR << 13;
 		purestConsoleChannel->fpdR ^= purestConsoleChannel->fpdR >> 17;
 		purestConsoleChannel->fpdR ^= purestConsoleChannel->fpdR << 5;
-		inputSampleR += (((double) purestConsoleChannel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) purestConsoleChannel->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define PURESTDRIVE_URI "https://hannesbraun.net/ns/lv2/airwindows/purestdrive"
 
 typedef enum {
@@ -96,24 +98,24 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		drySampleL = inputSampleL;
 		drySampleR = inputSampleR;
 
-		inputSampleL = sin(inputSampleL);
+		inputSampleL = fast_sin(inputSampleL);
 		// basic distortion factor
 		apply = (fabs(purestDrive->previousSampleL + inputSampleL) / 2.0) * intensity;
 		// saturate less if previous sample was undistorted and low level, or if it was
 		// inverse polarity. Lets through highs and brightness more.
 		inputSampleL = (drySampleL * (1.0 - apply)) + (inputSampleL * apply);
 		// dry-wet control for intensity also has FM modulation to clean up highs
-		purestDrive->previousSampleL = sin(drySampleL);
+		purestDrive->previousSampleL = fast_sin(drySampleL);
 		// apply the sine while storing previous sample
 
-		inputSampleR = sin(inputSampleR);
+		inputSampleR = fast_sin(inputSampleR);
 		// basic distortion factor
 		apply = (fabs(purestDrive->previousSampleR + inputSampleR) / 2.0) * intensity;
 		// saturate less if previous sample was undistorted and low level, or if it was
 		// inverse polarity. Lets through highs and brightness more.
 		inputSampleR = (drySampleR * (1.0 - apply)) + (inputSampleR * apply);
 		// dry-wet control for intensity also has FM modulation to clean up highs
-		purestDrive->previousSampleR = sin(drySampleR);
+		purestDrive->previousSampleR = fast_sin(drySampleR);
 		// apply the sine while storing previous sample
 
 		// begin 32 bit stereo floating point dither
@@ -122,12 +124,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		purestDrive->fpdL ^= purestDrive->fpdL << 13;
 		purestDrive->fpdL ^= purestDrive->fpdL >> 17;
 		purestDrive->fpdL ^= purestDrive->fpdL << 5;
-		inputSampleL += (((double) purestDrive->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) purestDrive->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		purestDrive->fpdR ^= purestDrive->fpdR << 13;
 		purestDrive->fpdR ^= purestDrive->fpdR >> 17;
 		purestDrive->fpdR ^= purestDrive->fpdR << 5;
-		inputSampleR += (((double) purestDrive->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) purestDrive->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define PURESTFADE_URI "https://hannesbraun.net/ns/lv2/airwindows/purestfade"
 
 typedef enum {
@@ -145,8 +147,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		// directly multiply the dB gain by the straight multiply gain
 
 		if (1.0 == outputgain) {
-			*out1 = *in1;
-			*out2 = *in2;
+			const float drySampleL = *in1;
+			const float drySampleR = *in2;
+			*out1 = drySampleL;
+			*out2 = drySampleR;
 		} else {
 			inputSampleL *= outputgain;
 			inputSampleR *= outputgain;
@@ -157,12 +161,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			purestFade->fpdL ^= purestFade->fpdL << 13;
 			purestFade->fpdL ^= purestFade->fpdL >> 17;
 			purestFade->fpdL ^= purestFade->fpdL << 5;
-			inputSampleL += (((double) purestFade->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+			inputSampleL += (((double) purestFade->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 			frexpf((float) inputSampleR, &expon);
 			purestFade->fpdR ^= purestFade->fpdR << 13;
 			purestFade->fpdR ^= purestFade->fpdR >> 17;
 			purestFade->fpdR ^= purestFade->fpdR << 5;
-			inputSampleR += (((double) purestFade->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+			inputSampleR += (((double) purestFade->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 			// end 32 bit stereo floating point dither
 			*out1 = (float) inputSampleL;
 			*out2 = (float) inputSampleR;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define PURESTGAIN_URI "https://hannesbraun.net/ns/lv2/airwindows/purestgain"
 
 typedef enum {
@@ -146,8 +148,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = purestGain->fpdR * 1.18e-17;
 
 		if (1.0 == outputgain) {
-			*out1 = *in1;
-			*out2 = *in2;
+			const float drySampleL = *in1;
+			const float drySampleR = *in2;
+			*out1 = drySampleL;
+			*out2 = drySampleR;
 		} else {
 			inputSampleL *= outputgain;
 			inputSampleR *= outputgain;
@@ -157,12 +161,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			purestGain->fpdL ^= purestGain->fpdL << 13;
 			purestGain->fpdL ^= purestGain->fpdL >> 17;
 			purestGain->fpdL ^= purestGain->fpdL << 5;
-			inputSampleL += (((double) purestGain->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+			inputSampleL += (((double) purestGain->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 			frexpf((float) inputSampleR, &expon);
 			purestGain->fpdR ^= purestGain->fpdR << 13;
 			purestGain->fpdR ^= purestGain->fpdR >> 17;
 			purestGain->fpdR ^= purestGain->fpdR << 5;
-			inputSampleR += (((double) purestGain->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+			inputSampleR += (((double) purestGain->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 			// end 32 bit stereo floating point dither
 			*out1 = (float) inputSampleL;
 			*out2 = (float) inputSampleR;
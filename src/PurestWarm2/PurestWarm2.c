@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define PURESTWARM2_URI "https://hannesbraun.net/ns/lv2/airwindows/purestwarm2"
@@ -130,16 +132,16 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		purestWarm2->fixA[fix_sL2] = (inputSampleL * purestWarm2->fixA[fix_a2]) - (outSample * purestWarm2->fixA[fix_b2]);
 		inputSampleL = outSample; // fixed biquad filtering ultrasonics
 
-		if (inputSampleL > 0) inputSampleL = (sin(inputSampleL * 1.57079634 * pos) / 1.57079634) + (inputSampleL * (1.0 - pos));
-		if (inputSampleL < 0) inputSampleL = (sin(inputSampleL * 1.57079634 * neg) / 1.57079634) + (inputSampleL * (1.0 - neg));
+		if (inputSampleL > 0) inputSampleL = (fast_sin(inputSampleL * 1.57079634 * pos) / 1.57079634) + (inputSampleL * (1.0 - pos));
+		if (inputSampleL < 0) inputSampleL = (fast_sin(inputSampleL * 1.57079634 * neg) / 1.57079634) + (inputSampleL * (1.0 - neg));
 
 		outSample = (inputSampleR * purestWarm2->fixA[fix_a0]) + purestWarm2->fixA[fix_sR1];
 		purestWarm2->fixA[fix_sR1] = (inputSampleR * purestWarm2->fixA[fix_a1]) - (outSample * purestWarm2->fixA[fix_b1]) + purestWarm2->fixA[fix_sR2];
 		purestWarm2->fixA[fix_sR2] = (inputSampleR * purestWarm2->fixA[fix_a2]) - (outSample * purestWarm2->fixA[fix_b2]);
 		inputSampleR = outSample; // fixed biquad filtering ultrasonics
 
-		if (inputSampleR > 0) inputSampleR = (sin(inputSampleR * 1.57079634 * pos) / 1.57079634) + (inputSampleR * (1.0 - pos));
-		if (inputSampleR < 0) inputSampleR = (sin(inputSampleR * 1.57079634 * neg) / 1.57079634) + (inputSampleR * (1.0 - neg));
+		if (inputSampleR > 0) inputSampleR = (fast_sin(inputSampleR * 1.57079634 * pos) / 1.57079634) + (inputSampleR * (1.0 - pos));
+		if (inputSampleR < 0) inputSampleR = (fast_sin(inputSampleR * 1.57079634 * neg) / 1.57079634) + (inputSampleR * (1.0 - neg));
 
 		// begin 32 bit stereo floating point dither
 		int expon;
@@ -147,12 +149,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		purestWarm2->fpdL ^= purestWarm2->fpdL << 13;
 		purestWarm2->fpdL ^= purestWarm2->fpdL >> 17;
 		purestWarm2->fpdL ^= purestWarm2->fpdL << 5;
-		inputSampleL += (((double) purestWarm2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) purestWarm2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		purestWarm2->fpdR ^= purestWarm2->fpdR << 13;
 		purestWarm2->fpdR ^= purestWarm2->fpdR >> 17;
 		purestWarm2->fpdR ^= purestWarm2->fpdR << 5;
-		inputSampleR += (((double) purestWarm2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) purestWarm2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
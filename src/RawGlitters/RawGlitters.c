@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/dispatch.h"
+
 #define RAWGLITTERS_URI "https://hannesbraun.net/ns/lv2/airwindows/rawglitters"
 
 typedef enum {
@@ -80,7 +82,7 @@ static void activate(LV2_Handle instance)
 	rawGlitters->lastSample2R = 0.0;
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+CPU_DISPATCH static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	RawGlitters* rawGlitters = (RawGlitters*) instance;
 
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define RECURVE_URI "https://hannesbraun.net/ns/lv2/airwindows/recurve"
 
 typedef enum {
@@ -107,12 +109,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		recurve->fpdL ^= recurve->fpdL << 13;
 		recurve->fpdL ^= recurve->fpdL >> 17;
 		recurve->fpdL ^= recurve->fpdL << 5;
-		inputSampleL += (((double) recurve->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) recurve->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		recurve->fpdR ^= recurve->fpdR << 13;
 		recurve->fpdR ^= recurve->fpdR >> 17;
 		recurve->fpdR ^= recurve->fpdR << 5;
-		inputSampleR += (((double) recurve->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) recurve->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define RESEQ_URI "https://hannesbraun.net/ns/lv2/airwindows/reseq"
 
 typedef enum {
@@ -520,12 +522,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		resEQ->fpdL ^= resEQ->fpdL << 13;
 		resEQ->fpdL ^= resEQ->fpdL >> 17;
 		resEQ->fpdL ^= resEQ->fpdL << 5;
-		inputSampleL += (((double) resEQ->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) resEQ->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		resEQ->fpdR ^= resEQ->fpdR << 13;
 		resEQ->fpdR ^= resEQ->fpdR >> 17;
 		resEQ->fpdR ^= resEQ->fpdR << 5;
-		inputSampleR += (((double) resEQ->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) resEQ->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -1,13 +1,20 @@
 #include <lv2/core/lv2.h>
+#include <lv2/worker/worker.h>
 
 #include <math.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include "../common/fastmath.h"
+#include "../common/ramp.h"
 
 #define M_PI_2 1.57079632679489661923132169163975144
 #define M_PI_4 0.785398163397448309615660845819875721
 
 #define RESEQ2_URI "https://hannesbraun.net/ns/lv2/airwindows/reseq2"
+#define RESEQ2CV_URI "https://hannesbraun.net/ns/lv2/airwindows/reseq2cv"
 
 typedef enum {
 	INPUT_L = 0,
@@ -15,23 +22,54 @@ typedef enum {
 	OUTPUT_L = 2,
 	OUTPUT_R = 3,
 	M_SWEEP = 4,
-	M_BOOST = 5
+	M_BOOST = 5,
+	M_SWEEP_CV = 6,
+	M_BOOST_CV = 7
 } PortIndex;
 
+// The mid peak kernel, rebuilt whenever sweep or boost move. With a host
+// worker the rebuild runs on the worker thread and the finished kernel is
+// copied in by work_response between two runs, otherwise run() builds it.
+// Following the CV ports, run() always builds it, once per RAMP_STEP at most.
+typedef struct {
+	double freqMPeak;
+	double amountMPeak;
+	int maxMPeak; // 0 until the first kernel is built
+	double f[66];
+} ResEQ2Kernel;
+
+// Work requests and responses carry the generation they were made in, so a
+// kernel requested before the last activate() is dropped when it arrives
+typedef struct {
+	uint32_t generation;
+	double freqMPeak;
+	double amountMPeak;
+} ResEQ2Request;
+
+typedef struct {
+	uint32_t generation;
+	ResEQ2Kernel kernel;
+} ResEQ2Response;
+
 typedef struct {
 	double sampleRate;
 	const float* input[2];
 	float* output[2];
 	const float* mSweep;
 	const float* mBoost;
+	const float* mSweepCV;
+	const float* mBoostCV; // NULL unless the host connects the CV ports, which only ResEQ2 CV has
 
 	double mpkL[2005];
 	double mpkR[2005];
-	double f[66];
-	double prevfreqMPeak;
-	double prevamountMPeak;
+	ResEQ2Kernel kernel;
+	double requestedfreqMPeak;
+	double requestedamountMPeak; // last kernel handed to the worker
+	uint32_t generation; // counts the activations
 	int mpc;
 
+	const LV2_Worker_Schedule* schedule;
+
 	uint32_t fpdL;
 	uint32_t fpdR;
 } ResEQ2;
@@ -44,6 +82,9 @@ static LV2_Handle instantiate(
 {
 	ResEQ2* resEQ2 = (ResEQ2*) calloc(1, sizeof(ResEQ2));
 	resEQ2->sampleRate = rate;
+	for (int i = 0; features && features[i]; i++) {
+		if (!strcmp(features[i]->URI, LV2_WORKER__schedule)) resEQ2->schedule = (const LV2_Worker_Schedule*) features[i]->data;
+	}
 	return (LV2_Handle) resEQ2;
 }
 
@@ -70,6 +111,12 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 		case M_BOOST:
 			resEQ2->mBoost = (const float*) data;
 			break;
+		case M_SWEEP_CV:
+			resEQ2->mSweepCV = (const float*) data;
+			break;
+		case M_BOOST_CV:
+			resEQ2->mBoostCV = (const float*) data;
+			break;
 	}
 }
 
@@ -81,10 +128,14 @@ static void activate(LV2_Handle instance)
 		resEQ2->mpkR[count] = 0.0;
 	}
 	for (int count = 0; count < 65; count++) {
-		resEQ2->f[count] = 0.0;
+		resEQ2->kernel.f[count] = 0.0;
 	}
-	resEQ2->prevfreqMPeak = -1;
-	resEQ2->prevamountMPeak = -1;
+	resEQ2->kernel.freqMPeak = -1;
+	resEQ2->kernel.amountMPeak = -1;
+	resEQ2->kernel.maxMPeak = 0;
+	resEQ2->requestedfreqMPeak = -1;
+	resEQ2->requestedamountMPeak = -1;
+	resEQ2->generation++;
 	resEQ2->mpc = 1;
 
 	resEQ2->fpdL = 1.0;
@@ -93,6 +144,18 @@ static void activate(LV2_Handle instance)
 	while (resEQ2->fpdR < 16386) resEQ2->fpdR = rand() * UINT32_MAX;
 }
 
+static void build_kernel(ResEQ2Kernel* kernel, double freqMPeak, double amountMPeak)
+{
+	int maxMPeak = (amountMPeak * 63.0) + 1;
+	for (int x = 0; x < maxMPeak; x++) {
+		if (((double) x * freqMPeak) < M_PI_4) kernel->f[x] = sin(((double) x * freqMPeak) * 4.0) * freqMPeak * sin(((double) (maxMPeak - x) / (double) maxMPeak) * M_PI_2);
+		else kernel->f[x] = cos((double) x * freqMPeak) * freqMPeak * sin(((double) (maxMPeak - x) / (double) maxMPeak) * M_PI_2);
+	}
+	kernel->freqMPeak = freqMPeak;
+	kernel->amountMPeak = amountMPeak;
+	kernel->maxMPeak = maxMPeak;
+}
+
 static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	ResEQ2* resEQ2 = (ResEQ2*) instance;
@@ -110,95 +173,110 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	if (cycleEnd > 4) cycleEnd = 4;
 	// this is going to be 2 for 88.1 or 96k, 3 for silly people, 4 for 176 or 192k
 
-	// begin ResEQ2 Mid Boost
-	double freqMPeak = pow(*resEQ2->mSweep + 0.15, 3);
-	double amountMPeak = pow(*resEQ2->mBoost, 2);
-	int maxMPeak = (amountMPeak * 63.0) + 1;
-	if ((freqMPeak != resEQ2->prevfreqMPeak) || (amountMPeak != resEQ2->prevamountMPeak)) {
-		for (int x = 0; x < maxMPeak; x++) {
-			if (((double) x * freqMPeak) < M_PI_4) resEQ2->f[x] = sin(((double) x * freqMPeak) * 4.0) * freqMPeak * sin(((double) (maxMPeak - x) / (double) maxMPeak) * M_PI_2);
-			else resEQ2->f[x] = cos((double) x * freqMPeak) * freqMPeak * sin(((double) (maxMPeak - x) / (double) maxMPeak) * M_PI_2);
-		}
-		resEQ2->prevfreqMPeak = freqMPeak;
-		resEQ2->prevamountMPeak = amountMPeak;
-	} // end ResEQ2 Mid Boost
-
-	while (sampleFrames-- > 0) {
-		double inputSampleL = *in1;
-		double inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = resEQ2->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = resEQ2->fpdR * 1.18e-17;
+	const bool ramped = resEQ2->mSweepCV || resEQ2->mBoostCV;
+	for (uint32_t frame = 0; frame < sampleFrames;) {
+		const uint32_t span = ramp_span(ramped, frame, sampleFrames);
 
 		// begin ResEQ2 Mid Boost
-		resEQ2->mpc++;
-		if (resEQ2->mpc < 1 || resEQ2->mpc > 2001) resEQ2->mpc = 1;
-		resEQ2->mpkL[resEQ2->mpc] = inputSampleL;
-		resEQ2->mpkR[resEQ2->mpc] = inputSampleR;
-		double midMPeakL = 0.0;
-		double midMPeakR = 0.0;
-		for (int x = 0; x < maxMPeak; x++) {
-			int y = x * cycleEnd;
-			switch (cycleEnd) {
-				case 1:
-					midMPeakL += (resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]);
-					midMPeakR += (resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]);
-					break;
-				case 2:
-					midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.5);
-					midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.5);
-					y--;
-					midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.5);
-					midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.5);
-					break;
-				case 3:
-					midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.333);
-					midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.333);
-					y--;
-					midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.333);
-					midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.333);
-					y--;
-					midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.333);
-					midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.333);
-					break;
-				case 4:
-					midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.25);
-					midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.25);
-					y--;
-					midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.25);
-					midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.25);
-					y--;
-					midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.25);
-					midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.25);
-					y--;
-					midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.25);
-					midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * resEQ2->f[x]) * 0.25); // break
+		ResEQ2Kernel* kernel = &resEQ2->kernel;
+		double freqMPeak = pow(ramp_value(resEQ2->mSweep, resEQ2->mSweepCV, frame) + 0.15, 3);
+		double amountMPeak = pow(ramp_value(resEQ2->mBoost, resEQ2->mBoostCV, frame), 2);
+		if ((freqMPeak != kernel->freqMPeak) || (amountMPeak != kernel->amountMPeak)) {
+			if (resEQ2->schedule && kernel->maxMPeak > 0 && !ramped) {
+				if ((freqMPeak != resEQ2->requestedfreqMPeak) || (amountMPeak != resEQ2->requestedamountMPeak)) {
+					const ResEQ2Request request = {resEQ2->generation, freqMPeak, amountMPeak};
+					if (resEQ2->schedule->schedule_work(resEQ2->schedule->handle, sizeof(request), &request) == LV2_WORKER_SUCCESS) {
+						resEQ2->requestedfreqMPeak = freqMPeak;
+						resEQ2->requestedamountMPeak = amountMPeak;
+					}
+				}
+			} else {
+				build_kernel(kernel, freqMPeak, amountMPeak);
 			}
 		}
-		inputSampleL = (midMPeakL * amountMPeak) + ((1.5 - amountMPeak > 1.0) ? inputSampleL : inputSampleL * (1.5 - amountMPeak));
-		inputSampleR = (midMPeakR * amountMPeak) + ((1.5 - amountMPeak > 1.0) ? inputSampleR : inputSampleR * (1.5 - amountMPeak));
+		// until the worker's kernel arrives, the previous one keeps playing
+		amountMPeak = kernel->amountMPeak;
+		const int maxMPeak = kernel->maxMPeak;
+		const double* f = kernel->f;
 		// end ResEQ2 Mid Boost
 
-		// begin 32 bit stereo floating point dither
-		int expon;
-		frexpf((float) inputSampleL, &expon);
-		resEQ2->fpdL ^= resEQ2->fpdL << 13;
-		resEQ2->fpdL ^= resEQ2->fpdL >> 17;
-		resEQ2->fpdL ^= resEQ2->fpdL << 5;
-		inputSampleL += (((double) resEQ2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		frexpf((float) inputSampleR, &expon);
-		resEQ2->fpdR ^= resEQ2->fpdR << 13;
-		resEQ2->fpdR ^= resEQ2->fpdR >> 17;
-		resEQ2->fpdR ^= resEQ2->fpdR << 5;
-		inputSampleR += (((double) resEQ2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		// end 32 bit stereo floating point dither
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+		for (uint32_t end = frame + span; frame < end; frame++) {
+			double inputSampleL = *in1;
+			double inputSampleR = *in2;
+			if (fabs(inputSampleL) < 1.18e-23) inputSampleL = resEQ2->fpdL * 1.18e-17;
+			if (fabs(inputSampleR) < 1.18e-23) inputSampleR = resEQ2->fpdR * 1.18e-17;
+
+			// begin ResEQ2 Mid Boost
+			resEQ2->mpc++;
+			if (resEQ2->mpc < 1 || resEQ2->mpc > 2001) resEQ2->mpc = 1;
+			resEQ2->mpkL[resEQ2->mpc] = inputSampleL;
+			resEQ2->mpkR[resEQ2->mpc] = inputSampleR;
+			double midMPeakL = 0.0;
+			double midMPeakR = 0.0;
+			for (int x = 0; x < maxMPeak; x++) {
+				int y = x * cycleEnd;
+				switch (cycleEnd) {
+					case 1:
+						midMPeakL += (resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]);
+						midMPeakR += (resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]);
+						break;
+					case 2:
+						midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.5);
+						midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.5);
+						y--;
+						midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.5);
+						midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.5);
+						break;
+					case 3:
+						midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.333);
+						midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.333);
+						y--;
+						midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.333);
+						midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.333);
+						y--;
+						midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.333);
+						midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.333);
+						break;
+					case 4:
+						midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.25);
+						midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.25);
+						y--;
+						midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.25);
+						midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.25);
+						y--;
+						midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.25);
+						midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.25);
+						y--;
+						midMPeakL += ((resEQ2->mpkL[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.25);
+						midMPeakR += ((resEQ2->mpkR[(resEQ2->mpc - y) + ((resEQ2->mpc - y < 1) ? 2001 : 0)] * f[x]) * 0.25); // break
+				}
+			}
+			inputSampleL = (midMPeakL * amountMPeak) + ((1.5 - amountMPeak > 1.0) ? inputSampleL : inputSampleL * (1.5 - amountMPeak));
+			inputSampleR = (midMPeakR * amountMPeak) + ((1.5 - amountMPeak > 1.0) ? inputSampleR : inputSampleR * (1.5 - amountMPeak));
+			// end ResEQ2 Mid Boost
+
+			// begin 32 bit stereo floating point dither
+			int expon;
+			frexpf((float) inputSampleL, &expon);
+			resEQ2->fpdL ^= resEQ2->fpdL << 13;
+			resEQ2->fpdL ^= resEQ2->fpdL >> 17;
+			resEQ2->fpdL ^= resEQ2->fpdL << 5;
+			inputSampleL += (((double) resEQ2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+			frexpf((float) inputSampleR, &expon);
+			resEQ2->fpdR ^= resEQ2->fpdR << 13;
+			resEQ2->fpdR ^= resEQ2->fpdR >> 17;
+			resEQ2->fpdR ^= resEQ2->fpdR << 5;
+			inputSampleR += (((double) resEQ2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+			// end 32 bit stereo floating point dither
+
+			*out1 = (float) inputSampleL;
+			*out2 = (float) inputSampleR;
+
+			in1++;
+			in2++;
+			out1++;
+			out2++;
+		}
 	}
 }
 
@@ -209,22 +287,53 @@ static void cleanup(LV2_Handle instance)
 	free(instance);
 }
 
+static LV2_Worker_Status work(LV2_Handle instance, LV2_Worker_Respond_Function respond, LV2_Worker_Respond_Handle handle, uint32_t size, const void* data)
+{
+	if (size != sizeof(ResEQ2Request)) return LV2_WORKER_ERR_UNKNOWN;
+	const ResEQ2Request* request = (const ResEQ2Request*) data;
+
+	ResEQ2Response response;
+	response.generation = request->generation;
+	build_kernel(&response.kernel, request->freqMPeak, request->amountMPeak);
+	return respond(handle, sizeof(response), &response);
+}
+
+static LV2_Worker_Status work_response(LV2_Handle instance, uint32_t size, const void* body)
+{
+	ResEQ2* resEQ2 = (ResEQ2*) instance;
+
+	if (size != sizeof(ResEQ2Response)) return LV2_WORKER_ERR_UNKNOWN;
+	const ResEQ2Response* response = (const ResEQ2Response*) body;
+	if (response->generation == resEQ2->generation) memcpy(&resEQ2->kernel, &response->kernel, sizeof(ResEQ2Kernel));
+	return LV2_WORKER_SUCCESS;
+}
+
 static const void* extension_data(const char* uri)
 {
+	static const LV2_Worker_Interface worker = {work, work_response, NULL};
+	if (!strcmp(uri, LV2_WORKER__interface)) return &worker;
 	return NULL;
 }
 
-static const LV2_Descriptor descriptor = {
-	RESEQ2_URI,
-	instantiate,
-	connect_port,
-	activate,
-	run,
-	deactivate,
-	cleanup,
-	extension_data};
+static const LV2_Descriptor descriptors[] = {
+	{RESEQ2_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{RESEQ2CV_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data}};
 
 LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
 {
-	return index == 0 ? &descriptor : NULL;
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
 }
@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define REVERB_URI "https://hannesbraun.net/ns/lv2/airwindows/reverb"
@@ -90,6 +93,8 @@ typedef struct {
 
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	Silence silence;
 } Reverb;
 
 static LV2_Handle instantiate(
@@ -251,6 +256,8 @@ static void activate(LV2_Handle instance)
 	while (reverb->fpdL < 16386) reverb->fpdL = rand() * UINT32_MAX;
 	reverb->fpdR = 1.0;
 	while (reverb->fpdR < 16386) reverb->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&reverb->silence, 71843); // delay memory per channel
 }
 
 static void run(LV2_Handle instance, uint32_t sampleFrames)
@@ -262,6 +269,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = reverb->output[0];
 	float* out2 = reverb->output[1];
 
+	if (silence_skip(&reverb->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	double big = *reverb->big;
 	double wet = *reverb->wet;
 	double vibSpeed = 0.1;
@@ -346,8 +355,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleR *= wet;
 		// we're going to use this as a kind of balance since the reverb buildup can be so large
 
-		inputSampleL = sin(inputSampleL);
-		inputSampleR = sin(inputSampleR);
+		inputSampleL = fast_sin(inputSampleL);
+		inputSampleR = fast_sin(inputSampleR);
 
 		double allpassIL = inputSampleL;
 		double allpassJL = inputSampleL;
@@ -642,8 +651,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
 
-		inputSampleL = asin(inputSampleL);
-		inputSampleR = asin(inputSampleR);
+		inputSampleL = fast_asin(inputSampleL);
+		inputSampleR = fast_asin(inputSampleR);
 
 		tempSampleL = (inputSampleL * reverb->biquadC[2]) + reverb->biquadC[7];
 		reverb->biquadC[7] = (inputSampleL * reverb->biquadC[3]) - (tempSampleL * reverb->biquadC[5]) + reverb->biquadC[8];
@@ -666,12 +675,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		reverb->fpdL ^= reverb->fpdL << 13;
 		reverb->fpdL ^= reverb->fpdL >> 17;
 		reverb->fpdL ^= reverb->fpdL << 5;
-		inputSampleL += (((double) reverb->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) reverb->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		reverb->fpdR ^= reverb->fpdR << 13;
 		reverb->fpdR ^= reverb->fpdR >> 17;
 		reverb->fpdR ^= reverb->fpdR << 5;
-		inputSampleR += (((double) reverb->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) reverb->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -682,6 +691,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&reverb->silence, reverb->output[0], reverb->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
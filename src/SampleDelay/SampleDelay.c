@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define SAMPLEDELAY_URI "https://hannesbraun.net/ns/lv2/airwindows/sampledelay"
 
 typedef enum {
@@ -32,6 +35,8 @@ typedef struct {
 	double pL[16386];
 	double pR[16386];
 	int gcount;
+
+	Silence silence;
 } SampleDelay;
 
 static LV2_Handle instantiate(
@@ -90,6 +95,8 @@ static void activate(LV2_Handle instance)
 	while (sampleDelay->fpdL < 16386) sampleDelay->fpdL = rand() * UINT32_MAX;
 	sampleDelay->fpdR = 1.0;
 	while (sampleDelay->fpdR < 16386) sampleDelay->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&sampleDelay->silence, 16386); // delay memory per channel
 }
 
 static void run(LV2_Handle instance, uint32_t sampleFrames)
@@ -101,6 +108,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = sampleDelay->output[0];
 	float* out2 = sampleDelay->output[1];
 
+	if (silence_skip(&sampleDelay->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	double overallscale = 1.0;
 	overallscale /= 44100.0;
 	overallscale *= sampleDelay->sampleRate;
@@ -151,12 +160,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		sampleDelay->fpdL ^= sampleDelay->fpdL << 13;
 		sampleDelay->fpdL ^= sampleDelay->fpdL >> 17;
 		sampleDelay->fpdL ^= sampleDelay->fpdL << 5;
-		inputSampleL += (((double) sampleDelay->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) sampleDelay->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		sampleDelay->fpdR ^= sampleDelay->fpdR << 13;
 		sampleDelay->fpdR ^= sampleDelay->fpdR >> 17;
 		sampleDelay->fpdR ^= sampleDelay->fpdR << 5;
-		inputSampleR += (((double) sampleDelay->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) sampleDelay->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 		*out1 = (float) inputSampleL;
 		*out2 = (float) inputSampleR;
@@ -166,6 +175,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&sampleDelay->silence, sampleDelay->output[0], sampleDelay->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define SHORTBUSS_URI "https://hannesbraun.net/ns/lv2/airwindows/shortbuss"
 
 typedef enum {
@@ -105,12 +107,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		double drySampleR = inputSampleR;
 
 		inputSampleL += (2.0 * inputSampleL * inputSampleL) * shortBuss->sbSampleL;
-		shortBuss->sbSampleL += ((inputSampleL - sin(inputSampleL)) * sbScale);
-		shortBuss->sbSampleL = sin(shortBuss->sbSampleL * 0.015625) * 64.0;
+		shortBuss->sbSampleL += ((inputSampleL - fast_sin(inputSampleL)) * sbScale);
+		shortBuss->sbSampleL = fast_sin(shortBuss->sbSampleL * 0.015625) * 64.0;
 
 		inputSampleR += (2.0 * inputSampleR * inputSampleR) * shortBuss->sbSampleR;
-		shortBuss->sbSampleR += ((inputSampleR - sin(inputSampleR)) * sbScale);
-		shortBuss->sbSampleR = sin(shortBuss->sbSampleR * 0.015625) * 64.0;
+		shortBuss->sbSampleR += ((inputSampleR - fast_sin(inputSampleR)) * sbScale);
+		shortBuss->sbSampleR = fast_sin(shortBuss->sbSampleR * 0.015625) * 64.0;
 
 		if (wet != 1.0) {
 			inputSampleL = (inputSampleL * wet) + (drySampleL * (1.0 - wet));
@@ -123,12 +125,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		shortBuss->fpdL ^= shortBuss->fpdL << 13;
 		shortBuss->fpdL ^= shortBuss->fpdL >> 17;
 		shortBuss->fpdL ^= shortBuss->fpdL << 5;
-		inputSampleL += (((double) shortBuss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) shortBuss->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		shortBuss->fpdR ^= shortBuss->fpdR << 13;
 		shortBuss->fpdR ^= shortBuss->fpdR >> 17;
 		shortBuss->fpdR ^= shortBuss->fpdR << 5;
-		inputSampleR += (((double) shortBuss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) shortBuss->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
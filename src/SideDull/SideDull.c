@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define SIDEDULL_URI "https://hannesbraun.net/ns/lv2/airwindows/sidedull"
 
 typedef enum {
@@ -120,12 +122,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		sideDull->fpdL ^= sideDull->fpdL << 13;
 		sideDull->fpdL ^= sideDull->fpdL >> 17;
 		sideDull->fpdL ^= sideDull->fpdL << 5;
-		inputSampleL += (((double) sideDull->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) sideDull->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		sideDull->fpdR ^= sideDull->fpdR << 13;
 		sideDull->fpdR ^= sideDull->fpdR >> 17;
 		sideDull->fpdR ^= sideDull->fpdR << 5;
-		inputSampleR += (((double) sideDull->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) sideDull->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define SIDEPASS_URI "https://hannesbraun.net/ns/lv2/airwindows/sidepass"
 
 typedef enum {
@@ -119,12 +121,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		sidepass->fpdL ^= sidepass->fpdL << 13;
 		sidepass->fpdL ^= sidepass->fpdL >> 17;
 		sidepass->fpdL ^= sidepass->fpdL << 5;
-		inputSampleL += (((double) sidepass->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) sidepass->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		sidepass->fpdR ^= sidepass->fpdR << 13;
 		sidepass->fpdR ^= sidepass->fpdR >> 17;
 		sidepass->fpdR ^= sidepass->fpdR << 5;
-		inputSampleR += (((double) sidepass->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) sidepass->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define SINEW_URI "https://hannesbraun.net/ns/lv2/airwindows/sinew"
 
 typedef enum {
@@ -121,12 +123,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		sinewInstance->fpdL ^= sinewInstance->fpdL << 13;
 		sinewInstance->fpdL ^= sinewInstance->fpdL >> 17;
 		sinewInstance->fpdL ^= sinewInstance->fpdL << 5;
-		inputSampleL += (((double) sinewInstance->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) sinewInstance->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		sinewInstance->fpdR ^= sinewInstance->fpdR << 13;
 		sinewInstance->fpdR ^= sinewInstance->fpdR >> 17;
 		sinewInstance->fpdR ^= sinewInstance->fpdR << 5;
-		inputSampleR += (((double) sinewInstance->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) sinewInstance->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define SPIRAL_URI "https://hannesbraun.net/ns/lv2/airwindows/spiral"
 
 typedef enum {
@@ -77,8 +79,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = spiral->fpdR * 1.18e-17;
 
 		// clip to 1.2533141373155 to reach maximum output
-		inputSampleL = sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL));
-		inputSampleR = sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR));
+		inputSampleL = fast_sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL));
+		inputSampleR = fast_sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR));
 
 		// begin 32 bit stereo floating point dither
 		int expon;
@@ -86,12 +88,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		spiral->fpdL ^= spiral->fpdL << 13;
 		spiral->fpdL ^= spiral->fpdL >> 17;
 		spiral->fpdL ^= spiral->fpdL << 5;
-		inputSampleL += (((double) spiral->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) spiral->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		spiral->fpdR ^= spiral->fpdR << 13;
 		spiral->fpdR ^= spiral->fpdR >> 17;
 		spiral->fpdR ^= spiral->fpdR << 5;
-		inputSampleR += (((double) spiral->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) spiral->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
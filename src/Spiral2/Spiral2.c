@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define SPIRAL2_URI "https://hannesbraun.net/ns/lv2/airwindows/spiral2"
 
 typedef enum {
@@ -154,11 +156,11 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		}
 		// highpass section
 
-		double presenceSampleL = sin(inputSampleL * fabs(spiral2->prevSampleL)) / ((spiral2->prevSampleL == 0.0) ? 1 : fabs(spiral2->prevSampleL));
-		double presenceSampleR = sin(inputSampleR * fabs(spiral2->prevSampleR)) / ((spiral2->prevSampleR == 0.0) ? 1 : fabs(spiral2->prevSampleR));
+		double presenceSampleL = fast_sin(inputSampleL * fabs(spiral2->prevSampleL)) / ((spiral2->prevSampleL == 0.0) ? 1 : fabs(spiral2->prevSampleL));
+		double presenceSampleR = fast_sin(inputSampleR * fabs(spiral2->prevSampleR)) / ((spiral2->prevSampleR == 0.0) ? 1 : fabs(spiral2->prevSampleR));
 		// change from first Spiral: delay of one sample on the scaling factor.
-		inputSampleL = sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL));
-		inputSampleR = sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR));
+		inputSampleL = fast_sin(inputSampleL * fabs(inputSampleL)) / ((fabs(inputSampleL) == 0.0) ? 1 : fabs(inputSampleL));
+		inputSampleR = fast_sin(inputSampleR * fabs(inputSampleR)) / ((fabs(inputSampleR) == 0.0) ? 1 : fabs(inputSampleR));
 
 		if (output < 1.0) {
 			inputSampleL *= output;
@@ -187,12 +189,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		spiral2->fpdL ^= spiral2->fpdL << 13;
 		spiral2->fpdL ^= spiral2->fpdL >> 17;
 		spiral2->fpdL ^= spiral2->fpdL << 5;
-		inputSampleL += (((double) spiral2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) spiral2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		spiral2->fpdR ^= spiral2->fpdR << 13;
 		spiral2->fpdR ^= spiral2->fpdR >> 17;
 		spiral2->fpdR ^= spiral2->fpdR << 5;
-		inputSampleR += (((double) spiral2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) spiral2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define SRSLY2_URI "https://hannesbraun.net/ns/lv2/airwindows/srsly2"
@@ -248,8 +250,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		double drySampleL = inputSampleL;
 		double drySampleR = inputSampleR;
 
-		inputSampleL = sin(inputSampleL);
-		inputSampleR = sin(inputSampleR);
+		inputSampleL = fast_sin(inputSampleL);
+		inputSampleR = fast_sin(inputSampleR);
 		// encode Console5: good cleanness
 
 		double mid = inputSampleL + inputSampleR;
@@ -327,7 +329,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		// we crank things up more than a bit, or cut them in line with how the hardware box works
 		if (side > 1.57079633) side = 1.57079633;
 		if (side < -1.57079633) side = -1.57079633;
-		side = sin(side);
+		side = fast_sin(side);
 		side *= gainS;
 
 		inputSampleL = ((mid + side) / 2.0) + processingL;
@@ -344,8 +346,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		if (inputSampleR > 1.0) inputSampleR = 1.0;
 		if (inputSampleR < -1.0) inputSampleR = -1.0;
 		// without this, you can get a NaN condition where it spits out DC offset at full blast!
-		inputSampleL = asin(inputSampleL);
-		inputSampleR = asin(inputSampleR);
+		inputSampleL = fast_asin(inputSampleL);
+		inputSampleR = fast_asin(inputSampleR);
 		// amplitude aspect
 
 		if (wet < 1.0) {
@@ -359,12 +361,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		srsly2->fpdL ^= srsly2->fpdL << 13;
 		srsly2->fpdL ^= srsly2->fpdL >> 17;
 		srsly2->fpdL ^= srsly2->fpdL << 5;
-		inputSampleL += (((double) srsly2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) srsly2->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		srsly2->fpdR ^= srsly2->fpdR << 13;
 		srsly2->fpdR ^= srsly2->fpdR >> 17;
 		srsly2->fpdR ^= srsly2->fpdR << 5;
-		inputSampleR += (((double) srsly2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) srsly2->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
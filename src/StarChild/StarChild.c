@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define STARCHILD_URI "https://hannesbraun.net/ns/lv2/airwindows/starchild"
 
 typedef enum {
@@ -43,6 +46,8 @@ typedef struct {
 	double factor[11];
 	double wearLPrev;
 	double wearRPrev;
+
+	Silence silence;
 } StarChild;
 
 static LV2_Handle instantiate(
@@ -308,6 +313,8 @@ static void activate(LV2_Handle instance)
 	while (starchild->fpdL < 16386) starchild->fpdL = rand() * UINT32_MAX;
 	starchild->fpdR = 1.0;
 	while (starchild->fpdR < 16386) starchild->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&starchild->silence, 45102); // delay memory per channel
 }
 
 static void run(LV2_Handle instance, uint32_t sampleFrames)
@@ -319,6 +326,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = starchild->output[0];
 	float* out2 = starchild->output[1];
 
+	if (silence_skip(&starchild->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	double drySampleL;
 	double drySampleR;
 	double inputSampleL;
@@ -1063,12 +1072,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		starchild->fpdL ^= starchild->fpdL << 13;
 		starchild->fpdL ^= starchild->fpdL >> 17;
 		starchild->fpdL ^= starchild->fpdL << 5;
-		inputSampleL += (((double) starchild->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) starchild->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		starchild->fpdR ^= starchild->fpdR << 13;
 		starchild->fpdR ^= starchild->fpdR >> 17;
 		starchild->fpdR ^= starchild->fpdR << 5;
-		inputSampleR += (((double) starchild->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) starchild->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -1079,6 +1088,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&starchild->silence, starchild->output[0], starchild->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
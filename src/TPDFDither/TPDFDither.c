@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/dispatch.h"
+
 #define TPDFDITHER_URI "https://hannesbraun.net/ns/lv2/airwindows/tpdfdither"
 
 typedef enum {
@@ -71,7 +73,7 @@ static void activate(LV2_Handle instance)
 	while (tpdfDither->fpdR < 16386) tpdfDither->fpdR = rand() * UINT32_MAX;
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+CPU_DISPATCH static void run(LV2_Handle instance, uint32_t sampleFrames)
 {
 	TPDFDither* tpdfDither = (TPDFDither*) instance;
 
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define TOTAPE5_URI "https://hannesbraun.net/ns/lv2/airwindows/totape5"
 
 typedef enum {
@@ -456,13 +458,13 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		bridgerectifierL = fabs(inputSampleL);
 		if (bridgerectifierL > 1.57079633) bridgerectifierL = 1.57079633;
-		bridgerectifierL = sin(bridgerectifierL);
+		bridgerectifierL = fast_sin(bridgerectifierL);
 		if (inputSampleL > 0) inputSampleL = bridgerectifierL;
 		if (inputSampleL < 0) inputSampleL = -bridgerectifierL;
 
 		bridgerectifierR = fabs(inputSampleR);
 		if (bridgerectifierR > 1.57079633) bridgerectifierR = 1.57079633;
-		bridgerectifierR = sin(bridgerectifierR);
+		bridgerectifierR = fast_sin(bridgerectifierR);
 		if (inputSampleR > 0) inputSampleR = bridgerectifierR;
 		if (inputSampleR < 0) inputSampleR = -bridgerectifierR;
 		// drive section: the tape sound includes a very gentle saturation curve, which is always an attenuation.
@@ -689,12 +691,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		toTape5->fpdL ^= toTape5->fpdL << 13;
 		toTape5->fpdL ^= toTape5->fpdL >> 17;
 		toTape5->fpdL ^= toTape5->fpdL << 5;
-		inputSampleL += (((double) toTape5->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) toTape5->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		toTape5->fpdR ^= toTape5->fpdR << 13;
 		toTape5->fpdR ^= toTape5->fpdR >> 17;
 		toTape5->fpdR ^= toTape5->fpdR << 5;
-		inputSampleR += (((double) toTape5->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) toTape5->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,10 +4,16 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include "../common/fastmath.h"
+#include "../common/fused.h"
+#include "../common/lanes.h"
 
 #define M_PI 3.14159265358979323846264338327950288
 
 #define TOTAPE6_URI "https://hannesbraun.net/ns/lv2/airwindows/totape6"
+#define TOTAPE6MONO_URI "https://hannesbraun.net/ns/lv2/airwindows/totape6mono"
 
 typedef enum {
 	INPUT_L = 0,
@@ -33,38 +39,25 @@ typedef struct {
 	const float* outputGain;
 	const float* dryWet;
 
-	double dL[502];
-	double dR[502];
+	double d[2][502];
 	int gcount;
 	double rateof;
 	double sweep;
 	double nextmax;
 
-	double iirMidRollerAL;
-	double iirMidRollerBL;
-	double iirHeadBumpAL;
-	double iirHeadBumpBL;
-
-	double iirMidRollerAR;
-	double iirMidRollerBR;
-	double iirHeadBumpAR;
-	double iirHeadBumpBR;
-	double biquadAL[9];
-	double biquadBL[9];
-	double biquadCL[9];
-	double biquadDL[9];
-
-	double biquadAR[9];
-	double biquadBR[9];
-	double biquadCR[9];
-	double biquadDR[9];
+	double iirMidRollerA[2];
+	double iirMidRollerB[2];
+	double iirHeadBumpA[2];
+	double iirHeadBumpB[2];
+	double biquadA[11]; // the coefficients, then the two states of each channel
+	double biquadB[11];
+	double biquadC[11];
+	double biquadD[11];
 	bool flip;
 
-	double lastSampleL;
-	double lastSampleR;
+	double lastSample[2];
 
-	uint32_t fpdL;
-	uint32_t fpdR;
+	uint32_t fpd[2];
 } ToTape6;
 
 static LV2_Handle instantiate(
@@ -116,59 +109,62 @@ static void connect_port(LV2_Handle instance, uint32_t port, void* data)
 	}
 }
 
+// The mono variant has one input and one output, its controls follow at 2
+static void connect_port_mono(LV2_Handle instance, uint32_t port, void* data)
+{
+	ToTape6* toTape6 = (ToTape6*) instance;
+
+	if (port == 0) {
+		toTape6->input[0] = (const float*) data;
+	} else if (port == 1) {
+		toTape6->output[0] = (float*) data;
+	} else {
+		connect_port(instance, port + 2, data);
+	}
+}
+
 static void activate(LV2_Handle instance)
 {
 	ToTape6* toTape6 = (ToTape6*) instance;
 
-	toTape6->iirMidRollerAL = 0.0;
-	toTape6->iirMidRollerBL = 0.0;
-	toTape6->iirHeadBumpAL = 0.0;
-	toTape6->iirHeadBumpBL = 0.0;
-
-	toTape6->iirMidRollerAR = 0.0;
-	toTape6->iirMidRollerBR = 0.0;
-	toTape6->iirHeadBumpAR = 0.0;
-	toTape6->iirHeadBumpBR = 0.0;
-
-	for (int x = 0; x < 9; x++) {
-		toTape6->biquadAL[x] = 0.0;
-		toTape6->biquadBL[x] = 0.0;
-		toTape6->biquadCL[x] = 0.0;
-		toTape6->biquadDL[x] = 0.0;
-		toTape6->biquadAR[x] = 0.0;
-		toTape6->biquadBR[x] = 0.0;
-		toTape6->biquadCR[x] = 0.0;
-		toTape6->biquadDR[x] = 0.0;
+	for (int c = 0; c < 2; c++) {
+		toTape6->iirMidRollerA[c] = 0.0;
+		toTape6->iirMidRollerB[c] = 0.0;
+		toTape6->iirHeadBumpA[c] = 0.0;
+		toTape6->iirHeadBumpB[c] = 0.0;
+	}
+
+	for (int x = 0; x < 11; x++) {
+		toTape6->biquadA[x] = 0.0;
+		toTape6->biquadB[x] = 0.0;
+		toTape6->biquadC[x] = 0.0;
+		toTape6->biquadD[x] = 0.0;
 	}
 	toTape6->flip = false;
 	for (int temp = 0; temp < 501; temp++) {
-		toTape6->dL[temp] = 0.0;
-		toTape6->dR[temp] = 0.0;
+		toTape6->d[0][temp] = 0.0;
+		toTape6->d[1][temp] = 0.0;
 	}
 
 	toTape6->gcount = 0;
 	toTape6->rateof = 0.5;
 	toTape6->sweep = M_PI;
 	toTape6->nextmax = 0.5;
-	toTape6->lastSampleL = 0.0;
-	toTape6->lastSampleR = 0.0;
+	toTape6->lastSample[0] = 0.0;
+	toTape6->lastSample[1] = 0.0;
 	toTape6->flip = 0;
 
-	toTape6->fpdL = 1.0;
-	while (toTape6->fpdL < 16386) toTape6->fpdL = rand() * UINT32_MAX;
-	toTape6->fpdR = 1.0;
-	while (toTape6->fpdR < 16386) toTape6->fpdR = rand() * UINT32_MAX;
+	for (int c = 0; c < 2; c++) {
+		toTape6->fpd[c] = 1.0;
+		while (toTape6->fpd[c] < 16386) toTape6->fpd[c] = rand() * UINT32_MAX;
+	}
 }
 
-static void run(LV2_Handle instance, uint32_t sampleFrames)
+// Processes the first `channels` inputs into the outputs, or the samples in
+// place for process(). The flutter and the flip are shared, the flutter takes
+// its randomness from the first channel.
+static inline void run_channels(ToTape6* toTape6, uint32_t sampleFrames, const int channels, double* const* samples, const bool dither)
 {
-	ToTape6* toTape6 = (ToTape6*) instance;
-
-	const float* in1 = toTape6->input[0];
-	const float* in2 = toTape6->input[1];
-	float* out1 = toTape6->output[0];
-	float* out2 = toTape6->output[1];
-
 	double overallscale = 1.0;
 	overallscale /= 44100.0;
 	overallscale *= toTape6->sampleRate;
@@ -180,59 +176,30 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	double HeadBumpFreq = 0.12 / overallscale;
 	//[0] is frequency: 0.000001 to 0.499999 is near-zero to near-Nyquist
 	//[1] is resonance, 0.7071 is Butterworth. Also can't be zero
-	toTape6->biquadAL[0] = 0.007 / overallscale;
-	toTape6->biquadBL[0] = 0.007 / overallscale;
-	toTape6->biquadAR[0] = 0.007 / overallscale;
-	toTape6->biquadBR[0] = 0.007 / overallscale;
-	toTape6->biquadAL[1] = 0.0009;
-	toTape6->biquadBL[1] = 0.0009;
-	toTape6->biquadAR[1] = 0.0009;
-	toTape6->biquadBR[1] = 0.0009;
-	double K = tan(M_PI * toTape6->biquadBR[0]);
-	double norm = 1.0 / (1.0 + K / toTape6->biquadBR[1] + K * K);
-	toTape6->biquadAL[2] = K / toTape6->biquadBR[1] * norm;
-	toTape6->biquadBL[2] = toTape6->biquadAL[2];
-	toTape6->biquadAR[2] = toTape6->biquadAL[2];
-	toTape6->biquadBR[2] = toTape6->biquadAL[2];
-	toTape6->biquadAL[4] = -toTape6->biquadBR[2];
-	toTape6->biquadBL[4] = -toTape6->biquadBR[2];
-	toTape6->biquadAR[4] = -toTape6->biquadBR[2];
-	toTape6->biquadBR[4] = -toTape6->biquadBR[2];
-	toTape6->biquadAL[5] = 2.0 * (K * K - 1.0) * norm;
-	toTape6->biquadBL[5] = toTape6->biquadAL[5];
-	toTape6->biquadAR[5] = toTape6->biquadAL[5];
-	toTape6->biquadBR[5] = toTape6->biquadAL[5];
-	toTape6->biquadAL[6] = (1.0 - K / toTape6->biquadBR[1] + K * K) * norm;
-	toTape6->biquadBL[6] = toTape6->biquadAL[6];
-	toTape6->biquadAR[6] = toTape6->biquadAL[6];
-	toTape6->biquadBR[6] = toTape6->biquadAL[6];
-
-	toTape6->biquadCL[0] = 0.032 / overallscale;
-	toTape6->biquadDL[0] = 0.032 / overallscale;
-	toTape6->biquadCR[0] = 0.032 / overallscale;
-	toTape6->biquadDR[0] = 0.032 / overallscale;
-	toTape6->biquadCL[1] = 0.0007;
-	toTape6->biquadDL[1] = 0.0007;
-	toTape6->biquadCR[1] = 0.0007;
-	toTape6->biquadDR[1] = 0.0007;
-	K = tan(M_PI * toTape6->biquadDR[0]);
-	norm = 1.0 / (1.0 + K / toTape6->biquadDR[1] + K * K);
-	toTape6->biquadCL[2] = K / toTape6->biquadDR[1] * norm;
-	toTape6->biquadDL[2] = toTape6->biquadCL[2];
-	toTape6->biquadCR[2] = toTape6->biquadCL[2];
-	toTape6->biquadDR[2] = toTape6->biquadCL[2];
-	toTape6->biquadCL[4] = -toTape6->biquadDR[2];
-	toTape6->biquadDL[4] = -toTape6->biquadDR[2];
-	toTape6->biquadCR[4] = -toTape6->biquadDR[2];
-	toTape6->biquadDR[4] = -toTape6->biquadDR[2];
-	toTape6->biquadCL[5] = 2.0 * (K * K - 1.0) * norm;
-	toTape6->biquadDL[5] = toTape6->biquadCL[5];
-	toTape6->biquadCR[5] = toTape6->biquadCL[5];
-	toTape6->biquadDR[5] = toTape6->biquadCL[5];
-	toTape6->biquadCL[6] = (1.0 - K / toTape6->biquadDR[1] + K * K) * norm;
-	toTape6->biquadDL[6] = toTape6->biquadCL[6];
-	toTape6->biquadCR[6] = toTape6->biquadCL[6];
-	toTape6->biquadDR[6] = toTape6->biquadCL[6];
+	double* biquadA = toTape6->biquadA;
+	biquadA[0] = 0.007 / overallscale;
+	biquadA[1] = 0.0009;
+	double K = tan(M_PI * biquadA[0]);
+	double norm = 1.0 / (1.0 + K / biquadA[1] + K * K);
+	biquadA[2] = K / biquadA[1] * norm;
+	biquadA[4] = -biquadA[2];
+	biquadA[5] = 2.0 * (K * K - 1.0) * norm;
+	biquadA[6] = (1.0 - K / biquadA[1] + K * K) * norm;
+
+	double* biquadC = toTape6->biquadC;
+	biquadC[0] = 0.032 / overallscale;
+	biquadC[1] = 0.0007;
+	K = tan(M_PI * biquadC[0]);
+	norm = 1.0 / (1.0 + K / biquadC[1] + K * K);
+	biquadC[2] = K / biquadC[1] * norm;
+	biquadC[4] = -biquadC[2];
+	biquadC[5] = 2.0 * (K * K - 1.0) * norm;
+	biquadC[6] = (1.0 - K / biquadC[1] + K * K) * norm;
+
+	for (int x = 0; x < 7; x++) {
+		toTape6->biquadB[x] = biquadA[x];
+		toTape6->biquadD[x] = biquadC[x];
+	} // B and D use the same coefficients
 
 	const float flutter = *toTape6->flutter;
 	double depth = pow(flutter, 2) * overallscale * 70;
@@ -244,36 +211,39 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 	double wet = *toTape6->dryWet;
 
-	while (sampleFrames-- > 0) {
-		double inputSampleL = *in1;
-		double inputSampleR = *in2;
-		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = toTape6->fpdL * 1.18e-17;
-		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = toTape6->fpdR * 1.18e-17;
-		double drySampleL = inputSampleL;
-		double drySampleR = inputSampleR;
+	double inputSample[2];
+	double drySample[2];
+	double vibDrySample[2];
+	double HighsSample[2];
+	double groundSample[2];
+
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		for (int c = 0; c < channels; c++) {
+			inputSample[c] = samples ? samples[c][i] : toTape6->input[c][i];
+			if (fabs(inputSample[c]) < 1.18e-23) inputSample[c] = toTape6->fpd[c] * 1.18e-17;
+			drySample[c] = inputSample[c];
+		}
 
 		if (inputgain < 1.0) {
-			inputSampleL *= inputgain;
-			inputSampleR *= inputgain;
+			for (int c = 0; c < channels; c++) inputSample[c] *= inputgain;
 		} // gain cut before plugin
 
-		double flutterrandy = (double) toTape6->fpdL / UINT32_MAX;
+		double flutterrandy = (double) toTape6->fpd[0] / UINT32_MAX;
 		// now we've got a random flutter, so we're messing with the pitch before tape effects go on
 		if (toTape6->gcount < 0 || toTape6->gcount > 499) {
 			toTape6->gcount = 499;
 		}
-		toTape6->dL[toTape6->gcount] = inputSampleL;
-		toTape6->dR[toTape6->gcount] = inputSampleR;
+		for (int c = 0; c < channels; c++) toTape6->d[c][toTape6->gcount] = inputSample[c];
 		int count = toTape6->gcount;
 		if (depth != 0.0) {
 
 			double offset = depth + (depth * pow(toTape6->rateof, 2) * sin(toTape6->sweep));
 
 			count += (int) floor(offset);
-			inputSampleL = (toTape6->dL[count - ((count > 499) ? 500 : 0)] * (1 - (offset - floor(offset))));
-			inputSampleR = (toTape6->dR[count - ((count > 499) ? 500 : 0)] * (1 - (offset - floor(offset))));
-			inputSampleL += (toTape6->dL[count + 1 - ((count + 1 > 499) ? 500 : 0)] * (offset - floor(offset)));
-			inputSampleR += (toTape6->dR[count + 1 - ((count + 1 > 499) ? 500 : 0)] * (offset - floor(offset)));
+			for (int c = 0; c < channels; c++) {
+				inputSample[c] = (toTape6->d[c][count - ((count > 499) ? 500 : 0)] * (1 - (offset - floor(offset))));
+				inputSample[c] += (toTape6->d[c][count + 1 - ((count + 1 > 499) ? 500 : 0)] * (offset - floor(offset)));
+			}
 
 			toTape6->rateof = (toTape6->rateof * (1.0 - fluttertrim)) + (toTape6->nextmax * fluttertrim);
 			toTape6->sweep += toTape6->rateof * fluttertrim;
@@ -286,250 +256,178 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		}
 		toTape6->gcount--;
 
-		double vibDrySampleL = inputSampleL;
-		double vibDrySampleR = inputSampleR;
-		double HighsSampleL = 0.0;
-		double HighsSampleR = 0.0;
-		double NonHighsSampleL = 0.0;
-		double NonHighsSampleR = 0.0;
-		double tempSample;
-
 		if (toTape6->flip) {
-			toTape6->iirMidRollerAL = (toTape6->iirMidRollerAL * (1.0 - RollAmount)) + (inputSampleL * RollAmount);
-			toTape6->iirMidRollerAR = (toTape6->iirMidRollerAR * (1.0 - RollAmount)) + (inputSampleR * RollAmount);
-			HighsSampleL = inputSampleL - toTape6->iirMidRollerAL;
-			HighsSampleR = inputSampleR - toTape6->iirMidRollerAR;
-			NonHighsSampleL = toTape6->iirMidRollerAL;
-			NonHighsSampleR = toTape6->iirMidRollerAR;
-
-			toTape6->iirHeadBumpAL += (inputSampleL * 0.05);
-			toTape6->iirHeadBumpAR += (inputSampleR * 0.05);
-			toTape6->iirHeadBumpAL -= (toTape6->iirHeadBumpAL * toTape6->iirHeadBumpAL * toTape6->iirHeadBumpAL * HeadBumpFreq);
-			toTape6->iirHeadBumpAR -= (toTape6->iirHeadBumpAR * toTape6->iirHeadBumpAR * toTape6->iirHeadBumpAR * HeadBumpFreq);
-			toTape6->iirHeadBumpAL = sin(toTape6->iirHeadBumpAL);
-			toTape6->iirHeadBumpAR = sin(toTape6->iirHeadBumpAR);
-
-			tempSample = (toTape6->iirHeadBumpAL * toTape6->biquadAL[2]) + toTape6->biquadAL[7];
-			toTape6->biquadAL[7] = (toTape6->iirHeadBumpAL * toTape6->biquadAL[3]) - (tempSample * toTape6->biquadAL[5]) + toTape6->biquadAL[8];
-			toTape6->biquadAL[8] = (toTape6->iirHeadBumpAL * toTape6->biquadAL[4]) - (tempSample * toTape6->biquadAL[6]);
-			toTape6->iirHeadBumpAL = tempSample; // interleaved biquad
-			if (toTape6->iirHeadBumpAL > 1.0) toTape6->iirHeadBumpAL = 1.0;
-			if (toTape6->iirHeadBumpAL < -1.0) toTape6->iirHeadBumpAL = -1.0;
-			toTape6->iirHeadBumpAL = asin(toTape6->iirHeadBumpAL);
-
-			tempSample = (toTape6->iirHeadBumpAR * toTape6->biquadAR[2]) + toTape6->biquadAR[7];
-			toTape6->biquadAR[7] = (toTape6->iirHeadBumpAR * toTape6->biquadAR[3]) - (tempSample * toTape6->biquadAR[5]) + toTape6->biquadAR[8];
-			toTape6->biquadAR[8] = (toTape6->iirHeadBumpAR * toTape6->biquadAR[4]) - (tempSample * toTape6->biquadAR[6]);
-			toTape6->iirHeadBumpAR = tempSample; // interleaved biquad
-			if (toTape6->iirHeadBumpAR > 1.0) toTape6->iirHeadBumpAR = 1.0;
-			if (toTape6->iirHeadBumpAR < -1.0) toTape6->iirHeadBumpAR = -1.0;
-			toTape6->iirHeadBumpAR = asin(toTape6->iirHeadBumpAR);
-
-			inputSampleL = sin(inputSampleL);
-			tempSample = (inputSampleL * toTape6->biquadCL[2]) + toTape6->biquadCL[7];
-			toTape6->biquadCL[7] = (inputSampleL * toTape6->biquadCL[3]) - (tempSample * toTape6->biquadCL[5]) + toTape6->biquadCL[8];
-			toTape6->biquadCL[8] = (inputSampleL * toTape6->biquadCL[4]) - (tempSample * toTape6->biquadCL[6]);
-			inputSampleL = tempSample; // interleaved biquad
-			if (inputSampleL > 1.0) inputSampleL = 1.0;
-			if (inputSampleL < -1.0) inputSampleL = -1.0;
-			inputSampleL = asin(inputSampleL);
-
-			inputSampleR = sin(inputSampleR);
-			tempSample = (inputSampleR * toTape6->biquadCR[2]) + toTape6->biquadCR[7];
-			toTape6->biquadCR[7] = (inputSampleR * toTape6->biquadCR[3]) - (tempSample * toTape6->biquadCR[5]) + toTape6->biquadCR[8];
-			toTape6->biquadCR[8] = (inputSampleR * toTape6->biquadCR[4]) - (tempSample * toTape6->biquadCR[6]);
-			inputSampleR = tempSample; // interleaved biquad
-			if (inputSampleR > 1.0) inputSampleR = 1.0;
-			if (inputSampleR < -1.0) inputSampleR = -1.0;
-			inputSampleR = asin(inputSampleR);
+			LANES_UNROLL
+			for (int c = 0; c < channels; c++) {
+				vibDrySample[c] = inputSample[c];
+				toTape6->iirMidRollerA[c] = (toTape6->iirMidRollerA[c] * (1.0 - RollAmount)) + (inputSample[c] * RollAmount);
+				HighsSample[c] = inputSample[c] - toTape6->iirMidRollerA[c];
+
+				toTape6->iirHeadBumpA[c] += (inputSample[c] * 0.05);
+				toTape6->iirHeadBumpA[c] -= (toTape6->iirHeadBumpA[c] * toTape6->iirHeadBumpA[c] * toTape6->iirHeadBumpA[c] * HeadBumpFreq);
+				toTape6->iirHeadBumpA[c] = fast_sin(toTape6->iirHeadBumpA[c]);
+			}
+
+			LANES_UNROLL
+			for (int c = 0; c < channels; c++) {
+				double* state = biquadA + 7 + 2 * c;
+				double tempSample = (toTape6->iirHeadBumpA[c] * biquadA[2]) + state[0];
+				state[0] = (toTape6->iirHeadBumpA[c] * biquadA[3]) - (tempSample * biquadA[5]) + state[1];
+				state[1] = (toTape6->iirHeadBumpA[c] * biquadA[4]) - (tempSample * biquadA[6]);
+				toTape6->iirHeadBumpA[c] = tempSample; // interleaved biquad
+				if (toTape6->iirHeadBumpA[c] > 1.0) toTape6->iirHeadBumpA[c] = 1.0;
+				if (toTape6->iirHeadBumpA[c] < -1.0) toTape6->iirHeadBumpA[c] = -1.0;
+				toTape6->iirHeadBumpA[c] = fast_asin(toTape6->iirHeadBumpA[c]);
+			}
+
+			LANES_UNROLL
+			for (int c = 0; c < channels; c++) {
+				double* state = biquadC + 7 + 2 * c;
+				inputSample[c] = fast_sin(inputSample[c]);
+				double tempSample = (inputSample[c] * biquadC[2]) + state[0];
+				state[0] = (inputSample[c] * biquadC[3]) - (tempSample * biquadC[5]) + state[1];
+				state[1] = (inputSample[c] * biquadC[4]) - (tempSample * biquadC[6]);
+				inputSample[c] = tempSample; // interleaved biquad
+				if (inputSample[c] > 1.0) inputSample[c] = 1.0;
+				if (inputSample[c] < -1.0) inputSample[c] = -1.0;
+				inputSample[c] = fast_asin(inputSample[c]);
+			}
 		} else {
-			toTape6->iirMidRollerBL = (toTape6->iirMidRollerBL * (1.0 - RollAmount)) + (inputSampleL * RollAmount);
-			toTape6->iirMidRollerBR = (toTape6->iirMidRollerBR * (1.0 - RollAmount)) + (inputSampleR * RollAmount);
-			HighsSampleL = inputSampleL - toTape6->iirMidRollerBL;
-			HighsSampleR = inputSampleR - toTape6->iirMidRollerBR;
-			NonHighsSampleL = toTape6->iirMidRollerBL;
-			NonHighsSampleR = toTape6->iirMidRollerBR;
-
-			toTape6->iirHeadBumpBL += (inputSampleL * 0.05);
-			toTape6->iirHeadBumpBR += (inputSampleR * 0.05);
-			toTape6->iirHeadBumpBL -= (toTape6->iirHeadBumpBL * toTape6->iirHeadBumpBL * toTape6->iirHeadBumpBL * HeadBumpFreq);
-			toTape6->iirHeadBumpBR -= (toTape6->iirHeadBumpBR * toTape6->iirHeadBumpBR * toTape6->iirHeadBumpBR * HeadBumpFreq);
-			toTape6->iirHeadBumpBL = sin(toTape6->iirHeadBumpBL);
-			toTape6->iirHeadBumpBR = sin(toTape6->iirHeadBumpBR);
-
-			tempSample = (toTape6->iirHeadBumpBL * toTape6->biquadBL[2]) + toTape6->biquadBL[7];
-			toTape6->biquadBL[7] = (toTape6->iirHeadBumpBL * toTape6->biquadBL[3]) - (tempSample * toTape6->biquadBL[5]) + toTape6->biquadBL[8];
-			toTape6->biquadBL[8] = (toTape6->iirHeadBumpBL * toTape6->biquadBL[4]) - (tempSample * toTape6->biquadBL[6]);
-			toTape6->iirHeadBumpBL = tempSample; // interleaved biquad
-			if (toTape6->iirHeadBumpBL > 1.0) toTape6->iirHeadBumpBL = 1.0;
-			if (toTape6->iirHeadBumpBL < -1.0) toTape6->iirHeadBumpBL = -1.0;
-			toTape6->iirHeadBumpBL = asin(toTape6->iirHeadBumpBL);
-
-			tempSample = (toTape6->iirHeadBumpBR * toTape6->biquadBR[2]) + toTape6->biquadBR[7];
-			toTape6->biquadBR[7] = (toTape6->iirHeadBumpBR * toTape6->biquadBR[3]) - (tempSample * toTape6->biquadBR[5]) + toTape6->biquadBR[8];
-			toTape6->biquadBR[8] = (toTape6->iirHeadBumpBR * toTape6->biquadBR[4]) - (tempSample * toTape6->biquadBR[6]);
-			toTape6->iirHeadBumpBR = tempSample; // interleaved biquad
-			if (toTape6->iirHeadBumpBR > 1.0) toTape6->iirHeadBumpBR = 1.0;
-			if (toTape6->iirHeadBumpBR < -1.0) toTape6->iirHeadBumpBR = -1.0;
-			toTape6->iirHeadBumpBR = asin(toTape6->iirHeadBumpBR);
-
-			inputSampleL = sin(inputSampleL);
-			tempSample = (inputSampleL * toTape6->biquadDL[2]) + toTape6->biquadDL[7];
-			toTape6->biquadDL[7] = (inputSampleL * toTape6->biquadDL[3]) - (tempSample * toTape6->biquadDL[5]) + toTape6->biquadDL[8];
-			toTape6->biquadDL[8] = (inputSampleL * toTape6->biquadDL[4]) - (tempSample * toTape6->biquadDL[6]);
-			inputSampleL = tempSample; // interleaved biquad
-			if (inputSampleL > 1.0) inputSampleL = 1.0;
-			if (inputSampleL < -1.0) inputSampleL = -1.0;
-			inputSampleL = asin(inputSampleL);
-
-			inputSampleR = sin(inputSampleR);
-			tempSample = (inputSampleR * toTape6->biquadDR[2]) + toTape6->biquadDR[7];
-			toTape6->biquadDR[7] = (inputSampleR * toTape6->biquadDR[3]) - (tempSample * toTape6->biquadDR[5]) + toTape6->biquadDR[8];
-			toTape6->biquadDR[8] = (inputSampleR * toTape6->biquadDR[4]) - (tempSample * toTape6->biquadDR[6]);
-			inputSampleR = tempSample; // interleaved biquad
-			if (inputSampleR > 1.0) inputSampleR = 1.0;
-			if (inputSampleR < -1.0) inputSampleR = -1.0;
-			inputSampleR = asin(inputSampleR);
+			double* biquadB = toTape6->biquadB;
+			double* biquadD = toTape6->biquadD;
+			LANES_UNROLL
+			for (int c = 0; c < channels; c++) {
+				vibDrySample[c] = inputSample[c];
+				toTape6->iirMidRollerB[c] = (toTape6->iirMidRollerB[c] * (1.0 - RollAmount)) + (inputSample[c] * RollAmount);
+				HighsSample[c] = inputSample[c] - toTape6->iirMidRollerB[c];
+
+				toTape6->iirHeadBumpB[c] += (inputSample[c] * 0.05);
+				toTape6->iirHeadBumpB[c] -= (toTape6->iirHeadBumpB[c] * toTape6->iirHeadBumpB[c] * toTape6->iirHeadBumpB[c] * HeadBumpFreq);
+				toTape6->iirHeadBumpB[c] = fast_sin(toTape6->iirHeadBumpB[c]);
+			}
+
+			LANES_UNROLL
+			for (int c = 0; c < channels; c++) {
+				double* state = biquadB + 7 + 2 * c;
+				double tempSample = (toTape6->iirHeadBumpB[c] * biquadB[2]) + state[0];
+				state[0] = (toTape6->iirHeadBumpB[c] * biquadB[3]) - (tempSample * biquadB[5]) + state[1];
+				state[1] = (toTape6->iirHeadBumpB[c] * biquadB[4]) - (tempSample * biquadB[6]);
+				toTape6->iirHeadBumpB[c] = tempSample; // interleaved biquad
+				if (toTape6->iirHeadBumpB[c] > 1.0) toTape6->iirHeadBumpB[c] = 1.0;
+				if (toTape6->iirHeadBumpB[c] < -1.0) toTape6->iirHeadBumpB[c] = -1.0;
+				toTape6->iirHeadBumpB[c] = fast_asin(toTape6->iirHeadBumpB[c]);
+			}
+
+			LANES_UNROLL
+			for (int c = 0; c < channels; c++) {
+				double* state = biquadD + 7 + 2 * c;
+				inputSample[c] = fast_sin(inputSample[c]);
+				double tempSample = (inputSample[c] * biquadD[2]) + state[0];
+				state[0] = (inputSample[c] * biquadD[3]) - (tempSample * biquadD[5]) + state[1];
+				state[1] = (inputSample[c] * biquadD[4]) - (tempSample * biquadD[6]);
+				inputSample[c] = tempSample; // interleaved biquad
+				if (inputSample[c] > 1.0) inputSample[c] = 1.0;
+				if (inputSample[c] < -1.0) inputSample[c] = -1.0;
+				inputSample[c] = fast_asin(inputSample[c]);
+			}
 		}
 		toTape6->flip = !toTape6->flip;
 
-		double groundSampleL = vibDrySampleL - inputSampleL; // set up UnBox on fluttered audio
-		double groundSampleR = vibDrySampleR - inputSampleR; // set up UnBox on fluttered audio
+		LANES_UNROLL
+		for (int c = 0; c < channels; c++) {
+			groundSample[c] = vibDrySample[c] - inputSample[c]; // set up UnBox on fluttered audio
 
-		if (inputgain > 1.0) {
-			inputSampleL *= inputgain;
-			inputSampleR *= inputgain;
-		}
+			if (inputgain > 1.0) inputSample[c] *= inputgain;
 
-		double applySoften = fabs(HighsSampleL) * 1.57079633;
-		if (applySoften > 1.57079633) applySoften = 1.57079633;
-		applySoften = 1 - cos(applySoften);
-		if (HighsSampleL > 0) inputSampleL -= applySoften;
-		if (HighsSampleL < 0) inputSampleL += applySoften;
-		// apply Soften depending on polarity
-		applySoften = fabs(HighsSampleR) * 1.57079633;
-		if (applySoften > 1.57079633) applySoften = 1.57079633;
-		applySoften = 1 - cos(applySoften);
-		if (HighsSampleR > 0) inputSampleR -= applySoften;
-		if (HighsSampleR < 0) inputSampleR += applySoften;
-		// apply Soften depending on polarity
-
-		double suppress = (1.0 - fabs(inputSampleL)) * 0.00013;
-		if (toTape6->iirHeadBumpAL > suppress) toTape6->iirHeadBumpAL -= suppress;
-		if (toTape6->iirHeadBumpAL < -suppress) toTape6->iirHeadBumpAL += suppress;
-		if (toTape6->iirHeadBumpBL > suppress) toTape6->iirHeadBumpBL -= suppress;
-		if (toTape6->iirHeadBumpBL < -suppress) toTape6->iirHeadBumpBL += suppress;
-		// restrain resonant quality of head bump algorithm
-		suppress = (1.0 - fabs(inputSampleR)) * 0.00013;
-		if (toTape6->iirHeadBumpAR > suppress) toTape6->iirHeadBumpAR -= suppress;
-		if (toTape6->iirHeadBumpAR < -suppress) toTape6->iirHeadBumpAR += suppress;
-		if (toTape6->iirHeadBumpBR > suppress) toTape6->iirHeadBumpBR -= suppress;
-		if (toTape6->iirHeadBumpBR < -suppress) toTape6->iirHeadBumpBR += suppress;
-		// restrain resonant quality of head bump algorithm
-
-		inputSampleL += ((toTape6->iirHeadBumpAL + toTape6->iirHeadBumpBL) * HeadBumpControl);
-		inputSampleR += ((toTape6->iirHeadBumpAR + toTape6->iirHeadBumpBR) * HeadBumpControl);
-		// apply Fatten.
-
-		if (inputSampleL > 1.0) inputSampleL = 1.0;
-		if (inputSampleL < -1.0) inputSampleL = -1.0;
-		double mojo;
-		mojo = pow(fabs(inputSampleL), 0.25);
-		if (mojo > 0.0) inputSampleL = (sin(inputSampleL * mojo * M_PI * 0.5) / mojo);
-		// mojo is the one that flattens WAAAAY out very softly before wavefolding
-
-		if (inputSampleR > 1.0) inputSampleR = 1.0;
-		if (inputSampleR < -1.0) inputSampleR = -1.0;
-		mojo = pow(fabs(inputSampleR), 0.25);
-		if (mojo > 0.0) inputSampleR = (sin(inputSampleR * mojo * M_PI * 0.5) / mojo);
-		// mojo is the one that flattens WAAAAY out very softly before wavefolding
-
-		inputSampleL += groundSampleL; // apply UnBox processing
-		inputSampleR += groundSampleR; // apply UnBox processing
-
-		if (outputgain != 1.0) {
-			inputSampleL *= outputgain;
-			inputSampleR *= outputgain;
+			double applySoften = fabs(HighsSample[c]) * 1.57079633;
+			if (applySoften > 1.57079633) applySoften = 1.57079633;
+			applySoften = 1 - cos(applySoften);
+			if (HighsSample[c] > 0) inputSample[c] -= applySoften;
+			if (HighsSample[c] < 0) inputSample[c] += applySoften;
+			// apply Soften depending on polarity
 		}
 
-		if (toTape6->lastSampleL >= refclip) {
-			if (inputSampleL < refclip) toTape6->lastSampleL = ((refclip * softness) + (inputSampleL * (1.0 - softness)));
-			else toTape6->lastSampleL = refclip;
+		LANES_UNROLL
+		for (int c = 0; c < channels; c++) {
+			double suppress = (1.0 - fabs(inputSample[c])) * 0.00013;
+			if (toTape6->iirHeadBumpA[c] > suppress) toTape6->iirHeadBumpA[c] -= suppress;
+			if (toTape6->iirHeadBumpA[c] < -suppress) toTape6->iirHeadBumpA[c] += suppress;
+			if (toTape6->iirHeadBumpB[c] > suppress) toTape6->iirHeadBumpB[c] -= suppress;
+			if (toTape6->iirHeadBumpB[c] < -suppress) toTape6->iirHeadBumpB[c] += suppress;
+			// restrain resonant quality of head bump algorithm
+
+			inputSample[c] += ((toTape6->iirHeadBumpA[c] + toTape6->iirHeadBumpB[c]) * HeadBumpControl);
+			// apply Fatten.
+
+			if (inputSample[c] > 1.0) inputSample[c] = 1.0;
+			if (inputSample[c] < -1.0) inputSample[c] = -1.0;
+			double mojo = pow(fabs(inputSample[c]), 0.25);
+			if (mojo > 0.0) inputSample[c] = (fast_sin(inputSample[c] * mojo * M_PI * 0.5) / mojo);
+			// mojo is the one that flattens WAAAAY out very softly before wavefolding
 		}
 
-		if (toTape6->lastSampleL <= -refclip) {
-			if (inputSampleL > -refclip) toTape6->lastSampleL = ((-refclip * softness) + (inputSampleL * (1.0 - softness)));
-			else toTape6->lastSampleL = -refclip;
-		}
+		LANES_UNROLL
+		for (int c = 0; c < channels; c++) {
+			inputSample[c] += groundSample[c]; // apply UnBox processing
 
-		if (inputSampleL > refclip) {
-			if (toTape6->lastSampleL < refclip) inputSampleL = ((refclip * softness) + (toTape6->lastSampleL * (1.0 - softness)));
-			else inputSampleL = refclip;
-		}
+			if (outputgain != 1.0) inputSample[c] *= outputgain;
 
-		if (inputSampleL < -refclip) {
-			if (toTape6->lastSampleL > -refclip) inputSampleL = ((-refclip * softness) + (toTape6->lastSampleL * (1.0 - softness)));
-			else inputSampleL = -refclip;
-		}
-		toTape6->lastSampleL = inputSampleL; // end ADClip L
+			if (toTape6->lastSample[c] >= refclip) {
+				if (inputSample[c] < refclip) toTape6->lastSample[c] = ((refclip * softness) + (inputSample[c] * (1.0 - softness)));
+				else toTape6->lastSample[c] = refclip;
+			}
 
-		if (toTape6->lastSampleR >= refclip) {
-			if (inputSampleR < refclip) toTape6->lastSampleR = ((refclip * softness) + (inputSampleR * (1.0 - softness)));
-			else toTape6->lastSampleR = refclip;
-		}
+			if (toTape6->lastSample[c] <= -refclip) {
+				if (inputSample[c] > -refclip) toTape6->lastSample[c] = ((-refclip * softness) + (inputSample[c] * (1.0 - softness)));
+				else toTape6->lastSample[c] = -refclip;
+			}
 
-		if (toTape6->lastSampleR <= -refclip) {
-			if (inputSampleR > -refclip) toTape6->lastSampleR = ((-refclip * softness) + (inputSampleR * (1.0 - softness)));
-			else toTape6->lastSampleR = -refclip;
-		}
+			if (inputSample[c] > refclip) {
+				if (toTape6->lastSample[c] < refclip) inputSample[c] = ((refclip * softness) + (toTape6->lastSample[c] * (1.0 - softness)));
+				else inputSample[c] = refclip;
+			}
 
-		if (inputSampleR > refclip) {
-			if (toTape6->lastSampleR < refclip) inputSampleR = ((refclip * softness) + (toTape6->lastSampleR * (1.0 - softness)));
-			else inputSampleR = refclip;
-		}
+			if (inputSample[c] < -refclip) {
+				if (toTape6->lastSample[c] > -refclip) inputSample[c] = ((-refclip * softness) + (toTape6->lastSample[c] * (1.0 - softness)));
+				else inputSample[c] = -refclip;
+			}
+			toTape6->lastSample[c] = inputSample[c]; // end ADClip
 
-		if (inputSampleR < -refclip) {
-			if (toTape6->lastSampleR > -refclip) inputSampleR = ((-refclip * softness) + (toTape6->lastSampleR * (1.0 - softness)));
-			else inputSampleR = -refclip;
+			if (inputSample[c] > refclip) inputSample[c] = refclip;
+			if (inputSample[c] < -refclip) inputSample[c] = -refclip;
+			// final iron bar
+
+			if (wet != 1.0) inputSample[c] = (inputSample[c] * wet) + (drySample[c] * (1.0 - wet));
 		}
-		toTape6->lastSampleR = inputSampleR; // end ADClip R
-
-		if (inputSampleL > refclip) inputSampleL = refclip;
-		if (inputSampleL < -refclip) inputSampleL = -refclip;
-		// final iron bar
-		if (inputSampleR > refclip) inputSampleR = refclip;
-		if (inputSampleR < -refclip) inputSampleR = -refclip;
-		// final iron bar
-
-		if (wet != 1.0) {
-			inputSampleL = (inputSampleL * wet) + (drySampleL * (1.0 - wet));
-			inputSampleR = (inputSampleR * wet) + (drySampleR * (1.0 - wet));
+
+		// begin 32 bit floating point dither
+		for (int c = 0; c < channels; c++) {
+			int expon;
+			frexpf((float) inputSample[c], &expon);
+			toTape6->fpd[c] ^= toTape6->fpd[c] << 13;
+			toTape6->fpd[c] ^= toTape6->fpd[c] >> 17;
+			toTape6->fpd[c] ^= toTape6->fpd[c] << 5;
+			if (dither) inputSample[c] += (((double) toTape6->fpd[c] - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		}
+		// end 32 bit floating point dither
 
-		// begin 32 bit stereo floating point dither
-		int expon;
-		frexpf((float) inputSampleL, &expon);
-		toTape6->fpdL ^= toTape6->fpdL << 13;
-		toTape6->fpdL ^= toTape6->fpdL >> 17;
-		toTape6->fpdL ^= toTape6->fpdL << 5;
-		inputSampleL += (((double) toTape6->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		frexpf((float) inputSampleR, &expon);
-		toTape6->fpdR ^= toTape6->fpdR << 13;
-		toTape6->fpdR ^= toTape6->fpdR >> 17;
-		toTape6->fpdR ^= toTape6->fpdR << 5;
-		inputSampleR += (((double) toTape6->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
-		// end 32 bit stereo floating point dither
-
-		*out1 = (float) inputSampleL;
-		*out2 = (float) inputSampleR;
-
-		in1++;
-		in2++;
-		out1++;
-		out2++;
+		for (int c = 0; c < channels; c++) {
+			if (samples) samples[c][i] = inputSample[c];
+			else toTape6->output[c][i] = (float) inputSample[c];
+		}
 	}
 }
 
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((ToTape6*) instance, sampleFrames, 2, NULL, true);
+}
+
+static void run_mono(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_channels((ToTape6*) instance, sampleFrames, 1, NULL, true);
+}
+
 static void deactivate(LV2_Handle instance) {}
 
 static void cleanup(LV2_Handle instance)
@@ -537,22 +435,47 @@ static void cleanup(LV2_Handle instance)
 	free(instance);
 }
 
+static void process(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_channels((ToTape6*) instance, sampleFrames, 2, samples, dither);
+}
+
+static void process_mono(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	run_channels((ToTape6*) instance, sampleFrames, 1, samples, dither);
+}
+
 static const void* extension_data(const char* uri)
 {
-	return NULL;
+	static const AirwindowsFused fused = {process};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
+}
+
+static const void* extension_data_mono(const char* uri)
+{
+	static const AirwindowsFused fused = {process_mono};
+	return strcmp(uri, AIRWINDOWS__fused) ? NULL : &fused;
 }
 
-static const LV2_Descriptor descriptor = {
-	TOTAPE6_URI,
-	instantiate,
-	connect_port,
-	activate,
-	run,
-	deactivate,
-	cleanup,
-	extension_data};
+static const LV2_Descriptor descriptors[] = {
+	{TOTAPE6_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{TOTAPE6MONO_URI,
+	 instantiate,
+	 connect_port_mono,
+	 activate,
+	 run_mono,
+	 deactivate,
+	 cleanup,
+	 extension_data_mono}};
 
 LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
 {
-	return index == 0 ? &descriptor : NULL;
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
 }
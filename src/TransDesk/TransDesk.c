@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define TRANSDESK_URI "https://hannesbraun.net/ns/lv2/airwindows/transdesk"
 
 typedef enum {
@@ -167,7 +169,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bridgerectifier = fabs(inputSampleL);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 		// max value for sine function
-		if (thickness > 0) bridgerectifier = sin(bridgerectifier);
+		if (thickness > 0) bridgerectifier = fast_sin(bridgerectifier);
 		else bridgerectifier = 1 - cos(bridgerectifier);
 		// produce either boosted or starved version
 		if (inputSampleL > 0) inputSampleL = (inputSampleL * (1 - out)) + (bridgerectifier * out);
@@ -179,7 +181,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		// Set up direct reference for slew
 		bridgerectifier = fabs(slew * slewgain);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (slew > 0) slew = bridgerectifier / slewgain;
 		else slew = -(bridgerectifier / slewgain);
 		inputSampleL = (transDesk->lastOutSampleL * balanceA) + (transDesk->lastSampleL * balanceB) + slew;
@@ -195,7 +197,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleL *= gain;
 		bridgerectifier = fabs(inputSampleL);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleL > 0) inputSampleL = bridgerectifier;
 		else inputSampleL = -bridgerectifier;
 		// drive section
@@ -225,7 +227,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bridgerectifier = fabs(inputSampleR);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 		// max value for sine function
-		if (thickness > 0) bridgerectifier = sin(bridgerectifier);
+		if (thickness > 0) bridgerectifier = fast_sin(bridgerectifier);
 		else bridgerectifier = 1 - cos(bridgerectifier);
 		// produce either boosted or starved version
 		if (inputSampleR > 0) inputSampleR = (inputSampleR * (1 - out)) + (bridgerectifier * out);
@@ -237,7 +239,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		// Set up direct reference for slew
 		bridgerectifier = fabs(slew * slewgain);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (slew > 0) slew = bridgerectifier / slewgain;
 		else slew = -(bridgerectifier / slewgain);
 		inputSampleR = (transDesk->lastOutSampleR * balanceA) + (transDesk->lastSampleR * balanceB) + slew;
@@ -253,7 +255,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleR *= gain;
 		bridgerectifier = fabs(inputSampleR);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleR > 0) inputSampleR = bridgerectifier;
 		else inputSampleR = -bridgerectifier;
 		// drive section
@@ -269,12 +271,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		transDesk->fpdL ^= transDesk->fpdL << 13;
 		transDesk->fpdL ^= transDesk->fpdL >> 17;
 		transDesk->fpdL ^= transDesk->fpdL << 5;
-		inputSampleL += (((double) transDesk->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) transDesk->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		transDesk->fpdR ^= transDesk->fpdR << 13;
 		transDesk->fpdR ^= transDesk->fpdR >> 17;
 		transDesk->fpdR ^= transDesk->fpdR << 5;
-		inputSampleR += (((double) transDesk->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) transDesk->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define TUBE_URI "https://hannesbraun.net/ns/lv2/airwindows/tube"
 
 typedef enum {
@@ -178,12 +180,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		tube->fpdL ^= tube->fpdL << 13;
 		tube->fpdL ^= tube->fpdL >> 17;
 		tube->fpdL ^= tube->fpdL << 5;
-		inputSampleL += (((double) tube->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) tube->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		tube->fpdR ^= tube->fpdR << 13;
 		tube->fpdR ^= tube->fpdR >> 17;
 		tube->fpdR ^= tube->fpdR << 5;
-		inputSampleR += (((double) tube->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) tube->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define TUBEDESK_URI "https://hannesbraun.net/ns/lv2/airwindows/tubedesk"
 
 typedef enum {
@@ -166,7 +168,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bridgerectifier = fabs(inputSampleL);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 		// max value for sine function
-		if (thickness > 0) bridgerectifier = sin(bridgerectifier);
+		if (thickness > 0) bridgerectifier = fast_sin(bridgerectifier);
 		else bridgerectifier = 1 - cos(bridgerectifier);
 		// produce either boosted or starved version
 		if (inputSampleL > 0) inputSampleL = (inputSampleL * (1 - out)) + (bridgerectifier * out);
@@ -178,7 +180,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		// Set up direct reference for slew
 		bridgerectifier = fabs(slew * slewgain);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (slew > 0) slew = bridgerectifier / slewgain;
 		else slew = -(bridgerectifier / slewgain);
 		inputSampleL = (tubeDesk->lastOutSampleL * balanceA) + (tubeDesk->lastSampleL * balanceB) + slew;
@@ -194,7 +196,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleL *= gain;
 		bridgerectifier = fabs(inputSampleL);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleL > 0) inputSampleL = bridgerectifier;
 		else inputSampleL = -bridgerectifier;
 		// drive section
@@ -224,7 +226,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		bridgerectifier = fabs(inputSampleR);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.57079633;
 		// max value for sine function
-		if (thickness > 0) bridgerectifier = sin(bridgerectifier);
+		if (thickness > 0) bridgerectifier = fast_sin(bridgerectifier);
 		else bridgerectifier = 1 - cos(bridgerectifier);
 		// produce either boosted or starved version
 		if (inputSampleR > 0) inputSampleR = (inputSampleR * (1 - out)) + (bridgerectifier * out);
@@ -236,7 +238,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		// Set up direct reference for slew
 		bridgerectifier = fabs(slew * slewgain);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (slew > 0) slew = bridgerectifier / slewgain;
 		else slew = -(bridgerectifier / slewgain);
 		inputSampleR = (tubeDesk->lastOutSampleR * balanceA) + (tubeDesk->lastSampleR * balanceB) + slew;
@@ -252,7 +254,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleR *= gain;
 		bridgerectifier = fabs(inputSampleR);
 		if (bridgerectifier > 1.57079633) bridgerectifier = 1.0;
-		else bridgerectifier = sin(bridgerectifier);
+		else bridgerectifier = fast_sin(bridgerectifier);
 		if (inputSampleR > 0) inputSampleR = bridgerectifier;
 		else inputSampleR = -bridgerectifier;
 		// drive section
@@ -268,12 +270,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		tubeDesk->fpdL ^= tubeDesk->fpdL << 13;
 		tubeDesk->fpdL ^= tubeDesk->fpdL >> 17;
 		tubeDesk->fpdL ^= tubeDesk->fpdL << 5;
-		inputSampleL += (((double) tubeDesk->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) tubeDesk->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		tubeDesk->fpdR ^= tubeDesk->fpdR << 13;
 		tubeDesk->fpdR ^= tubeDesk->fpdR >> 17;
 		tubeDesk->fpdR ^= tubeDesk->fpdR << 5;
-		inputSampleR += (((double) tubeDesk->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) tubeDesk->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define ULTRASONIC_URI "https://hannesbraun.net/ns/lv2/airwindows/ultrasonic"
@@ -68,21 +70,6 @@ static void activate(LV2_Handle instance)
 		ultrasonic->biquadD[x] = 0.0;
 		ultrasonic->biquadE[x] = 0.0;
 	}
-	ultrasonic->fpdL = 1.0;
-	while (ultrasonic->fpdL < 16386) ultrasonic->fpdL = rand() * UINT32_MAX;
-	ultrasonic->fpdR = 1.0;
-	while (ultrasonic->fpdR < 16386) ultrasonic->fpdR = rand() * UINT32_MAX;
-}
-
-static void run(LV2_Handle instance, uint32_t sampleFrames)
-{
-	Ultrasonic* ultrasonic = (Ultrasonic*) instance;
-
-	const float* in1 = ultrasonic->input[0];
-	const float* in2 = ultrasonic->input[1];
-	float* out1 = ultrasonic->output[0];
-	float* out2 = ultrasonic->output[1];
-
 	const double init = 20000.0 / ultrasonic->sampleRate;
 	ultrasonic->biquadA[0] = init;
 	ultrasonic->biquadB[0] = init;
@@ -135,6 +122,21 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	ultrasonic->biquadE[5] = 2.0 * (K * K - 1.0) * norm;
 	ultrasonic->biquadE[6] = (1.0 - K / ultrasonic->biquadE[1] + K * K) * norm;
 
+	ultrasonic->fpdL = 1.0;
+	while (ultrasonic->fpdL < 16386) ultrasonic->fpdL = rand() * UINT32_MAX;
+	ultrasonic->fpdR = 1.0;
+	while (ultrasonic->fpdR < 16386) ultrasonic->fpdR = rand() * UINT32_MAX;
+}
+
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	Ultrasonic* ultrasonic = (Ultrasonic*) instance;
+
+	const float* in1 = ultrasonic->input[0];
+	const float* in2 = ultrasonic->input[1];
+	float* out1 = ultrasonic->output[0];
+	float* out2 = ultrasonic->output[1];
+
 	while (sampleFrames-- > 0) {
 		double inputSampleL = *in1;
 		double inputSampleR = *in2;
@@ -217,12 +219,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		ultrasonic->fpdL ^= ultrasonic->fpdL << 13;
 		ultrasonic->fpdL ^= ultrasonic->fpdL >> 17;
 		ultrasonic->fpdL ^= ultrasonic->fpdL << 5;
-		inputSampleL += (((double) ultrasonic->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) ultrasonic->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		ultrasonic->fpdR ^= ultrasonic->fpdR << 13;
 		ultrasonic->fpdR ^= ultrasonic->fpdR >> 17;
 		ultrasonic->fpdR ^= ultrasonic->fpdR << 5;
-		inputSampleR += (((double) ultrasonic->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) ultrasonic->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
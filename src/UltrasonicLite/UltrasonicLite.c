@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define ULTRASONICLITE_URI "https://hannesbraun.net/ns/lv2/airwindows/ultrasoniclite"
@@ -60,6 +62,20 @@ static void activate(LV2_Handle instance)
 	for (int x = 0; x < 15; x++) {
 		ultrasoniclite->biquadA[x] = 0.0;
 	}
+	ultrasoniclite->biquadA[0] = 24000.0 / ultrasoniclite->sampleRate;
+	if (ultrasoniclite->sampleRate < 88000.0) {
+		ultrasoniclite->biquadA[0] = 21000.0 / ultrasoniclite->sampleRate;
+	}
+	ultrasoniclite->biquadA[1] = 0.70710678;
+
+	double K = tan(M_PI * ultrasoniclite->biquadA[0]); // lowpass
+	double norm = 1.0 / (1.0 + K / ultrasoniclite->biquadA[1] + K * K);
+	ultrasoniclite->biquadA[2] = K * K * norm;
+	ultrasoniclite->biquadA[3] = 2.0 * ultrasoniclite->biquadA[2];
+	ultrasoniclite->biquadA[4] = ultrasoniclite->biquadA[2];
+	ultrasoniclite->biquadA[5] = 2.0 * (K * K - 1.0) * norm;
+	ultrasoniclite->biquadA[6] = (1.0 - K / ultrasoniclite->biquadA[1] + K * K) * norm;
+
 	ultrasoniclite->fpdL = 1.0;
 	while (ultrasoniclite->fpdL < 16386) ultrasoniclite->fpdL = rand() * UINT32_MAX;
 	ultrasoniclite->fpdR = 1.0;
@@ -75,20 +91,6 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = ultrasoniclite->output[0];
 	float* out2 = ultrasoniclite->output[1];
 
-	ultrasoniclite->biquadA[0] = 24000.0 / ultrasoniclite->sampleRate;
-	if (ultrasoniclite->sampleRate < 88000.0) {
-		ultrasoniclite->biquadA[0] = 21000.0 / ultrasoniclite->sampleRate;
-	}
-	ultrasoniclite->biquadA[1] = 0.70710678;
-
-	double K = tan(M_PI * ultrasoniclite->biquadA[0]); // lowpass
-	double norm = 1.0 / (1.0 + K / ultrasoniclite->biquadA[1] + K * K);
-	ultrasoniclite->biquadA[2] = K * K * norm;
-	ultrasoniclite->biquadA[3] = 2.0 * ultrasoniclite->biquadA[2];
-	ultrasoniclite->biquadA[4] = ultrasoniclite->biquadA[2];
-	ultrasoniclite->biquadA[5] = 2.0 * (K * K - 1.0) * norm;
-	ultrasoniclite->biquadA[6] = (1.0 - K / ultrasoniclite->biquadA[1] + K * K) * norm;
-
 	while (sampleFrames-- > 0) {
 		double inputSampleL = *in1;
 		double inputSampleR = *in2;
@@ -115,12 +117,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		ultrasoniclite->fpdL ^= ultrasoniclite->fpdL << 13;
 		ultrasoniclite->fpdL ^= ultrasoniclite->fpdL >> 17;
 		ultrasoniclite->fpdL ^= ultrasoniclite->fpdL << 5;
-		inputSampleL += (((double) ultrasoniclite->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) ultrasoniclite->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		ultrasoniclite->fpdR ^= ultrasoniclite->fpdR << 13;
 		ultrasoniclite->fpdR ^= ultrasoniclite->fpdR >> 17;
 		ultrasoniclite->fpdR ^= ultrasoniclite->fpdR << 5;
-		inputSampleR += (((double) ultrasoniclite->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) ultrasoniclite->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
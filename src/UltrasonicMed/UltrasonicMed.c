@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define ULTRASONICMED_URI "https://hannesbraun.net/ns/lv2/airwindows/ultrasonicmed"
@@ -63,21 +65,6 @@ static void activate(LV2_Handle instance)
 		ultrasonicMed->biquadA[x] = 0.0;
 		ultrasonicMed->biquadB[x] = 0.0;
 	}
-	ultrasonicMed->fpdL = 1.0;
-	while (ultrasonicMed->fpdL < 16386) ultrasonicMed->fpdL = rand() * UINT32_MAX;
-	ultrasonicMed->fpdR = 1.0;
-	while (ultrasonicMed->fpdR < 16386) ultrasonicMed->fpdR = rand() * UINT32_MAX;
-}
-
-static void run(LV2_Handle instance, uint32_t sampleFrames)
-{
-	UltrasonicMed* ultrasonicMed = (UltrasonicMed*) instance;
-
-	const float* in1 = ultrasonicMed->input[0];
-	const float* in2 = ultrasonicMed->input[1];
-	float* out1 = ultrasonicMed->output[0];
-	float* out2 = ultrasonicMed->output[1];
-
 	ultrasonicMed->biquadA[0] = 24000.0 / ultrasonicMed->sampleRate;
 	ultrasonicMed->biquadB[0] = 22000.0 / ultrasonicMed->sampleRate;
 	if (ultrasonicMed->sampleRate < 88000.0) {
@@ -104,6 +91,21 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	ultrasonicMed->biquadB[5] = 2.0 * (K * K - 1.0) * norm;
 	ultrasonicMed->biquadB[6] = (1.0 - K / ultrasonicMed->biquadB[1] + K * K) * norm;
 
+	ultrasonicMed->fpdL = 1.0;
+	while (ultrasonicMed->fpdL < 16386) ultrasonicMed->fpdL = rand() * UINT32_MAX;
+	ultrasonicMed->fpdR = 1.0;
+	while (ultrasonicMed->fpdR < 16386) ultrasonicMed->fpdR = rand() * UINT32_MAX;
+}
+
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	UltrasonicMed* ultrasonicMed = (UltrasonicMed*) instance;
+
+	const float* in1 = ultrasonicMed->input[0];
+	const float* in2 = ultrasonicMed->input[1];
+	float* out1 = ultrasonicMed->output[0];
+	float* out2 = ultrasonicMed->output[1];
+
 	while (sampleFrames-- > 0) {
 		double inputSampleL = *in1;
 		double inputSampleR = *in2;
@@ -144,12 +146,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		ultrasonicMed->fpdL ^= ultrasonicMed->fpdL << 13;
 		ultrasonicMed->fpdL ^= ultrasonicMed->fpdL >> 17;
 		ultrasonicMed->fpdL ^= ultrasonicMed->fpdL << 5;
-		inputSampleL += (((double) ultrasonicMed->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) ultrasonicMed->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		ultrasonicMed->fpdR ^= ultrasonicMed->fpdR << 13;
 		ultrasonicMed->fpdR ^= ultrasonicMed->fpdR >> 17;
 		ultrasonicMed->fpdR ^= ultrasonicMed->fpdR << 5;
-		inputSampleR += (((double) ultrasonicMed->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) ultrasonicMed->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
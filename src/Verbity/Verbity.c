@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
 #define VERBITY_URI "https://hannesbraun.net/ns/lv2/airwindows/verbity"
 
 typedef enum {
@@ -102,6 +105,8 @@ typedef struct {
 
 	uint32_t fpdL;
 	uint32_t fpdR;
+
+	Silence silence;
 } Verbity;
 
 static LV2_Handle instantiate(
@@ -251,6 +256,8 @@ static void activate(LV2_Handle instance)
 	while (verbity->fpdL < 16386) verbity->fpdL = rand() * UINT32_MAX;
 	verbity->fpdR = 1.0;
 	while (verbity->fpdR < 16386) verbity->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&verbity->silence, 62920 * 4); // delay memory per channel, undersampled
 }
 
 static void run(LV2_Handle instance, uint32_t sampleFrames)
@@ -262,6 +269,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 	float* out1 = verbity->output[0];
 	float* out2 = verbity->output[1];
 
+	if (silence_skip(&verbity->silence, in1, in2, out1, out2, sampleFrames)) return;
+
 	double overallscale = 1.0;
 	overallscale /= 44100.0;
 	overallscale *= verbity->sampleRate;
@@ -509,12 +518,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		verbity->fpdL ^= verbity->fpdL << 13;
 		verbity->fpdL ^= verbity->fpdL >> 17;
 		verbity->fpdL ^= verbity->fpdL << 5;
-		inputSampleL += (((double) verbity->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) verbity->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		verbity->fpdR ^= verbity->fpdR << 13;
 		verbity->fpdR ^= verbity->fpdR >> 17;
 		verbity->fpdR ^= verbity->fpdR << 5;
-		inputSampleR += (((double) verbity->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) verbity->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -525,6 +534,8 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		out1++;
 		out2++;
 	}
+
+	silence_track(&verbity->silence, verbity->output[0], verbity->output[1]);
 }
 
 static void deactivate(LV2_Handle instance) {}
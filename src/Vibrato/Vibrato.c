@@ -5,6 +5,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/air.h"
+#include "../common/fastmath.h"
+
 #define VIBRATO_URI "https://hannesbraun.net/ns/lv2/airwindows/vibrato"
 
 typedef enum {
@@ -34,16 +37,7 @@ typedef struct {
 	double sweepB;
 	int gcount;
 
-	double airPrevL;
-	double airEvenL;
-	double airOddL;
-	double airFactorL;
-	double airPrevR;
-	double airEvenR;
-	double airOddR;
-	double airFactorR;
-
-	bool flip;
+	Air air;
 	uint32_t fpdL;
 	uint32_t fpdR;
 } Vibrato;
@@ -105,16 +99,7 @@ static void activate(LV2_Handle instance)
 	vibrato->sweepB = 3.141592653589793238 / 2.0;
 	vibrato->gcount = 0;
 
-	vibrato->airPrevL = 0.0;
-	vibrato->airEvenL = 0.0;
-	vibrato->airOddL = 0.0;
-	vibrato->airFactorL = 0.0;
-	vibrato->airPrevR = 0.0;
-	vibrato->airEvenR = 0.0;
-	vibrato->airOddR = 0.0;
-	vibrato->airFactorR = 0.0;
-
-	vibrato->flip = false;
+	air_reset(&vibrato->air);
 
 	vibrato->fpdL = 1.0;
 	while (vibrato->fpdL < 16386) vibrato->fpdL = rand() * UINT32_MAX;
@@ -146,35 +131,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		double drySampleL = inputSampleL;
 		double drySampleR = inputSampleR;
 
-		vibrato->airFactorL = vibrato->airPrevL - inputSampleL;
-		vibrato->airFactorR = vibrato->airPrevR - inputSampleR;
-
-		if (vibrato->flip) {
-			vibrato->airEvenL += vibrato->airFactorL;
-			vibrato->airOddL -= vibrato->airFactorL;
-			vibrato->airFactorL = vibrato->airEvenL;
-			vibrato->airEvenR += vibrato->airFactorR;
-			vibrato->airOddR -= vibrato->airFactorR;
-			vibrato->airFactorR = vibrato->airEvenR;
-		} else {
-			vibrato->airOddL += vibrato->airFactorL;
-			vibrato->airEvenL -= vibrato->airFactorL;
-			vibrato->airFactorL = vibrato->airOddL;
-			vibrato->airOddR += vibrato->airFactorR;
-			vibrato->airEvenR -= vibrato->airFactorR;
-			vibrato->airFactorR = vibrato->airOddR;
-		}
-
-		vibrato->airOddL = (vibrato->airOddL - ((vibrato->airOddL - vibrato->airEvenL) / 256.0)) / 1.0001;
-		vibrato->airOddR = (vibrato->airOddR - ((vibrato->airOddR - vibrato->airEvenR) / 256.0)) / 1.0001;
-		vibrato->airEvenL = (vibrato->airEvenL - ((vibrato->airEvenL - vibrato->airOddL) / 256.0)) / 1.0001;
-		vibrato->airEvenR = (vibrato->airEvenR - ((vibrato->airEvenR - vibrato->airOddR) / 256.0)) / 1.0001;
-		vibrato->airPrevL = inputSampleL;
-		vibrato->airPrevR = inputSampleR;
-		inputSampleL += vibrato->airFactorL;
-		inputSampleR += vibrato->airFactorR;
-
-		vibrato->flip = !vibrato->flip;
+		air_process(&vibrato->air, &inputSampleL, &inputSampleR);
 		// air, compensates for loss of highs in the interpolation
 
 		if (vibrato->gcount < 1 || vibrato->gcount > 8192) {
@@ -225,12 +182,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		vibrato->fpdL ^= vibrato->fpdL << 13;
 		vibrato->fpdL ^= vibrato->fpdL >> 17;
 		vibrato->fpdL ^= vibrato->fpdL << 5;
-		inputSampleL += (((double) vibrato->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) vibrato->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		vibrato->fpdR ^= vibrato->fpdR << 13;
 		vibrato->fpdR ^= vibrato->fpdR >> 17;
 		vibrato->fpdR ^= vibrato->fpdR << 5;
-		inputSampleR += (((double) vibrato->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) vibrato->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
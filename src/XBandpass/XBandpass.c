@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define XBANDPASS_URI "https://hannesbraun.net/ns/lv2/airwindows/xbandpass"
@@ -177,7 +179,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		xBandpass->biquad[10] = xBandpass->biquad[9];
 		if (outSample > 1.57079633) outSample = 1.57079633;
 		if (outSample < -1.57079633) outSample = -1.57079633;
-		xBandpass->biquad[9] = sin(outSample); // DF1 left
+		xBandpass->biquad[9] = fast_sin(outSample); // DF1 left
 		inputSampleL = outSample / compensation;
 		nukeLevelL = inputSampleL;
 
@@ -188,7 +190,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		xBandpass->biquad[14] = xBandpass->biquad[13];
 		if (outSample > 1.57079633) outSample = 1.57079633;
 		if (outSample < -1.57079633) outSample = -1.57079633;
-		xBandpass->biquad[13] = sin(outSample); // DF1 right
+		xBandpass->biquad[13] = fast_sin(outSample); // DF1 right
 		inputSampleR = outSample / compensation;
 		nukeLevelR = inputSampleR;
 
@@ -200,7 +202,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			xBandpass->biquadA[10] = xBandpass->biquadA[9];
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xBandpass->biquadA[9] = sin(outSample); // DF1 left
+			xBandpass->biquadA[9] = fast_sin(outSample); // DF1 left
 			inputSampleL = outSample / compensation;
 			inputSampleL = (inputSampleL * aWet) + (nukeLevelL * (1.0 - aWet));
 			nukeLevelL = inputSampleL;
@@ -212,7 +214,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			xBandpass->biquadA[14] = xBandpass->biquadA[13];
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xBandpass->biquadA[13] = sin(outSample); // DF1 right
+			xBandpass->biquadA[13] = fast_sin(outSample); // DF1 right
 			inputSampleR = outSample / compensation;
 			inputSampleR = (inputSampleR * aWet) + (nukeLevelR * (1.0 - aWet));
 			nukeLevelR = inputSampleR;
@@ -225,7 +227,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			xBandpass->biquadB[10] = xBandpass->biquadB[9];
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xBandpass->biquadB[9] = sin(outSample); // DF1 left
+			xBandpass->biquadB[9] = fast_sin(outSample); // DF1 left
 			inputSampleL = outSample / compensation;
 			inputSampleL = (inputSampleL * bWet) + (nukeLevelL * (1.0 - bWet));
 			nukeLevelL = inputSampleL;
@@ -237,7 +239,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			xBandpass->biquadB[14] = xBandpass->biquadB[13];
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xBandpass->biquadB[13] = sin(outSample); // DF1 right
+			xBandpass->biquadB[13] = fast_sin(outSample); // DF1 right
 			inputSampleR = outSample / compensation;
 			inputSampleR = (inputSampleR * bWet) + (nukeLevelR * (1.0 - bWet));
 			nukeLevelR = inputSampleR;
@@ -250,7 +252,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			xBandpass->biquadC[10] = xBandpass->biquadC[9];
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xBandpass->biquadC[9] = sin(outSample); // DF1 left
+			xBandpass->biquadC[9] = fast_sin(outSample); // DF1 left
 			inputSampleL = outSample / compensation;
 			inputSampleL = (inputSampleL * cWet) + (nukeLevelL * (1.0 - cWet));
 			nukeLevelL = inputSampleL;
@@ -262,7 +264,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			xBandpass->biquadC[14] = xBandpass->biquadC[13];
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xBandpass->biquadC[13] = sin(outSample); // DF1 right
+			xBandpass->biquadC[13] = fast_sin(outSample); // DF1 right
 			inputSampleR = outSample / compensation;
 			inputSampleR = (inputSampleR * cWet) + (nukeLevelR * (1.0 - cWet));
 			nukeLevelR = inputSampleR;
@@ -275,7 +277,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			xBandpass->biquadD[10] = xBandpass->biquadD[9];
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xBandpass->biquadD[9] = sin(outSample); // DF1 left
+			xBandpass->biquadD[9] = fast_sin(outSample); // DF1 left
 			inputSampleL = outSample / compensation;
 			inputSampleL = (inputSampleL * dWet) + (nukeLevelL * (1.0 - dWet));
 			nukeLevelL = inputSampleL;
@@ -287,7 +289,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			xBandpass->biquadD[14] = xBandpass->biquadD[13];
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xBandpass->biquadD[13] = sin(outSample); // DF1 right
+			xBandpass->biquadD[13] = fast_sin(outSample); // DF1 right
 			inputSampleR = outSample / compensation;
 			inputSampleR = (inputSampleR * dWet) + (nukeLevelR * (1.0 - dWet));
 			nukeLevelR = inputSampleR;
@@ -304,12 +306,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		xBandpass->fpdL ^= xBandpass->fpdL << 13;
 		xBandpass->fpdL ^= xBandpass->fpdL >> 17;
 		xBandpass->fpdL ^= xBandpass->fpdL << 5;
-		inputSampleL += (((double) xBandpass->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) xBandpass->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		xBandpass->fpdR ^= xBandpass->fpdR << 13;
 		xBandpass->fpdR ^= xBandpass->fpdR >> 17;
 		xBandpass->fpdR ^= xBandpass->fpdR << 5;
-		inputSampleR += (((double) xBandpass->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) xBandpass->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define XLOWPASS_URI "https://hannesbraun.net/ns/lv2/airwindows/xlowpass"
@@ -178,7 +180,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		outSample *= clipFactor;
 		if (outSample > 1.57079633) outSample = 1.57079633;
 		if (outSample < -1.57079633) outSample = -1.57079633;
-		xLowpass->biquad[9] = sin(outSample); // DF1 left
+		xLowpass->biquad[9] = fast_sin(outSample); // DF1 left
 		inputSampleL = outSample / compensation;
 		nukeLevelL = inputSampleL;
 
@@ -189,7 +191,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		outSample *= clipFactor;
 		if (outSample > 1.57079633) outSample = 1.57079633;
 		if (outSample < -1.57079633) outSample = -1.57079633;
-		xLowpass->biquad[13] = sin(outSample); // DF1 right
+		xLowpass->biquad[13] = fast_sin(outSample); // DF1 right
 		inputSampleR = outSample / compensation;
 		nukeLevelR = inputSampleR;
 
@@ -201,7 +203,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			outSample *= clipFactor;
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xLowpass->biquadA[9] = sin(outSample); // DF1 left
+			xLowpass->biquadA[9] = fast_sin(outSample); // DF1 left
 			inputSampleL = outSample / compensation;
 			inputSampleL = (inputSampleL * aWet) + (nukeLevelL * (1.0 - aWet));
 			nukeLevelL = inputSampleL;
@@ -213,7 +215,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			outSample *= clipFactor;
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xLowpass->biquadA[13] = sin(outSample); // DF1 right
+			xLowpass->biquadA[13] = fast_sin(outSample); // DF1 right
 			inputSampleR = outSample / compensation;
 			inputSampleR = (inputSampleR * aWet) + (nukeLevelR * (1.0 - aWet));
 			nukeLevelR = inputSampleR;
@@ -226,7 +228,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			outSample *= clipFactor;
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xLowpass->biquadB[9] = sin(outSample); // DF1 left
+			xLowpass->biquadB[9] = fast_sin(outSample); // DF1 left
 			inputSampleL = outSample / compensation;
 			inputSampleL = (inputSampleL * bWet) + (nukeLevelL * (1.0 - bWet));
 			nukeLevelL = inputSampleL;
@@ -238,7 +240,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			outSample *= clipFactor;
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xLowpass->biquadB[13] = sin(outSample); // DF1 right
+			xLowpass->biquadB[13] = fast_sin(outSample); // DF1 right
 			inputSampleR = outSample / compensation;
 			inputSampleR = (inputSampleR * bWet) + (nukeLevelR * (1.0 - bWet));
 			nukeLevelR = inputSampleR;
@@ -251,7 +253,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			outSample *= clipFactor;
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xLowpass->biquadC[9] = sin(outSample); // DF1 left
+			xLowpass->biquadC[9] = fast_sin(outSample); // DF1 left
 			inputSampleL = outSample / compensation;
 			inputSampleL = (inputSampleL * cWet) + (nukeLevelL * (1.0 - cWet));
 			nukeLevelL = inputSampleL;
@@ -263,7 +265,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			outSample *= clipFactor;
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xLowpass->biquadC[13] = sin(outSample); // DF1 right
+			xLowpass->biquadC[13] = fast_sin(outSample); // DF1 right
 			inputSampleR = outSample / compensation;
 			inputSampleR = (inputSampleR * cWet) + (nukeLevelR * (1.0 - cWet));
 			nukeLevelR = inputSampleR;
@@ -276,7 +278,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			outSample *= clipFactor;
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xLowpass->biquadD[9] = sin(outSample); // DF1 left
+			xLowpass->biquadD[9] = fast_sin(outSample); // DF1 left
 			inputSampleL = outSample / compensation;
 			inputSampleL = (inputSampleL * dWet) + (nukeLevelL * (1.0 - dWet));
 			nukeLevelL = inputSampleL;
@@ -288,7 +290,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			outSample *= clipFactor;
 			if (outSample > 1.57079633) outSample = 1.57079633;
 			if (outSample < -1.57079633) outSample = -1.57079633;
-			xLowpass->biquadD[13] = sin(outSample); // DF1 right
+			xLowpass->biquadD[13] = fast_sin(outSample); // DF1 right
 			inputSampleR = outSample / compensation;
 			inputSampleR = (inputSampleR * dWet) + (nukeLevelR * (1.0 - dWet));
 			nukeLevelR = inputSampleR;
@@ -305,12 +307,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		xLowpass->fpdL ^= xLowpass->fpdL << 13;
 		xLowpass->fpdL ^= xLowpass->fpdL >> 17;
 		xLowpass->fpdL ^= xLowpass->fpdL << 5;
-		inputSampleL += (((double) xLowpass->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) xLowpass->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		xLowpass->fpdR ^= xLowpass->fpdR << 13;
 		xLowpass->fpdR ^= xLowpass->fpdR >> 17;
 		xLowpass->fpdR ^= xLowpass->fpdR << 5;
-		inputSampleR += (((double) xLowpass->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) xLowpass->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define XNOTCH_URI "https://hannesbraun.net/ns/lv2/airwindows/xnotch"
@@ -170,7 +172,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 		if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-		inputSampleL = sin(inputSampleL);
+		inputSampleL = fast_sin(inputSampleL);
 		outSample = xNotch->biquad[2] * inputSampleL + xNotch->biquad[3] * xNotch->biquad[7] + xNotch->biquad[4] * xNotch->biquad[8] - xNotch->biquad[5] * xNotch->biquad[9] - xNotch->biquad[6] * xNotch->biquad[10];
 		xNotch->biquad[8] = xNotch->biquad[7];
 		xNotch->biquad[7] = inputSampleL;
@@ -179,7 +181,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 		if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-		inputSampleR = sin(inputSampleR);
+		inputSampleR = fast_sin(inputSampleR);
 		outSample = xNotch->biquad[2] * inputSampleR + xNotch->biquad[3] * xNotch->biquad[11] + xNotch->biquad[4] * xNotch->biquad[12] - xNotch->biquad[5] * xNotch->biquad[13] - xNotch->biquad[6] * xNotch->biquad[14];
 		xNotch->biquad[12] = xNotch->biquad[11];
 		xNotch->biquad[11] = inputSampleR;
@@ -190,7 +192,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleL *= clipFactor;
 			if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 			if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-			inputSampleL = sin(inputSampleL);
+			inputSampleL = fast_sin(inputSampleL);
 			outSample = xNotch->biquadA[2] * inputSampleL + xNotch->biquadA[3] * xNotch->biquadA[7] + xNotch->biquadA[4] * xNotch->biquadA[8] - xNotch->biquadA[5] * xNotch->biquadA[9] - xNotch->biquadA[6] * xNotch->biquadA[10];
 			xNotch->biquadA[8] = xNotch->biquadA[7];
 			xNotch->biquadA[7] = inputSampleL;
@@ -201,7 +203,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleR *= clipFactor;
 			if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 			if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-			inputSampleR = sin(inputSampleR);
+			inputSampleR = fast_sin(inputSampleR);
 			outSample = xNotch->biquadA[2] * inputSampleR + xNotch->biquadA[3] * xNotch->biquadA[11] + xNotch->biquadA[4] * xNotch->biquadA[12] - xNotch->biquadA[5] * xNotch->biquadA[13] - xNotch->biquadA[6] * xNotch->biquadA[14];
 			xNotch->biquadA[12] = xNotch->biquadA[11];
 			xNotch->biquadA[11] = inputSampleR;
@@ -214,7 +216,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleL *= clipFactor;
 			if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 			if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-			inputSampleL = sin(inputSampleL);
+			inputSampleL = fast_sin(inputSampleL);
 			outSample = xNotch->biquadB[2] * inputSampleL + xNotch->biquadB[3] * xNotch->biquadB[7] + xNotch->biquadB[4] * xNotch->biquadB[8] - xNotch->biquadB[5] * xNotch->biquadB[9] - xNotch->biquadB[6] * xNotch->biquadB[10];
 			xNotch->biquadB[8] = xNotch->biquadB[7];
 			xNotch->biquadB[7] = inputSampleL;
@@ -225,7 +227,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleR *= clipFactor;
 			if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 			if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-			inputSampleR = sin(inputSampleR);
+			inputSampleR = fast_sin(inputSampleR);
 			outSample = xNotch->biquadB[2] * inputSampleR + xNotch->biquadB[3] * xNotch->biquadB[11] + xNotch->biquadB[4] * xNotch->biquadB[12] - xNotch->biquadB[5] * xNotch->biquadB[13] - xNotch->biquadB[6] * xNotch->biquadB[14];
 			xNotch->biquadB[12] = xNotch->biquadB[11];
 			xNotch->biquadB[11] = inputSampleR;
@@ -237,7 +239,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleL *= clipFactor;
 			if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 			if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-			inputSampleL = sin(inputSampleL);
+			inputSampleL = fast_sin(inputSampleL);
 			outSample = xNotch->biquadC[2] * inputSampleL + xNotch->biquadC[3] * xNotch->biquadC[7] + xNotch->biquadC[4] * xNotch->biquadC[8] - xNotch->biquadC[5] * xNotch->biquadC[9] - xNotch->biquadC[6] * xNotch->biquadC[10];
 			xNotch->biquadC[8] = xNotch->biquadC[7];
 			xNotch->biquadC[7] = inputSampleL;
@@ -248,7 +250,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleR *= clipFactor;
 			if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 			if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-			inputSampleR = sin(inputSampleR);
+			inputSampleR = fast_sin(inputSampleR);
 			outSample = xNotch->biquadC[2] * inputSampleR + xNotch->biquadC[3] * xNotch->biquadC[11] + xNotch->biquadC[4] * xNotch->biquadC[12] - xNotch->biquadC[5] * xNotch->biquadC[13] - xNotch->biquadC[6] * xNotch->biquadC[14];
 			xNotch->biquadC[12] = xNotch->biquadC[11];
 			xNotch->biquadC[11] = inputSampleR;
@@ -260,7 +262,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleL *= clipFactor;
 			if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 			if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-			inputSampleL = sin(inputSampleL);
+			inputSampleL = fast_sin(inputSampleL);
 			outSample = xNotch->biquadD[2] * inputSampleL + xNotch->biquadD[3] * xNotch->biquadD[7] + xNotch->biquadD[4] * xNotch->biquadD[8] - xNotch->biquadD[5] * xNotch->biquadD[9] - xNotch->biquadD[6] * xNotch->biquadD[10];
 			xNotch->biquadD[8] = xNotch->biquadD[7];
 			xNotch->biquadD[7] = inputSampleL;
@@ -271,7 +273,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleR *= clipFactor;
 			if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 			if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-			inputSampleR = sin(inputSampleR);
+			inputSampleR = fast_sin(inputSampleR);
 			outSample = xNotch->biquadD[2] * inputSampleR + xNotch->biquadD[3] * xNotch->biquadD[11] + xNotch->biquadD[4] * xNotch->biquadD[12] - xNotch->biquadD[5] * xNotch->biquadD[13] - xNotch->biquadD[6] * xNotch->biquadD[14];
 			xNotch->biquadD[12] = xNotch->biquadD[11];
 			xNotch->biquadD[11] = inputSampleR;
@@ -282,10 +284,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 		if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-		inputSampleL = sin(inputSampleL);
+		inputSampleL = fast_sin(inputSampleL);
 		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 		if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-		inputSampleR = sin(inputSampleR);
+		inputSampleR = fast_sin(inputSampleR);
 
 		if (wet < 1.0) {
 			inputSampleL = (drySampleL * (1.0 - wet)) + (inputSampleL * wet);
@@ -298,12 +300,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		xNotch->fpdL ^= xNotch->fpdL << 13;
 		xNotch->fpdL ^= xNotch->fpdL >> 17;
 		xNotch->fpdL ^= xNotch->fpdL << 5;
-		inputSampleL += (((double) xNotch->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) xNotch->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		xNotch->fpdR ^= xNotch->fpdR << 13;
 		xNotch->fpdR ^= xNotch->fpdR >> 17;
 		xNotch->fpdR ^= xNotch->fpdR << 5;
-		inputSampleR += (((double) xNotch->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) xNotch->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
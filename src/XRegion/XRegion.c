@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define XREGION_URI "https://hannesbraun.net/ns/lv2/airwindows/xregion"
@@ -228,7 +230,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleL *= clipFactor;
 		if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 		if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-		inputSampleL = sin(inputSampleL);
+		inputSampleL = fast_sin(inputSampleL);
 		outSample = xRegion->biquad[2] * inputSampleL + xRegion->biquad[4] * xRegion->biquad[8] - xRegion->biquad[5] * xRegion->biquad[9] - xRegion->biquad[6] * xRegion->biquad[10];
 		xRegion->biquad[8] = xRegion->biquad[7];
 		xRegion->biquad[7] = inputSampleL;
@@ -240,7 +242,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		inputSampleR *= clipFactor;
 		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 		if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-		inputSampleR = sin(inputSampleR);
+		inputSampleR = fast_sin(inputSampleR);
 		outSample = xRegion->biquad[2] * inputSampleR + xRegion->biquad[4] * xRegion->biquad[12] - xRegion->biquad[5] * xRegion->biquad[13] - xRegion->biquad[6] * xRegion->biquad[14];
 		xRegion->biquad[12] = xRegion->biquad[11];
 		xRegion->biquad[11] = inputSampleR;
@@ -253,7 +255,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleL *= clipFactorA;
 			if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 			if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-			inputSampleL = sin(inputSampleL);
+			inputSampleL = fast_sin(inputSampleL);
 			outSample = xRegion->biquadA[2] * inputSampleL + xRegion->biquadA[4] * xRegion->biquadA[8] - xRegion->biquadA[5] * xRegion->biquadA[9] - xRegion->biquadA[6] * xRegion->biquadA[10];
 			xRegion->biquadA[8] = xRegion->biquadA[7];
 			xRegion->biquadA[7] = inputSampleL;
@@ -266,7 +268,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleR *= clipFactorA;
 			if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 			if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-			inputSampleR = sin(inputSampleR);
+			inputSampleR = fast_sin(inputSampleR);
 			outSample = xRegion->biquadA[2] * inputSampleR + xRegion->biquadA[4] * xRegion->biquadA[12] - xRegion->biquadA[5] * xRegion->biquadA[13] - xRegion->biquadA[6] * xRegion->biquadA[14];
 			xRegion->biquadA[12] = xRegion->biquadA[11];
 			xRegion->biquadA[11] = inputSampleR;
@@ -280,7 +282,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleL *= clipFactorB;
 			if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 			if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-			inputSampleL = sin(inputSampleL);
+			inputSampleL = fast_sin(inputSampleL);
 			outSample = xRegion->biquadB[2] * inputSampleL + xRegion->biquadB[4] * xRegion->biquadB[8] - xRegion->biquadB[5] * xRegion->biquadB[9] - xRegion->biquadB[6] * xRegion->biquadB[10];
 			xRegion->biquadB[8] = xRegion->biquadB[7];
 			xRegion->biquadB[7] = inputSampleL;
@@ -293,7 +295,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleR *= clipFactorB;
 			if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 			if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-			inputSampleR = sin(inputSampleR);
+			inputSampleR = fast_sin(inputSampleR);
 			outSample = xRegion->biquadB[2] * inputSampleR + xRegion->biquadB[4] * xRegion->biquadB[12] - xRegion->biquadB[5] * xRegion->biquadB[13] - xRegion->biquadB[6] * xRegion->biquadB[14];
 			xRegion->biquadB[12] = xRegion->biquadB[11];
 			xRegion->biquadB[11] = inputSampleR;
@@ -307,7 +309,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleL *= clipFactorC;
 			if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 			if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-			inputSampleL = sin(inputSampleL);
+			inputSampleL = fast_sin(inputSampleL);
 			outSample = xRegion->biquadC[2] * inputSampleL + xRegion->biquadC[4] * xRegion->biquadC[8] - xRegion->biquadC[5] * xRegion->biquadC[9] - xRegion->biquadC[6] * xRegion->biquadC[10];
 			xRegion->biquadC[8] = xRegion->biquadC[7];
 			xRegion->biquadC[7] = inputSampleL;
@@ -320,7 +322,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleR *= clipFactorC;
 			if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 			if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-			inputSampleR = sin(inputSampleR);
+			inputSampleR = fast_sin(inputSampleR);
 			outSample = xRegion->biquadC[2] * inputSampleR + xRegion->biquadC[4] * xRegion->biquadC[12] - xRegion->biquadC[5] * xRegion->biquadC[13] - xRegion->biquadC[6] * xRegion->biquadC[14];
 			xRegion->biquadC[12] = xRegion->biquadC[11];
 			xRegion->biquadC[11] = inputSampleR;
@@ -334,7 +336,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleL *= clipFactorD;
 			if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 			if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-			inputSampleL = sin(inputSampleL);
+			inputSampleL = fast_sin(inputSampleL);
 			outSample = xRegion->biquadD[2] * inputSampleL + xRegion->biquadD[4] * xRegion->biquadD[8] - xRegion->biquadD[5] * xRegion->biquadD[9] - xRegion->biquadD[6] * xRegion->biquadD[10];
 			xRegion->biquadD[8] = xRegion->biquadD[7];
 			xRegion->biquadD[7] = inputSampleL;
@@ -347,7 +349,7 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 			inputSampleR *= clipFactorD;
 			if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 			if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-			inputSampleR = sin(inputSampleR);
+			inputSampleR = fast_sin(inputSampleR);
 			outSample = xRegion->biquadD[2] * inputSampleR + xRegion->biquadD[4] * xRegion->biquadD[12] - xRegion->biquadD[5] * xRegion->biquadD[13] - xRegion->biquadD[6] * xRegion->biquadD[14];
 			xRegion->biquadD[12] = xRegion->biquadD[11];
 			xRegion->biquadD[11] = inputSampleR;
@@ -360,10 +362,10 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 
 		if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
 		if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
-		inputSampleL = sin(inputSampleL);
+		inputSampleL = fast_sin(inputSampleL);
 		if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
 		if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
-		inputSampleR = sin(inputSampleR);
+		inputSampleR = fast_sin(inputSampleR);
 
 		if (wet < 1.0) {
 			inputSampleL = (drySampleL * (1.0 - wet)) + (inputSampleL * wet);
@@ -376,12 +378,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		xRegion->fpdL ^= xRegion->fpdL << 13;
 		xRegion->fpdL ^= xRegion->fpdL >> 17;
 		xRegion->fpdL ^= xRegion->fpdL << 5;
-		inputSampleL += (((double) xRegion->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) xRegion->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		xRegion->fpdR ^= xRegion->fpdR << 13;
 		xRegion->fpdR ^= xRegion->fpdR >> 17;
 		xRegion->fpdR ^= xRegion->fpdR << 5;
-		inputSampleR += (((double) xRegion->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) xRegion->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
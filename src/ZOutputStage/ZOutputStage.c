@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define M_PI 3.14159265358979323846264338327950288
 
 #define ZOUTPUTSTAGE_URI "https://hannesbraun.net/ns/lv2/airwindows/zoutputstage"
@@ -184,12 +186,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		zOutputStage->fpdL ^= zOutputStage->fpdL << 13;
 		zOutputStage->fpdL ^= zOutputStage->fpdL >> 17;
 		zOutputStage->fpdL ^= zOutputStage->fpdL << 5;
-		inputSampleL += (((double) zOutputStage->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) zOutputStage->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		zOutputStage->fpdR ^= zOutputStage->fpdR << 13;
 		zOutputStage->fpdR ^= zOutputStage->fpdR >> 17;
 		zOutputStage->fpdR ^= zOutputStage->fpdR << 5;
-		inputSampleR += (((double) zOutputStage->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) zOutputStage->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -0,0 +1,51 @@
+#ifndef AIRWINDOWS_AIR_H
+#define AIRWINDOWS_AIR_H
+
+#include <stdbool.h>
+
+// Air: alternating even/odd highpass that compensates for the loss of highs
+// caused by the buffer interpolation in GlitchShifter, Vibrato and Doublelay.
+// Left and right are processed as two lanes of the same arrays, and the
+// even/odd alternation selects its accumulators by pointer instead of
+// branching on flip.
+
+typedef struct {
+	double prev[2];
+	double even[2];
+	double odd[2];
+	bool flip;
+} Air;
+
+static inline void air_reset(Air* air)
+{
+	for (int c = 0; c < 2; c++) {
+		air->prev[c] = 0.0;
+		air->even[c] = 0.0;
+		air->odd[c] = 0.0;
+	}
+	air->flip = false;
+}
+
+static inline void air_process(Air* air, double* inputSampleL, double* inputSampleR)
+{
+	double sample[2] = {*inputSampleL, *inputSampleR};
+	double* rising = air->flip ? air->even : air->odd;
+	double* falling = air->flip ? air->odd : air->even;
+
+	for (int c = 0; c < 2; c++) {
+		double factor = air->prev[c] - sample[c];
+		rising[c] += factor;
+		falling[c] -= factor;
+		factor = rising[c];
+		air->odd[c] = (air->odd[c] - ((air->odd[c] - air->even[c]) / 256.0)) / 1.0001;
+		air->even[c] = (air->even[c] - ((air->even[c] - air->odd[c]) / 256.0)) / 1.0001;
+		air->prev[c] = sample[c];
+		sample[c] += factor;
+	}
+	air->flip = !air->flip;
+
+	*inputSampleL = sample[0];
+	*inputSampleR = sample[1];
+}
+
+#endif
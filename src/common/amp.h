@@ -0,0 +1,247 @@
+#ifndef AIRWINDOWS_AMP_H
+#define AIRWINDOWS_AMP_H
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846264338327950288
+#endif
+
+// Stages shared by the guitar amps (BigAmp, FireAmp, GrindAmp, LeadAmp, LilAmp
+// and MidAmp). Their gain stages differ and stay in the plugins, but the
+// ultrasonic filtering, the speaker reflections, the cabinet and the
+// undersampling around it only differ in their voicing.
+// Left and right are processed as two lanes of the same arrays.
+
+// Fixed biquad lowpasses for ultrasonics, six of them at one cutoff
+#define AMP_FIX_STAGES 6
+
+typedef struct {
+	double a0;
+	double a1;
+	double a2;
+	double b1;
+	double b2;
+	double s1[2];
+	double s2[2];
+} AmpFix;
+
+static const double ampFixReso[AMP_FIX_STAGES] = {4.46570214, 1.51387132, 0.93979296, 0.70710678, 0.52972649, 0.50316379};
+
+static inline void amp_fix_reset(AmpFix fix[AMP_FIX_STAGES])
+{
+	for (int stage = 0; stage < AMP_FIX_STAGES; stage++) {
+		fix[stage].a0 = fix[stage].a1 = fix[stage].a2 = 0.0;
+		fix[stage].b1 = fix[stage].b2 = 0.0;
+		for (int c = 0; c < 2; c++) fix[stage].s1[c] = fix[stage].s2[c] = 0.0;
+	}
+}
+
+static inline void amp_fix_set(AmpFix fix[AMP_FIX_STAGES], double cutoff)
+{
+	double K = tan(M_PI * cutoff); // lowpass
+	for (int stage = 0; stage < AMP_FIX_STAGES; stage++) {
+		double reso = ampFixReso[stage];
+		double norm = 1.0 / (1.0 + K / reso + K * K);
+		fix[stage].a0 = K * K * norm;
+		fix[stage].a1 = 2.0 * fix[stage].a0;
+		fix[stage].a2 = fix[stage].a0;
+		fix[stage].b1 = 2.0 * (K * K - 1.0) * norm;
+		fix[stage].b2 = (1.0 - K / reso + K * K) * norm;
+	}
+}
+
+static inline void amp_fix_process(AmpFix* fix, double* inputSampleL, double* inputSampleR)
+{
+	double sample[2] = {*inputSampleL, *inputSampleR};
+	for (int c = 0; c < 2; c++) {
+		double outSample = (sample[c] * fix->a0) + fix->s1[c];
+		fix->s1[c] = (sample[c] * fix->a1) - (outSample * fix->b1) + fix->s2[c];
+		fix->s2[c] = (sample[c] * fix->a2) - (outSample * fix->b2);
+		sample[c] = outSample; // fixed biquad filtering ultrasonics
+	}
+	*inputSampleL = sample[0];
+	*inputSampleR = sample[1];
+}
+
+// Speaker reflections: the sample is written twice into a 128 sample window so
+// that the taps at down, side and diagonal never wrap. Odd and even samples
+// get their own window.
+typedef struct {
+	double odd[257][2];
+	double even[257][2];
+	int count;
+	bool flip;
+} AmpSpeaker;
+
+static inline void amp_speaker_reset(AmpSpeaker* speaker)
+{
+	for (int fcount = 0; fcount < 257; fcount++) {
+		for (int c = 0; c < 2; c++) speaker->odd[fcount][c] = speaker->even[fcount][c] = 0.0;
+	}
+	speaker->count = 0;
+	speaker->flip = false;
+}
+
+// Replaces the samples by the sum of their reflections at offsets[0..taps-1]
+static inline void amp_speaker_process(AmpSpeaker* speaker, const int* offsets, int taps, double* sampleL, double* sampleR)
+{
+	double sample[2] = {*sampleL, *sampleR};
+	double(*window)[2] = speaker->flip ? speaker->odd : speaker->even;
+
+	if (speaker->count < 0 || speaker->count > 128) speaker->count = 128;
+	for (int c = 0; c < 2; c++) {
+		window[speaker->count + 128][c] = window[speaker->count][c] = sample[c];
+		double result = window[speaker->count + offsets[0]][c];
+		for (int tap = 1; tap < taps; tap++) result += window[speaker->count + offsets[tap]][c];
+		sample[c] = result;
+	}
+	speaker->count--;
+	speaker->flip = !speaker->flip;
+
+	*sampleL = sample[0];
+	*sampleR = sample[1];
+}
+
+// Cabinet: a convolution with a slight nonlinearity per tap, smoothed before and
+// after. The history is a ring buffer written twice, so b[k] is always
+// history[position + k] without wrapping, and the taps run over both lanes.
+#define AMP_CAB_SIZE 90
+
+typedef struct {
+	const double (*taps)[2]; // tap k (from 1) adds b[k] * (taps[k - 1][0] + taps[k - 1][1] * |b[k]|)
+	int length;
+	double randomness[2]; // how much of the last cab sample to blend in, scaled by fpd
+} AmpCabVoicing;
+
+typedef struct {
+	double history[AMP_CAB_SIZE * 2][2];
+	int position;
+	double smoothA[2];
+	double smoothB[2];
+	double lastSample[2];
+} AmpCab;
+
+static inline void amp_cab_reset(AmpCab* cab)
+{
+	for (int x = 0; x < AMP_CAB_SIZE * 2; x++) cab->history[x][0] = cab->history[x][1] = 0.0;
+	cab->position = 0;
+	for (int c = 0; c < 2; c++) cab->smoothA[c] = cab->smoothB[c] = cab->lastSample[c] = 0.0;
+}
+
+static inline void amp_cab_process(AmpCab* cab, const AmpCabVoicing* voicing, const uint32_t fpd[2], double wet, double outputlevel, double* inputSampleL, double* inputSampleR, double drySampleL, double drySampleR)
+{
+	double sample[2] = {*inputSampleL, *inputSampleR};
+	double drySample[2] = {drySampleL, drySampleR};
+
+	if (--cab->position < 0) cab->position = AMP_CAB_SIZE - 1;
+	double(*b)[2] = cab->history + cab->position;
+	for (int c = 0; c < 2; c++) {
+		double temp = (sample[c] + cab->smoothA[c]) / 3.0;
+		cab->smoothA[c] = sample[c];
+		sample[c] = temp;
+		b[0][c] = b[AMP_CAB_SIZE][c] = sample[c];
+	}
+
+	for (int k = 1; k <= voicing->length; k++) {
+		const double* tap = voicing->taps[k - 1];
+		for (int c = 0; c < 2; c++) sample[c] += (b[k][c] * (tap[0] + (tap[1] * fabs(b[k][c]))));
+	}
+
+	for (int c = 0; c < 2; c++) {
+		double temp = (sample[c] + cab->smoothB[c]) / 3.0;
+		cab->smoothB[c] = sample[c];
+		sample[c] = temp / 4.0;
+
+		double randy = (((double) fpd[c] / UINT32_MAX) * voicing->randomness[c]);
+		drySample[c] = ((((sample[c] * (1.0 - randy)) + (cab->lastSample[c] * randy)) * wet) + (drySample[c] * (1.0 - wet))) * outputlevel;
+		cab->lastSample[c] = sample[c];
+		sample[c] = drySample[c];
+	}
+
+	*inputSampleL = sample[0];
+	*inputSampleR = sample[1];
+}
+
+// Undersampling: above 44.1k the cabinet only runs every cycleEnd samples, and
+// the samples in between are interpolated from lastRef and then averaged.
+typedef struct {
+	double lastRef[10][2];
+	int cycle;
+} AmpUndersampling;
+
+static inline void amp_undersampling_reset(AmpUndersampling* undersampling)
+{
+	for (int fcount = 0; fcount < 10; fcount++) undersampling->lastRef[fcount][0] = undersampling->lastRef[fcount][1] = 0.0;
+	undersampling->cycle = 0;
+}
+
+static inline int amp_cycle_end(AmpUndersampling* undersampling, double overallscale)
+{
+	int cycleEnd = floor(overallscale);
+	if (cycleEnd < 1) cycleEnd = 1;
+	if (cycleEnd > 4) cycleEnd = 4;
+	// this is going to be 2 for 88.1 or 96k, 3 for silly people, 4 for 176 or 192k
+	if (undersampling->cycle > cycleEnd - 1) undersampling->cycle = cycleEnd - 1; // sanity check
+	return cycleEnd;
+}
+
+// Advances the cycle, true if this sample is the one to run the cabinet on
+static inline bool amp_undersampling_due(AmpUndersampling* undersampling, int cycleEnd)
+{
+	undersampling->cycle++;
+	return undersampling->cycle == cycleEnd;
+}
+
+// Stores the new cabinet output and the interpolated references leading up to it
+static inline void amp_undersampling_store(AmpUndersampling* undersampling, int cycleEnd, double inputSampleL, double inputSampleR)
+{
+	double(*lastRef)[2] = undersampling->lastRef;
+	double sample[2] = {inputSampleL, inputSampleR};
+
+	for (int c = 0; c < 2; c++) {
+		if (cycleEnd == 4) {
+			lastRef[0][c] = lastRef[4][c]; // start from previous last
+			lastRef[2][c] = (lastRef[0][c] + sample[c]) / 2; // half
+			lastRef[1][c] = (lastRef[0][c] + lastRef[2][c]) / 2; // one quarter
+			lastRef[3][c] = (lastRef[2][c] + sample[c]) / 2; // three quarters
+			lastRef[4][c] = sample[c]; // full
+		}
+		if (cycleEnd == 3) {
+			lastRef[0][c] = lastRef[3][c]; // start from previous last
+			lastRef[2][c] = (lastRef[0][c] + lastRef[0][c] + sample[c]) / 3; // third
+			lastRef[1][c] = (lastRef[0][c] + sample[c] + sample[c]) / 3; // two thirds
+			lastRef[3][c] = sample[c]; // full
+		}
+		if (cycleEnd == 2) {
+			lastRef[0][c] = lastRef[2][c]; // start from previous last
+			lastRef[1][c] = (lastRef[0][c] + sample[c]) / 2; // half
+			lastRef[2][c] = sample[c]; // full
+		}
+		if (cycleEnd == 1) lastRef[0][c] = sample[c];
+	}
+	undersampling->cycle = 0; // reset
+}
+
+// Reads the reference for this cycle through the multi-pole average
+static inline void amp_undersampling_read(AmpUndersampling* undersampling, int cycleEnd, double* inputSampleL, double* inputSampleR)
+{
+	double(*lastRef)[2] = undersampling->lastRef;
+	double sample[2];
+
+	for (int c = 0; c < 2; c++) {
+		sample[c] = lastRef[undersampling->cycle][c];
+		for (int pole = cycleEnd + 3; pole > 4; pole--) {
+			lastRef[8][c] = sample[c];
+			sample[c] = (sample[c] + lastRef[pole][c]) * 0.5;
+			lastRef[pole][c] = lastRef[8][c];
+		}
+	}
+
+	*inputSampleL = sample[0];
+	*inputSampleR = sample[1];
+}
+
+#endif
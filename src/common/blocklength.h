@@ -0,0 +1,67 @@
+#ifndef AIRWINDOWS_BLOCKLENGTH_H
+#define AIRWINDOWS_BLOCKLENGTH_H
+
+#include <lv2/atom/atom.h>
+#include <lv2/buf-size/buf-size.h>
+#include <lv2/core/lv2.h>
+#include <lv2/options/options.h>
+#include <lv2/urid/urid.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Block lengths the host announces at instantiate through the options and
+// buf-size features. Lengths the host doesn't announce are 0.
+
+typedef struct {
+	uint32_t nominal;
+	uint32_t max;
+	bool bounded; // run() never gets more than max frames
+} BlockLength;
+
+static inline BlockLength block_length_from_features(const LV2_Feature* const* features)
+{
+	BlockLength length = {0, 0, false};
+	const LV2_URID_Map* map = NULL;
+	const LV2_Options_Option* options = NULL;
+
+	for (int i = 0; features && features[i]; i++) {
+		if (!strcmp(features[i]->URI, LV2_URID__map)) {
+			map = (const LV2_URID_Map*) features[i]->data;
+		} else if (!strcmp(features[i]->URI, LV2_OPTIONS__options)) {
+			options = (const LV2_Options_Option*) features[i]->data;
+		} else if (!strcmp(features[i]->URI, LV2_BUF_SIZE__boundedBlockLength)) {
+			length.bounded = true;
+		}
+	}
+	if (!map || !options) {
+		length.bounded = false;
+		return length;
+	}
+
+	LV2_URID atomInt = map->map(map->handle, LV2_ATOM__Int);
+	LV2_URID nominalBlockLength = map->map(map->handle, LV2_BUF_SIZE__nominalBlockLength);
+	LV2_URID maxBlockLength = map->map(map->handle, LV2_BUF_SIZE__maxBlockLength);
+	for (const LV2_Options_Option* option = options; option->key; option++) {
+		if (option->type != atomInt || option->size != sizeof(int32_t)) continue;
+		int32_t value = *(const int32_t*) option->value;
+		if (value <= 0) continue;
+		if (option->key == nominalBlockLength) length.nominal = (uint32_t) value;
+		if (option->key == maxBlockLength) length.max = (uint32_t) value;
+	}
+	if (length.max == 0) length.bounded = false;
+	return length;
+}
+
+// Frames to process per pass over the block scratch buffers: a whole run if
+// the host bounds it, the usual run otherwise, within [fallback, limit]
+static inline uint32_t block_length_chunk(BlockLength length, uint32_t fallback, uint32_t limit)
+{
+	uint32_t chunk = length.bounded ? length.max : length.nominal;
+	if (chunk < fallback) chunk = fallback;
+	if (chunk > limit) chunk = limit;
+	return chunk;
+}
+
+#endif
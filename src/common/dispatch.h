@@ -0,0 +1,21 @@
+#ifndef AIRWINDOWS_DISPATCH_H
+#define AIRWINDOWS_DISPATCH_H
+
+#include <stdint.h>
+
+// Runtime CPU dispatch for the kernels that gain from a newer instruction set.
+// CPU_DISPATCH before a function has the compiler build it once per x86-64
+// level and pick the variant for the running CPU when the plugin is loaded,
+// through an ifunc, so this needs an ELF target with glibc. Most of the gain is
+// SSE4.1's roundsd for the floor() in the dither and the delay interpolation,
+// AVX2 adds a little more. AVX-512 was never faster than AVX2 on these kernels
+// and is left out. As contraction stays off in C99, all variants render the
+// same samples. Elsewhere CPU_DISPATCH is empty and the baseline is built.
+
+#if defined(AIRWINDOWS_CPU_DISPATCH) && defined(__x86_64__) && defined(__ELF__) && defined(__GLIBC__) && ((defined(__clang__) && __clang_major__ >= 14) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 11))
+#define CPU_DISPATCH __attribute__((target_clones("arch=x86-64-v3", "arch=x86-64-v2", "default")))
+#else
+#define CPU_DISPATCH
+#endif
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef AIRWINDOWS_FASTMATH_H
+#define AIRWINDOWS_FASTMATH_H
+
+#include <math.h>
+#include <stdint.h>
+
+// Math used per sample by the saturation stages. By default these are libm and
+// the plugins are bit-identical to the reference. With -Dfast_math=true
+// (AIRWINDOWS_FAST_MATH), sin and asin are replaced by polynomials which stay
+// far below the resolution of the 32 bit float output:
+//
+// fast_sin:  |error| <= 2.7e-11 for |x| < 2^20 (the saturators mostly clamp
+//            to [-pi/2, pi/2] anyway). Beyond that and for inf or nan, libm
+//            is used.
+// fast_asin: |error| <= 1.8e-11 on [-1, 1], nan outside like libm.
+//
+// fast_pow2i is exact and used in both modes.
+
+// Coefficients of x * q(x^2), fitted through Chebyshev interpolation of q
+#define FAST_SIN_C0 0.9999999999829193
+#define FAST_SIN_C1 -0.1666666661681625
+#define FAST_SIN_C2 0.008333330974228687
+#define FAST_SIN_C3 -0.00019840861181631608
+#define FAST_SIN_C4 2.752526991875962e-06
+#define FAST_SIN_C5 -2.3889219518205926e-08
+
+#define FAST_ASIN_C0 0.999999999986353
+#define FAST_ASIN_C1 0.16666667364193288
+#define FAST_ASIN_C2 0.0749994190874208
+#define FAST_ASIN_C3 0.04466113925610671
+#define FAST_ASIN_C4 0.03010250790248392
+#define FAST_ASIN_C5 0.024650855208165012
+#define FAST_ASIN_C6 0.00740103202406317
+#define FAST_ASIN_C7 0.034748394042253494
+
+// sin(x) for |x| <= pi/2, Estrin's scheme keeps the dependency chain short
+static inline double fast_sin_kernel(double x)
+{
+	double x2 = x * x;
+	double x4 = x2 * x2;
+	double x8 = x4 * x4;
+	double low = FAST_SIN_C0 + x2 * FAST_SIN_C1;
+	double mid = FAST_SIN_C2 + x2 * FAST_SIN_C3;
+	double high = FAST_SIN_C4 + x2 * FAST_SIN_C5;
+	return x * (low + x4 * mid + x8 * high);
+}
+
+static inline double fast_sin(double x)
+{
+#ifdef AIRWINDOWS_FAST_MATH
+	double a = fabs(x);
+	if (a <= 1.57079632679489661923) return fast_sin_kernel(x);
+	if (!(a < 1048576.0)) return sin(x);
+	// a = k * pi + r with r in [-pi/2, pi/2]. The high part of pi has 33
+	// significant bits, so k times it is exact for k < 2^20.
+	int32_t k = (int32_t) (a * 0.31830988618379067154 + 0.5);
+	double r = (a - k * 3.14159265346825122834) - k * 1.21542010130123844986e-10;
+	double p = fast_sin_kernel(r) * (double) (1 - 2 * (k & 1));
+	return copysign(1.0, x) * p;
+#else
+	return sin(x);
+#endif
+}
+
+static inline double fast_asin(double x)
+{
+#ifdef AIRWINDOWS_FAST_MATH
+	// The polynomial covers [0, 0.5], above that
+	// asin(a) = pi/2 - 2 * asin(sqrt((1 - a) / 2))
+	double a = fabs(x);
+	double s = a;
+	double z = a * a;
+	if (a > 0.5) {
+		z = (1.0 - a) * 0.5;
+		s = sqrt(z);
+	}
+	double z2 = z * z;
+	double z4 = z2 * z2;
+	double low = (FAST_ASIN_C0 + z * FAST_ASIN_C1) + z2 * (FAST_ASIN_C2 + z * FAST_ASIN_C3);
+	double high = (FAST_ASIN_C4 + z * FAST_ASIN_C5) + z2 * (FAST_ASIN_C6 + z * FAST_ASIN_C7);
+	double p = s * (low + z4 * high);
+	if (a > 0.5) p = 1.57079632679489661923 - 2.0 * p;
+	return copysign(p, x);
+#else
+	return asin(x);
+#endif
+}
+
+// 2^n for -1022 <= n <= 1023, the same as pow(2, n) without the libm call.
+// The float dithers scale by 2^(expon + 62), where expon comes from frexpf
+// and can't leave that range.
+static inline double fast_pow2i(int n)
+{
+	union {
+		uint64_t bits;
+		double value;
+	} pow2;
+	pow2.bits = (uint64_t) (n + 1023) << 52;
+	return pow2.value;
+}
+
+#endif
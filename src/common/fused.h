@@ -0,0 +1,24 @@
+#ifndef AIRWINDOWS_FUSED_H
+#define AIRWINDOWS_FUSED_H
+
+#include <lv2/core/lv2.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Extension data for hosts which run several plugins back to back, like
+// airwindows-render does for chains. process() runs the plugin's kernel in
+// place on double precision samples, one buffer per audio channel, with the
+// controls connected as for run(). A row of plugins can so share one scratch
+// buffer, skipping the float conversions in between: only the last one in the
+// row dithers to 32 bit float, the others pass on everything they computed.
+// Their noise generators still advance as in run(), since the plugins also
+// take their randomness for other things from them.
+
+#define AIRWINDOWS__fused "https://hannesbraun.net/ns/lv2/airwindows#fused"
+
+typedef struct {
+	void (*process)(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither);
+} AirwindowsFused;
+
+#endif
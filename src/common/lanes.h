@@ -0,0 +1,16 @@
+#ifndef AIRWINDOWS_LANES_H
+#define AIRWINDOWS_LANES_H
+
+// The plugins with a mono variant keep their per channel state in lanes, and
+// their kernel loops over the lanes once per stage, with the channel count a
+// constant 1 or 2. In stereo those loops have to be unrolled for the samples to
+// stay in registers, and GCC leaves the longer stages rolled unless told so.
+// LANES_UNROLL goes right before such a loop.
+
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 8)
+#define LANES_UNROLL _Pragma("GCC unroll 2")
+#else
+#define LANES_UNROLL
+#endif
+
+#endif
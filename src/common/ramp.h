@@ -0,0 +1,45 @@
+#ifndef AIRWINDOWS_RAMP_H
+#define AIRWINDOWS_RAMP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Sample-accurate automation without the host splitting blocks. Some plugins
+// have a CV variant, a second descriptor whose controls each get a CV port next
+// to the control port, which the host may leave unconnected. A connected CV
+// port overrides its control port: the plugin steps through the run RAMP_STEP
+// frames at a time and derives its coefficients from the CV once per step,
+// where it otherwise does once per run. Gains may additionally be ramped across
+// the step with ramp_to(). The plain descriptors have no CV ports, as some
+// hosts connect every CV port and feed silence to the ones nothing is routed
+// to, which would hold the controls at 0.
+
+#define RAMP_STEP 32
+
+// The control at frame, from the CV port if the host connected one. CV has no
+// strict bounds, so it's clamped to the 0 to 1 of the controls that have one.
+static inline float ramp_value(const float* control, const float* cv, uint32_t frame)
+{
+	if (!cv) return *control;
+	float value = cv[frame];
+	if (!(value >= 0.0f)) value = 0.0f;
+	if (value > 1.0f) value = 1.0f;
+	return value;
+}
+
+// Frames from frame up to the next coefficient update, the rest of the run
+// if no CV port is connected
+static inline uint32_t ramp_span(bool ramped, uint32_t frame, uint32_t sampleFrames)
+{
+	uint32_t span = sampleFrames - frame;
+	if (ramped && span > RAMP_STEP) span = RAMP_STEP;
+	return span;
+}
+
+// Per frame increment from a value to its target at the end of a span
+static inline double ramp_to(double value, double target, uint32_t span)
+{
+	return (target - value) / span;
+}
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef AIRWINDOWS_SILENCE_H
+#define AIRWINDOWS_SILENCE_H
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Sleeping through silence in the reverbs and delays. Once the input has been
+// silent and the output below SILENCE_FLOOR for longer than the plugin's tail,
+// the plugin writes zeros without processing until the input carries signal
+// again. The tail bounds how long the input can take to reach the output: the
+// plugins pass their delay memory per channel, times four if the delay lines
+// are undersampled (they run every cycleEnd samples, up to 4 at 192k).
+// The fpd noise the plugins substitute for digital silence comes out at around
+// 1e-7, so SILENCE_FLOOR sits above it.
+
+#define SILENCE_INPUT 1.18e-23 // the plugins' own threshold for digital silence
+#define SILENCE_FLOOR 1.0e-6 // -120 dBFS
+
+typedef struct {
+	uint32_t tail;
+	uint32_t quiet; // frames so far with silent input and output
+	uint32_t frames; // frames of the current run
+	bool inputSilent;
+	bool sleeping;
+} Silence;
+
+static inline void silence_reset(Silence* silence, uint32_t tail)
+{
+	silence->tail = tail;
+	silence->quiet = 0;
+	silence->frames = 0;
+	silence->inputSilent = false;
+	silence->sleeping = false;
+}
+
+// Called before processing, true if the run was handled by writing zeros.
+// The input is checked here because the host may process in place.
+static inline bool silence_skip(Silence* silence, const float* in1, const float* in2, float* out1, float* out2, uint32_t sampleFrames)
+{
+	silence->frames = sampleFrames;
+	silence->inputSilent = true;
+	for (uint32_t i = 0; i < sampleFrames; i++) {
+		if (!(fabsf(in1[i]) < SILENCE_INPUT) || !(fabsf(in2[i]) < SILENCE_INPUT)) {
+			silence->inputSilent = false;
+			break;
+		}
+	}
+
+	if (silence->inputSilent && silence->sleeping) {
+		memset(out1, 0, sampleFrames * sizeof(float));
+		memset(out2, 0, sampleFrames * sizeof(float));
+		return true;
+	}
+	silence->sleeping = false;
+	return false;
+}
+
+// Called after processing with the output of the run
+static inline void silence_track(Silence* silence, const float* out1, const float* out2)
+{
+	if (!silence->inputSilent) {
+		silence->quiet = 0;
+		return;
+	}
+
+	// only the quiet frames at the end of the run count, so search backwards
+	for (uint32_t i = silence->frames; i > 0; i--) {
+		if (!(fabsf(out1[i - 1]) < SILENCE_FLOOR) || !(fabsf(out2[i - 1]) < SILENCE_FLOOR)) {
+			silence->quiet = silence->frames - i;
+			return;
+		}
+	}
+	silence->quiet += silence->frames;
+	if (silence->quiet >= silence->tail) {
+		silence->quiet = silence->tail;
+		silence->sleeping = true;
+	}
+}
+
+#endif
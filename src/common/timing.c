@@ -0,0 +1,211 @@
+// Built into every plugin with -Dcpu_timing=true, see timing.h. The build
+// renames the plugin's lv2_descriptor() to airwindows_plugin_descriptor(), and
+// the one here wraps each of its descriptors: an instance gets a Timed around
+// the plugin's handle, and run() reads the clock before and after the plugin's.
+// The worker and fused extensions are passed on with the plugin's handle, the
+// plugins have no others.
+
+#undef lv2_descriptor
+#define _POSIX_C_SOURCE 199309L
+
+#include "fused.h"
+#include "timing.h"
+
+#include <lv2/core/lv2.h>
+#include <lv2/worker/worker.h>
+
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define MAX_DESCRIPTORS 16
+#define SMOOTHING (1.0 / 32.0)
+
+LV2_SYMBOL_EXPORT const LV2_Descriptor* airwindows_plugin_descriptor(uint32_t index);
+
+typedef struct {
+	const LV2_Descriptor* plugin;
+	LV2_Handle handle;
+	const AirwindowsFused* fused;
+	const LV2_Worker_Interface* worker;
+	AirwindowsTimingStats stats;
+} Timed;
+
+static LV2_Descriptor descriptors[MAX_DESCRIPTORS];
+
+// in µs
+static double now(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER counter, frequency;
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return counter.QuadPart * 1e6 / frequency.QuadPart;
+#else
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec * 1e6 + time.tv_nsec * 1e-3;
+#endif
+}
+
+static void count(Timed* timed, double start, uint32_t frames)
+{
+	const double elapsed = now() - start;
+	AirwindowsTimingStats* stats = &timed->stats;
+	stats->average = stats->blocks ? stats->average + (elapsed - stats->average) * SMOOTHING : elapsed;
+	if (elapsed > stats->peak) stats->peak = elapsed;
+	stats->blocks++;
+	stats->frames += frames;
+}
+
+static LV2_Handle instantiate(const LV2_Descriptor* descriptor, double rate, const char* bundlePath, const LV2_Feature* const* features)
+{
+	const LV2_Descriptor* plugin = airwindows_plugin_descriptor((uint32_t) (descriptor - descriptors));
+	Timed* timed = (Timed*) calloc(1, sizeof(Timed));
+	if (!timed) return NULL;
+
+	timed->plugin = plugin;
+	timed->handle = plugin->instantiate(plugin, rate, bundlePath, features);
+	if (!timed->handle) {
+		free(timed);
+		return NULL;
+	}
+	if (plugin->extension_data) {
+		timed->fused = (const AirwindowsFused*) plugin->extension_data(AIRWINDOWS__fused);
+		timed->worker = (const LV2_Worker_Interface*) plugin->extension_data(LV2_WORKER__interface);
+	}
+	return timed;
+}
+
+static void connect_port(LV2_Handle instance, uint32_t port, void* data)
+{
+	Timed* timed = (Timed*) instance;
+	timed->plugin->connect_port(timed->handle, port, data);
+}
+
+static void reset(LV2_Handle instance)
+{
+	Timed* timed = (Timed*) instance;
+	memset(&timed->stats, 0, sizeof(AirwindowsTimingStats));
+}
+
+static void activate(LV2_Handle instance)
+{
+	Timed* timed = (Timed*) instance;
+	reset(instance);
+	timed->plugin->activate(timed->handle);
+}
+
+static void run(LV2_Handle instance, uint32_t sampleFrames)
+{
+	Timed* timed = (Timed*) instance;
+	const double start = now();
+	timed->plugin->run(timed->handle, sampleFrames);
+	count(timed, start, sampleFrames);
+}
+
+static void deactivate(LV2_Handle instance)
+{
+	Timed* timed = (Timed*) instance;
+	timed->plugin->deactivate(timed->handle);
+}
+
+static void cleanup(LV2_Handle instance)
+{
+	Timed* timed = (Timed*) instance;
+	timed->plugin->cleanup(timed->handle);
+	free(timed);
+}
+
+static void read_stats(LV2_Handle instance, AirwindowsTimingStats* stats)
+{
+	*stats = ((Timed*) instance)->stats;
+}
+
+static void process(LV2_Handle instance, double* const* samples, uint32_t sampleFrames, bool dither)
+{
+	Timed* timed = (Timed*) instance;
+	const double start = now();
+	timed->fused->process(timed->handle, samples, sampleFrames, dither);
+	count(timed, start, sampleFrames);
+}
+
+static LV2_Worker_Status work(LV2_Handle instance, LV2_Worker_Respond_Function respond, LV2_Worker_Respond_Handle handle, uint32_t size, const void* data)
+{
+	Timed* timed = (Timed*) instance;
+	return timed->worker->work(timed->handle, respond, handle, size, data);
+}
+
+static LV2_Worker_Status work_response(LV2_Handle instance, uint32_t size, const void* body)
+{
+	Timed* timed = (Timed*) instance;
+	return timed->worker->work_response(timed->handle, size, body);
+}
+
+static LV2_Worker_Status end_run(LV2_Handle instance)
+{
+	Timed* timed = (Timed*) instance;
+	return timed->worker->end_run ? timed->worker->end_run(timed->handle) : LV2_WORKER_SUCCESS;
+}
+
+// extension_data() can't tell the descriptors apart, so each gets its own
+static const void* extension_data_of(uint32_t index, const char* uri)
+{
+	static const AirwindowsTiming timing = {read_stats, reset};
+	static const AirwindowsFused fused = {process};
+	static const LV2_Worker_Interface worker = {work, work_response, end_run};
+	if (!strcmp(uri, AIRWINDOWS__timing)) return &timing;
+
+	const LV2_Descriptor* plugin = airwindows_plugin_descriptor(index);
+	if (!plugin->extension_data || !plugin->extension_data(uri)) return NULL;
+	if (!strcmp(uri, AIRWINDOWS__fused)) return &fused;
+	if (!strcmp(uri, LV2_WORKER__interface)) return &worker;
+	return NULL;
+}
+
+#define EXTENSION_DATA(index) \
+	static const void* extension_data_##index(const char* uri) { return extension_data_of(index, uri); }
+EXTENSION_DATA(0)
+EXTENSION_DATA(1)
+EXTENSION_DATA(2)
+EXTENSION_DATA(3)
+EXTENSION_DATA(4)
+EXTENSION_DATA(5)
+EXTENSION_DATA(6)
+EXTENSION_DATA(7)
+EXTENSION_DATA(8)
+EXTENSION_DATA(9)
+EXTENSION_DATA(10)
+EXTENSION_DATA(11)
+EXTENSION_DATA(12)
+EXTENSION_DATA(13)
+EXTENSION_DATA(14)
+EXTENSION_DATA(15)
+
+static const void* (*const extension_data[MAX_DESCRIPTORS])(const char* uri) = {
+	extension_data_0, extension_data_1, extension_data_2, extension_data_3,
+	extension_data_4, extension_data_5, extension_data_6, extension_data_7,
+	extension_data_8, extension_data_9, extension_data_10, extension_data_11,
+	extension_data_12, extension_data_13, extension_data_14, extension_data_15};
+
+LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
+{
+	const LV2_Descriptor* plugin = airwindows_plugin_descriptor(index);
+	if (!plugin || index >= MAX_DESCRIPTORS) return NULL;
+
+	// the same values every time, so concurrent calls do no harm
+	LV2_Descriptor* descriptor = &descriptors[index];
+	descriptor->URI = plugin->URI;
+	descriptor->instantiate = instantiate;
+	descriptor->connect_port = connect_port;
+	descriptor->activate = plugin->activate ? activate : NULL;
+	descriptor->run = run;
+	descriptor->deactivate = plugin->deactivate ? deactivate : NULL;
+	descriptor->cleanup = cleanup;
+	descriptor->extension_data = extension_data[index];
+	return descriptor;
+}
@@ -0,0 +1,30 @@
+#ifndef AIRWINDOWS_TIMING_H
+#define AIRWINDOWS_TIMING_H
+
+#include <lv2/core/lv2.h>
+
+#include <stdint.h>
+
+// Extension data of plugins built with -Dcpu_timing=true, which clock every
+// run() of an instance (and process() of the fused extension) to tell which
+// of many instances in a session costs the most. Without the option the
+// plugins are built as usual and don't offer it. read() may be called from
+// any thread, it isn't synchronized with run(), so a block may be missing
+// from the values it returns.
+
+#define AIRWINDOWS__timing "https://hannesbraun.net/ns/lv2/airwindows#timing"
+
+typedef struct {
+	double average; // µs per block, smoothed over roughly the last 32 blocks
+	double peak; // µs of the slowest block
+	uint64_t blocks;
+	uint64_t frames;
+} AirwindowsTimingStats;
+
+// The stats count from activate() or the last reset()
+typedef struct {
+	void (*read)(LV2_Handle instance, AirwindowsTimingStats* stats);
+	void (*reset)(LV2_Handle instance);
+} AirwindowsTiming;
+
+#endif
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "../common/fastmath.h"
+
 #define CURVE_URI "https://hannesbraun.net/ns/lv2/airwindows/curve"
 
 typedef enum {
@@ -101,12 +103,12 @@ static void run(LV2_Handle instance, uint32_t sampleFrames)
 		curve->fpdL ^= curve->fpdL << 13;
 		curve->fpdL ^= curve->fpdL >> 17;
 		curve->fpdL ^= curve->fpdL << 5;
-		inputSampleL += (((double) curve->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleL += (((double) curve->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		frexpf((float) inputSampleR, &expon);
 		curve->fpdR ^= curve->fpdR << 13;
 		curve->fpdR ^= curve->fpdR >> 17;
 		curve->fpdR ^= curve->fpdR << 5;
-		inputSampleR += (((double) curve->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * pow(2, expon + 62));
+		inputSampleR += (((double) curve->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
 		// end 32 bit stereo floating point dither
 
 		*out1 = (float) inputSampleL;
@@ -0,0 +1,1650 @@
+#include <lv2/core/lv2.h>
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../common/fastmath.h"
+#include "../common/silence.h"
+
+#define M_PI 3.14159265358979323846264338327950288
+
+#define KPLATEA_URI "https://hannesbraun.net/ns/lv2/airwindows/kplatea"
+#define KPLATEB_URI "https://hannesbraun.net/ns/lv2/airwindows/kplateb"
+#define KPLATEC_URI "https://hannesbraun.net/ns/lv2/airwindows/kplatec"
+#define KPLATED_URI "https://hannesbraun.net/ns/lv2/airwindows/kplated"
+
+// kPlateA, kPlateB, kPlateC and kPlateD share the same 5x5 Householder matrix
+// engine and only differ in their voicing below. Each plugin gets its own run()
+// entry point handing its static voicing to the inlined engine, so the delay
+// lengths and stage selections are still compile-time constants per variant.
+
+typedef enum {
+	INPUT_L = 0,
+	INPUT_R = 1,
+	OUTPUT_L = 2,
+	OUTPUT_R = 3,
+	INPUT_PAD = 4,
+	DAMPING = 5,
+	LOW_CUT = 6,
+	PREDELAY = 7,
+	WETNESS = 8
+} PortIndex;
+
+#define predelay 24010
+// longest delay lines of all voicings, used for the buffer sizes
+#define maxEarlyA 103
+#define maxEarlyB 1123
+#define maxEarlyC 379
+#define maxEarlyD 619
+#define maxEarlyE 1433
+#define maxEarlyF 757
+#define maxEarlyG 1361
+#define maxEarlyH 47
+#define maxEarlyI 1093
+#define maxDelayA 631
+#define maxDelayB 281
+#define maxDelayC 137
+#define maxDelayD 709
+#define maxDelayE 401
+#define maxDelayF 163
+#define maxDelayG 409
+#define maxDelayH 37
+#define maxDelayI 659
+#define maxDelayJ 701
+#define maxDelayK 17
+#define maxDelayL 769
+#define maxDelayM 809
+#define maxDelayN 31
+#define maxDelayO 83
+#define maxDelayP 829
+#define maxDelayQ 127
+#define maxDelayR 691
+#define maxDelayS 5
+#define maxDelayT 613
+#define maxDelayU 857
+#define maxDelayV 449
+#define maxDelayW 53
+#define maxDelayX 607
+#define maxDelayY 193
+
+typedef struct {
+	int earlyA, earlyB, earlyC, earlyD, earlyE, earlyF, earlyG, earlyH, earlyI;
+	int delayA, delayB, delayC, delayD, delayE;
+	int delayF, delayG, delayH, delayI, delayJ;
+	int delayK, delayL, delayM, delayN, delayO;
+	int delayP, delayQ, delayR, delayS, delayT;
+	int delayU, delayV, delayW, delayX, delayY;
+	double regenScale;
+	double regenOffset;
+	double fixAFreq;
+	double fixAReso;
+	double fixBReso;
+	double fixCReso;
+	double fixDFreq;
+	double fixDReso;
+	int inputAverages; // 10k filter stages before the first highpass
+	bool sinInput;
+	double inputTrim;
+	bool inputCurve;
+	bool overdrive;
+	bool mulchA, mulchB, mulchC;
+	bool swapFeedbackCO;
+	bool swapFeedbackDTEY;
+	int outputAverages;
+	bool asinOutput;
+} KPlateVoicing;
+
+static const KPlateVoicing voicingA = {
+	61, 499, 107, 127, 607, 313, 563, 47, 409, // 37 ms, 170 seat club
+	631, 281, 97, 709, 307,
+	149, 313, 37, 659, 701,
+	13, 733, 773, 23, 61,
+	787, 83, 691, 5, 587,
+	829, 449, 53, 503, 181, // 86 ms, 882 seat hall. Scarcity, 1 in 41582
+	.regenScale = 0.415,
+	.regenOffset = 0.16,
+	.fixAFreq = 46.0,
+	.fixAReso = 0.0061504,
+	.fixBReso = 0.0045802,
+	.fixCReso = 0.0030101,
+	.fixDFreq = 22.0,
+	.fixDReso = 0.00144,
+	.inputAverages = 1,
+	.sinInput = false,
+	.inputTrim = 0.5,
+	.inputCurve = false,
+	.overdrive = true,
+	.mulchA = true,
+	.mulchB = true,
+	.mulchC = true,
+	.swapFeedbackCO = false,
+	.swapFeedbackDTEY = false,
+	.outputAverages = 1,
+	.asinOutput = false
+};
+
+static const KPlateVoicing voicingB = {
+	97, 1123, 379, 619, 1187, 757, 1151, 13, 1093, // 78 ms, 732 seat theater
+	631, 251, 137, 673, 293,
+	163, 389, 37, 641, 661,
+	17, 719, 787, 31, 83,
+	823, 127, 653, 3, 613,
+	857, 431, 53, 607, 193, // 86 ms, 883 seat hall. Scarcity, 1 in 34934
+	.regenScale = 0.415,
+	.regenOffset = 0.1,
+	.fixAFreq = 12.0,
+	.fixAReso = 0.0015625,
+	.fixBReso = 0.0011425,
+	.fixCReso = 0.0007225,
+	.fixDFreq = 26.0,
+	.fixDReso = 0.0003025,
+	.inputAverages = 2,
+	.sinInput = false,
+	.inputTrim = 0.25,
+	.inputCurve = true,
+	.overdrive = true,
+	.mulchA = false,
+	.mulchB = true,
+	.mulchC = true,
+	.swapFeedbackCO = false,
+	.swapFeedbackDTEY = false,
+	.outputAverages = 3,
+	.asinOutput = false
+};
+
+static const KPlateVoicing voicingC = {
+	31, 661, 73, 137, 811, 269, 701, 7, 449, // 49 ms, 288 seat club
+	547, 149, 67, 619, 241,
+	79, 359, 19, 557, 601,
+	7, 769, 809, 17, 41,
+	829, 47, 569, 3, 509,
+	857, 433, 29, 449, 137, // 84 ms, 843 seat hall. Scarcity, 1 in 188924
+	.regenScale = 0.415,
+	.regenOffset = 0.1,
+	.fixAFreq = 21.0,
+	.fixAReso = 0.0020736,
+	.fixBReso = 0.0019285,
+	.fixCReso = 0.0017834,
+	.fixDFreq = 25.0,
+	.fixDReso = 0.0016384,
+	.inputAverages = 1,
+	.sinInput = false,
+	.inputTrim = 0.25,
+	.inputCurve = true,
+	.overdrive = true,
+	.mulchA = false,
+	.mulchB = false,
+	.mulchC = false,
+	.swapFeedbackCO = true,
+	.swapFeedbackDTEY = false,
+	.outputAverages = 2,
+	.asinOutput = false
+};
+
+static const KPlateVoicing voicingD = {
+	103, 709, 151, 263, 1433, 593, 1361, 31, 691, // 79 ms, 750 seat theater. Scarcity, 1 in 60270
+	619, 181, 101, 677, 401,
+	151, 409, 31, 641, 661,
+	11, 691, 719, 17, 61,
+	743, 89, 659, 5, 547,
+	769, 421, 47, 521, 163, // 80 ms, 778 seat theater. Scarcity, 1 in 94194
+	.regenScale = 0.425,
+	.regenOffset = 0.16,
+	.fixAFreq = 20.0,
+	.fixAReso = 0.0018769,
+	.fixBReso = 0.0020834,
+	.fixCReso = 0.0022899,
+	.fixDFreq = 14.0,
+	.fixDReso = 0.0024964,
+	.inputAverages = 1,
+	.sinInput = true,
+	.inputTrim = 0.5,
+	.inputCurve = false,
+	.overdrive = false,
+	.mulchA = false,
+	.mulchB = true,
+	.mulchC = true,
+	.swapFeedbackCO = false,
+	.swapFeedbackDTEY = true,
+	.outputAverages = 2,
+	.asinOutput = true
+};
+
+enum {
+	fix_freq,
+	fix_reso,
+	fix_a0,
+	fix_a1,
+	fix_a2,
+	fix_b1,
+	fix_b2,
+	fix_sL1,
+	fix_sL2,
+	fix_sR1,
+	fix_sR2,
+	fix_total
+}; // fixed frequency biquad filter for ultrasonics, stereo
+
+typedef struct {
+	double sampleRate;
+	const float* input[2];
+	float* output[2];
+	const float* inputPad;
+	const float* damping;
+	const float* lowCut;
+	const float* predelayS;
+	const float* wetness;
+
+	double iirAL;
+	double iirBL;
+
+	double gainIn;
+	double gainOutL;
+	double gainOutR;
+
+	double eAL[maxEarlyA + 5];
+	double eBL[maxEarlyB + 5];
+	double eCL[maxEarlyC + 5];
+	double eDL[maxEarlyD + 5];
+	double eEL[maxEarlyE + 5];
+	double eFL[maxEarlyF + 5];
+	double eGL[maxEarlyG + 5];
+	double eHL[maxEarlyH + 5];
+	double eIL[maxEarlyI + 5];
+
+	double eAR[maxEarlyA + 5];
+	double eBR[maxEarlyB + 5];
+	double eCR[maxEarlyC + 5];
+	double eDR[maxEarlyD + 5];
+	double eER[maxEarlyE + 5];
+	double eFR[maxEarlyF + 5];
+	double eGR[maxEarlyG + 5];
+	double eHR[maxEarlyH + 5];
+	double eIR[maxEarlyI + 5];
+
+	int earlyAL, earlyAR;
+	int earlyBL, earlyBR;
+	int earlyCL, earlyCR;
+	int earlyDL, earlyDR;
+	int earlyEL, earlyER;
+	int earlyFL, earlyFR;
+	int earlyGL, earlyGR;
+	int earlyHL, earlyHR;
+	int earlyIL, earlyIR;
+
+	double aAL[maxDelayA + 5];
+	double aBL[maxDelayB + 5];
+	double aCL[maxDelayC + 5];
+	double aDL[maxDelayD + 5];
+	double aEL[maxDelayE + 5];
+	double aFL[maxDelayF + 5];
+	double aGL[maxDelayG + 5];
+	double aHL[maxDelayH + 5];
+	double aIL[maxDelayI + 5];
+	double aJL[maxDelayJ + 5];
+	double aKL[maxDelayK + 5];
+	double aLL[maxDelayL + 5];
+	double aML[maxDelayM + 5];
+	double aNL[maxDelayN + 5];
+	double aOL[maxDelayO + 5];
+	double aPL[maxDelayP + 5];
+	double aQL[maxDelayQ + 5];
+	double aRL[maxDelayR + 5];
+	double aSL[maxDelayS + 5];
+	double aTL[maxDelayT + 5];
+	double aUL[maxDelayU + 5];
+	double aVL[maxDelayV + 5];
+	double aWL[maxDelayW + 5];
+	double aXL[maxDelayX + 5];
+	double aYL[maxDelayY + 5];
+
+	double aAR[maxDelayA + 5];
+	double aBR[maxDelayB + 5];
+	double aCR[maxDelayC + 5];
+	double aDR[maxDelayD + 5];
+	double aER[maxDelayE + 5];
+	double aFR[maxDelayF + 5];
+	double aGR[maxDelayG + 5];
+	double aHR[maxDelayH + 5];
+	double aIR[maxDelayI + 5];
+	double aJR[maxDelayJ + 5];
+	double aKR[maxDelayK + 5];
+	double aLR[maxDelayL + 5];
+	double aMR[maxDelayM + 5];
+	double aNR[maxDelayN + 5];
+	double aOR[maxDelayO + 5];
+	double aPR[maxDelayP + 5];
+	double aQR[maxDelayQ + 5];
+	double aRR[maxDelayR + 5];
+	double aSR[maxDelayS + 5];
+	double aTR[maxDelayT + 5];
+	double aUR[maxDelayU + 5];
+	double aVR[maxDelayV + 5];
+	double aWR[maxDelayW + 5];
+	double aXR[maxDelayX + 5];
+	double aYR[maxDelayY + 5];
+
+	double aZL[predelay + 5];
+	double aZR[predelay + 5];
+
+	double feedbackAL;
+	double feedbackBL;
+	double feedbackCL;
+	double feedbackDL;
+	double feedbackEL;
+
+	double feedbackER;
+	double feedbackJR;
+	double feedbackOR;
+	double feedbackTR;
+	double feedbackYR;
+
+	double previousAL;
+	double previousBL;
+	double previousCL;
+	double previousDL;
+	double previousEL;
+
+	double lastRefL[7];
+
+	double iirAR;
+	double iirBR;
+
+	double previousAR;
+	double previousBR;
+	double previousCR;
+	double previousDR;
+	double previousER;
+
+	double lastRefR[7];
+
+	int countAL;
+	int countBL;
+	int countCL;
+	int countDL;
+	int countEL;
+	int countFL;
+	int countGL;
+	int countHL;
+	int countIL;
+	int countJL;
+	int countKL;
+	int countLL;
+	int countML;
+	int countNL;
+	int countOL;
+	int countPL;
+	int countQL;
+	int countRL;
+	int countSL;
+	int countTL;
+	int countUL;
+	int countVL;
+	int countWL;
+	int countXL;
+	int countYL;
+
+	int countAR;
+	int countBR;
+	int countCR;
+	int countDR;
+	int countER;
+	int countFR;
+	int countGR;
+	int countHR;
+	int countIR;
+	int countJR;
+	int countKR;
+	int countLR;
+	int countMR;
+	int countNR;
+	int countOR;
+	int countPR;
+	int countQR;
+	int countRR;
+	int countSR;
+	int countTR;
+	int countUR;
+	int countVR;
+	int countWR;
+	int countXR;
+	int countYR;
+
+	int countZ;
+
+	int cycle;
+	double fixA[fix_total];
+	double fixB[fix_total];
+	double fixC[fix_total];
+	double fixD[fix_total];
+	bool fixReady; // the fix banks only depend on the sample rate
+
+	double prevMulchAL;
+	double prevMulchAR;
+	double prevMulchBL;
+	double prevMulchBR;
+	double prevMulchCL;
+	double prevMulchCR;
+	double prevMulchDL;
+	double prevMulchDR;
+	double prevMulchEL;
+	double prevMulchER;
+
+	double prevOutL[3];
+	double prevOutR[3];
+
+	double prevInL[2];
+	double prevInR[2];
+	double prevInPostL;
+	double prevInPostR;
+
+	uint32_t fpdL;
+	uint32_t fpdR;
+
+	Silence silence;
+} KPlate;
+
+static LV2_Handle instantiate(
+	const LV2_Descriptor* descriptor,
+	double rate,
+	const char* bundle_path,
+	const LV2_Feature* const* features)
+{
+	KPlate* kPlate = (KPlate*) calloc(1, sizeof(KPlate));
+	kPlate->sampleRate = rate;
+	return (LV2_Handle) kPlate;
+}
+
+static void connect_port(LV2_Handle instance, uint32_t port, void* data)
+{
+	KPlate* kPlate = (KPlate*) instance;
+
+	switch ((PortIndex) port) {
+		case INPUT_L:
+			kPlate->input[0] = (const float*) data;
+			break;
+		case INPUT_R:
+			kPlate->input[1] = (const float*) data;
+			break;
+		case OUTPUT_L:
+			kPlate->output[0] = (float*) data;
+			break;
+		case OUTPUT_R:
+			kPlate->output[1] = (float*) data;
+			break;
+		case INPUT_PAD:
+			kPlate->inputPad = (const float*) data;
+			break;
+		case DAMPING:
+			kPlate->damping = (const float*) data;
+			break;
+		case LOW_CUT:
+			kPlate->lowCut = (const float*) data;
+			break;
+		case PREDELAY:
+			kPlate->predelayS = (const float*) data;
+			break;
+		case WETNESS:
+			kPlate->wetness = (const float*) data;
+			break;
+	}
+}
+
+static void activate(LV2_Handle instance)
+{
+	KPlate* kPlate = (KPlate*) instance;
+
+	kPlate->iirAL = 0.0;
+	kPlate->iirBL = 0.0;
+
+	kPlate->iirAR = 0.0;
+	kPlate->iirBR = 0.0;
+
+	kPlate->gainIn = kPlate->gainOutL = kPlate->gainOutR = 1.0;
+
+	for (int count = 0; count < maxDelayA + 2; count++) {
+		kPlate->aAL[count] = 0.0;
+		kPlate->aAR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayB + 2; count++) {
+		kPlate->aBL[count] = 0.0;
+		kPlate->aBR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayC + 2; count++) {
+		kPlate->aCL[count] = 0.0;
+		kPlate->aCR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayD + 2; count++) {
+		kPlate->aDL[count] = 0.0;
+		kPlate->aDR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayE + 2; count++) {
+		kPlate->aEL[count] = 0.0;
+		kPlate->aER[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayF + 2; count++) {
+		kPlate->aFL[count] = 0.0;
+		kPlate->aFR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayG + 2; count++) {
+		kPlate->aGL[count] = 0.0;
+		kPlate->aGR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayH + 2; count++) {
+		kPlate->aHL[count] = 0.0;
+		kPlate->aHR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayI + 2; count++) {
+		kPlate->aIL[count] = 0.0;
+		kPlate->aIR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayJ + 2; count++) {
+		kPlate->aJL[count] = 0.0;
+		kPlate->aJR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayK + 2; count++) {
+		kPlate->aKL[count] = 0.0;
+		kPlate->aKR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayL + 2; count++) {
+		kPlate->aLL[count] = 0.0;
+		kPlate->aLR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayM + 2; count++) {
+		kPlate->aML[count] = 0.0;
+		kPlate->aMR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayN + 2; count++) {
+		kPlate->aNL[count] = 0.0;
+		kPlate->aNR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayO + 2; count++) {
+		kPlate->aOL[count] = 0.0;
+		kPlate->aOR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayP + 2; count++) {
+		kPlate->aPL[count] = 0.0;
+		kPlate->aPR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayQ + 2; count++) {
+		kPlate->aQL[count] = 0.0;
+		kPlate->aQR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayR + 2; count++) {
+		kPlate->aRL[count] = 0.0;
+		kPlate->aRR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayS + 2; count++) {
+		kPlate->aSL[count] = 0.0;
+		kPlate->aSR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayT + 2; count++) {
+		kPlate->aTL[count] = 0.0;
+		kPlate->aTR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayU + 2; count++) {
+		kPlate->aUL[count] = 0.0;
+		kPlate->aUR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayV + 2; count++) {
+		kPlate->aVL[count] = 0.0;
+		kPlate->aVR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayW + 2; count++) {
+		kPlate->aWL[count] = 0.0;
+		kPlate->aWR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayX + 2; count++) {
+		kPlate->aXL[count] = 0.0;
+		kPlate->aXR[count] = 0.0;
+	}
+	for (int count = 0; count < maxDelayY + 2; count++) {
+		kPlate->aYL[count] = 0.0;
+		kPlate->aYR[count] = 0.0;
+	}
+
+	for (int count = 0; count < maxEarlyA + 2; count++) {
+		kPlate->eAL[count] = 0.0;
+		kPlate->eAR[count] = 0.0;
+	}
+	for (int count = 0; count < maxEarlyB + 2; count++) {
+		kPlate->eBL[count] = 0.0;
+		kPlate->eBR[count] = 0.0;
+	}
+	for (int count = 0; count < maxEarlyC + 2; count++) {
+		kPlate->eCL[count] = 0.0;
+		kPlate->eCR[count] = 0.0;
+	}
+	for (int count = 0; count < maxEarlyD + 2; count++) {
+		kPlate->eDL[count] = 0.0;
+		kPlate->eDR[count] = 0.0;
+	}
+	for (int count = 0; count < maxEarlyE + 2; count++) {
+		kPlate->eEL[count] = 0.0;
+		kPlate->eER[count] = 0.0;
+	}
+	for (int count = 0; count < maxEarlyF + 2; count++) {
+		kPlate->eFL[count] = 0.0;
+		kPlate->eFR[count] = 0.0;
+	}
+	for (int count = 0; count < maxEarlyG + 2; count++) {
+		kPlate->eGL[count] = 0.0;
+		kPlate->eGR[count] = 0.0;
+	}
+	for (int count = 0; count < maxEarlyH + 2; count++) {
+		kPlate->eHL[count] = 0.0;
+		kPlate->eHR[count] = 0.0;
+	}
+	for (int count = 0; count < maxEarlyI + 2; count++) {
+		kPlate->eIL[count] = 0.0;
+		kPlate->eIR[count] = 0.0;
+	}
+
+	for (int count = 0; count < predelay + 2; count++) {
+		kPlate->aZL[count] = 0.0;
+		kPlate->aZR[count] = 0.0;
+	}
+
+	kPlate->feedbackAL = 0.0;
+	kPlate->feedbackBL = 0.0;
+	kPlate->feedbackCL = 0.0;
+	kPlate->feedbackDL = 0.0;
+	kPlate->feedbackEL = 0.0;
+
+	kPlate->previousAL = 0.0;
+	kPlate->previousBL = 0.0;
+	kPlate->previousCL = 0.0;
+	kPlate->previousDL = 0.0;
+	kPlate->previousEL = 0.0;
+
+	kPlate->feedbackER = 0.0;
+	kPlate->feedbackJR = 0.0;
+	kPlate->feedbackOR = 0.0;
+	kPlate->feedbackTR = 0.0;
+	kPlate->feedbackYR = 0.0;
+
+	kPlate->previousAR = 0.0;
+	kPlate->previousBR = 0.0;
+	kPlate->previousCR = 0.0;
+	kPlate->previousDR = 0.0;
+	kPlate->previousER = 0.0;
+
+	kPlate->prevMulchAL = 0.0;
+	kPlate->prevMulchAR = 0.0;
+	kPlate->prevMulchBL = 0.0;
+	kPlate->prevMulchBR = 0.0;
+	kPlate->prevMulchCL = 0.0;
+	kPlate->prevMulchCR = 0.0;
+	kPlate->prevMulchDL = 0.0;
+	kPlate->prevMulchDR = 0.0;
+	kPlate->prevMulchEL = 0.0;
+	kPlate->prevMulchER = 0.0;
+
+	for (int x = 0; x < 3; x++) {
+		kPlate->prevOutL[x] = 0.0;
+		kPlate->prevOutR[x] = 0.0;
+	}
+
+	for (int x = 0; x < 2; x++) {
+		kPlate->prevInL[x] = 0.0;
+		kPlate->prevInR[x] = 0.0;
+	}
+	kPlate->prevInPostL = 0.0;
+	kPlate->prevInPostR = 0.0;
+
+	for (int count = 0; count < 6; count++) {
+		kPlate->lastRefL[count] = 0.0;
+		kPlate->lastRefR[count] = 0.0;
+	}
+
+	kPlate->earlyAL = 1;
+	kPlate->earlyBL = 1;
+	kPlate->earlyCL = 1;
+	kPlate->earlyDL = 1;
+	kPlate->earlyEL = 1;
+	kPlate->earlyFL = 1;
+	kPlate->earlyGL = 1;
+	kPlate->earlyHL = 1;
+	kPlate->earlyIL = 1;
+
+	kPlate->earlyAR = 1;
+	kPlate->earlyBR = 1;
+	kPlate->earlyCR = 1;
+	kPlate->earlyDR = 1;
+	kPlate->earlyER = 1;
+	kPlate->earlyFR = 1;
+	kPlate->earlyGR = 1;
+	kPlate->earlyHR = 1;
+	kPlate->earlyIR = 1;
+
+	kPlate->countAL = 1;
+	kPlate->countBL = 1;
+	kPlate->countCL = 1;
+	kPlate->countDL = 1;
+	kPlate->countEL = 1;
+	kPlate->countFL = 1;
+	kPlate->countGL = 1;
+	kPlate->countHL = 1;
+	kPlate->countIL = 1;
+	kPlate->countJL = 1;
+	kPlate->countKL = 1;
+	kPlate->countLL = 1;
+	kPlate->countML = 1;
+	kPlate->countNL = 1;
+	kPlate->countOL = 1;
+	kPlate->countPL = 1;
+	kPlate->countQL = 1;
+	kPlate->countRL = 1;
+	kPlate->countSL = 1;
+	kPlate->countTL = 1;
+	kPlate->countUL = 1;
+	kPlate->countVL = 1;
+	kPlate->countWL = 1;
+	kPlate->countXL = 1;
+	kPlate->countYL = 1;
+
+	kPlate->countAR = 1;
+	kPlate->countBR = 1;
+	kPlate->countCR = 1;
+	kPlate->countDR = 1;
+	kPlate->countER = 1;
+	kPlate->countFR = 1;
+	kPlate->countGR = 1;
+	kPlate->countHR = 1;
+	kPlate->countIR = 1;
+	kPlate->countJR = 1;
+	kPlate->countKR = 1;
+	kPlate->countLR = 1;
+	kPlate->countMR = 1;
+	kPlate->countNR = 1;
+	kPlate->countOR = 1;
+	kPlate->countPR = 1;
+	kPlate->countQR = 1;
+	kPlate->countRR = 1;
+	kPlate->countSR = 1;
+	kPlate->countTR = 1;
+	kPlate->countUR = 1;
+	kPlate->countVR = 1;
+	kPlate->countWR = 1;
+	kPlate->countXR = 1;
+	kPlate->countYR = 1;
+
+	kPlate->countZ = 1;
+
+	kPlate->cycle = 0;
+
+	for (int x = 0; x < fix_total; x++) {
+		kPlate->fixA[x] = 0.0;
+		kPlate->fixB[x] = 0.0;
+		kPlate->fixC[x] = 0.0;
+		kPlate->fixD[x] = 0.0;
+	}
+	kPlate->fixReady = false;
+	// from ZBandpass, so I can use enums with it
+
+	kPlate->fpdL = 1.0;
+	while (kPlate->fpdL < 16386) kPlate->fpdL = rand() * UINT32_MAX;
+	kPlate->fpdR = 1.0;
+	while (kPlate->fpdR < 16386) kPlate->fpdR = rand() * UINT32_MAX;
+
+	silence_reset(&kPlate->silence, 41361 * 4); // delay memory per channel, undersampled
+}
+
+static inline void run_voicing(KPlate* kPlate, uint32_t sampleFrames, const KPlateVoicing* v)
+{
+	const float* in1 = kPlate->input[0];
+	const float* in2 = kPlate->input[1];
+	float* out1 = kPlate->output[0];
+	float* out2 = kPlate->output[1];
+
+	if (silence_skip(&kPlate->silence, in1, in2, out1, out2, sampleFrames)) return;
+
+	double overallscale = 1.0;
+	overallscale /= 44100.0;
+	overallscale *= kPlate->sampleRate;
+	int cycleEnd = floor(overallscale);
+	if (cycleEnd < 1) cycleEnd = 1;
+	if (cycleEnd > 4) cycleEnd = 4;
+	// this is going to be 2 for 88.1 or 96k, 3 for silly people, 4 for 176 or 192k
+	if (kPlate->cycle > cycleEnd - 1) kPlate->cycle = cycleEnd - 1; // sanity check
+
+	double downRate = kPlate->sampleRate / cycleEnd;
+	// we now shift gears between 44.1k and 48k so our tone is the same, slight changes in delay times
+
+	double inputPad = *kPlate->inputPad;
+	double regen = ((*kPlate->damping / 10.0) * v->regenScale) + v->regenOffset;
+	regen = (regen * 0.0001) + 0.00024;
+	double iirAmount = ((*kPlate->lowCut / 3.0) * 0.3) + 0.04;
+	iirAmount = (iirAmount * 1000.0) / downRate;
+	double earlyVolume = *kPlate->predelayS; // predelay to a half-second
+	int adjPredelay = (downRate * earlyVolume);
+	double wet = *kPlate->wetness * 2.0;
+	double dry = 2.0 - wet;
+	if (wet > 1.0) wet = 1.0;
+	if (wet < 0.0) wet = 0.0;
+	if (dry > 1.0) dry = 1.0;
+	if (dry < 0.0) dry = 0.0;
+	// this reverb makes 50% full dry AND full wet, not crossfaded.
+	// that's so it can be on submixes without cutting back dry channel when adjusted:
+	// unless you go super heavy, you are only adjusting the added verb loudness.
+
+	if (!kPlate->fixReady) {
+		kPlate->fixA[fix_freq] = v->fixAFreq / downRate;
+		kPlate->fixA[fix_reso] = v->fixAReso;
+		kPlate->fixD[fix_freq] = v->fixDFreq / downRate;
+		kPlate->fixD[fix_reso] = v->fixDReso;
+		kPlate->fixB[fix_freq] = (kPlate->fixA[fix_freq] + kPlate->fixA[fix_freq] + kPlate->fixD[fix_freq]) / 3.0;
+		kPlate->fixB[fix_reso] = v->fixBReso;
+		kPlate->fixC[fix_freq] = (kPlate->fixA[fix_freq] + kPlate->fixD[fix_freq] + kPlate->fixD[fix_freq]) / 3.0;
+		kPlate->fixC[fix_reso] = v->fixCReso;
+		double K = tan(M_PI * kPlate->fixA[fix_freq]);
+		double norm = 1.0 / (1.0 + K / kPlate->fixA[fix_reso] + K * K);
+		kPlate->fixA[fix_a0] = K / kPlate->fixA[fix_reso] * norm;
+		kPlate->fixA[fix_a1] = 0.0;
+		kPlate->fixA[fix_a2] = -kPlate->fixA[fix_a0];
+		kPlate->fixA[fix_b1] = 2.0 * (K * K - 1.0) * norm;
+		kPlate->fixA[fix_b2] = (1.0 - K / kPlate->fixA[fix_reso] + K * K) * norm;
+		// stereo biquad bandpasses we can put into the reverb matrix
+		K = tan(M_PI * kPlate->fixB[fix_freq]);
+		norm = 1.0 / (1.0 + K / kPlate->fixB[fix_reso] + K * K);
+		kPlate->fixB[fix_a0] = K / kPlate->fixB[fix_reso] * norm;
+		kPlate->fixB[fix_a1] = 0.0;
+		kPlate->fixB[fix_a2] = -kPlate->fixB[fix_a0];
+		kPlate->fixB[fix_b1] = 2.0 * (K * K - 1.0) * norm;
+		kPlate->fixB[fix_b2] = (1.0 - K / kPlate->fixB[fix_reso] + K * K) * norm;
+		// stereo biquad bandpasses we can put into the reverb matrix
+		K = tan(M_PI * kPlate->fixC[fix_freq]);
+		norm = 1.0 / (1.0 + K / kPlate->fixC[fix_reso] + K * K);
+		kPlate->fixC[fix_a0] = K / kPlate->fixC[fix_reso] * norm;
+		kPlate->fixC[fix_a1] = 0.0;
+		kPlate->fixC[fix_a2] = -kPlate->fixC[fix_a0];
+		kPlate->fixC[fix_b1] = 2.0 * (K * K - 1.0) * norm;
+		kPlate->fixC[fix_b2] = (1.0 - K / kPlate->fixC[fix_reso] + K * K) * norm;
+		// stereo biquad bandpasses we can put into the reverb matrix
+		K = tan(M_PI * kPlate->fixD[fix_freq]);
+		norm = 1.0 / (1.0 + K / kPlate->fixD[fix_reso] + K * K);
+		kPlate->fixD[fix_a0] = K / kPlate->fixD[fix_reso] * norm;
+		kPlate->fixD[fix_a1] = 0.0;
+		kPlate->fixD[fix_a2] = -kPlate->fixD[fix_a0];
+		kPlate->fixD[fix_b1] = 2.0 * (K * K - 1.0) * norm;
+		kPlate->fixD[fix_b2] = (1.0 - K / kPlate->fixD[fix_reso] + K * K) * norm;
+		// stereo biquad bandpasses we can put into the reverb matrix
+		kPlate->fixReady = true;
+	}
+
+	while (sampleFrames-- > 0) {
+		double inputSampleL = *in1;
+		double inputSampleR = *in2;
+		if (fabs(inputSampleL) < 1.18e-23) inputSampleL = kPlate->fpdL * 1.18e-17;
+		if (fabs(inputSampleR) < 1.18e-23) inputSampleR = kPlate->fpdR * 1.18e-17;
+		double drySampleL = inputSampleL;
+		double drySampleR = inputSampleR;
+
+		kPlate->cycle++;
+		if (kPlate->cycle == cycleEnd) { // hit the end point and we do a reverb sample
+			if (inputPad < 1.0) {
+				inputSampleL *= inputPad;
+				inputSampleR *= inputPad;
+			}
+			double outSample;
+			for (int x = 0; x < v->inputAverages; x++) {
+				outSample = (inputSampleL + kPlate->prevInL[x]) * 0.5;
+				kPlate->prevInL[x] = inputSampleL;
+				inputSampleL = outSample;
+				outSample = (inputSampleR + kPlate->prevInR[x]) * 0.5;
+				kPlate->prevInR[x] = inputSampleR;
+				inputSampleR = outSample;
+			}
+			// 10k filter on input
+
+			if (v->sinInput) {
+				if (inputSampleL > 1.57079633) inputSampleL = 1.57079633;
+				if (inputSampleL < -1.57079633) inputSampleL = -1.57079633;
+				if (inputSampleR > 1.57079633) inputSampleR = 1.57079633;
+				if (inputSampleR < -1.57079633) inputSampleR = -1.57079633;
+				inputSampleL = fast_sin(inputSampleL);
+				inputSampleR = fast_sin(inputSampleR);
+				// amplitude aspect
+			}
+
+			kPlate->iirAL = (kPlate->iirAL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
+			inputSampleL = inputSampleL - kPlate->iirAL;
+			kPlate->iirAR = (kPlate->iirAR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
+			inputSampleR = inputSampleR - kPlate->iirAR;
+			// 600hz highpass on input
+
+			inputSampleL *= v->inputTrim;
+			inputSampleR *= v->inputTrim;
+			if (kPlate->gainIn < 0.0078125) kPlate->gainIn = 0.0078125;
+			if (kPlate->gainIn > 1.0) kPlate->gainIn = 1.0;
+			// gain of 1,0 gives you a super-clean one, gain of 2 is obviously compressing
+			// smaller number is maximum clamping, if too small it'll take a while to bounce back
+			inputSampleL *= kPlate->gainIn;
+			inputSampleR *= kPlate->gainIn;
+			kPlate->gainIn += sin((fabs(inputSampleL * 4) > 1) ? 4 : fabs(inputSampleL * 4)) * pow(inputSampleL, 4);
+			kPlate->gainIn += sin((fabs(inputSampleR * 4) > 1) ? 4 : fabs(inputSampleR * 4)) * pow(inputSampleR, 4);
+			// 4.71239 radians sined will turn to -1 which is the maximum gain reduction speed
+			if (v->inputCurve) {
+				inputSampleL *= 2.0;
+				inputSampleR *= 2.0;
+			}
+			// curve! To get a compressed effect that matches a certain other plugin
+			// that is too overprocessed for its own good :)
+
+			if (v->overdrive) {
+				// begin overdrive
+				if (inputSampleL > 1.4137166941154) inputSampleL = 1.4137166941154;
+				if (inputSampleL < -1.4137166941154) inputSampleL = -1.4137166941154;
+				if (inputSampleL > 0.0) inputSampleL = (inputSampleL / 2.0) * (2.8274333882308 - inputSampleL);
+				else inputSampleL = -(inputSampleL / -2.0) * (2.8274333882308 + inputSampleL);
+				// BigFastSin channel stage
+				if (inputSampleR > 1.4137166941154) inputSampleR = 1.4137166941154;
+				if (inputSampleR < -1.4137166941154) inputSampleR = -1.4137166941154;
+				if (inputSampleR > 0.0) inputSampleR = (inputSampleR / 2.0) * (2.8274333882308 - inputSampleR);
+				else inputSampleR = -(inputSampleR / -2.0) * (2.8274333882308 + inputSampleR);
+				// end overdrive
+			}
+
+			kPlate->iirBL = (kPlate->iirBL * (1.0 - iirAmount)) + (inputSampleL * iirAmount);
+			inputSampleL = inputSampleL - kPlate->iirBL;
+			kPlate->iirBR = (kPlate->iirBR * (1.0 - iirAmount)) + (inputSampleR * iirAmount);
+			inputSampleR = inputSampleR - kPlate->iirBR;
+			// 600hz highpass on input
+
+			outSample = (inputSampleL + kPlate->prevInPostL) * 0.5;
+			kPlate->prevInPostL = inputSampleL;
+			inputSampleL = outSample;
+			outSample = (inputSampleR + kPlate->prevInPostR) * 0.5;
+			kPlate->prevInPostR = inputSampleR;
+			inputSampleR = outSample;
+			// 10k filter on input
+
+			// begin allpasses
+			double oeAL = inputSampleL - (kPlate->eAL[(kPlate->earlyAL + 1) - ((kPlate->earlyAL + 1 > v->earlyA) ? v->earlyA + 1 : 0)] * 0.5);
+			double oeBL = inputSampleL - (kPlate->eBL[(kPlate->earlyBL + 1) - ((kPlate->earlyBL + 1 > v->earlyB) ? v->earlyB + 1 : 0)] * 0.5);
+			double oeCL = inputSampleL - (kPlate->eCL[(kPlate->earlyCL + 1) - ((kPlate->earlyCL + 1 > v->earlyC) ? v->earlyC + 1 : 0)] * 0.5);
+			double oeCR = inputSampleR - (kPlate->eCR[(kPlate->earlyCR + 1) - ((kPlate->earlyCR + 1 > v->earlyC) ? v->earlyC + 1 : 0)] * 0.5);
+			double oeFR = inputSampleR - (kPlate->eFR[(kPlate->earlyFR + 1) - ((kPlate->earlyFR + 1 > v->earlyF) ? v->earlyF + 1 : 0)] * 0.5);
+			double oeIR = inputSampleR - (kPlate->eIR[(kPlate->earlyIR + 1) - ((kPlate->earlyIR + 1 > v->earlyI) ? v->earlyI + 1 : 0)] * 0.5);
+
+			kPlate->eAL[kPlate->earlyAL] = oeAL;
+			oeAL *= 0.5;
+			kPlate->eBL[kPlate->earlyBL] = oeBL;
+			oeBL *= 0.5;
+			kPlate->eCL[kPlate->earlyCL] = oeCL;
+			oeCL *= 0.5;
+			kPlate->eCR[kPlate->earlyCR] = oeCR;
+			oeCR *= 0.5;
+			kPlate->eFR[kPlate->earlyFR] = oeFR;
+			oeFR *= 0.5;
+			kPlate->eIR[kPlate->earlyIR] = oeIR;
+			oeIR *= 0.5;
+
+			kPlate->earlyAL++;
+			if (kPlate->earlyAL < 0 || kPlate->earlyAL > v->earlyA) kPlate->earlyAL = 0;
+			kPlate->earlyBL++;
+			if (kPlate->earlyBL < 0 || kPlate->earlyBL > v->earlyB) kPlate->earlyBL = 0;
+			kPlate->earlyCL++;
+			if (kPlate->earlyCL < 0 || kPlate->earlyCL > v->earlyC) kPlate->earlyCL = 0;
+			kPlate->earlyCR++;
+			if (kPlate->earlyCR < 0 || kPlate->earlyCR > v->earlyC) kPlate->earlyCR = 0;
+			kPlate->earlyFR++;
+			if (kPlate->earlyFR < 0 || kPlate->earlyFR > v->earlyF) kPlate->earlyFR = 0;
+			kPlate->earlyIR++;
+			if (kPlate->earlyIR < 0 || kPlate->earlyIR > v->earlyI) kPlate->earlyIR = 0;
+
+			oeAL += kPlate->eAL[kPlate->earlyAL - ((kPlate->earlyAL > v->earlyA) ? v->earlyA + 1 : 0)];
+			oeBL += kPlate->eBL[kPlate->earlyBL - ((kPlate->earlyBL > v->earlyB) ? v->earlyB + 1 : 0)];
+			oeCL += kPlate->eCL[kPlate->earlyCL - ((kPlate->earlyCL > v->earlyC) ? v->earlyC + 1 : 0)];
+			oeCR += kPlate->eCR[kPlate->earlyCR - ((kPlate->earlyCR > v->earlyC) ? v->earlyC + 1 : 0)];
+			oeFR += kPlate->eFR[kPlate->earlyFR - ((kPlate->earlyFR > v->earlyF) ? v->earlyF + 1 : 0)];
+			oeIR += kPlate->eIR[kPlate->earlyIR - ((kPlate->earlyIR > v->earlyI) ? v->earlyI + 1 : 0)];
+
+			double oeDL = ((oeBL + oeCL) - oeAL) - (kPlate->eDL[(kPlate->earlyDL + 1) - ((kPlate->earlyDL + 1 > v->earlyD) ? v->earlyD + 1 : 0)] * 0.5);
+			double oeEL = ((oeAL + oeCL) - oeBL) - (kPlate->eEL[(kPlate->earlyEL + 1) - ((kPlate->earlyEL + 1 > v->earlyE) ? v->earlyE + 1 : 0)] * 0.5);
+			double oeFL = ((oeAL + oeBL) - oeCL) - (kPlate->eFL[(kPlate->earlyFL + 1) - ((kPlate->earlyFL + 1 > v->earlyF) ? v->earlyF + 1 : 0)] * 0.5);
+			double oeBR = ((oeFR + oeIR) - oeCR) - (kPlate->eBR[(kPlate->earlyBR + 1) - ((kPlate->earlyBR + 1 > v->earlyB) ? v->earlyB + 1 : 0)] * 0.5);
+			double oeER = ((oeCR + oeIR) - oeFR) - (kPlate->eER[(kPlate->earlyER + 1) - ((kPlate->earlyER + 1 > v->earlyE) ? v->earlyE + 1 : 0)] * 0.5);
+			double oeHR = ((oeCR + oeFR) - oeIR) - (kPlate->eHR[(kPlate->earlyHR + 1) - ((kPlate->earlyHR + 1 > v->earlyH) ? v->earlyH + 1 : 0)] * 0.5);
+
+			kPlate->eDL[kPlate->earlyDL] = oeDL;
+			oeDL *= 0.5;
+			kPlate->eEL[kPlate->earlyEL] = oeEL;
+			oeEL *= 0.5;
+			kPlate->eFL[kPlate->earlyFL] = oeFL;
+			oeFL *= 0.5;
+			kPlate->eBR[kPlate->earlyBR] = oeBR;
+			oeBR *= 0.5;
+			kPlate->eER[kPlate->earlyER] = oeER;
+			oeER *= 0.5;
+			kPlate->eHR[kPlate->earlyHR] = oeHR;
+			oeHR *= 0.5;
+
+			kPlate->earlyDL++;
+			if (kPlate->earlyDL < 0 || kPlate->earlyDL > v->earlyD) kPlate->earlyDL = 0;
+			kPlate->earlyEL++;
+			if (kPlate->earlyEL < 0 || kPlate->earlyEL > v->earlyE) kPlate->earlyEL = 0;
+			kPlate->earlyFL++;
+			if (kPlate->earlyFL < 0 || kPlate->earlyFL > v->earlyF) kPlate->earlyFL = 0;
+			kPlate->earlyBR++;
+			if (kPlate->earlyBR < 0 || kPlate->earlyBR > v->earlyB) kPlate->earlyBR = 0;
+			kPlate->earlyER++;
+			if (kPlate->earlyER < 0 || kPlate->earlyER > v->earlyE) kPlate->earlyER = 0;
+			kPlate->earlyHR++;
+			if (kPlate->earlyHR < 0 || kPlate->earlyHR > v->earlyH) kPlate->earlyHR = 0;
+
+			oeDL += kPlate->eDL[kPlate->earlyDL - ((kPlate->earlyDL > v->earlyD) ? v->earlyD + 1 : 0)];
+			oeEL += kPlate->eEL[kPlate->earlyEL - ((kPlate->earlyEL > v->earlyE) ? v->earlyE + 1 : 0)];
+			oeFL += kPlate->eFL[kPlate->earlyFL - ((kPlate->earlyFL > v->earlyF) ? v->earlyF + 1 : 0)];
+			oeBR += kPlate->eBR[kPlate->earlyBR - ((kPlate->earlyBR > v->earlyB) ? v->earlyB + 1 : 0)];
+			oeER += kPlate->eER[kPlate->earlyER - ((kPlate->earlyER > v->earlyE) ? v->earlyE + 1 : 0)];
+			oeHR += kPlate->eHR[kPlate->earlyHR - ((kPlate->earlyHR > v->earlyH) ? v->earlyH + 1 : 0)];
+
+			double oeGL = ((oeEL + oeFL) - oeDL) - (kPlate->eGL[(kPlate->earlyGL + 1) - ((kPlate->earlyGL + 1 > v->earlyG) ? v->earlyG + 1 : 0)] * 0.5);
+			double oeHL = ((oeDL + oeFL) - oeEL) - (kPlate->eHL[(kPlate->earlyHL + 1) - ((kPlate->earlyHL + 1 > v->earlyH) ? v->earlyH + 1 : 0)] * 0.5);
+			double oeIL = ((oeDL + oeEL) - oeFL) - (kPlate->eIL[(kPlate->earlyIL + 1) - ((kPlate->earlyIL + 1 > v->earlyI) ? v->earlyI + 1 : 0)] * 0.5);
+			double oeAR = ((oeER + oeHR) - oeBR) - (kPlate->eAR[(kPlate->earlyAR + 1) - ((kPlate->earlyAR + 1 > v->earlyA) ? v->earlyA + 1 : 0)] * 0.5);
+			double oeDR = ((oeBR + oeHR) - oeER) - (kPlate->eDR[(kPlate->earlyDR + 1) - ((kPlate->earlyDR + 1 > v->earlyD) ? v->earlyD + 1 : 0)] * 0.5);
+			double oeGR = ((oeBR + oeER) - oeHR) - (kPlate->eGR[(kPlate->earlyGR + 1) - ((kPlate->earlyGR + 1 > v->earlyG) ? v->earlyG + 1 : 0)] * 0.5);
+
+			kPlate->eGL[kPlate->earlyGL] = oeGL;
+			oeGL *= 0.5;
+			kPlate->eHL[kPlate->earlyHL] = oeHL;
+			oeHL *= 0.5;
+			kPlate->eIL[kPlate->earlyIL] = oeIL;
+			oeIL *= 0.5;
+			kPlate->eAR[kPlate->earlyAR] = oeAR;
+			oeAR *= 0.5;
+			kPlate->eDR[kPlate->earlyDR] = oeDR;
+			oeDR *= 0.5;
+			kPlate->eGR[kPlate->earlyGR] = oeGR;
+			oeGR *= 0.5;
+
+			kPlate->earlyGL++;
+			if (kPlate->earlyGL < 0 || kPlate->earlyGL > v->earlyG) kPlate->earlyGL = 0;
+			kPlate->earlyHL++;
+			if (kPlate->earlyHL < 0 || kPlate->earlyHL > v->earlyH) kPlate->earlyHL = 0;
+			kPlate->earlyIL++;
+			if (kPlate->earlyIL < 0 || kPlate->earlyIL > v->earlyI) kPlate->earlyIL = 0;
+			kPlate->earlyAR++;
+			if (kPlate->earlyAR < 0 || kPlate->earlyAR > v->earlyA) kPlate->earlyAR = 0;
+			kPlate->earlyDR++;
+			if (kPlate->earlyDR < 0 || kPlate->earlyDR > v->earlyD) kPlate->earlyDR = 0;
+			kPlate->earlyGR++;
+			if (kPlate->earlyGR < 0 || kPlate->earlyGR > v->earlyG) kPlate->earlyGR = 0;
+
+			oeGL += kPlate->eGL[kPlate->earlyGL - ((kPlate->earlyGL > v->earlyG) ? v->earlyG + 1 : 0)];
+			oeHL += kPlate->eHL[kPlate->earlyHL - ((kPlate->earlyHL > v->earlyH) ? v->earlyH + 1 : 0)];
+			oeIL += kPlate->eIL[kPlate->earlyIL - ((kPlate->earlyIL > v->earlyI) ? v->earlyI + 1 : 0)];
+			oeAR += kPlate->eAR[kPlate->earlyAR - ((kPlate->earlyAR > v->earlyA) ? v->earlyA + 1 : 0)];
+			oeDR += kPlate->eDR[kPlate->earlyDR - ((kPlate->earlyDR > v->earlyD) ? v->earlyD + 1 : 0)];
+			oeGR += kPlate->eGR[kPlate->earlyGR - ((kPlate->earlyGR > v->earlyG) ? v->earlyG + 1 : 0)];
+
+			// allpasses predelay
+			kPlate->aZL[kPlate->countZ] = (oeGL + oeHL + oeIL) * 0.25;
+			kPlate->aZR[kPlate->countZ] = (oeAR + oeDR + oeGR) * 0.25;
+			kPlate->countZ++;
+			if (kPlate->countZ < 0 || kPlate->countZ > adjPredelay) kPlate->countZ = 0;
+			inputSampleL = kPlate->aZL[kPlate->countZ - ((kPlate->countZ > adjPredelay) ? adjPredelay + 1 : 0)];
+			inputSampleR = kPlate->aZR[kPlate->countZ - ((kPlate->countZ > adjPredelay) ? adjPredelay + 1 : 0)];
+			// end allpasses
+
+			kPlate->aAL[kPlate->countAL] = inputSampleL + (kPlate->feedbackAL * regen);
+			kPlate->aBL[kPlate->countBL] = inputSampleL + (kPlate->feedbackBL * regen);
+			kPlate->aCL[kPlate->countCL] = inputSampleL + (kPlate->feedbackCL * regen);
+			kPlate->aDL[kPlate->countDL] = inputSampleL + (kPlate->feedbackDL * regen);
+			kPlate->aEL[kPlate->countEL] = inputSampleL + (kPlate->feedbackEL * regen);
+
+			kPlate->aER[kPlate->countER] = inputSampleR + (kPlate->feedbackER * regen);
+			kPlate->aJR[kPlate->countJR] = inputSampleR + (kPlate->feedbackJR * regen);
+			kPlate->aOR[kPlate->countOR] = inputSampleR + (kPlate->feedbackOR * regen);
+			kPlate->aTR[kPlate->countTR] = inputSampleR + (kPlate->feedbackTR * regen);
+			kPlate->aYR[kPlate->countYR] = inputSampleR + (kPlate->feedbackYR * regen);
+
+			kPlate->countAL++;
+			if (kPlate->countAL < 0 || kPlate->countAL > v->delayA) kPlate->countAL = 0;
+			kPlate->countBL++;
+			if (kPlate->countBL < 0 || kPlate->countBL > v->delayB) kPlate->countBL = 0;
+			kPlate->countCL++;
+			if (kPlate->countCL < 0 || kPlate->countCL > v->delayC) kPlate->countCL = 0;
+			kPlate->countDL++;
+			if (kPlate->countDL < 0 || kPlate->countDL > v->delayD) kPlate->countDL = 0;
+			kPlate->countEL++;
+			if (kPlate->countEL < 0 || kPlate->countEL > v->delayE) kPlate->countEL = 0;
+
+			kPlate->countER++;
+			if (kPlate->countER < 0 || kPlate->countER > v->delayE) kPlate->countER = 0;
+			kPlate->countJR++;
+			if (kPlate->countJR < 0 || kPlate->countJR > v->delayJ) kPlate->countJR = 0;
+			kPlate->countOR++;
+			if (kPlate->countOR < 0 || kPlate->countOR > v->delayO) kPlate->countOR = 0;
+			kPlate->countTR++;
+			if (kPlate->countTR < 0 || kPlate->countTR > v->delayT) kPlate->countTR = 0;
+			kPlate->countYR++;
+			if (kPlate->countYR < 0 || kPlate->countYR > v->delayY) kPlate->countYR = 0;
+
+			double outAL = kPlate->aAL[kPlate->countAL - ((kPlate->countAL > v->delayA) ? v->delayA + 1 : 0)];
+			double outBL = kPlate->aBL[kPlate->countBL - ((kPlate->countBL > v->delayB) ? v->delayB + 1 : 0)];
+			double outCL = kPlate->aCL[kPlate->countCL - ((kPlate->countCL > v->delayC) ? v->delayC + 1 : 0)];
+			double outDL = kPlate->aDL[kPlate->countDL - ((kPlate->countDL > v->delayD) ? v->delayD + 1 : 0)];
+			double outEL = kPlate->aEL[kPlate->countEL - ((kPlate->countEL > v->delayE) ? v->delayE + 1 : 0)];
+
+			double outER = kPlate->aER[kPlate->countER - ((kPlate->countER > v->delayE) ? v->delayE + 1 : 0)];
+			double outJR = kPlate->aJR[kPlate->countJR - ((kPlate->countJR > v->delayJ) ? v->delayJ + 1 : 0)];
+			double outOR = kPlate->aOR[kPlate->countOR - ((kPlate->countOR > v->delayO) ? v->delayO + 1 : 0)];
+			double outTR = kPlate->aTR[kPlate->countTR - ((kPlate->countTR > v->delayT) ? v->delayT + 1 : 0)];
+			double outYR = kPlate->aYR[kPlate->countYR - ((kPlate->countYR > v->delayY) ? v->delayY + 1 : 0)];
+
+			//-------- one
+
+			outSample = (outAL * kPlate->fixA[fix_a0]) + kPlate->fixA[fix_sL1];
+			kPlate->fixA[fix_sL1] = (outAL * kPlate->fixA[fix_a1]) - (outSample * kPlate->fixA[fix_b1]) + kPlate->fixA[fix_sL2];
+			kPlate->fixA[fix_sL2] = (outAL * kPlate->fixA[fix_a2]) - (outSample * kPlate->fixA[fix_b2]);
+			outAL = outSample; // fixed biquad
+
+			outSample = (outER * kPlate->fixA[fix_a0]) + kPlate->fixA[fix_sR1];
+			kPlate->fixA[fix_sR1] = (outER * kPlate->fixA[fix_a1]) - (outSample * kPlate->fixA[fix_b1]) + kPlate->fixA[fix_sR2];
+			kPlate->fixA[fix_sR2] = (outER * kPlate->fixA[fix_a2]) - (outSample * kPlate->fixA[fix_b2]);
+			outER = outSample; // fixed biquad
+
+			//-------- mulch
+			if (v->mulchA) {
+				outSample = (outBL + kPlate->prevMulchAL) * 0.5;
+				kPlate->prevMulchAL = outBL;
+				outBL = outSample;
+				outSample = (outJR + kPlate->prevMulchAR) * 0.5;
+				kPlate->prevMulchAR = outJR;
+				outJR = outSample;
+			}
+			//-------- filtered (one path in five, feeding the rest of the matrix
+
+			kPlate->aFL[kPlate->countFL] = ((outAL * 3.0) - ((outBL + outCL + outDL + outEL) * 2.0));
+			kPlate->aGL[kPlate->countGL] = ((outBL * 3.0) - ((outAL + outCL + outDL + outEL) * 2.0));
+			kPlate->aHL[kPlate->countHL] = ((outCL * 3.0) - ((outAL + outBL + outDL + outEL) * 2.0));
+			kPlate->aIL[kPlate->countIL] = ((outDL * 3.0) - ((outAL + outBL + outCL + outEL) * 2.0));
+			kPlate->aJL[kPlate->countJL] = ((outEL * 3.0) - ((outAL + outBL + outCL + outDL) * 2.0));
+
+			kPlate->aDR[kPlate->countDR] = ((outER * 3.0) - ((outJR + outOR + outTR + outYR) * 2.0));
+			kPlate->aIR[kPlate->countIR] = ((outJR * 3.0) - ((outER + outOR + outTR + outYR) * 2.0));
+			kPlate->aNR[kPlate->countNR] = ((outOR * 3.0) - ((outER + outJR + outTR + outYR) * 2.0));
+			kPlate->aSR[kPlate->countSR] = ((outTR * 3.0) - ((outER + outJR + outOR + outYR) * 2.0));
+			kPlate->aXR[kPlate->countXR] = ((outYR * 3.0) - ((outER + outJR + outOR + outTR) * 2.0));
+
+			kPlate->countFL++;
+			if (kPlate->countFL < 0 || kPlate->countFL > v->delayF) kPlate->countFL = 0;
+			kPlate->countGL++;
+			if (kPlate->countGL < 0 || kPlate->countGL > v->delayG) kPlate->countGL = 0;
+			kPlate->countHL++;
+			if (kPlate->countHL < 0 || kPlate->countHL > v->delayH) kPlate->countHL = 0;
+			kPlate->countIL++;
+			if (kPlate->countIL < 0 || kPlate->countIL > v->delayI) kPlate->countIL = 0;
+			kPlate->countJL++;
+			if (kPlate->countJL < 0 || kPlate->countJL > v->delayJ) kPlate->countJL = 0;
+
+			kPlate->countDR++;
+			if (kPlate->countDR < 0 || kPlate->countDR > v->delayD) kPlate->countDR = 0;
+			kPlate->countIR++;
+			if (kPlate->countIR < 0 || kPlate->countIR > v->delayI) kPlate->countIR = 0;
+			kPlate->countNR++;
+			if (kPlate->countNR < 0 || kPlate->countNR > v->delayN) kPlate->countNR = 0;
+			kPlate->countSR++;
+			if (kPlate->countSR < 0 || kPlate->countSR > v->delayS) kPlate->countSR = 0;
+			kPlate->countXR++;
+			if (kPlate->countXR < 0 || kPlate->countXR > v->delayX) kPlate->countXR = 0;
+
+			double outFL = kPlate->aFL[kPlate->countFL - ((kPlate->countFL > v->delayF) ? v->delayF + 1 : 0)];
+			double outGL = kPlate->aGL[kPlate->countGL - ((kPlate->countGL > v->delayG) ? v->delayG + 1 : 0)];
+			double outHL = kPlate->aHL[kPlate->countHL - ((kPlate->countHL > v->delayH) ? v->delayH + 1 : 0)];
+			double outIL = kPlate->aIL[kPlate->countIL - ((kPlate->countIL > v->delayI) ? v->delayI + 1 : 0)];
+			double outJL = kPlate->aJL[kPlate->countJL - ((kPlate->countJL > v->delayJ) ? v->delayJ + 1 : 0)];
+
+			double outDR = kPlate->aDR[kPlate->countDR - ((kPlate->countDR > v->delayD) ? v->delayD + 1 : 0)];
+			double outIR = kPlate->aIR[kPlate->countIR - ((kPlate->countIR > v->delayI) ? v->delayI + 1 : 0)];
+			double outNR = kPlate->aNR[kPlate->countNR - ((kPlate->countNR > v->delayN) ? v->delayN + 1 : 0)];
+			double outSR = kPlate->aSR[kPlate->countSR - ((kPlate->countSR > v->delayS) ? v->delayS + 1 : 0)];
+			double outXR = kPlate->aXR[kPlate->countXR - ((kPlate->countXR > v->delayX) ? v->delayX + 1 : 0)];
+
+			//-------- mulch
+
+			outSample = (outFL * kPlate->fixB[fix_a0]) + kPlate->fixB[fix_sL1];
+			kPlate->fixB[fix_sL1] = (outFL * kPlate->fixB[fix_a1]) - (outSample * kPlate->fixB[fix_b1]) + kPlate->fixB[fix_sL2];
+			kPlate->fixB[fix_sL2] = (outFL * kPlate->fixB[fix_a2]) - (outSample * kPlate->fixB[fix_b2]);
+			outFL = outSample; // fixed biquad
+
+			outSample = (outDR * kPlate->fixB[fix_a0]) + kPlate->fixB[fix_sR1];
+			kPlate->fixB[fix_sR1] = (outDR * kPlate->fixB[fix_a1]) - (outSample * kPlate->fixB[fix_b1]) + kPlate->fixB[fix_sR2];
+			kPlate->fixB[fix_sR2] = (outDR * kPlate->fixB[fix_a2]) - (outSample * kPlate->fixB[fix_b2]);
+			outDR = outSample; // fixed biquad
+
+			if (v->mulchB) {
+				outSample = (outGL + kPlate->prevMulchBL) * 0.5;
+				kPlate->prevMulchBL = outGL;
+				outGL = outSample;
+				outSample = (outIR + kPlate->prevMulchBR) * 0.5;
+				kPlate->prevMulchBR = outIR;
+				outIR = outSample;
+			}
+
+			//-------- two
+
+			kPlate->aKL[kPlate->countKL] = ((outFL * 3.0) - ((outGL + outHL + outIL + outJL) * 2.0));
+			kPlate->aLL[kPlate->countLL] = ((outGL * 3.0) - ((outFL + outHL + outIL + outJL) * 2.0));
+			kPlate->aML[kPlate->countML] = ((outHL * 3.0) - ((outFL + outGL + outIL + outJL) * 2.0));
+			kPlate->aNL[kPlate->countNL] = ((outIL * 3.0) - ((outFL + outGL + outHL + outJL) * 2.0));
+			kPlate->aOL[kPlate->countOL] = ((outJL * 3.0) - ((outFL + outGL + outHL + outIL) * 2.0));
+
+			kPlate->aCR[kPlate->countCR] = ((outDR * 3.0) - ((outIR + outNR + outSR + outXR) * 2.0));
+			kPlate->aHR[kPlate->countHR] = ((outIR * 3.0) - ((outDR + outNR + outSR + outXR) * 2.0));
+			kPlate->aMR[kPlate->countMR] = ((outNR * 3.0) - ((outDR + outIR + outSR + outXR) * 2.0));
+			kPlate->aRR[kPlate->countRR] = ((outSR * 3.0) - ((outDR + outIR + outNR + outXR) * 2.0));
+			kPlate->aWR[kPlate->countWR] = ((outXR * 3.0) - ((outDR + outIR + outNR + outSR) * 2.0));
+
+			kPlate->countKL++;
+			if (kPlate->countKL < 0 || kPlate->countKL > v->delayK) kPlate->countKL = 0;
+			kPlate->countLL++;
+			if (kPlate->countLL < 0 || kPlate->countLL > v->delayL) kPlate->countLL = 0;
+			kPlate->countML++;
+			if (kPlate->countML < 0 || kPlate->countML > v->delayM) kPlate->countML = 0;
+			kPlate->countNL++;
+			if (kPlate->countNL < 0 || kPlate->countNL > v->delayN) kPlate->countNL = 0;
+			kPlate->countOL++;
+			if (kPlate->countOL < 0 || kPlate->countOL > v->delayO) kPlate->countOL = 0;
+
+			kPlate->countCR++;
+			if (kPlate->countCR < 0 || kPlate->countCR > v->delayC) kPlate->countCR = 0;
+			kPlate->countHR++;
+			if (kPlate->countHR < 0 || kPlate->countHR > v->delayH) kPlate->countHR = 0;
+			kPlate->countMR++;
+			if (kPlate->countMR < 0 || kPlate->countMR > v->delayM) kPlate->countMR = 0;
+			kPlate->countRR++;
+			if (kPlate->countRR < 0 || kPlate->countRR > v->delayR) kPlate->countRR = 0;
+			kPlate->countWR++;
+			if (kPlate->countWR < 0 || kPlate->countWR > v->delayW) kPlate->countWR = 0;
+
+			double outKL = kPlate->aKL[kPlate->countKL - ((kPlate->countKL > v->delayK) ? v->delayK + 1 : 0)];
+			double outLL = kPlate->aLL[kPlate->countLL - ((kPlate->countLL > v->delayL) ? v->delayL + 1 : 0)];
+			double outML = kPlate->aML[kPlate->countML - ((kPlate->countML > v->delayM) ? v->delayM + 1 : 0)];
+			double outNL = kPlate->aNL[kPlate->countNL - ((kPlate->countNL > v->delayN) ? v->delayN + 1 : 0)];
+			double outOL = kPlate->aOL[kPlate->countOL - ((kPlate->countOL > v->delayO) ? v->delayO + 1 : 0)];
+
+			double outCR = kPlate->aCR[kPlate->countCR - ((kPlate->countCR > v->delayC) ? v->delayC + 1 : 0)];
+			double outHR = kPlate->aHR[kPlate->countHR - ((kPlate->countHR > v->delayH) ? v->delayH + 1 : 0)];
+			double outMR = kPlate->aMR[kPlate->countMR - ((kPlate->countMR > v->delayM) ? v->delayM + 1 : 0)];
+			double outRR = kPlate->aRR[kPlate->countRR - ((kPlate->countRR > v->delayR) ? v->delayR + 1 : 0)];
+			double outWR = kPlate->aWR[kPlate->countWR - ((kPlate->countWR > v->delayW) ? v->delayW + 1 : 0)];
+
+			//-------- mulch
+
+			outSample = (outKL * kPlate->fixC[fix_a0]) + kPlate->fixC[fix_sL1];
+			kPlate->fixC[fix_sL1] = (outKL * kPlate->fixC[fix_a1]) - (outSample * kPlate->fixC[fix_b1]) + kPlate->fixC[fix_sL2];
+			kPlate->fixC[fix_sL2] = (outKL * kPlate->fixC[fix_a2]) - (outSample * kPlate->fixC[fix_b2]);
+			outKL = outSample; // fixed biquad
+
+			outSample = (outCR * kPlate->fixC[fix_a0]) + kPlate->fixC[fix_sR1];
+			kPlate->fixC[fix_sR1] = (outCR * kPlate->fixC[fix_a1]) - (outSample * kPlate->fixC[fix_b1]) + kPlate->fixC[fix_sR2];
+			kPlate->fixC[fix_sR2] = (outCR * kPlate->fixC[fix_a2]) - (outSample * kPlate->fixC[fix_b2]);
+			outCR = outSample; // fixed biquad
+
+			if (v->mulchC) {
+				outSample = (outLL + kPlate->prevMulchCL) * 0.5;
+				kPlate->prevMulchCL = outLL;
+				outLL = outSample;
+				outSample = (outHR + kPlate->prevMulchCR) * 0.5;
+				kPlate->prevMulchCR = outHR;
+				outHR = outSample;
+			}
+
+			//-------- three
+
+			kPlate->aPL[kPlate->countPL] = ((outKL * 3.0) - ((outLL + outML + outNL + outOL) * 2.0));
+			kPlate->aQL[kPlate->countQL] = ((outLL * 3.0) - ((outKL + outML + outNL + outOL) * 2.0));
+			kPlate->aRL[kPlate->countRL] = ((outML * 3.0) - ((outKL + outLL + outNL + outOL) * 2.0));
+			kPlate->aSL[kPlate->countSL] = ((outNL * 3.0) - ((outKL + outLL + outML + outOL) * 2.0));
+			kPlate->aTL[kPlate->countTL] = ((outOL * 3.0) - ((outKL + outLL + outML + outNL) * 2.0));
+
+			kPlate->aBR[kPlate->countBR] = ((outCR * 3.0) - ((outHR + outMR + outRR + outWR) * 2.0));
+			kPlate->aGR[kPlate->countGR] = ((outHR * 3.0) - ((outCR + outMR + outRR + outWR) * 2.0));
+			kPlate->aLR[kPlate->countLR] = ((outMR * 3.0) - ((outCR + outHR + outRR + outWR) * 2.0));
+			kPlate->aQR[kPlate->countQR] = ((outRR * 3.0) - ((outCR + outHR + outMR + outWR) * 2.0));
+			kPlate->aVR[kPlate->countVR] = ((outWR * 3.0) - ((outCR + outHR + outMR + outRR) * 2.0));
+
+			kPlate->countPL++;
+			if (kPlate->countPL < 0 || kPlate->countPL > v->delayP) kPlate->countPL = 0;
+			kPlate->countQL++;
+			if (kPlate->countQL < 0 || kPlate->countQL > v->delayQ) kPlate->countQL = 0;
+			kPlate->countRL++;
+			if (kPlate->countRL < 0 || kPlate->countRL > v->delayR) kPlate->countRL = 0;
+			kPlate->countSL++;
+			if (kPlate->countSL < 0 || kPlate->countSL > v->delayS) kPlate->countSL = 0;
+			kPlate->countTL++;
+			if (kPlate->countTL < 0 || kPlate->countTL > v->delayT) kPlate->countTL = 0;
+
+			kPlate->countBR++;
+			if (kPlate->countBR < 0 || kPlate->countBR > v->delayB) kPlate->countBR = 0;
+			kPlate->countGR++;
+			if (kPlate->countGR < 0 || kPlate->countGR > v->delayG) kPlate->countGR = 0;
+			kPlate->countLR++;
+			if (kPlate->countLR < 0 || kPlate->countLR > v->delayL) kPlate->countLR = 0;
+			kPlate->countQR++;
+			if (kPlate->countQR < 0 || kPlate->countQR > v->delayQ) kPlate->countQR = 0;
+			kPlate->countVR++;
+			if (kPlate->countVR < 0 || kPlate->countVR > v->delayV) kPlate->countVR = 0;
+
+			double outPL = kPlate->aPL[kPlate->countPL - ((kPlate->countPL > v->delayP) ? v->delayP + 1 : 0)];
+			double outQL = kPlate->aQL[kPlate->countQL - ((kPlate->countQL > v->delayQ) ? v->delayQ + 1 : 0)];
+			double outRL = kPlate->aRL[kPlate->countRL - ((kPlate->countRL > v->delayR) ? v->delayR + 1 : 0)];
+			double outSL = kPlate->aSL[kPlate->countSL - ((kPlate->countSL > v->delayS) ? v->delayS + 1 : 0)];
+			double outTL = kPlate->aTL[kPlate->countTL - ((kPlate->countTL > v->delayT) ? v->delayT + 1 : 0)];
+
+			double outBR = kPlate->aBR[kPlate->countBR - ((kPlate->countBR > v->delayB) ? v->delayB + 1 : 0)];
+			double outGR = kPlate->aGR[kPlate->countGR - ((kPlate->countGR > v->delayG) ? v->delayG + 1 : 0)];
+			double outLR = kPlate->aLR[kPlate->countLR - ((kPlate->countLR > v->delayL) ? v->delayL + 1 : 0)];
+			double outQR = kPlate->aQR[kPlate->countQR - ((kPlate->countQR > v->delayQ) ? v->delayQ + 1 : 0)];
+			double outVR = kPlate->aVR[kPlate->countVR - ((kPlate->countVR > v->delayV) ? v->delayV + 1 : 0)];
+
+			//-------- mulch
+
+			outSample = (outPL * kPlate->fixD[fix_a0]) + kPlate->fixD[fix_sL1];
+			kPlate->fixD[fix_sL1] = (outPL * kPlate->fixD[fix_a1]) - (outSample * kPlate->fixD[fix_b1]) + kPlate->fixD[fix_sL2];
+			kPlate->fixD[fix_sL2] = (outPL * kPlate->fixD[fix_a2]) - (outSample * kPlate->fixD[fix_b2]);
+			outPL = outSample; // fixed biquad
+
+			outSample = (outBR * kPlate->fixD[fix_a0]) + kPlate->fixD[fix_sR1];
+			kPlate->fixD[fix_sR1] = (outBR * kPlate->fixD[fix_a1]) - (outSample * kPlate->fixD[fix_b1]) + kPlate->fixD[fix_sR2];
+			kPlate->fixD[fix_sR2] = (outBR * kPlate->fixD[fix_a2]) - (outSample * kPlate->fixD[fix_b2]);
+			outBR = outSample; // fixed biquad
+
+			outSample = (outQL + kPlate->prevMulchDL) * 0.5;
+			kPlate->prevMulchDL = outQL;
+			outQL = outSample;
+			outSample = (outGR + kPlate->prevMulchDR) * 0.5;
+			kPlate->prevMulchDR = outGR;
+			outGR = outSample;
+
+			//-------- four
+
+			kPlate->aUL[kPlate->countUL] = ((outPL * 3.0) - ((outQL + outRL + outSL + outTL) * 2.0));
+			kPlate->aVL[kPlate->countVL] = ((outQL * 3.0) - ((outPL + outRL + outSL + outTL) * 2.0));
+			kPlate->aWL[kPlate->countWL] = ((outRL * 3.0) - ((outPL + outQL + outSL + outTL) * 2.0));
+			kPlate->aXL[kPlate->countXL] = ((outSL * 3.0) - ((outPL + outQL + outRL + outTL) * 2.0));
+			kPlate->aYL[kPlate->countYL] = ((outTL * 3.0) - ((outPL + outQL + outRL + outSL) * 2.0));
+
+			kPlate->aAR[kPlate->countAR] = ((outBR * 3.0) - ((outGR + outLR + outQR + outVR) * 2.0));
+			kPlate->aFR[kPlate->countFR] = ((outGR * 3.0) - ((outBR + outLR + outQR + outVR) * 2.0));
+			kPlate->aKR[kPlate->countKR] = ((outLR * 3.0) - ((outBR + outGR + outQR + outVR) * 2.0));
+			kPlate->aPR[kPlate->countPR] = ((outQR * 3.0) - ((outBR + outGR + outLR + outVR) * 2.0));
+			kPlate->aUR[kPlate->countUR] = ((outVR * 3.0) - ((outBR + outGR + outLR + outQR) * 2.0));
+
+			kPlate->countUL++;
+			if (kPlate->countUL < 0 || kPlate->countUL > v->delayU) kPlate->countUL = 0;
+			kPlate->countVL++;
+			if (kPlate->countVL < 0 || kPlate->countVL > v->delayV) kPlate->countVL = 0;
+			kPlate->countWL++;
+			if (kPlate->countWL < 0 || kPlate->countWL > v->delayW) kPlate->countWL = 0;
+			kPlate->countXL++;
+			if (kPlate->countXL < 0 || kPlate->countXL > v->delayX) kPlate->countXL = 0;
+			kPlate->countYL++;
+			if (kPlate->countYL < 0 || kPlate->countYL > v->delayY) kPlate->countYL = 0;
+
+			kPlate->countAR++;
+			if (kPlate->countAR < 0 || kPlate->countAR > v->delayA) kPlate->countAR = 0;
+			kPlate->countFR++;
+			if (kPlate->countFR < 0 || kPlate->countFR > v->delayF) kPlate->countFR = 0;
+			kPlate->countKR++;
+			if (kPlate->countKR < 0 || kPlate->countKR > v->delayK) kPlate->countKR = 0;
+			kPlate->countPR++;
+			if (kPlate->countPR < 0 || kPlate->countPR > v->delayP) kPlate->countPR = 0;
+			kPlate->countUR++;
+			if (kPlate->countUR < 0 || kPlate->countUR > v->delayU) kPlate->countUR = 0;
+
+			double outUL = kPlate->aUL[kPlate->countUL - ((kPlate->countUL > v->delayU) ? v->delayU + 1 : 0)];
+			double outVL = kPlate->aVL[kPlate->countVL - ((kPlate->countVL > v->delayV) ? v->delayV + 1 : 0)];
+			double outWL = kPlate->aWL[kPlate->countWL - ((kPlate->countWL > v->delayW) ? v->delayW + 1 : 0)];
+			double outXL = kPlate->aXL[kPlate->countXL - ((kPlate->countXL > v->delayX) ? v->delayX + 1 : 0)];
+			double outYL = kPlate->aYL[kPlate->countYL - ((kPlate->countYL > v->delayY) ? v->delayY + 1 : 0)];
+
+			double outAR = kPlate->aAR[kPlate->countAR - ((kPlate->countAR > v->delayA) ? v->delayA + 1 : 0)];
+			double outFR = kPlate->aFR[kPlate->countFR - ((kPlate->countFR > v->delayF) ? v->delayF + 1 : 0)];
+			double outKR = kPlate->aKR[kPlate->countKR - ((kPlate->countKR > v->delayK) ? v->delayK + 1 : 0)];
+			double outPR = kPlate->aPR[kPlate->countPR - ((kPlate->countPR > v->delayP) ? v->delayP + 1 : 0)];
+			double outUR = kPlate->aUR[kPlate->countUR - ((kPlate->countUR > v->delayU) ? v->delayU + 1 : 0)];
+
+			//-------- mulch
+			outSample = (outVL + kPlate->prevMulchEL) * 0.5;
+			kPlate->prevMulchEL = outVL;
+			outVL = outSample;
+			outSample = (outFR + kPlate->prevMulchER) * 0.5;
+			kPlate->prevMulchER = outFR;
+			outFR = outSample;
+			//-------- five
+
+			kPlate->feedbackER = ((outUL * 3.0) - ((outVL + outWL + outXL + outYL) * 2.0));
+			kPlate->feedbackAL = ((outAR * 3.0) - ((outFR + outKR + outPR + outUR) * 2.0));
+			kPlate->feedbackJR = ((outVL * 3.0) - ((outUL + outWL + outXL + outYL) * 2.0));
+			kPlate->feedbackBL = ((outFR * 3.0) - ((outAR + outKR + outPR + outUR) * 2.0));
+			if (v->swapFeedbackCO) {
+				kPlate->feedbackCL = ((outWL * 3.0) - ((outUL + outVL + outXL + outYL) * 2.0));
+				kPlate->feedbackOR = ((outKR * 3.0) - ((outAR + outFR + outPR + outUR) * 2.0));
+			} else {
+				kPlate->feedbackOR = ((outWL * 3.0) - ((outUL + outVL + outXL + outYL) * 2.0));
+				kPlate->feedbackCL = ((outKR * 3.0) - ((outAR + outFR + outPR + outUR) * 2.0));
+			}
+			if (v->swapFeedbackDTEY) {
+				kPlate->feedbackTR = ((outXL * 3.0) - ((outUL + outVL + outWL + outYL) * 2.0));
+				kPlate->feedbackDL = ((outPR * 3.0) - ((outAR + outFR + outKR + outUR) * 2.0));
+				kPlate->feedbackYR = ((outYL * 3.0) - ((outUL + outVL + outWL + outXL) * 2.0));
+				kPlate->feedbackEL = ((outUR * 3.0) - ((outAR + outFR + outKR + outPR) * 2.0));
+			} else {
+				kPlate->feedbackDL = ((outXL * 3.0) - ((outUL + outVL + outWL + outYL) * 2.0));
+				kPlate->feedbackTR = ((outPR * 3.0) - ((outAR + outFR + outKR + outUR) * 2.0));
+				kPlate->feedbackEL = ((outYL * 3.0) - ((outUL + outVL + outWL + outXL) * 2.0));
+				kPlate->feedbackYR = ((outUR * 3.0) - ((outAR + outFR + outKR + outPR) * 2.0));
+			}
+			// which we need to feed back into the input again, a bit
+
+			inputSampleL = (outUL + outVL + outWL + outXL + outYL) * 0.0016;
+			inputSampleR = (outAR + outFR + outKR + outPR + outUR) * 0.0016;
+			// and take the final combined sum of outputs, corrected for Householder gain
+
+			inputSampleL *= 0.5;
+			inputSampleR *= 0.5;
+			if (kPlate->gainOutL < 0.0078125) kPlate->gainOutL = 0.0078125;
+			if (kPlate->gainOutL > 1.0) kPlate->gainOutL = 1.0;
+			if (kPlate->gainOutR < 0.0078125) kPlate->gainOutR = 0.0078125;
+			if (kPlate->gainOutR > 1.0) kPlate->gainOutR = 1.0;
+			// gain of 1,0 gives you a super-clean one, gain of 2 is obviously compressing
+			// smaller number is maximum clamping, if too small it'll take a while to bounce back
+			inputSampleL *= kPlate->gainOutL;
+			inputSampleR *= kPlate->gainOutR;
+			kPlate->gainOutL += sin((fabs(inputSampleL * 4) > 1) ? 4 : fabs(inputSampleL * 4)) * pow(inputSampleL, 4);
+			kPlate->gainOutR += sin((fabs(inputSampleR * 4) > 1) ? 4 : fabs(inputSampleR * 4)) * pow(inputSampleR, 4);
+			// 4.71239 radians sined will turn to -1 which is the maximum gain reduction speed
+			inputSampleL *= 2.0;
+			inputSampleR *= 2.0;
+			// curve! To get a compressed effect that matches a certain other plugin
+			// that is too overprocessed for its own good :)
+
+			for (int x = 0; x < v->outputAverages; x++) {
+				outSample = (inputSampleL + kPlate->prevOutL[x]) * 0.5;
+				kPlate->prevOutL[x] = inputSampleL;
+				inputSampleL = outSample;
+				outSample = (inputSampleR + kPlate->prevOutR[x]) * 0.5;
+				kPlate->prevOutR[x] = inputSampleR;
+				inputSampleR = outSample;
+			}
+
+			if (cycleEnd == 4) {
+				kPlate->lastRefL[0] = kPlate->lastRefL[4]; // start from previous last
+				kPlate->lastRefL[2] = (kPlate->lastRefL[0] + inputSampleL) / 2; // half
+				kPlate->lastRefL[1] = (kPlate->lastRefL[0] + kPlate->lastRefL[2]) / 2; // one quarter
+				kPlate->lastRefL[3] = (kPlate->lastRefL[2] + inputSampleL) / 2; // three quarters
+				kPlate->lastRefL[4] = inputSampleL; // full
+				kPlate->lastRefR[0] = kPlate->lastRefR[4]; // start from previous last
+				kPlate->lastRefR[2] = (kPlate->lastRefR[0] + inputSampleR) / 2; // half
+				kPlate->lastRefR[1] = (kPlate->lastRefR[0] + kPlate->lastRefR[2]) / 2; // one quarter
+				kPlate->lastRefR[3] = (kPlate->lastRefR[2] + inputSampleR) / 2; // three quarters
+				kPlate->lastRefR[4] = inputSampleR; // full
+			}
+			if (cycleEnd == 3) {
+				kPlate->lastRefL[0] = kPlate->lastRefL[3]; // start from previous last
+				kPlate->lastRefL[2] = (kPlate->lastRefL[0] + kPlate->lastRefL[0] + inputSampleL) / 3; // third
+				kPlate->lastRefL[1] = (kPlate->lastRefL[0] + inputSampleL + inputSampleL) / 3; // two thirds
+				kPlate->lastRefL[3] = inputSampleL; // full
+				kPlate->lastRefR[0] = kPlate->lastRefR[3]; // start from previous last
+				kPlate->lastRefR[2] = (kPlate->lastRefR[0] + kPlate->lastRefR[0] + inputSampleR) / 3; // third
+				kPlate->lastRefR[1] = (kPlate->lastRefR[0] + inputSampleR + inputSampleR) / 3; // two thirds
+				kPlate->lastRefR[3] = inputSampleR; // full
+			}
+			if (cycleEnd == 2) {
+				kPlate->lastRefL[0] = kPlate->lastRefL[2]; // start from previous last
+				kPlate->lastRefL[1] = (kPlate->lastRefL[0] + inputSampleL) / 2; // half
+				kPlate->lastRefL[2] = inputSampleL; // full
+				kPlate->lastRefR[0] = kPlate->lastRefR[2]; // start from previous last
+				kPlate->lastRefR[1] = (kPlate->lastRefR[0] + inputSampleR) / 2; // half
+				kPlate->lastRefR[2] = inputSampleR; // full
+			}
+			if (cycleEnd == 1) {
+				kPlate->lastRefL[0] = inputSampleL;
+				kPlate->lastRefR[0] = inputSampleR;
+			}
+			kPlate->cycle = 0; // reset
+			inputSampleL = kPlate->lastRefL[kPlate->cycle];
+			inputSampleR = kPlate->lastRefR[kPlate->cycle];
+		} else {
+			inputSampleL = kPlate->lastRefL[kPlate->cycle];
+			inputSampleR = kPlate->lastRefR[kPlate->cycle];
+			// we are going through our references now
+		}
+
+		if (v->asinOutput) {
+			if (inputSampleL > 1.0) inputSampleL = 1.0;
+			if (inputSampleL < -1.0) inputSampleL = -1.0;
+			if (inputSampleR > 1.0) inputSampleR = 1.0;
+			if (inputSampleR < -1.0) inputSampleR = -1.0;
+			// without this, you can get a NaN condition where it spits out DC offset at full blast!
+			inputSampleL = fast_asin(inputSampleL);
+			inputSampleR = fast_asin(inputSampleR);
+			// amplitude aspect
+		} else {
+			if (inputSampleL > 2.8) inputSampleL = 2.8;
+			if (inputSampleL < -2.8) inputSampleL = -2.8;
+			if (inputSampleR > 2.8) inputSampleR = 2.8;
+			if (inputSampleR < -2.8) inputSampleR = -2.8; // clip BigFastArcSin harder
+			if (inputSampleL > 0.0) inputSampleL = (inputSampleL * 2.0) / (2.8274333882308 - inputSampleL);
+			else inputSampleL = -(inputSampleL * -2.0) / (2.8274333882308 + inputSampleL);
+			if (inputSampleR > 0.0) inputSampleR = (inputSampleR * 2.0) / (2.8274333882308 - inputSampleR);
+			else inputSampleR = -(inputSampleR * -2.0) / (2.8274333882308 + inputSampleR);
+			// BigFastArcSin output stage
+		}
+
+		if (wet < 1.0) {
+			inputSampleL *= wet;
+			inputSampleR *= wet;
+		}
+		if (dry < 1.0) {
+			drySampleL *= dry;
+			drySampleR *= dry;
+		}
+		inputSampleL += drySampleL;
+		inputSampleR += drySampleR;
+		// this is our submix verb dry/wet: 0.5 is BOTH at FULL VOLUME
+		// purpose is that, if you're adding verb, you're not altering other balances
+
+		// begin 32 bit stereo floating point dither
+		int expon;
+		frexpf((float) inputSampleL, &expon);
+		kPlate->fpdL ^= kPlate->fpdL << 13;
+		kPlate->fpdL ^= kPlate->fpdL >> 17;
+		kPlate->fpdL ^= kPlate->fpdL << 5;
+		inputSampleL += (((double) kPlate->fpdL - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+		frexpf((float) inputSampleR, &expon);
+		kPlate->fpdR ^= kPlate->fpdR << 13;
+		kPlate->fpdR ^= kPlate->fpdR >> 17;
+		kPlate->fpdR ^= kPlate->fpdR << 5;
+		inputSampleR += (((double) kPlate->fpdR - (uint32_t) 0x7fffffff) * 5.5e-36l * fast_pow2i(expon + 62));
+		// end 32 bit stereo floating point dither
+
+		*out1 = (float) inputSampleL;
+		*out2 = (float) inputSampleR;
+
+		in1++;
+		in2++;
+		out1++;
+		out2++;
+	}
+
+	silence_track(&kPlate->silence, kPlate->output[0], kPlate->output[1]);
+}
+
+static void run_a(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_voicing((KPlate*) instance, sampleFrames, &voicingA);
+}
+
+static void run_b(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_voicing((KPlate*) instance, sampleFrames, &voicingB);
+}
+
+static void run_c(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_voicing((KPlate*) instance, sampleFrames, &voicingC);
+}
+
+static void run_d(LV2_Handle instance, uint32_t sampleFrames)
+{
+	run_voicing((KPlate*) instance, sampleFrames, &voicingD);
+}
+
+static void deactivate(LV2_Handle instance) {}
+
+static void cleanup(LV2_Handle instance)
+{
+	free(instance);
+}
+
+static const void* extension_data(const char* uri)
+{
+	return NULL;
+}
+
+static const LV2_Descriptor descriptors[] = {
+	{KPLATEA_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_a,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{KPLATEB_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_b,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{KPLATEC_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_c,
+	 deactivate,
+	 cleanup,
+	 extension_data},
+	{KPLATED_URI,
+	 instantiate,
+	 connect_port,
+	 activate,
+	 run_d,
+	 deactivate,
+	 cleanup,
+	 extension_data}};
+
+LV2_SYMBOL_EXPORT const LV2_Descriptor* lv2_descriptor(uint32_t index)
+{
+	return index < sizeof(descriptors) / sizeof(descriptors[0]) ? &descriptors[index] : NULL;
+}
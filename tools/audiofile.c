@@ -0,0 +1,296 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "audiofile.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static bool is_wav(const char* path)
+{
+	size_t length = strlen(path);
+	return length >= 4 && !strcasecmp(path + length - 4, ".wav");
+}
+
+static uint32_t read_u32(const uint8_t* p)
+{
+	return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static uint16_t read_u16(const uint8_t* p)
+{
+	return (uint16_t) (p[0] | (p[1] << 8));
+}
+
+static bool parse_wav(InputFile* input, const uint8_t* file, size_t size, const char* path)
+{
+	if (size < 12 || memcmp(file, "RIFF", 4) || memcmp(file + 8, "WAVE", 4)) {
+		fprintf(stderr, "%s is no WAV file\n", path);
+		return false;
+	}
+
+	uint16_t format = 0, blockAlign = 0, bits = 0;
+	for (size_t position = 12; position + 8 <= size;) {
+		const uint8_t* chunk = file + position;
+		uint64_t chunkSize = read_u32(chunk + 4);
+		position += 8;
+		if (!memcmp(chunk, "fmt ", 4) && chunkSize >= 16 && position + 16 <= size) {
+			format = read_u16(chunk + 8);
+			input->channels = read_u16(chunk + 10);
+			input->rate = read_u32(chunk + 12);
+			blockAlign = read_u16(chunk + 20);
+			bits = read_u16(chunk + 22);
+			if (format == 0xfffe && chunkSize >= 40 && position + 40 <= size) format = read_u16(chunk + 32); // the subformat
+		} else if (!memcmp(chunk, "data", 4)) {
+			// streamed files may leave the size open
+			if (chunkSize > size - position) chunkSize = size - position;
+			input->data = file + position;
+			input->frames = blockAlign ? chunkSize / blockAlign : 0;
+			break;
+		}
+		position += chunkSize + (chunkSize & 1);
+	}
+
+	if (format == 1 && bits == 16) input->format = SAMPLE_INT16;
+	else if (format == 1 && bits == 24) input->format = SAMPLE_INT24;
+	else if (format == 1 && bits == 32) input->format = SAMPLE_INT32;
+	else if (format == 3 && bits == 32) input->format = SAMPLE_FLOAT32;
+	else {
+		fprintf(stderr, "%s holds %u bit samples of format %u, only 16, 24 and 32 bit integers and 32 bit floats are supported\n", path, bits, format);
+		return false;
+	}
+	if (!input->data || input->channels == 0 || blockAlign != input->channels * (bits / 8) || input->rate <= 0.0) {
+		fprintf(stderr, "%s is no valid WAV file\n", path);
+		return false;
+	}
+	return true;
+}
+
+bool input_open(InputFile* input, const char* path, double rate, uint32_t channels)
+{
+	memset(input, 0, sizeof(InputFile));
+
+	int descriptor = open(path, O_RDONLY);
+	struct stat status;
+	if (descriptor < 0 || fstat(descriptor, &status) != 0) {
+		fprintf(stderr, "cannot open %s\n", path);
+		if (descriptor >= 0) close(descriptor);
+		return false;
+	}
+	input->mapSize = (size_t) status.st_size;
+	if (input->mapSize > 0) {
+		input->map = mmap(NULL, input->mapSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+		if (input->map == MAP_FAILED) input->map = NULL;
+	}
+	close(descriptor);
+	if (!input->map && input->mapSize > 0) {
+		fprintf(stderr, "cannot map %s\n", path);
+		return false;
+	}
+	if (input->map) posix_madvise(input->map, input->mapSize, POSIX_MADV_SEQUENTIAL);
+
+	if (is_wav(path)) {
+		if (!parse_wav(input, (const uint8_t*) input->map, input->mapSize, path)) {
+			input_close(input);
+			return false;
+		}
+		return true;
+	}
+
+	if (rate <= 0.0 || channels == 0) {
+		fprintf(stderr, "%s is raw, its rate and channels have to be given\n", path);
+		input_close(input);
+		return false;
+	}
+	input->data = (const uint8_t*) input->map;
+	input->frames = input->mapSize / (sizeof(float) * channels);
+	input->channels = channels;
+	input->rate = rate;
+	input->format = SAMPLE_FLOAT32;
+	return true;
+}
+
+void input_read(const InputFile* input, uint64_t frame, uint32_t frames, float* const* channels)
+{
+	const uint32_t count = input->channels;
+	switch (input->format) {
+		case SAMPLE_INT16: {
+			const uint8_t* p = input->data + frame * count * 2;
+			for (uint32_t i = 0; i < frames; i++) {
+				for (uint32_t c = 0; c < count; c++, p += 2) channels[c][i] = (int16_t) read_u16(p) * (1.0f / 32768.0f);
+			}
+			break;
+		}
+		case SAMPLE_INT24: {
+			const uint8_t* p = input->data + frame * count * 3;
+			for (uint32_t i = 0; i < frames; i++) {
+				for (uint32_t c = 0; c < count; c++, p += 3) {
+					const int32_t sample = (int32_t) (((uint32_t) p[0] << 8) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 24)) >> 8;
+					channels[c][i] = sample * (1.0f / 8388608.0f);
+				}
+			}
+			break;
+		}
+		case SAMPLE_INT32: {
+			const uint8_t* p = input->data + frame * count * 4;
+			for (uint32_t i = 0; i < frames; i++) {
+				for (uint32_t c = 0; c < count; c++, p += 4) channels[c][i] = (float) ((int32_t) read_u32(p) * (1.0 / 2147483648.0));
+			}
+			break;
+		}
+		case SAMPLE_FLOAT32: {
+			const uint8_t* p = input->data + frame * count * 4;
+			for (uint32_t i = 0; i < frames; i++) {
+				for (uint32_t c = 0; c < count; c++, p += 4) memcpy(&channels[c][i], p, sizeof(float));
+			}
+			break;
+		}
+	}
+}
+
+void input_close(InputFile* input)
+{
+	if (input->map) munmap(input->map, input->mapSize);
+	input->map = NULL;
+	input->data = NULL;
+}
+
+static void write_u32(uint8_t* p, uint32_t value)
+{
+	p[0] = value;
+	p[1] = value >> 8;
+	p[2] = value >> 16;
+	p[3] = value >> 24;
+}
+
+static bool write_wav_header(FILE* file, uint32_t channels, double rate, uint64_t frames)
+{
+	uint64_t dataSize = frames * channels * sizeof(float);
+	if (dataSize > UINT32_MAX - 36) dataSize = UINT32_MAX - 36; // beyond 4 GiB the sizes can't be right
+	uint8_t header[44];
+	memcpy(header, "RIFF", 4);
+	write_u32(header + 4, (uint32_t) (36 + dataSize));
+	memcpy(header + 8, "WAVEfmt ", 8);
+	write_u32(header + 16, 16);
+	write_u32(header + 20, 3 | (channels << 16)); // IEEE float
+	write_u32(header + 24, (uint32_t) rate);
+	write_u32(header + 28, (uint32_t) rate * channels * sizeof(float));
+	write_u32(header + 32, (uint32_t) (channels * sizeof(float)) | (32 << 16));
+	memcpy(header + 36, "data", 4);
+	write_u32(header + 40, (uint32_t) dataSize);
+	return fwrite(header, sizeof(header), 1, file) == 1;
+}
+
+static void* write_blocks(void* data)
+{
+	OutputFile* output = (OutputFile*) data;
+	int next = 0;
+
+	pthread_mutex_lock(&output->lock);
+	for (;;) {
+		while (!output->filled[next] && !output->finished) pthread_cond_wait(&output->changed, &output->lock);
+		// blocks are committed to the buffers in turn, so nothing is left
+		if (!output->filled[next]) break;
+
+		const uint32_t frames = output->filled[next];
+		pthread_mutex_unlock(&output->lock);
+		const bool written = fwrite(output->buffers[next], sizeof(float) * output->channels, frames, output->file) == frames;
+		pthread_mutex_lock(&output->lock);
+
+		if (!written) output->failed = true;
+		output->frames += frames;
+		output->filled[next] = 0;
+		pthread_cond_broadcast(&output->changed);
+		next ^= 1;
+	}
+	pthread_mutex_unlock(&output->lock);
+	return NULL;
+}
+
+bool output_open(OutputFile* output, const char* path, double rate, uint32_t channels, uint32_t block)
+{
+	memset(output, 0, sizeof(OutputFile));
+	output->wav = is_wav(path);
+	output->channels = channels;
+	output->rate = rate;
+	output->block = block;
+
+	output->file = fopen(path, "wb");
+	if (!output->file) {
+		fprintf(stderr, "cannot create %s\n", path);
+		return false;
+	}
+	output->buffers[0] = (float*) malloc(sizeof(float) * channels * block);
+	output->buffers[1] = (float*) malloc(sizeof(float) * channels * block);
+	if (!output->buffers[0] || !output->buffers[1] || (output->wav && !write_wav_header(output->file, channels, rate, 0))) {
+		fprintf(stderr, "cannot write %s\n", path);
+		free(output->buffers[0]);
+		free(output->buffers[1]);
+		fclose(output->file);
+		return false;
+	}
+
+	pthread_mutex_init(&output->lock, NULL);
+	pthread_cond_init(&output->changed, NULL);
+	if (pthread_create(&output->thread, NULL, write_blocks, output) != 0) {
+		fprintf(stderr, "cannot start the writer of %s\n", path);
+		pthread_cond_destroy(&output->changed);
+		pthread_mutex_destroy(&output->lock);
+		free(output->buffers[0]);
+		free(output->buffers[1]);
+		fclose(output->file);
+		return false;
+	}
+	return true;
+}
+
+float* output_buffer(OutputFile* output)
+{
+	pthread_mutex_lock(&output->lock);
+	while (output->filled[output->current]) pthread_cond_wait(&output->changed, &output->lock);
+	pthread_mutex_unlock(&output->lock);
+	return output->buffers[output->current];
+}
+
+void output_commit(OutputFile* output, uint32_t frames)
+{
+	if (frames == 0) return;
+	pthread_mutex_lock(&output->lock);
+	output->filled[output->current] = frames;
+	output->current ^= 1;
+	pthread_cond_broadcast(&output->changed);
+	pthread_mutex_unlock(&output->lock);
+}
+
+void output_write(OutputFile* output, const float* const* channels, uint32_t frames)
+{
+	const uint32_t count = output->channels;
+	float* interleaved = output_buffer(output);
+	for (uint32_t c = 0; c < count; c++) {
+		const float* channel = channels[c];
+		for (uint32_t i = 0; i < frames; i++) interleaved[i * count + c] = channel[i];
+	}
+	output_commit(output, frames);
+}
+
+bool output_close(OutputFile* output)
+{
+	pthread_mutex_lock(&output->lock);
+	output->finished = true;
+	pthread_cond_broadcast(&output->changed);
+	pthread_mutex_unlock(&output->lock);
+	pthread_join(output->thread, NULL);
+	pthread_cond_destroy(&output->changed);
+	pthread_mutex_destroy(&output->lock);
+
+	bool written = !output->failed;
+	if (output->wav) written = written && fseek(output->file, 0, SEEK_SET) == 0 && write_wav_header(output->file, output->channels, output->rate, output->frames);
+	written = (fclose(output->file) == 0) && written;
+	free(output->buffers[0]);
+	free(output->buffers[1]);
+	return written;
+}
@@ -0,0 +1,67 @@
+#ifndef AIRWINDOWS_TOOLS_AUDIOFILE_H
+#define AIRWINDOWS_TOOLS_AUDIOFILE_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Audio files for the offline renderer: WAV files, or headerless interleaved
+// 32 bit float if the name doesn't end in .wav. Inputs are mapped into memory
+// and converted block by block. Outputs are written as 32 bit float by a thread
+// of their own from two buffers, so rendering the next block overlaps with
+// writing the last one. Samples are little endian, as on all the targets.
+
+typedef enum {
+	SAMPLE_INT16,
+	SAMPLE_INT24,
+	SAMPLE_INT32,
+	SAMPLE_FLOAT32
+} SampleFormat;
+
+typedef struct {
+	void* map;
+	size_t mapSize;
+	const uint8_t* data; // the interleaved samples
+	uint64_t frames;
+	uint32_t channels;
+	double rate;
+	SampleFormat format;
+} InputFile;
+
+// rate and channels describe raw files, WAV files bring their own
+bool input_open(InputFile* input, const char* path, double rate, uint32_t channels);
+// Converts frames from frame on into one buffer per channel
+void input_read(const InputFile* input, uint64_t frame, uint32_t frames, float* const* channels);
+void input_close(InputFile* input);
+
+typedef struct {
+	FILE* file;
+	bool wav;
+	uint32_t channels;
+	double rate;
+	uint32_t block;
+	uint64_t frames; // written so far
+
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t changed;
+	float* buffers[2]; // interleaved
+	uint32_t filled[2]; // frames waiting in each buffer for the writer
+	int current; // the buffer rendered into
+	bool finished;
+	bool failed;
+} OutputFile;
+
+// Blocks of up to block frames go through output_buffer() and output_commit()
+bool output_open(OutputFile* output, const char* path, double rate, uint32_t channels, uint32_t block);
+// The interleaved buffer to fill next, once the writer is done with it
+float* output_buffer(OutputFile* output);
+void output_commit(OutputFile* output, uint32_t frames);
+// Interleaves one buffer per channel into the output
+void output_write(OutputFile* output, const float* const* channels, uint32_t frames);
+// Writes the rest and completes the header, false if anything failed
+bool output_close(OutputFile* output);
+
+#endif
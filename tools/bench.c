@@ -0,0 +1,275 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include "counters.h"
+#include "host.h"
+#include "material.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// The distribution of block times of every plugin of a bundle, for the worst
+// cases an average hides: a kernel rebuilt when a control moves, a tail
+// decaying into denormals, an activate() clearing large buffers. Each plugin
+// runs the material in several scenarios, on an instance of its own after a
+// few warm up blocks:
+//
+//     steady   the material at the default settings
+//     sweep    every control moves a little in every block, sweeping its range
+//     onset    a second of digital silence and a second of the material in turn
+//     toggle   deactivate() and activate() every 64 blocks, as when a host
+//              bypasses the plugin and enables it again, timed with the block
+//
+// It prints the median, 99th and 99.9th percentile and the longest block in
+// µs, the average per sample, and flags the runs whose longest block is over
+// the budget, by default a tenth of the block's duration. With --counters it
+// also counts the cycles, instructions, cache misses and branch misses of the
+// blocks, see counters.h, and prints the instructions per cycle and the misses
+// per sample: few instructions per cycle with many cache misses point at
+// memory, with many branch misses at mispredictions, and many instructions per
+// cycle at arithmetic. Without counters on the machine it runs as without
+// --counters.
+//
+//     airwindows-bench [--rate <Hz>] [--block <frames>] [--seconds <s>] [--budget <µs>] [--counters] [--scenario <name>]... <bundle> [plugin...]
+
+typedef enum {
+	SCENARIO_STEADY,
+	SCENARIO_SWEEP,
+	SCENARIO_ONSET,
+	SCENARIO_TOGGLE,
+	SCENARIO_COUNT
+} Scenario;
+
+static const char* const scenarioNames[SCENARIO_COUNT] = {"steady", "sweep", "onset", "toggle"};
+
+#define MAX_BLOCK 8192
+#define WARMUP_BLOCKS 16
+#define TOGGLE_BLOCKS 64
+#define SWEEP_SECONDS 2.0 // up and down again
+
+typedef struct {
+	double rate;
+	uint32_t block;
+	double seconds; // per scenario
+	double budget; // µs
+	bool scenarios[SCENARIO_COUNT];
+	const Counters* counters; // NULL unless counting
+} Settings;
+
+typedef struct {
+	double median; // µs
+	double p99;
+	double p999;
+	double longest;
+	double perSample; // ns
+	CounterTotals counts;
+} Distribution;
+
+static float input[2][MAX_BLOCK];
+static float output[2][MAX_BLOCK];
+
+static double now(void)
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec * 1e6 + time.tv_nsec * 1e-3;
+}
+
+static int ascending(const void* a, const void* b)
+{
+	const double timeA = *(const double*) a;
+	const double timeB = *(const double*) b;
+	return timeA < timeB ? -1 : timeA > timeB ? 1 : 0;
+}
+
+// The nearest rank
+static double percentile(const double* sorted, uint32_t count, double fraction)
+{
+	uint32_t rank = (uint32_t) (fraction * count);
+	return sorted[rank < count ? rank : count - 1];
+}
+
+static void sweep(Instance* instance, double position)
+{
+	const Plugin* plugin = instance->plugin;
+	for (uint32_t i = 0; i < plugin->portCount; i++) {
+		const Port* port = &plugin->ports[i];
+		if (port->type != PORT_CONTROL || !port->input) continue;
+		// the controls start apart, so they don't all reach the ends together
+		double phase = position + (double) i / plugin->portCount;
+		phase -= (uint64_t) phase;
+		const double triangle = phase < 0.5 ? 2.0 * phase : 2.0 - 2.0 * phase;
+		instance_set(instance, i, port->minimum + (port->maximum - port->minimum) * (float) triangle);
+	}
+}
+
+static bool bench(const Plugin* plugin, const Settings* settings, Scenario scenario, double* times, uint32_t blocks, Distribution* distribution)
+{
+	Instance instance;
+	if (!instance_create(&instance, plugin, settings->rate, NULL)) return false;
+
+	float* inputs[2] = {input[0], input[1]};
+	float* outputs[2] = {output[0], output[1]};
+	instance_connect(&instance, (const float* const*) inputs, outputs);
+	const LV2_Descriptor* descriptor = plugin->descriptor;
+
+	Material material;
+	material_init(&material, settings->rate, 1);
+	const uint32_t block = settings->block;
+	const uint64_t second = (uint64_t) settings->rate;
+
+	const Counters* counters = settings->counters;
+	if (counters) counters_clear(counters);
+	double total = 0.0;
+	for (uint32_t b = 0; b < WARMUP_BLOCKS + blocks; b++) {
+		const uint64_t frame = (uint64_t) b * block;
+		if (scenario == SCENARIO_SWEEP) sweep(&instance, frame / (settings->rate * SWEEP_SECONDS));
+		material_render(&material, inputs, plugin->audioIns, block);
+		if (scenario == SCENARIO_ONSET && (frame / second) % 2 == 0) {
+			for (uint32_t c = 0; c < plugin->audioIns; c++) memset(input[c], 0, sizeof(float) * block);
+		}
+		const bool toggle = scenario == SCENARIO_TOGGLE && b > WARMUP_BLOCKS && b % TOGGLE_BLOCKS == 0;
+
+		const bool counting = counters && b >= WARMUP_BLOCKS;
+		if (counting) counters_start(counters);
+		const double start = now();
+		if (toggle && descriptor->deactivate) descriptor->deactivate(instance.handle);
+		if (toggle && descriptor->activate) descriptor->activate(instance.handle);
+		instance_run(&instance, block);
+		const double elapsed = now() - start;
+		if (counting) counters_stop(counters);
+
+		if (b < WARMUP_BLOCKS) continue;
+		times[b - WARMUP_BLOCKS] = elapsed;
+		total += elapsed;
+	}
+	instance_destroy(&instance);
+
+	qsort(times, blocks, sizeof(double), ascending);
+	distribution->median = percentile(times, blocks, 0.5);
+	distribution->p99 = percentile(times, blocks, 0.99);
+	distribution->p999 = percentile(times, blocks, 0.999);
+	distribution->longest = times[blocks - 1];
+	distribution->perSample = total * 1e3 / ((double) blocks * block);
+	if (!counters || !counters_read(counters, &distribution->counts)) memset(&distribution->counts, 0, sizeof(CounterTotals));
+	return true;
+}
+
+// A ratio of two counts, or "-" for counters left out
+static void print_ratio(const CounterTotals* counts, Counter counter, Counter by, double byValue)
+{
+	const bool counted = counts->counted[counter] && (by == COUNTER_COUNT || (counts->counted[by] && counts->values[by] > 0));
+	if (!counted) {
+		printf(" %13s", "-");
+		return;
+	}
+	printf(" %13.3f", counts->values[counter] / (by == COUNTER_COUNT ? byValue : counts->values[by]));
+}
+
+static void usage(const char* name)
+{
+	fprintf(stderr, "usage: %s [--rate <Hz>] [--block <frames>] [--seconds <s>] [--budget <µs>] [--counters] [--scenario <name>]... <bundle> [plugin...]\n", name);
+	fprintf(stderr, "scenarios: steady sweep onset toggle (all by default)\n");
+}
+
+int main(int argc, char** argv)
+{
+	Settings settings = {48000.0, 256, 20.0, 0.0, {false}, NULL};
+	bool chosen = false;
+	bool counting = false;
+	int arg = 1;
+	for (; arg + 1 < argc && !strncmp(argv[arg], "--", 2); arg += 2) {
+		if (!strcmp(argv[arg], "--counters")) {
+			counting = true;
+			arg--; // it takes no value
+		} else if (!strcmp(argv[arg], "--rate")) {
+			settings.rate = strtod(argv[arg + 1], NULL);
+		} else if (!strcmp(argv[arg], "--block")) {
+			settings.block = (uint32_t) strtoul(argv[arg + 1], NULL, 10);
+		} else if (!strcmp(argv[arg], "--seconds")) {
+			settings.seconds = strtod(argv[arg + 1], NULL);
+		} else if (!strcmp(argv[arg], "--budget")) {
+			settings.budget = strtod(argv[arg + 1], NULL);
+		} else if (!strcmp(argv[arg], "--scenario")) {
+			int s = 0;
+			while (s < SCENARIO_COUNT && strcmp(argv[arg + 1], scenarioNames[s])) s++;
+			if (s == SCENARIO_COUNT) {
+				usage(argv[0]);
+				return EXIT_FAILURE;
+			}
+			settings.scenarios[s] = true;
+			chosen = true;
+		} else {
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	const uint32_t blocks = (uint32_t) (settings.seconds * settings.rate / settings.block);
+	if (arg >= argc || settings.rate <= 0.0 || settings.block == 0 || settings.block > MAX_BLOCK || blocks == 0) {
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	if (!chosen) {
+		for (int s = 0; s < SCENARIO_COUNT; s++) settings.scenarios[s] = true;
+	}
+	if (settings.budget <= 0.0) settings.budget = settings.block / settings.rate * 1e6 / 10.0;
+
+	double* times = (double*) malloc(sizeof(double) * blocks);
+	Bundle bundle;
+	if (!times || !bundle_open(&bundle, argv[arg])) {
+		free(times);
+		return EXIT_FAILURE;
+	}
+	Counters counters;
+	if (counting && counters_open(&counters)) settings.counters = &counters;
+
+	printf("block times in µs for %u frames at %.0f Hz, budget %.1f µs\n", settings.block, settings.rate, settings.budget);
+	printf("%-24s %-8s %10s %10s %10s %10s %12s", "plugin", "scenario", "p50", "p99", "p99.9", "max", "ns/sample");
+	if (settings.counters) printf(" %13s %13s %13s", "IPC", "cache/sample", "branch/sample");
+	printf("\n");
+	int failures = 0;
+	uint32_t runs = 0, over = 0;
+	const uint32_t count = argc > arg + 1 ? (uint32_t) (argc - arg - 1) : bundle.count;
+	for (uint32_t p = 0; p < count; p++) {
+		const BundleEntry* entry = argc > arg + 1 ? bundle_find(&bundle, argv[arg + 1 + p]) : &bundle.entries[p];
+		if (!entry) {
+			fprintf(stderr, "no plugin %s in %s\n", argv[arg + 1 + p], argv[arg]);
+			failures++;
+			continue;
+		}
+
+		Plugin plugin;
+		if (!plugin_load(&plugin, &bundle, entry)) {
+			failures++;
+			continue;
+		}
+		for (int s = 0; s < SCENARIO_COUNT; s++) {
+			Distribution distribution;
+			if (!settings.scenarios[s]) continue;
+			if (!bench(&plugin, &settings, (Scenario) s, times, blocks, &distribution)) {
+				failures++;
+				continue;
+			}
+			const bool late = distribution.longest > settings.budget;
+			runs++;
+			if (late) over++;
+			printf("%-24s %-8s %10.1f %10.1f %10.1f %10.1f %12.2f", entry->name, scenarioNames[s], distribution.median, distribution.p99, distribution.p999, distribution.longest, distribution.perSample);
+			if (settings.counters) {
+				const double samples = (double) blocks * settings.block;
+				print_ratio(&distribution.counts, COUNTER_INSTRUCTIONS, COUNTER_CYCLES, 0.0);
+				print_ratio(&distribution.counts, COUNTER_CACHE_MISSES, COUNTER_COUNT, samples);
+				print_ratio(&distribution.counts, COUNTER_BRANCH_MISSES, COUNTER_COUNT, samples);
+			}
+			printf("%s\n", late ? "  over budget" : "");
+			fflush(stdout);
+		}
+		plugin_unload(&plugin);
+	}
+	printf("%u of %u runs over budget\n", over, runs);
+
+	if (settings.counters) counters_close(&counters);
+	bundle_close(&bundle);
+	free(times);
+	return failures || over ? EXIT_FAILURE : EXIT_SUCCESS;
+}
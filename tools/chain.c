@@ -0,0 +1,204 @@
+#include "chain.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FUSED_BLOCK 256
+
+static bool parse_stage(Stage* stage, const Bundle* bundle, const char* text)
+{
+	char name[HOST_MAX_NAME];
+	size_t length = strcspn(text, ":");
+	if (length >= sizeof(name)) length = sizeof(name) - 1;
+	memcpy(name, text, length);
+	name[length] = '\0';
+
+	const BundleEntry* entry = bundle_find(bundle, name);
+	if (!entry) {
+		fprintf(stderr, "no plugin %s in %s\n", name, bundle->path);
+		return false;
+	}
+	if (!plugin_load(&stage->plugin, bundle, entry)) return false;
+
+	stage->settingCount = 0;
+	for (const char* setting = text + length; *setting;) {
+		setting++; // the ':' or ','
+		char symbol[HOST_MAX_NAME];
+		float value;
+		int consumed = 0;
+		if (sscanf(setting, "%63[^=,]=%f%n", symbol, &value, &consumed) != 2) {
+			fprintf(stderr, "cannot read the settings of %s, they read <symbol>=<value>,...\n", text);
+			plugin_unload(&stage->plugin);
+			return false;
+		}
+		const int port = plugin_port(&stage->plugin, symbol);
+		if (port < 0 || stage->plugin.ports[port].type != PORT_CONTROL || !stage->plugin.ports[port].input) {
+			fprintf(stderr, "%s has no control %s\n", name, symbol);
+			plugin_unload(&stage->plugin);
+			return false;
+		}
+		// a control set twice takes the last value, so there's at most one
+		// setting per port
+		uint32_t i = 0;
+		while (i < stage->settingCount && stage->settingPorts[i] != (uint32_t) port) i++;
+		stage->settingPorts[i] = (uint32_t) port;
+		stage->settingValues[i] = value;
+		if (i == stage->settingCount) stage->settingCount++;
+		setting += consumed;
+		if (*setting && *setting != ',') {
+			fprintf(stderr, "cannot read the settings of %s, they read <symbol>=<value>,...\n", text);
+			plugin_unload(&stage->plugin);
+			return false;
+		}
+	}
+	return true;
+}
+
+bool chain_load(Chain* chain, const Bundle* bundle, char* const* stages, uint32_t count)
+{
+	chain->stageCount = 0;
+	chain->fused = false;
+	if (count > CHAIN_MAX_STAGES) {
+		fprintf(stderr, "a chain has at most %d plugins\n", CHAIN_MAX_STAGES);
+		return false;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		if (!parse_stage(&chain->stages[i], bundle, stages[i])) {
+			chain_unload(chain);
+			return false;
+		}
+		chain->stageCount++;
+	}
+	return true;
+}
+
+void chain_unload(Chain* chain)
+{
+	for (uint32_t i = 0; i < chain->stageCount; i++) plugin_unload(&chain->stages[i].plugin);
+	chain->stageCount = 0;
+}
+
+// The plugins seed their dither with rand() as they're created. Each run seeds
+// it the same, so a file renders the same samples whichever thread renders it
+// and whatever renders next to it.
+static pthread_mutex_t seeding = PTHREAD_MUTEX_INITIALIZER;
+
+static bool add_instance(ChainRun* run, const Stage* stage, uint32_t channel)
+{
+	Instance* instance = &run->instances[run->instanceCount];
+	if (!instance_create(instance, &stage->plugin, run->rate, NULL)) return false;
+	run->instanceChannels[run->instanceCount] = channel;
+	const LV2_Descriptor* descriptor = stage->plugin.descriptor;
+	if (run->chain->fused && descriptor->extension_data) run->fused[run->instanceCount] = (const AirwindowsFused*) descriptor->extension_data(AIRWINDOWS__fused);
+	run->instanceCount++;
+	for (uint32_t i = 0; i < stage->settingCount; i++) instance_set(instance, stage->settingPorts[i], stage->settingValues[i]);
+	instance_connect(instance, (const float* const*) &run->buffers[channel], &run->buffers[channel]);
+	return true;
+}
+
+bool chain_run_create(ChainRun* run, const Chain* chain, double rate, uint32_t channels, uint32_t block)
+{
+	memset(run, 0, sizeof(ChainRun));
+	run->chain = chain;
+	run->rate = rate;
+	run->channels = channels;
+	run->block = block;
+	if (channels < 1 || channels > 2) {
+		fprintf(stderr, "the chain takes mono or stereo, not %u channels\n", channels);
+		return false;
+	}
+	for (uint32_t c = 0; c < channels; c++) {
+		run->buffers[c] = (float*) calloc(block, sizeof(float));
+		if (!run->buffers[c]) {
+			chain_run_destroy(run);
+			return false;
+		}
+	}
+
+	pthread_mutex_lock(&seeding);
+	srand(1);
+	bool created = true;
+	for (uint32_t s = 0; s < chain->stageCount && created; s++) {
+		const Stage* stage = &chain->stages[s];
+		const uint32_t pluginChannels = stage->plugin.audioIns;
+		if (pluginChannels == channels) {
+			created = add_instance(run, stage, 0);
+		} else if (pluginChannels == 1) {
+			created = add_instance(run, stage, 0) && add_instance(run, stage, 1);
+		} else {
+			fprintf(stderr, "%s is stereo, the input is mono\n", stage->plugin.entry->name);
+			created = false;
+		}
+	}
+	pthread_mutex_unlock(&seeding);
+	if (!created) chain_run_destroy(run);
+	return created;
+}
+
+void chain_run_process(ChainRun* run, uint32_t frames)
+{
+	chain_run_process_on(run, 0, run->instanceCount, run->buffers, frames);
+}
+
+// Whether no instance after i up to end processes one of the channels of i
+static bool ends_row(const ChainRun* run, uint32_t i, uint32_t end)
+{
+	const uint32_t first = run->instanceChannels[i];
+	const uint32_t last = first + run->instances[i].plugin->audioIns;
+	for (uint32_t j = i + 1; j < end; j++) {
+		const uint32_t channel = run->instanceChannels[j];
+		if (channel < last && channel + run->instances[j].plugin->audioIns > first) return false;
+	}
+	return true;
+}
+
+// Runs a row of fused instances on a scratch buffer small enough to stay in
+// the L1 cache, converting from and to float once
+static void process_row(ChainRun* run, uint32_t first, uint32_t end, float* const* buffers, uint32_t frames)
+{
+	double scratch[2][FUSED_BLOCK];
+	double* channels[2] = {scratch[0], scratch[1]};
+	bool dither[CHAIN_MAX_STAGES * 2];
+	for (uint32_t i = first; i < end; i++) dither[i] = ends_row(run, i, end);
+
+	for (uint32_t frame = 0; frame < frames; frame += FUSED_BLOCK) {
+		const uint32_t block = frames - frame < FUSED_BLOCK ? frames - frame : FUSED_BLOCK;
+		for (uint32_t c = 0; c < run->channels; c++) {
+			for (uint32_t i = 0; i < block; i++) scratch[c][i] = buffers[c][frame + i];
+		}
+		for (uint32_t i = first; i < end; i++) {
+			run->fused[i]->process(run->instances[i].handle, &channels[run->instanceChannels[i]], block, dither[i]);
+		}
+		for (uint32_t c = 0; c < run->channels; c++) {
+			for (uint32_t i = 0; i < block; i++) buffers[c][frame + i] = (float) scratch[c][i];
+		}
+	}
+}
+
+void chain_run_process_on(ChainRun* run, uint32_t first, uint32_t end, float* const* buffers, uint32_t frames)
+{
+	for (uint32_t i = first; i < end;) {
+		uint32_t rowEnd = i + 1;
+		while (run->fused[i] && rowEnd < end && run->fused[rowEnd]) rowEnd++;
+		if (rowEnd - i > 1) {
+			process_row(run, i, rowEnd, buffers, frames);
+		} else {
+			float* const* channels = &buffers[run->instanceChannels[i]];
+			instance_connect(&run->instances[i], (const float* const*) channels, channels);
+			instance_run(&run->instances[i], frames);
+		}
+		i = rowEnd;
+	}
+}
+
+void chain_run_destroy(ChainRun* run)
+{
+	for (uint32_t i = 0; i < run->instanceCount; i++) instance_destroy(&run->instances[i]);
+	run->instanceCount = 0;
+	free(run->buffers[0]);
+	free(run->buffers[1]);
+	run->buffers[0] = NULL;
+	run->buffers[1] = NULL;
+}
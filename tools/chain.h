@@ -0,0 +1,53 @@
+#ifndef AIRWINDOWS_TOOLS_CHAIN_H
+#define AIRWINDOWS_TOOLS_CHAIN_H
+
+#include "../src/common/fused.h"
+#include "host.h"
+
+// A chain of plugins for offline rendering. The plugins are loaded once and
+// shared, while every file gets instances of its own in a ChainRun, for its
+// rate and channels: a mono plugin runs twice on a stereo file. The stages
+// process the run's buffers in place, which all plugins of the bundle allow.
+// In a fused chain, rows of plugins with the fused extension run back to back
+// on double precision samples, see fused.h.
+
+#define CHAIN_MAX_STAGES 32
+
+typedef struct {
+	Plugin plugin;
+	uint32_t settingCount;
+	uint32_t settingPorts[HOST_MAX_PORTS];
+	float settingValues[HOST_MAX_PORTS];
+} Stage;
+
+typedef struct {
+	uint32_t stageCount;
+	Stage stages[CHAIN_MAX_STAGES];
+	bool fused;
+} Chain;
+
+// The stages read <plugin>[:<symbol>=<value>[,<symbol>=<value>]...]
+bool chain_load(Chain* chain, const Bundle* bundle, char* const* stages, uint32_t count);
+void chain_unload(Chain* chain);
+
+typedef struct {
+	const Chain* chain;
+	double rate;
+	uint32_t channels;
+	uint32_t block;
+	float* buffers[2];
+	uint32_t instanceCount;
+	Instance instances[CHAIN_MAX_STAGES * 2];
+	uint32_t instanceChannels[CHAIN_MAX_STAGES * 2]; // the first channel each one processes
+	const AirwindowsFused* fused[CHAIN_MAX_STAGES * 2]; // NULL unless it's fused
+} ChainRun;
+
+bool chain_run_create(ChainRun* run, const Chain* chain, double rate, uint32_t channels, uint32_t block);
+// Processes the first frames of the buffers, up to block, in place
+void chain_run_process(ChainRun* run, uint32_t frames);
+// The same for the instances from first up to end, on other buffers, which
+// they stay connected to
+void chain_run_process_on(ChainRun* run, uint32_t first, uint32_t end, float* const* buffers, uint32_t frames);
+void chain_run_destroy(ChainRun* run);
+
+#endif
@@ -0,0 +1,125 @@
+#define _GNU_SOURCE
+
+#include "counters.h"
+
+#include <stdio.h>
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static const uint64_t events[COUNTER_COUNT] = {
+	PERF_COUNT_HW_CPU_CYCLES,
+	PERF_COUNT_HW_INSTRUCTIONS,
+	PERF_COUNT_HW_CACHE_MISSES,
+	PERF_COUNT_HW_BRANCH_MISSES};
+
+static int open_event(uint64_t event, int group)
+{
+	struct perf_event_attr attributes;
+	memset(&attributes, 0, sizeof(attributes));
+	attributes.size = sizeof(attributes);
+	attributes.type = PERF_TYPE_HARDWARE;
+	attributes.config = event;
+	attributes.disabled = group < 0; // the members follow the leader
+	attributes.exclude_kernel = 1;
+	attributes.exclude_hv = 1;
+	attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	return (int) syscall(SYS_perf_event_open, &attributes, 0, -1, group, 0);
+}
+
+bool counters_open(Counters* counters)
+{
+	counters->count = 0;
+	int error = 0;
+	for (int c = 0; c < COUNTER_COUNT; c++) {
+		const int descriptor = open_event(events[c], counters->count ? counters->descriptors[0] : -1);
+		if (descriptor < 0) {
+			if (!error) error = errno;
+			continue;
+		}
+		counters->descriptors[counters->count] = descriptor;
+		counters->counters[counters->count] = (Counter) c;
+		counters->count++;
+	}
+	if (counters->count == 0) {
+		fprintf(stderr, "no hardware counters: %s%s\n", strerror(error), error == EACCES || error == EPERM ? " (see /proc/sys/kernel/perf_event_paranoid)" : error == ENOENT ? " (the kernel exposes none for this CPU)" : "");
+		return false;
+	}
+	return true;
+}
+
+void counters_start(const Counters* counters)
+{
+	ioctl(counters->descriptors[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void counters_stop(const Counters* counters)
+{
+	ioctl(counters->descriptors[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+}
+
+void counters_clear(const Counters* counters)
+{
+	ioctl(counters->descriptors[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+}
+
+bool counters_read(const Counters* counters, CounterTotals* totals)
+{
+	memset(totals, 0, sizeof(CounterTotals));
+	uint64_t values[3 + COUNTER_COUNT]; // the count, the time enabled and running, the counts
+	const ssize_t size = read(counters->descriptors[0], values, sizeof(values));
+	if (size < (ssize_t) (sizeof(uint64_t) * 3) || values[0] != counters->count || size < (ssize_t) (sizeof(uint64_t) * (3 + values[0]))) return false;
+
+	// the group was on the hardware for part of the time only
+	const double scale = values[2] > 0 && values[2] < values[1] ? (double) values[1] / values[2] : 1.0;
+	for (uint32_t i = 0; i < counters->count; i++) {
+		const Counter counter = counters->counters[i];
+		totals->values[counter] = (uint64_t) (values[3 + i] * scale);
+		totals->counted[counter] = values[2] > 0;
+	}
+	return true;
+}
+
+void counters_close(Counters* counters)
+{
+	// the members first, they belong to the leader's group
+	while (counters->count > 0) close(counters->descriptors[--counters->count]);
+}
+
+#else
+
+bool counters_open(Counters* counters)
+{
+	counters->count = 0;
+	fprintf(stderr, "no hardware counters: they're read through perf_event_open(), which needs Linux\n");
+	return false;
+}
+
+void counters_start(const Counters* counters)
+{
+}
+
+void counters_stop(const Counters* counters)
+{
+}
+
+void counters_clear(const Counters* counters)
+{
+}
+
+bool counters_read(const Counters* counters, CounterTotals* totals)
+{
+	return false;
+}
+
+void counters_close(Counters* counters)
+{
+}
+
+#endif
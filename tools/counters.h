@@ -0,0 +1,45 @@
+#ifndef AIRWINDOWS_TOOLS_COUNTERS_H
+#define AIRWINDOWS_TOOLS_COUNTERS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Hardware performance counters of the calling thread, in user space only, for
+// airwindows-bench: they tell whether a plugin waits for memory, mispredicts
+// branches or is busy computing. They're read through perf_event_open(), so
+// Linux only, and need a CPU whose counters the kernel exposes, which virtual
+// machines often don't, and a perf_event_paranoid of at most 2. Counters the
+// CPU lacks are left out, the others still count.
+
+typedef enum {
+	COUNTER_CYCLES,
+	COUNTER_INSTRUCTIONS,
+	COUNTER_CACHE_MISSES,
+	COUNTER_BRANCH_MISSES,
+	COUNTER_COUNT
+} Counter;
+
+typedef struct {
+	uint32_t count; // opened
+	int descriptors[COUNTER_COUNT]; // the first one leads the group
+	Counter counters[COUNTER_COUNT]; // what each of them counts
+} Counters;
+
+typedef struct {
+	uint64_t values[COUNTER_COUNT];
+	bool counted[COUNTER_COUNT]; // false for those left out
+} CounterTotals;
+
+// false, with the reason on stderr, if none can be opened
+bool counters_open(Counters* counters);
+// The counters only count between start and stop, adding up until the next
+// clear. Each of these is a system call.
+void counters_start(const Counters* counters);
+void counters_stop(const Counters* counters);
+void counters_clear(const Counters* counters);
+// The totals since the last clear, scaled up if the kernel had to share the
+// hardware with other counters; false if they can't be read
+bool counters_read(const Counters* counters, CounterTotals* totals);
+void counters_close(Counters* counters);
+
+#endif
@@ -0,0 +1,473 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "host.h"
+#include "material.h"
+
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// Golden output regression check. Each plugin of a bundle renders the material
+// in the cases below, stepping through a grid of settings: the defaults, all
+// controls at their minimum, all at their maximum, then seeded random points.
+// digest hashes every output of every case into a digest file, one line per
+// plugin and case, and tools/golden.digests holds those of a default build in
+// the repository. record stores the samples themselves, one file per plugin in
+// a directory of references. check renders again and compares against either.
+//
+//     airwindows-golden digest <bundle> <digests> [plugin...]
+//     airwindows-golden record <bundle> <references> [plugin...]
+//     airwindows-golden check [--tolerances <file>] [--mode <mode>]... <bundle> <digests or references> [plugin...]
+//
+// check wants every plugin to render the same samples, unless the tolerance
+// file allows an error for one of the modes given. Its lines read "<mode>
+// <plugin or *> <bound in dB>", and the bound is the peak error relative to
+// full scale. A digest can only tell the same samples, so the modes are
+// checked against recorded samples. digest rewrites the lines of the plugins
+// given and keeps the others, or writes the file anew for the whole bundle.
+
+typedef struct {
+	const char* name;
+	double rate;
+	uint32_t block;
+	double start; // into the material, in seconds
+	bool cv; // only for plugins with CV ports, which then sweep
+} Case;
+
+static const Case cases[] = {
+	{"44k", 44100.0, 512, 0.0, false},
+	{"44k-odd", 44100.0, 37, 0.0, false},
+	{"96k", 96000.0, 512, 0.0, false},
+	{"192k", 192000.0, 512, 0.0, false},
+	{"44k-tail", 44100.0, 512, 2.5, false}, // from quiet over digital silence into the tail
+	{"44k-cv", 44100.0, 512, 0.0, true},
+};
+
+#define CASES (sizeof(cases) / sizeof(cases[0]))
+#define FRAMES 32768
+#define SETTINGS 8 // steps of the grid, FRAMES / SETTINGS frames each
+#define MAX_BLOCK 512
+#define MAX_MODES 8
+#define CV_PERIOD 8192 // frames of one sweep up and down
+#define CV_OVERSHOOT 0.1 // beyond each end of the range, as CV has no bounds
+#define MAX_DIGESTS 4096
+
+static const char magic[8] = {'A', 'W', 'G', 'O', 'L', 'D', '1', '\n'};
+
+static float rendered[CASES][2][FRAMES];
+static float reference[CASES][2][FRAMES];
+
+typedef struct {
+	char plugin[HOST_MAX_NAME];
+	char name[16]; // of the case
+	uint64_t digest;
+} Digest;
+
+static Digest digests[MAX_DIGESTS];
+static uint32_t digestCount;
+
+static float random_between(uint32_t* state, float minimum, float maximum)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return minimum + (maximum - minimum) * (float) ((double) *state / 4294967296.0);
+}
+
+static void apply_setting(Instance* instance, uint32_t step, uint32_t* state)
+{
+	const Plugin* plugin = instance->plugin;
+	for (uint32_t i = 0; i < plugin->portCount; i++) {
+		const Port* port = &plugin->ports[i];
+		if (port->type != PORT_CONTROL || !port->input) continue;
+		if (step == 0) instance_set(instance, i, port->value);
+		else if (step == 1) instance_set(instance, i, port->minimum);
+		else if (step == 2) instance_set(instance, i, port->maximum);
+		else instance_set(instance, i, random_between(state, port->minimum, port->maximum));
+	}
+}
+
+static bool has_cv(const Plugin* plugin)
+{
+	for (uint32_t i = 0; i < plugin->portCount; i++) {
+		if (plugin->ports[i].type == PORT_CV && plugin->ports[i].input) return true;
+	}
+	return false;
+}
+
+static bool applies(const Plugin* plugin, const Case* c)
+{
+	return !c->cv || has_cv(plugin);
+}
+
+// Each CV port sweeps a triangle over its range and a little beyond, starting
+// apart from the others so they don't all reach the ends together
+static void render_cv(const Plugin* plugin, float cv[HOST_MAX_PORTS][MAX_BLOCK], uint32_t frame, uint32_t block)
+{
+	for (uint32_t p = 0; p < plugin->portCount; p++) {
+		const Port* port = &plugin->ports[p];
+		if (port->type != PORT_CV || !port->input) continue;
+		const double range = port->maximum - port->minimum;
+		for (uint32_t i = 0; i < block; i++) {
+			double phase = (double) (frame + i) / CV_PERIOD + (double) p / plugin->portCount;
+			phase -= (uint64_t) phase;
+			const double triangle = phase < 0.5 ? 2.0 * phase : 2.0 - 2.0 * phase;
+			cv[p][i] = (float) (port->minimum - CV_OVERSHOOT * range + (1.0 + 2.0 * CV_OVERSHOOT) * range * triangle);
+		}
+	}
+}
+
+static bool render(const Plugin* plugin, const Case* c, float output[2][FRAMES])
+{
+	static float input[2][MAX_BLOCK];
+	static float cv[HOST_MAX_PORTS][MAX_BLOCK];
+
+	// the plugins seed their dither with rand(), which has to start the same
+	// for every render, whichever plugins were checked before
+	srand(1);
+	Instance instance;
+	if (!instance_create(&instance, plugin, c->rate, NULL)) return false;
+
+	Material material;
+	material_init(&material, c->rate, 1);
+	material.frame = (uint64_t) (c->start * c->rate);
+	float* inputs[2] = {input[0], input[1]};
+	uint32_t state = 1;
+	for (uint32_t p = 0; c->cv && p < plugin->portCount; p++) {
+		if (plugin->ports[p].type == PORT_CV && plugin->ports[p].input) instance_connect_cv(&instance, p, cv[p]);
+	}
+
+	for (uint32_t frame = 0, step = 0; frame < FRAMES; frame += c->block) {
+		const uint32_t block = FRAMES - frame < c->block ? FRAMES - frame : c->block;
+		// the settings change at the first block boundary of their step
+		if (frame >= step * (FRAMES / SETTINGS)) apply_setting(&instance, step++, &state);
+
+		float* outputs[2] = {output[0] + frame, output[1] + frame};
+		instance_connect(&instance, (const float* const*) inputs, outputs);
+		material_render(&material, inputs, plugin->audioIns, block);
+		if (c->cv) render_cv(plugin, cv, frame, block);
+		instance_run(&instance, block);
+	}
+
+	instance_destroy(&instance);
+	return true;
+}
+
+static uint32_t case_count(const Plugin* plugin)
+{
+	uint32_t count = 0;
+	for (size_t c = 0; c < CASES; c++) count += applies(plugin, &cases[c]);
+	return count;
+}
+
+static bool write_references(const char* path, const Plugin* plugin)
+{
+	FILE* file = fopen(path, "wb");
+	if (!file) {
+		fprintf(stderr, "cannot create %s\n", path);
+		return false;
+	}
+	const uint32_t header[3] = {case_count(plugin), plugin->audioOuts, FRAMES};
+	bool written = fwrite(magic, sizeof(magic), 1, file) == 1 && fwrite(header, sizeof(header), 1, file) == 1;
+	for (size_t c = 0; c < CASES; c++) {
+		if (!applies(plugin, &cases[c])) continue;
+		for (uint32_t channel = 0; channel < plugin->audioOuts; channel++) {
+			written = written && fwrite(rendered[c][channel], sizeof(float), FRAMES, file) == FRAMES;
+		}
+	}
+	if (fclose(file) != 0 || !written) {
+		fprintf(stderr, "cannot write %s\n", path);
+		return false;
+	}
+	return true;
+}
+
+static bool read_references(const char* path, const Plugin* plugin)
+{
+	FILE* file = fopen(path, "rb");
+	if (!file) {
+		fprintf(stderr, "no references in %s\n", path);
+		return false;
+	}
+	char fileMagic[sizeof(magic)];
+	uint32_t header[3];
+	bool read = fread(fileMagic, sizeof(fileMagic), 1, file) == 1 && fread(header, sizeof(header), 1, file) == 1;
+	read = read && !memcmp(fileMagic, magic, sizeof(magic)) && header[0] == case_count(plugin) && header[1] == plugin->audioOuts && header[2] == FRAMES;
+	for (size_t c = 0; c < CASES; c++) {
+		if (!applies(plugin, &cases[c])) continue;
+		for (uint32_t channel = 0; channel < plugin->audioOuts; channel++) {
+			read = read && fread(reference[c][channel], sizeof(float), FRAMES, file) == FRAMES;
+		}
+	}
+	fclose(file);
+	if (!read) fprintf(stderr, "%s doesn't hold references of these cases\n", path);
+	return read;
+}
+
+// 64 bit FNV-1a over the outputs, the samples' bits taken least significant
+// byte first, whatever the byte order of the machine
+static uint64_t digest(const Plugin* plugin, size_t c)
+{
+	uint64_t hash = 0xcbf29ce484222325u;
+	for (uint32_t channel = 0; channel < plugin->audioOuts; channel++) {
+		for (uint32_t i = 0; i < FRAMES; i++) {
+			uint32_t bits;
+			memcpy(&bits, &rendered[c][channel][i], sizeof(bits));
+			for (int b = 0; b < 4; b++) {
+				hash ^= (bits >> (8 * b)) & 0xff;
+				hash *= 0x100000001b3u;
+			}
+		}
+	}
+	return hash;
+}
+
+static Digest* find_digest(const char* plugin, const char* name)
+{
+	for (uint32_t i = 0; i < digestCount; i++) {
+		if (!strcmp(digests[i].plugin, plugin) && !strcmp(digests[i].name, name)) return &digests[i];
+	}
+	return NULL;
+}
+
+// The lines read "<plugin> <case> <digest>", those starting with '#' are comments
+static bool read_digests(const char* path)
+{
+	FILE* file = fopen(path, "r");
+	if (!file) {
+		fprintf(stderr, "no digests in %s\n", path);
+		return false;
+	}
+	char line[256];
+	digestCount = 0;
+	while (fgets(line, sizeof(line), file)) {
+		Digest entry;
+		unsigned long long value;
+		if (line[0] == '#' || sscanf(line, "%63s %15s %llx", entry.plugin, entry.name, &value) != 3) continue;
+		if (digestCount == MAX_DIGESTS) {
+			fprintf(stderr, "%s holds more than %d digests\n", path, MAX_DIGESTS);
+			fclose(file);
+			return false;
+		}
+		entry.digest = value;
+		digests[digestCount++] = entry;
+	}
+	fclose(file);
+	return true;
+}
+
+static bool set_digest(const char* plugin, const char* name, uint64_t value)
+{
+	Digest* entry = find_digest(plugin, name);
+	if (!entry) {
+		if (digestCount == MAX_DIGESTS) {
+			fprintf(stderr, "more than %d digests\n", MAX_DIGESTS);
+			return false;
+		}
+		entry = &digests[digestCount++];
+		snprintf(entry->plugin, sizeof(entry->plugin), "%s", plugin);
+		snprintf(entry->name, sizeof(entry->name), "%s", name);
+	}
+	entry->digest = value;
+	return true;
+}
+
+static bool write_digests(const char* path)
+{
+	FILE* file = fopen(path, "w");
+	if (!file) {
+		fprintf(stderr, "cannot create %s\n", path);
+		return false;
+	}
+	fprintf(file, "# Digests of the golden outputs of a default build on x86-64, written by\n");
+	fprintf(file, "# airwindows-golden digest, see tools/golden.c. \"<plugin> <case> <digest>\"\n");
+	for (uint32_t i = 0; i < digestCount; i++) fprintf(file, "%s %s %016llx\n", digests[i].plugin, digests[i].name, (unsigned long long) digests[i].digest);
+	if (fclose(file) != 0) {
+		fprintf(stderr, "cannot write %s\n", path);
+		return false;
+	}
+	return true;
+}
+
+// The most generous bound the tolerance file gives the plugin in one of the
+// modes, -INFINITY if it must render the same samples
+static double tolerance(const char* path, const char* const* modes, int modeCount, const char* plugin)
+{
+	double bound = -INFINITY;
+	FILE* file = path ? fopen(path, "r") : NULL;
+	if (!file) return bound;
+
+	char line[256];
+	while (fgets(line, sizeof(line), file)) {
+		char mode[64], name[HOST_MAX_NAME];
+		double dB;
+		if (line[0] == '#' || sscanf(line, "%63s %63s %lf", mode, name, &dB) != 3) continue;
+		if (strcmp(name, "*") && strcmp(name, plugin)) continue;
+		for (int m = 0; m < modeCount; m++) {
+			if (!strcmp(modes[m], mode) && dB > bound) bound = dB;
+		}
+	}
+	fclose(file);
+	return bound;
+}
+
+// Peak error relative to full scale in dB, -INFINITY if the outputs are the same
+static double compare(const Plugin* plugin, size_t c, uint32_t* where)
+{
+	double peak = 0.0;
+	*where = 0;
+	for (uint32_t channel = 0; channel < plugin->audioOuts; channel++) {
+		for (uint32_t i = 0; i < FRAMES; i++) {
+			const float a = reference[c][channel][i];
+			const float b = rendered[c][channel][i];
+			if (a == b || (a != a && b != b)) continue;
+			double error = fabs((double) a - (double) b);
+			if (!(error <= 2.0)) error = INFINITY; // a NaN or beyond any sane output
+			if (error > peak) {
+				peak = error;
+				*where = i;
+			}
+		}
+	}
+	return peak > 0.0 ? 20.0 * log10(peak) : -INFINITY;
+}
+
+static void usage(const char* name)
+{
+	fprintf(stderr, "usage: %s digest <bundle> <digests> [plugin...]\n", name);
+	fprintf(stderr, "       %s record <bundle> <references> [plugin...]\n", name);
+	fprintf(stderr, "       %s check [--tolerances <file>] [--mode <mode>]... <bundle> <digests or references> [plugin...]\n", name);
+}
+
+static void print_case(const char* verdict, const char* plugin, const Case* c)
+{
+	printf("%s %s at %.0f Hz in blocks of %u from %.1f s%s: ", verdict, plugin, c->rate, c->block, c->start, c->cv ? " with swept CV" : "");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2 || (strcmp(argv[1], "digest") && strcmp(argv[1], "record") && strcmp(argv[1], "check"))) {
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	const bool digesting = !strcmp(argv[1], "digest");
+	const bool record = !strcmp(argv[1], "record");
+	const bool check = !strcmp(argv[1], "check");
+
+	const char* tolerances = NULL;
+	const char* modes[MAX_MODES];
+	int modeCount = 0;
+	int arg = 2;
+	for (; arg + 1 < argc && !strncmp(argv[arg], "--", 2); arg += 2) {
+		if (check && !strcmp(argv[arg], "--tolerances")) {
+			tolerances = argv[arg + 1];
+		} else if (check && !strcmp(argv[arg], "--mode") && modeCount < MAX_MODES) {
+			modes[modeCount++] = argv[arg + 1];
+		} else {
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	if (argc - arg < 2) {
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	const char* references = argv[arg + 1];
+	const int first = arg + 2;
+
+	// a file of digests, or a directory of recorded samples
+	struct stat info;
+	const bool againstDigests = digesting || (check && stat(references, &info) == 0 && S_ISREG(info.st_mode));
+	if (check && againstDigests && modeCount > 0) {
+		fprintf(stderr, "digests only tell the same samples, check the modes against references recorded with a default build\n");
+		return EXIT_FAILURE;
+	}
+	if (record && mkdir(references, 0777) != 0 && errno != EEXIST) {
+		fprintf(stderr, "cannot create %s\n", references);
+		return EXIT_FAILURE;
+	}
+	// digest rewrites the lines of the plugins given and keeps the others
+	digestCount = 0;
+	if ((check && againstDigests) || (digesting && argc > first)) {
+		if (!read_digests(references)) return EXIT_FAILURE;
+	}
+
+	Bundle bundle;
+	if (!bundle_open(&bundle, argv[arg])) return EXIT_FAILURE;
+
+	int failures = 0;
+	const uint32_t count = argc > first ? (uint32_t) (argc - first) : bundle.count;
+	for (uint32_t p = 0; p < count; p++) {
+		const BundleEntry* entry = argc > first ? bundle_find(&bundle, argv[first + p]) : &bundle.entries[p];
+		if (!entry) {
+			fprintf(stderr, "no plugin %s in %s\n", argv[first + p], bundle.path);
+			failures++;
+			continue;
+		}
+
+		Plugin plugin;
+		if (!plugin_load(&plugin, &bundle, entry)) {
+			failures++;
+			continue;
+		}
+		bool renderedAll = true;
+		for (size_t c = 0; c < CASES; c++) {
+			if (applies(&plugin, &cases[c])) renderedAll = renderedAll && render(&plugin, &cases[c], rendered[c]);
+		}
+		plugin_unload(&plugin);
+		if (!renderedAll) {
+			failures++;
+			continue;
+		}
+
+		if (againstDigests) {
+			for (size_t c = 0; c < CASES; c++) {
+				if (!applies(&plugin, &cases[c])) continue;
+				const uint64_t value = digest(&plugin, c);
+				if (digesting) {
+					if (!set_digest(entry->name, cases[c].name, value)) failures++;
+					continue;
+				}
+				const Digest* expected = find_digest(entry->name, cases[c].name);
+				if (expected && expected->digest == value) continue;
+				print_case("FAIL", entry->name, &cases[c]);
+				printf("%s\n", expected ? "differs from the digest" : "no digest");
+				failures++;
+			}
+			continue;
+		}
+
+		char path[4200];
+		snprintf(path, sizeof(path), "%s/%s.golden", references, entry->name);
+		if (record) {
+			if (!write_references(path, &plugin)) failures++;
+			continue;
+		}
+		if (!read_references(path, &plugin)) {
+			failures++;
+			continue;
+		}
+
+		const double bound = tolerance(tolerances, modes, modeCount, entry->name);
+		for (size_t c = 0; c < CASES; c++) {
+			uint32_t where;
+			if (!applies(&plugin, &cases[c])) continue;
+			const double error = compare(&plugin, c, &where);
+			if (error == -INFINITY) continue;
+			const bool failed = !(error <= bound);
+			print_case(failed ? "FAIL" : "ok  ", entry->name, &cases[c]);
+			printf("%.1f dB at frame %u", error, where);
+			if (bound > -INFINITY) printf(", bound %.1f dB", bound);
+			printf("\n");
+			if (failed) failures++;
+		}
+	}
+
+	bundle_close(&bundle);
+	if (digesting && !failures && !write_digests(references)) failures++;
+	if (check) printf("%s\n", failures ? "golden outputs differ" : "golden outputs match");
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
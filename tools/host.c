@@ -0,0 +1,283 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "host.h"
+
+#include <dlfcn.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static char* read_file(const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	if (!file) {
+		fprintf(stderr, "cannot open %s\n", path);
+		return NULL;
+	}
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	char* text = (char*) malloc(size + 1);
+	if (text && fread(text, 1, size, file) != (size_t) size) {
+		free(text);
+		text = NULL;
+	}
+	fclose(file);
+	if (!text) {
+		fprintf(stderr, "cannot read %s\n", path);
+		return NULL;
+	}
+	text[size] = '\0';
+	return text;
+}
+
+// Copies the IRI after key up to the closing '>', false if key isn't found
+static bool read_iri(const char* text, const char* key, char* out, size_t size)
+{
+	const char* start = strstr(text, key);
+	if (!start) return false;
+	start += strlen(key);
+	const char* end = strchr(start, '>');
+	if (!end || (size_t) (end - start) >= size) return false;
+	memcpy(out, start, end - start);
+	out[end - start] = '\0';
+	return true;
+}
+
+bool bundle_open(Bundle* bundle, const char* path)
+{
+	memset(bundle, 0, sizeof(Bundle));
+	snprintf(bundle->path, sizeof(bundle->path), "%s", path);
+
+	char manifestPath[4200];
+	snprintf(manifestPath, sizeof(manifestPath), "%s/manifest.ttl", path);
+	char* manifest = read_file(manifestPath);
+	if (!manifest) return false;
+
+	uint32_t capacity = 0;
+	for (const char* subject = manifest; (subject = strstr(subject, "\n<")); subject++) capacity++;
+	bundle->entries = (BundleEntry*) calloc(capacity ? capacity : 1, sizeof(BundleEntry));
+
+	// every plugin is a statement of its own, starting with its URI on a new line
+	for (const char* subject = manifest; (subject = strstr(subject, "\n<")); subject++) {
+		const char* next = strstr(subject + 1, "\n<");
+		size_t length = next ? (size_t) (next - subject) : strlen(subject);
+		char statement[1024];
+		if (length >= sizeof(statement)) continue;
+		memcpy(statement, subject, length);
+		statement[length] = '\0';
+
+		BundleEntry* entry = &bundle->entries[bundle->count];
+		char seeAlso[HOST_MAX_NAME];
+		if (!read_iri(statement, "\n<", entry->uri, sizeof(entry->uri))) continue;
+		if (!read_iri(statement, "lv2:binary <", entry->binary, sizeof(entry->binary))) continue;
+		if (!read_iri(statement, "rdfs:seeAlso <", seeAlso, sizeof(seeAlso))) continue;
+		char* extension = strstr(seeAlso, ".ttl");
+		if (extension) *extension = '\0';
+		memcpy(entry->name, seeAlso, sizeof(entry->name));
+		bundle->count++;
+	}
+	free(manifest);
+
+	if (bundle->count == 0) {
+		fprintf(stderr, "no plugins in %s\n", manifestPath);
+		bundle_close(bundle);
+		return false;
+	}
+	return true;
+}
+
+const BundleEntry* bundle_find(const Bundle* bundle, const char* name)
+{
+	for (uint32_t i = 0; i < bundle->count; i++) {
+		if (!strcmp(bundle->entries[i].name, name) || !strcmp(bundle->entries[i].uri, name)) return &bundle->entries[i];
+	}
+	return NULL;
+}
+
+void bundle_close(Bundle* bundle)
+{
+	free(bundle->entries);
+	bundle->entries = NULL;
+	bundle->count = 0;
+}
+
+static float read_float(const char* block, const char* key, float fallback)
+{
+	const char* value = strstr(block, key);
+	float result;
+	if (!value || sscanf(value + strlen(key), " %f", &result) != 1) return fallback;
+	return result;
+}
+
+static bool parse_port(Plugin* plugin, const char* block)
+{
+	const char* index = strstr(block, "lv2:index");
+	unsigned int i;
+	if (!index || sscanf(index + strlen("lv2:index"), " %u", &i) != 1 || i >= HOST_MAX_PORTS) return false;
+
+	Port* port = &plugin->ports[i];
+	if (strstr(block, "lv2:AudioPort")) port->type = PORT_AUDIO;
+	else if (strstr(block, "lv2:CVPort")) port->type = PORT_CV;
+	else port->type = PORT_CONTROL;
+	port->input = strstr(block, "lv2:InputPort") != NULL;
+	port->integer = strstr(block, "lv2:integer") || strstr(block, "lv2:enumeration");
+	port->minimum = read_float(block, "lv2:minimum", 0.0f);
+	port->maximum = read_float(block, "lv2:maximum", 1.0f);
+	port->value = read_float(block, "lv2:default", port->minimum);
+
+	const char* symbol = strstr(block, "lv2:symbol \"");
+	if (symbol) {
+		symbol += strlen("lv2:symbol \"");
+		size_t length = strcspn(symbol, "\"");
+		if (length >= sizeof(port->symbol)) length = sizeof(port->symbol) - 1;
+		memcpy(port->symbol, symbol, length);
+		port->symbol[length] = '\0';
+	}
+
+	if (i + 1 > plugin->portCount) plugin->portCount = i + 1;
+	return true;
+}
+
+// The ports are the top level [ ] blocks of the lv2:port list, which ends with
+// the plugin's statement. Units may nest blocks of their own.
+static bool parse_ports(Plugin* plugin, const char* ttl)
+{
+	const char* p = strstr(ttl, "lv2:port");
+	if (!p) return false;
+
+	int depth = 0;
+	const char* start = NULL;
+	for (p += strlen("lv2:port"); *p; p++) {
+		if (*p == '"') {
+			p = strchr(p + 1, '"');
+			if (!p) return false;
+		} else if (*p == '[') {
+			if (depth++ == 0) start = p;
+		} else if (*p == ']') {
+			if (--depth == 0) {
+				char block[4096];
+				size_t length = p - start;
+				if (length >= sizeof(block)) return false;
+				memcpy(block, start, length);
+				block[length] = '\0';
+				if (!parse_port(plugin, block)) return false;
+			}
+		} else if (*p == '.' && depth == 0) {
+			break;
+		}
+	}
+	return plugin->portCount > 0;
+}
+
+bool plugin_load(Plugin* plugin, const Bundle* bundle, const BundleEntry* entry)
+{
+	memset(plugin, 0, sizeof(Plugin));
+	plugin->bundle = bundle;
+	plugin->entry = entry;
+
+	char path[4200];
+	snprintf(path, sizeof(path), "%s/%s.ttl", bundle->path, entry->name);
+	char* ttl = read_file(path);
+	if (!ttl) return false;
+	bool parsed = parse_ports(plugin, ttl);
+	free(ttl);
+	if (!parsed) {
+		fprintf(stderr, "cannot read the ports of %s\n", path);
+		return false;
+	}
+
+	for (uint32_t i = 0; i < plugin->portCount; i++) {
+		const Port* port = &plugin->ports[i];
+		if (port->type != PORT_AUDIO) continue;
+		if (port->input && plugin->audioIns < 2) plugin->audioIn[plugin->audioIns++] = i;
+		if (!port->input && plugin->audioOuts < 2) plugin->audioOut[plugin->audioOuts++] = i;
+	}
+
+	snprintf(path, sizeof(path), "%s/%s", bundle->path, entry->binary);
+	plugin->library = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+	if (!plugin->library) {
+		fprintf(stderr, "%s\n", dlerror());
+		return false;
+	}
+	const LV2_Descriptor* (*descriptors)(uint32_t) = (const LV2_Descriptor* (*) (uint32_t)) dlsym(plugin->library, "lv2_descriptor");
+	for (uint32_t i = 0; descriptors && descriptors(i); i++) {
+		if (!strcmp(descriptors(i)->URI, entry->uri)) {
+			plugin->descriptor = descriptors(i);
+			return true;
+		}
+	}
+	fprintf(stderr, "%s has no descriptor for %s\n", path, entry->uri);
+	plugin_unload(plugin);
+	return false;
+}
+
+int plugin_port(const Plugin* plugin, const char* symbol)
+{
+	for (uint32_t i = 0; i < plugin->portCount; i++) {
+		if (!strcmp(plugin->ports[i].symbol, symbol)) return (int) i;
+	}
+	return -1;
+}
+
+void plugin_unload(Plugin* plugin)
+{
+	if (plugin->library) dlclose(plugin->library);
+	plugin->library = NULL;
+	plugin->descriptor = NULL;
+}
+
+bool instance_create(Instance* instance, const Plugin* plugin, double rate, const LV2_Feature* const* features)
+{
+	static const LV2_Feature* const noFeatures[] = {NULL};
+
+	memset(instance, 0, sizeof(Instance));
+	instance->plugin = plugin;
+	instance->handle = plugin->descriptor->instantiate(plugin->descriptor, rate, plugin->bundle->path, features ? features : noFeatures);
+	if (!instance->handle) {
+		fprintf(stderr, "cannot instantiate %s\n", plugin->entry->name);
+		return false;
+	}
+	for (uint32_t i = 0; i < plugin->portCount; i++) {
+		if (plugin->ports[i].type != PORT_CONTROL) continue;
+		instance->controls[i] = plugin->ports[i].value;
+		plugin->descriptor->connect_port(instance->handle, i, &instance->controls[i]);
+	}
+	if (plugin->descriptor->activate) plugin->descriptor->activate(instance->handle);
+	return true;
+}
+
+void instance_set(Instance* instance, uint32_t port, float value)
+{
+	const Port* info = &instance->plugin->ports[port];
+	if (info->integer) value = roundf(value);
+	if (value < info->minimum) value = info->minimum;
+	if (value > info->maximum) value = info->maximum;
+	instance->controls[port] = value;
+}
+
+void instance_connect(Instance* instance, const float* const* inputs, float* const* outputs)
+{
+	const Plugin* plugin = instance->plugin;
+	for (uint32_t i = 0; i < plugin->audioIns; i++) {
+		plugin->descriptor->connect_port(instance->handle, plugin->audioIn[i], (void*) inputs[i]);
+	}
+	for (uint32_t i = 0; i < plugin->audioOuts; i++) {
+		plugin->descriptor->connect_port(instance->handle, plugin->audioOut[i], outputs[i]);
+	}
+}
+
+void instance_connect_cv(Instance* instance, uint32_t port, const float* cv)
+{
+	instance->plugin->descriptor->connect_port(instance->handle, port, (void*) cv);
+}
+
+void instance_destroy(Instance* instance)
+{
+	const LV2_Descriptor* descriptor = instance->plugin->descriptor;
+	if (!instance->handle) return;
+	if (descriptor->deactivate) descriptor->deactivate(instance->handle);
+	descriptor->cleanup(instance->handle);
+	instance->handle = NULL;
+}
@@ -0,0 +1,89 @@
+#ifndef AIRWINDOWS_TOOLS_HOST_H
+#define AIRWINDOWS_TOOLS_HOST_H
+
+#include <lv2/core/lv2.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// A minimal LV2 host for the tools, loading the plugins of a built bundle: the
+// meson build directory or an installed Airwindows.lv2. It reads just enough of
+// manifest.ttl and of the plugins' Turtle files, which all follow the layout of
+// the Template, to connect the ports. It is no general Turtle parser.
+
+#define HOST_MAX_PORTS 32
+#define HOST_MAX_NAME 64
+
+typedef enum {
+	PORT_AUDIO,
+	PORT_CONTROL,
+	PORT_CV
+} PortType;
+
+typedef struct {
+	PortType type;
+	bool input;
+	bool integer; // lv2:integer or lv2:enumeration
+	char symbol[HOST_MAX_NAME];
+	float value; // lv2:default
+	float minimum;
+	float maximum;
+} Port;
+
+typedef struct {
+	char name[HOST_MAX_NAME]; // of the Turtle file, e.g. Capacitor2Mono
+	char uri[256];
+	char binary[HOST_MAX_NAME]; // relative to the bundle
+} BundleEntry;
+
+typedef struct {
+	char path[4096];
+	uint32_t count;
+	BundleEntry* entries; // in the order of the manifest
+} Bundle;
+
+bool bundle_open(Bundle* bundle, const char* path);
+// By the name of the Turtle file or by URI, NULL if the bundle has no such plugin
+const BundleEntry* bundle_find(const Bundle* bundle, const char* name);
+void bundle_close(Bundle* bundle);
+
+typedef struct {
+	const Bundle* bundle;
+	const BundleEntry* entry;
+	void* library;
+	const LV2_Descriptor* descriptor;
+	uint32_t portCount;
+	Port ports[HOST_MAX_PORTS]; // by index
+	uint32_t audioIns;
+	uint32_t audioOuts;
+	uint32_t audioIn[2];
+	uint32_t audioOut[2];
+} Plugin;
+
+bool plugin_load(Plugin* plugin, const Bundle* bundle, const BundleEntry* entry);
+// The index of the port, -1 if the plugin has none with this symbol
+int plugin_port(const Plugin* plugin, const char* symbol);
+void plugin_unload(Plugin* plugin);
+
+typedef struct {
+	const Plugin* plugin;
+	LV2_Handle handle;
+	float controls[HOST_MAX_PORTS]; // by port index
+} Instance;
+
+// Instantiates and activates the plugin with every control at its default.
+// CV ports stay unconnected, unless connected with instance_connect_cv().
+bool instance_create(Instance* instance, const Plugin* plugin, double rate, const LV2_Feature* const* features);
+// Sets a control, clamped to the port's range and rounded if it's an integer
+void instance_set(Instance* instance, uint32_t port, float value);
+void instance_connect(Instance* instance, const float* const* inputs, float* const* outputs);
+// Connects a CV input port to a buffer holding as many frames as each run
+void instance_connect_cv(Instance* instance, uint32_t port, const float* cv);
+void instance_destroy(Instance* instance);
+
+static inline void instance_run(Instance* instance, uint32_t frames)
+{
+	instance->plugin->descriptor->run(instance->handle, frames);
+}
+
+#endif
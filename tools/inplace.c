@@ -0,0 +1,142 @@
+#include "host.h"
+#include "material.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Checks that every plugin of a bundle may process in place, as LV2 assumes of
+// plugins without lv2:inPlaceBroken: the material renders through each plugin
+// with separate buffers, with each output on its own input, and with the
+// outputs crossed onto the other input, and all three have to give the same
+// samples. The controls start at their defaults and jump to seeded random
+// settings, so the plugins take their other paths as well.
+//
+//     airwindows-inplace <bundle> [plugin...]
+
+typedef enum {
+	BUFFERS_SEPARATE,
+	BUFFERS_SHARED,
+	BUFFERS_CROSSED,
+	BUFFERS_COUNT
+} Buffers;
+
+static const char* const bufferNames[BUFFERS_COUNT] = {"separate buffers", "each output on its own input", "crossed outputs"};
+
+#define RATE 44100.0
+#define BLOCK 256
+#define FRAMES 65536
+#define SETTINGS 8 // the defaults, then random ones, FRAMES / SETTINGS frames each
+
+static float rendered[BUFFERS_COUNT][2][FRAMES];
+
+static float random_between(uint32_t* state, float minimum, float maximum)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return minimum + (maximum - minimum) * (float) ((double) *state / 4294967296.0);
+}
+
+static bool render(const Plugin* plugin, Buffers buffers, float output[2][FRAMES])
+{
+	static float input[2][BLOCK];
+	static float separate[2][BLOCK];
+
+	// the plugins seed their dither with rand(), the same for every render
+	srand(1);
+	Instance instance;
+	if (!instance_create(&instance, plugin, RATE, NULL)) return false;
+
+	float* inputs[2] = {input[0], input[1]};
+	float* outputs[2];
+	for (uint32_t c = 0; c < 2; c++) {
+		if (buffers == BUFFERS_SEPARATE) outputs[c] = separate[c];
+		else if (buffers == BUFFERS_CROSSED && plugin->audioIns > 1) outputs[c] = input[1 - c];
+		else outputs[c] = input[c < plugin->audioIns ? c : 0];
+	}
+	instance_connect(&instance, (const float* const*) inputs, outputs);
+
+	Material material;
+	material_init(&material, RATE, 1);
+	uint32_t state = 1;
+	for (uint32_t frame = 0; frame < FRAMES; frame += BLOCK) {
+		if (frame % (FRAMES / SETTINGS) == 0 && frame > 0) {
+			for (uint32_t i = 0; i < plugin->portCount; i++) {
+				const Port* port = &plugin->ports[i];
+				if (port->type == PORT_CONTROL && port->input) instance_set(&instance, i, random_between(&state, port->minimum, port->maximum));
+			}
+		}
+		material_render(&material, inputs, plugin->audioIns, BLOCK);
+		instance_run(&instance, BLOCK);
+		for (uint32_t c = 0; c < plugin->audioOuts; c++) memcpy(output[c] + frame, outputs[c], sizeof(float) * BLOCK);
+	}
+
+	instance_destroy(&instance);
+	return true;
+}
+
+// The first frame where the outputs differ, FRAMES if they're the same
+static uint32_t compare(const Plugin* plugin, Buffers buffers, uint32_t* channel)
+{
+	uint32_t first = FRAMES;
+	for (uint32_t c = 0; c < plugin->audioOuts; c++) {
+		for (uint32_t i = 0; i < first; i++) {
+			const float a = rendered[BUFFERS_SEPARATE][c][i];
+			const float b = rendered[buffers][c][i];
+			if (a == b || (a != a && b != b)) continue;
+			first = i;
+			*channel = c;
+		}
+	}
+	return first;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <bundle> [plugin...]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	Bundle bundle;
+	if (!bundle_open(&bundle, argv[1])) return EXIT_FAILURE;
+
+	int failures = 0;
+	const uint32_t count = argc > 2 ? (uint32_t) argc - 2 : bundle.count;
+	for (uint32_t p = 0; p < count; p++) {
+		const BundleEntry* entry = argc > 2 ? bundle_find(&bundle, argv[p + 2]) : &bundle.entries[p];
+		if (!entry) {
+			fprintf(stderr, "no plugin %s in %s\n", argv[p + 2], argv[1]);
+			failures++;
+			continue;
+		}
+
+		Plugin plugin;
+		if (!plugin_load(&plugin, &bundle, entry)) {
+			failures++;
+			continue;
+		}
+		// with one input, crossing is the same as sharing
+		const int ways = plugin.audioIns > 1 ? BUFFERS_COUNT : BUFFERS_CROSSED;
+		bool renderedAll = true;
+		for (int b = 0; b < ways; b++) renderedAll = renderedAll && render(&plugin, (Buffers) b, rendered[b]);
+		plugin_unload(&plugin);
+		if (!renderedAll) {
+			failures++;
+			continue;
+		}
+
+		for (int b = BUFFERS_SHARED; b < ways; b++) {
+			uint32_t channel = 0;
+			const uint32_t frame = compare(&plugin, (Buffers) b, &channel);
+			if (frame == FRAMES) continue;
+			printf("FAIL %s with %s: output %u differs from separate buffers at frame %u\n", entry->name, bufferNames[b], channel + 1, frame);
+			failures++;
+		}
+	}
+
+	bundle_close(&bundle);
+	printf("%s\n", failures ? "some plugins can't process in place" : "all plugins process in place");
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
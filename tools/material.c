@@ -0,0 +1,73 @@
+#include "material.h"
+
+// The melody's steps as frequency ratios, a quarter second each
+static const double melody[8] = {1.0, 1.189, 1.335, 1.498, 1.335, 1.782, 1.498, 2.0};
+
+// A sine like wave over a phase from 0 to 1, within about 0.1% of a sine
+static double wave(double phase)
+{
+	const double x = 2.0 * phase - 1.0;
+	const double y = 4.0 * x * (1.0 - (x < 0.0 ? -x : x));
+	return -y * (0.775 + 0.225 * (y < 0.0 ? -y : y));
+}
+
+static double noise(uint32_t* state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return (double) *state / 2147483648.0 - 1.0;
+}
+
+static double advance(double phase, double frequency, double rate)
+{
+	phase += frequency / rate;
+	return phase >= 1.0 ? phase - 1.0 : phase;
+}
+
+void material_init(Material* material, double rate, uint32_t seed)
+{
+	material->rate = rate;
+	material->half = (uint64_t) (rate * 0.5);
+	if (material->half < 1) material->half = 1;
+	material->frame = 0;
+	for (int c = 0; c < 2; c++) {
+		material->noise[c] = (seed + c) * 2654435761u;
+		if (material->noise[c] == 0) material->noise[c] = 1;
+		material->phase[c][0] = 0.0;
+		material->phase[c][1] = 0.25 * c;
+		material->burst[c] = 0.0;
+	}
+}
+
+void material_render(Material* material, float* const* outputs, uint32_t channels, uint32_t frames)
+{
+	const double rate = material->rate;
+	const uint64_t half = material->half;
+	const double decay = 1.0 - 24.0 / rate;
+
+	for (uint32_t i = 0; i < frames; i++) {
+		const uint64_t position = material->frame % (8 * half);
+		const uint64_t bar = position / half;
+		const double step = melody[(position * 2 / half) % 8];
+
+		for (uint32_t c = 0; c < channels && c < 2; c++) {
+			double sample = 0.0;
+			if (bar < 6) {
+				const double level = (bar % 2 == 0) ? 1.0 : 0.2;
+				if (position % half == 0) material->burst[c] = 1.0;
+				material->burst[c] *= decay;
+				material->phase[c][0] = advance(material->phase[c][0], 55.0 * (1.0 + 0.003 * c), rate);
+				material->phase[c][1] = advance(material->phase[c][1], 440.0 * step, rate);
+				sample = 0.35 * wave(material->phase[c][0]);
+				sample += 0.2 * wave(material->phase[c][1]);
+				sample += 0.4 * material->burst[c] * noise(&material->noise[c]);
+				sample *= level;
+			} else if (bar == 7) {
+				sample = 0.001 * noise(&material->noise[c]);
+			}
+			outputs[c][i] = (float) sample;
+		}
+		material->frame++;
+	}
+}
@@ -0,0 +1,26 @@
+#ifndef AIRWINDOWS_TOOLS_MATERIAL_H
+#define AIRWINDOWS_TOOLS_MATERIAL_H
+
+#include <stdint.h>
+
+// Synthetic program material for the tools, the same for a seed on every
+// machine: it's made with plain arithmetic only, no libm. Over a four second
+// cycle it plays three seconds of a bass line, a melody and drum like noise
+// bursts, alternating between loud and quiet bars, then half a second of
+// digital silence and half a second of a quiet noise tail, so the plugins go
+// through their loud, quiet and silent paths.
+
+typedef struct {
+	double rate;
+	uint64_t half; // frames in half a second
+	uint64_t frame;
+	uint32_t noise[2];
+	double phase[2][2]; // bass and melody of each channel
+	double burst[2]; // envelope of the noise bursts
+} Material;
+
+void material_init(Material* material, double rate, uint32_t seed);
+// Writes the next frames of one or two channels
+void material_render(Material* material, float* const* outputs, uint32_t channels, uint32_t frames);
+
+#endif
@@ -0,0 +1,207 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "pipeline.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SLOTS 4 // blocks in flight
+#define MEASURED_BLOCKS 8
+#define SPINS 4096 // before waiting threads yield
+
+typedef struct {
+	uint64_t value;
+	char padding[56]; // a cache line of its own
+} Counter;
+
+typedef struct Pipeline Pipeline;
+
+typedef struct {
+	Pipeline* pipeline;
+	uint32_t index;
+	uint32_t first; // instances
+	uint32_t end;
+	pthread_t thread;
+} Segment;
+
+struct Pipeline {
+	ChainRun* run;
+	const InputFile* input;
+	OutputFile* output;
+	uint64_t blocks;
+	uint32_t segmentCount;
+	Segment segments[PIPELINE_MAX_SEGMENTS];
+	Counter done[PIPELINE_MAX_SEGMENTS]; // blocks passed on by each segment
+	Counter stopped;
+	float* slots[SLOTS][2];
+};
+
+static double now(void)
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static uint32_t block_frames(const Pipeline* pipeline, uint64_t block)
+{
+	const uint64_t frame = block * pipeline->run->block;
+	const uint64_t left = pipeline->input->frames - frame;
+	return left < pipeline->run->block ? (uint32_t) left : pipeline->run->block;
+}
+
+// The time each instance of the run takes for the first blocks of the input,
+// measured on instances of their own so the run starts afresh
+static void measure(const ChainRun* run, const InputFile* input, double* costs)
+{
+	ChainRun probe;
+	const bool created = chain_run_create(&probe, run->chain, run->rate, run->channels, run->block);
+	for (uint32_t i = 0; i < run->instanceCount; i++) costs[i] = created ? 0.0 : 1.0;
+	if (!created) return;
+
+	for (uint64_t frame = 0, block = 0; frame < input->frames && block < MEASURED_BLOCKS; frame += run->block, block++) {
+		const uint32_t frames = input->frames - frame < run->block ? (uint32_t) (input->frames - frame) : run->block;
+		input_read(input, frame, frames, probe.buffers);
+		for (uint32_t i = 0; i < probe.instanceCount; i++) {
+			const double start = now();
+			instance_run(&probe.instances[i], frames);
+			costs[i] += now() - start;
+		}
+	}
+	chain_run_destroy(&probe);
+}
+
+// Splits the instances into consecutive segments so that the costliest
+// segment is as cheap as possible. Rows of fused instances stay together, a
+// cut would add a dither in between.
+static uint32_t split(Pipeline* pipeline, const double* costs, uint32_t segments)
+{
+	const ChainRun* run = pipeline->run;
+	const uint32_t count = run->instanceCount;
+	bool cuttable[CHAIN_MAX_STAGES * 2 + 1];
+	uint32_t cuts = 0;
+	for (uint32_t j = 1; j < count; j++) {
+		cuttable[j] = !run->fused[j - 1] || !run->fused[j];
+		if (cuttable[j]) cuts++;
+	}
+	if (segments > cuts + 1) segments = cuts + 1;
+	if (segments == 1) {
+		pipeline->segments[0].first = 0;
+		pipeline->segments[0].end = count;
+		return 1;
+	}
+
+	const double unreachable = 1e300;
+	double sums[CHAIN_MAX_STAGES * 2 + 1] = {0.0};
+	for (uint32_t i = 0; i < count; i++) sums[i + 1] = sums[i] + costs[i];
+
+	// best[s][i] is the costliest segment when the first i instances form s + 1 segments
+	double best[PIPELINE_MAX_SEGMENTS][CHAIN_MAX_STAGES * 2 + 1];
+	uint32_t cut[PIPELINE_MAX_SEGMENTS][CHAIN_MAX_STAGES * 2 + 1];
+	for (uint32_t i = 0; i <= count; i++) best[0][i] = sums[i];
+	for (uint32_t s = 1; s < segments; s++) {
+		for (uint32_t i = 0; i <= count; i++) {
+			best[s][i] = unreachable;
+			for (uint32_t j = s; j < i; j++) {
+				if (!cuttable[j]) continue;
+				const double last = sums[i] - sums[j];
+				const double worst = best[s - 1][j] > last ? best[s - 1][j] : last;
+				if (worst < best[s][i]) {
+					best[s][i] = worst;
+					cut[s][i] = j;
+				}
+			}
+		}
+	}
+
+	uint32_t end = count;
+	for (uint32_t s = segments; s-- > 0;) {
+		Segment* segment = &pipeline->segments[s];
+		segment->end = end;
+		segment->first = s > 0 ? cut[s][end] : 0;
+		end = segment->first;
+	}
+	return segments;
+}
+
+// false if the pipeline stopped before the counter got there
+static bool wait_for(Pipeline* pipeline, const Counter* counter, uint64_t value)
+{
+	for (uint32_t spins = 0; __atomic_load_n(&counter->value, __ATOMIC_ACQUIRE) < value; spins++) {
+		if (__atomic_load_n(&pipeline->stopped.value, __ATOMIC_RELAXED)) return false;
+		if (spins >= SPINS) sched_yield();
+	}
+	return true;
+}
+
+static void* run_segment(void* data)
+{
+	Segment* segment = (Segment*) data;
+	Pipeline* pipeline = segment->pipeline;
+	const uint32_t index = segment->index;
+	const uint32_t last = pipeline->segmentCount - 1;
+
+	for (uint64_t block = 0; block < pipeline->blocks; block++) {
+		if (index > 0 && !wait_for(pipeline, &pipeline->done[index - 1], block + 1)) break;
+		if (index == 0 && block >= SLOTS && !wait_for(pipeline, &pipeline->done[last], block + 1 - SLOTS)) break;
+
+		float* const* slot = pipeline->slots[block % SLOTS];
+		const uint32_t frames = block_frames(pipeline, block);
+		if (index == 0) input_read(pipeline->input, block * pipeline->run->block, frames, slot);
+		chain_run_process_on(pipeline->run, segment->first, segment->end, slot, frames);
+		if (index == last) output_write(pipeline->output, (const float* const*) slot, frames);
+
+		__atomic_store_n(&pipeline->done[index].value, block + 1, __ATOMIC_RELEASE);
+	}
+	return NULL;
+}
+
+bool pipeline_render(ChainRun* run, const InputFile* input, OutputFile* output, uint32_t segments)
+{
+	Pipeline* pipeline = (Pipeline*) calloc(1, sizeof(Pipeline));
+	if (!pipeline) return false;
+	pipeline->run = run;
+	pipeline->input = input;
+	pipeline->output = output;
+	pipeline->blocks = (input->frames + run->block - 1) / run->block;
+
+	bool allocated = true;
+	for (uint32_t s = 0; s < SLOTS; s++) {
+		for (uint32_t c = 0; c < run->channels; c++) {
+			pipeline->slots[s][c] = (float*) malloc(sizeof(float) * run->block);
+			allocated = allocated && pipeline->slots[s][c];
+		}
+	}
+
+	if (segments > PIPELINE_MAX_SEGMENTS) segments = PIPELINE_MAX_SEGMENTS;
+	if (segments > 1 && run->instanceCount > 1 && pipeline->blocks > 1) {
+		double costs[CHAIN_MAX_STAGES * 2];
+		measure(run, input, costs);
+		pipeline->segmentCount = split(pipeline, costs, segments);
+	} else {
+		pipeline->segmentCount = 1;
+		pipeline->segments[0].first = 0;
+		pipeline->segments[0].end = run->instanceCount;
+	}
+	for (uint32_t s = 0; s < pipeline->segmentCount; s++) {
+		pipeline->segments[s].pipeline = pipeline;
+		pipeline->segments[s].index = s;
+	}
+
+	uint32_t threads = 1; // the calling one runs the first segment
+	while (allocated && threads < pipeline->segmentCount && pthread_create(&pipeline->segments[threads].thread, NULL, run_segment, &pipeline->segments[threads]) == 0) threads++;
+	const bool running = allocated && threads == pipeline->segmentCount;
+	if (running) run_segment(&pipeline->segments[0]);
+	else __atomic_store_n(&pipeline->stopped.value, 1, __ATOMIC_RELAXED);
+	for (uint32_t s = 1; s < threads; s++) pthread_join(pipeline->segments[s].thread, NULL);
+
+	for (uint32_t s = 0; s < SLOTS; s++) {
+		free(pipeline->slots[s][0]);
+		free(pipeline->slots[s][1]);
+	}
+	free(pipeline);
+	return running;
+}
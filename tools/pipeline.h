@@ -0,0 +1,21 @@
+#ifndef AIRWINDOWS_TOOLS_PIPELINE_H
+#define AIRWINDOWS_TOOLS_PIPELINE_H
+
+#include "audiofile.h"
+#include "chain.h"
+
+// Rendering of one file with a long chain on several threads. The instances of
+// the run are split into segments of about the same cost, measured on the
+// first blocks of the file, and each segment runs on a thread of its own. The
+// blocks go from one segment to the next through a ring of buffers: every
+// segment owns a counter of the blocks it passed on, which only the next
+// segment reads, so each link is a lock free single producer, single consumer
+// queue. The first segment reads the counter of the last one to reuse buffers.
+
+#define PIPELINE_MAX_SEGMENTS 16
+
+// Renders the input to the output in up to segments threads, the calling one
+// included; false if the threads can't be started
+bool pipeline_render(ChainRun* run, const InputFile* input, OutputFile* output, uint32_t segments);
+
+#endif
@@ -0,0 +1,304 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../src/common/timing.h"
+#include "audiofile.h"
+#include "chain.h"
+#include "pipeline.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+// Offline rendering of audio files through a chain of plugins, without a host:
+// the input is mapped into memory, the chain processes it in large blocks, and
+// the output is written as 32 bit float while the next block renders.
+//
+//     airwindows-render [<options>] <bundle> <input> <output> <plugin>[:<symbol>=<value>,...]...
+//     airwindows-render [<options>] --batch <list> <bundle> <plugin>[:<symbol>=<value>,...]...
+//
+// A batch list holds an input and an output per line, separated by a tab, and
+// is read from standard input for "-". Its files render at the same time, one
+// per worker thread with instances and buffers of its own; the workers take the
+// longest files first and the next one whenever they're done. With --pipeline
+// every file also spreads its chain over that many threads, see pipeline.h.
+// --fuse runs the plugins with the fused extension back to back at double
+// precision, with only the last of them dithering to float, see fused.h.
+// --rate and --channels describe raw input, see audiofile.h. Plugins built with
+// -Dcpu_timing=true report the time each of their instances took, see timing.h.
+
+#define DEFAULT_BLOCK 8192
+
+typedef struct {
+	const Chain* chain;
+	uint32_t block;
+	uint32_t segments;
+	double rawRate;
+	uint32_t rawChannels;
+} Settings;
+
+typedef struct {
+	char* input;
+	char* output;
+	uint64_t size;
+} Job;
+
+typedef struct {
+	const Settings* settings;
+	Job* jobs;
+	uint32_t count;
+	pthread_mutex_t lock;
+	uint32_t next; // the first job no worker took yet
+	uint32_t failures;
+} Queue;
+
+static double now(void)
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static void report_timing(const ChainRun* run, const char* inputPath)
+{
+	for (uint32_t i = 0; i < run->instanceCount; i++) {
+		const Instance* instance = &run->instances[i];
+		const LV2_Descriptor* descriptor = instance->plugin->descriptor;
+		const AirwindowsTiming* timing = descriptor->extension_data ? (const AirwindowsTiming*) descriptor->extension_data(AIRWINDOWS__timing) : NULL;
+		if (!timing) continue;
+
+		AirwindowsTimingStats stats;
+		timing->read(instance->handle, &stats);
+		fprintf(stderr, "%s: %s: %.1f µs per block lately, peak %.1f µs, %llu frames\n", inputPath, instance->plugin->entry->name, stats.average, stats.peak, (unsigned long long) stats.frames);
+	}
+}
+
+static bool render_file(const Settings* settings, const char* inputPath, const char* outputPath)
+{
+	InputFile input;
+	if (!input_open(&input, inputPath, settings->rawRate, settings->rawChannels)) return false;
+
+	ChainRun run;
+	if (!chain_run_create(&run, settings->chain, input.rate, input.channels, settings->block)) {
+		input_close(&input);
+		return false;
+	}
+	OutputFile output;
+	if (!output_open(&output, outputPath, input.rate, input.channels, settings->block)) {
+		chain_run_destroy(&run);
+		input_close(&input);
+		return false;
+	}
+
+	const double start = now();
+	const bool rendered = pipeline_render(&run, &input, &output, settings->segments);
+	const bool written = output_close(&output);
+	const double seconds = now() - start;
+
+	if (rendered) report_timing(&run, inputPath);
+	chain_run_destroy(&run);
+	input_close(&input);
+	if (!rendered) {
+		fprintf(stderr, "cannot start the threads for %s\n", inputPath);
+		return false;
+	}
+	if (!written) {
+		fprintf(stderr, "cannot write %s\n", outputPath);
+		return false;
+	}
+	const double duration = input.frames / input.rate;
+	fprintf(stderr, "%s: %.1f s of audio in %.2f s (%.0fx realtime)\n", inputPath, duration, seconds, seconds > 0.0 ? duration / seconds : 0.0);
+	return true;
+}
+
+static void* work(void* data)
+{
+	Queue* queue = (Queue*) data;
+	for (;;) {
+		pthread_mutex_lock(&queue->lock);
+		const uint32_t next = queue->next < queue->count ? queue->next++ : queue->count;
+		pthread_mutex_unlock(&queue->lock);
+		if (next == queue->count) break;
+
+		const Job* job = &queue->jobs[next];
+		if (!render_file(queue->settings, job->input, job->output)) {
+			pthread_mutex_lock(&queue->lock);
+			queue->failures++;
+			pthread_mutex_unlock(&queue->lock);
+		}
+	}
+	return NULL;
+}
+
+static int longest_first(const void* a, const void* b)
+{
+	const uint64_t sizeA = ((const Job*) a)->size;
+	const uint64_t sizeB = ((const Job*) b)->size;
+	return sizeA < sizeB ? 1 : sizeA > sizeB ? -1 : 0;
+}
+
+// Renders all jobs with up to workers threads, returns the number that failed
+static uint32_t render_jobs(const Settings* settings, Job* jobs, uint32_t count, uint32_t workers)
+{
+	for (uint32_t j = 0; j < count; j++) {
+		struct stat status;
+		jobs[j].size = stat(jobs[j].input, &status) == 0 ? (uint64_t) status.st_size : 0;
+	}
+	// a long file taken last would keep one worker busy while the others idle
+	qsort(jobs, count, sizeof(Job), longest_first);
+
+	Queue queue;
+	queue.settings = settings;
+	queue.jobs = jobs;
+	queue.count = count;
+	queue.next = 0;
+	queue.failures = 0;
+	pthread_mutex_init(&queue.lock, NULL);
+
+	if (workers > count) workers = count;
+	pthread_t* threads = workers > 1 ? (pthread_t*) malloc(sizeof(pthread_t) * (workers - 1)) : NULL;
+	uint32_t started = 0;
+	while (threads && started < workers - 1 && pthread_create(&threads[started], NULL, work, &queue) == 0) started++;
+	work(&queue); // the calling thread works as well
+	for (uint32_t t = 0; t < started; t++) pthread_join(threads[t], NULL);
+	free(threads);
+
+	pthread_mutex_destroy(&queue.lock);
+	return queue.failures;
+}
+
+// Reads the input and output of each line, NULL if the list can't be read
+static Job* read_batch(const char* path, uint32_t* count)
+{
+	FILE* file = strcmp(path, "-") ? fopen(path, "r") : stdin;
+	if (!file) {
+		fprintf(stderr, "cannot open %s\n", path);
+		return NULL;
+	}
+
+	Job* jobs = NULL;
+	uint32_t capacity = 0;
+	*count = 0;
+	char* line = NULL;
+	size_t lineSize = 0;
+	ssize_t length;
+	bool read = true;
+	while (read && (length = getline(&line, &lineSize, file)) >= 0) {
+		while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r')) line[--length] = '\0';
+		if (length == 0 || line[0] == '#') continue;
+
+		char* tab = strchr(line, '\t');
+		if (!tab || tab == line || !tab[1]) {
+			fprintf(stderr, "%s: \"%s\" isn't <input><tab><output>\n", path, line);
+			read = false;
+			break;
+		}
+		*tab = '\0';
+		if (*count == capacity) {
+			capacity = capacity ? capacity * 2 : 64;
+			Job* grown = (Job*) realloc(jobs, sizeof(Job) * capacity);
+			if (!grown) {
+				read = false;
+				break;
+			}
+			jobs = grown;
+		}
+		Job* job = &jobs[*count];
+		job->input = strdup(line);
+		job->output = strdup(tab + 1);
+		(*count)++;
+		read = job->input && job->output;
+	}
+	free(line);
+	if (file != stdin) fclose(file);
+
+	if (read && *count == 0) {
+		fprintf(stderr, "no files in %s\n", path);
+		read = false;
+	}
+	if (!read) {
+		for (uint32_t j = 0; j < *count; j++) {
+			free(jobs[j].input);
+			free(jobs[j].output);
+		}
+		free(jobs);
+		return NULL;
+	}
+	return jobs;
+}
+
+static void usage(const char* name)
+{
+	fprintf(stderr, "usage: %s [<options>] <bundle> <input> <output> <plugin>[:<symbol>=<value>,...]...\n", name);
+	fprintf(stderr, "       %s [<options>] --batch <list> <bundle> <plugin>[:<symbol>=<value>,...]...\n", name);
+	fprintf(stderr, "options: --block <frames> --jobs <files at once> --pipeline <threads per file> --fuse --rate <Hz> --channels <n>\n");
+}
+
+int main(int argc, char** argv)
+{
+	Settings settings = {NULL, DEFAULT_BLOCK, 1, 0.0, 0};
+	const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+	uint32_t workers = processors > 0 ? (uint32_t) processors : 1;
+	const char* batch = NULL;
+
+	bool fused = false;
+	int arg = 1;
+	for (; arg + 1 < argc && !strncmp(argv[arg], "--", 2); arg += 2) {
+		if (!strcmp(argv[arg], "--fuse")) {
+			fused = true;
+			arg--; // it takes no value
+		} else if (!strcmp(argv[arg], "--block")) {
+			settings.block = (uint32_t) strtoul(argv[arg + 1], NULL, 10);
+		} else if (!strcmp(argv[arg], "--jobs")) {
+			workers = (uint32_t) strtoul(argv[arg + 1], NULL, 10);
+		} else if (!strcmp(argv[arg], "--pipeline")) {
+			settings.segments = (uint32_t) strtoul(argv[arg + 1], NULL, 10);
+		} else if (!strcmp(argv[arg], "--batch")) {
+			batch = argv[arg + 1];
+		} else if (!strcmp(argv[arg], "--rate")) {
+			settings.rawRate = strtod(argv[arg + 1], NULL);
+		} else if (!strcmp(argv[arg], "--channels")) {
+			settings.rawChannels = (uint32_t) strtoul(argv[arg + 1], NULL, 10);
+		} else {
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	const int first = batch ? arg + 1 : arg + 3; // the first plugin
+	if (argc - first < 1 || settings.block == 0 || workers == 0 || settings.segments == 0) {
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	Job single = {argv[arg + 1], argv[arg + 2], 0};
+	Job* jobs = &single;
+	uint32_t count = 1;
+	if (batch && !(jobs = read_batch(batch, &count))) return EXIT_FAILURE;
+
+	uint32_t failures = count;
+	Bundle bundle;
+	if (bundle_open(&bundle, argv[arg])) {
+		static Chain chain;
+		if (chain_load(&chain, &bundle, argv + first, (uint32_t) (argc - first))) {
+			chain.fused = fused;
+			settings.chain = &chain;
+			const double start = now();
+			failures = render_jobs(&settings, jobs, count, workers);
+			if (batch) fprintf(stderr, "rendered %u of %u files in %.1f s\n", count - failures, count, now() - start);
+			chain_unload(&chain);
+		}
+		bundle_close(&bundle);
+	}
+
+	if (batch) {
+		for (uint32_t j = 0; j < count; j++) {
+			free(jobs[j].input);
+			free(jobs[j].output);
+		}
+		free(jobs);
+	}
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,99 @@
+#include "host.h"
+#include "material.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// The training workload for profile guided builds: renders the material through
+// every plugin of a bundle at the common rates and block lengths, first at the
+// default settings, then jumping to new settings every quarter second, so the
+// profiles see the branches of the whole parameter range.
+//
+//     airwindows-train <bundle> [plugin...]
+
+static const double rates[] = {44100.0, 48000.0, 96000.0, 192000.0};
+static const uint32_t blocks[] = {64, 512, 4096};
+
+#define MAX_BLOCK 4096
+
+static float input[2][MAX_BLOCK];
+static float output[2][MAX_BLOCK];
+
+static float random_between(uint32_t* state, float minimum, float maximum)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return minimum + (maximum - minimum) * (float) ((double) *state / 4294967296.0);
+}
+
+static bool train(const Plugin* plugin, double rate, uint32_t block)
+{
+	Instance instance;
+	if (!instance_create(&instance, plugin, rate, NULL)) return false;
+
+	float* inputs[2] = {input[0], input[1]};
+	float* outputs[2] = {output[0], output[1]};
+	instance_connect(&instance, (const float* const*) inputs, outputs);
+
+	Material material;
+	material_init(&material, rate, 1);
+	uint32_t settings = 1;
+	const uint64_t quarter = (uint64_t) (rate / 4.0);
+	const uint64_t length = 4 * quarter;
+	uint64_t next = quarter;
+
+	for (uint64_t frame = 0; frame < length; frame += block) {
+		if (frame >= next) {
+			for (uint32_t i = 0; i < plugin->portCount; i++) {
+				const Port* port = &plugin->ports[i];
+				if (port->type == PORT_CONTROL && port->input) instance_set(&instance, i, random_between(&settings, port->minimum, port->maximum));
+			}
+			next += quarter;
+		}
+		material_render(&material, inputs, plugin->audioIns, block);
+		instance_run(&instance, block);
+	}
+
+	instance_destroy(&instance);
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <bundle> [plugin...]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	Bundle bundle;
+	if (!bundle_open(&bundle, argv[1])) return EXIT_FAILURE;
+
+	int failures = 0;
+	const uint32_t count = argc > 2 ? (uint32_t) argc - 2 : bundle.count;
+	for (uint32_t p = 0; p < count; p++) {
+		const BundleEntry* entry = argc > 2 ? bundle_find(&bundle, argv[p + 2]) : &bundle.entries[p];
+		if (!entry) {
+			fprintf(stderr, "no plugin %s in %s\n", argv[p + 2], argv[1]);
+			failures++;
+			continue;
+		}
+
+		Plugin plugin;
+		if (!plugin_load(&plugin, &bundle, entry)) {
+			failures++;
+			continue;
+		}
+		printf("%s\n", entry->name);
+		fflush(stdout);
+		for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+			for (size_t b = 0; b < sizeof(blocks) / sizeof(blocks[0]); b++) {
+				if (!train(&plugin, rates[r], blocks[b])) failures++;
+			}
+		}
+		plugin_unload(&plugin);
+	}
+
+	bundle_close(&bundle);
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}